@@ -13,17 +13,21 @@
 * Includes
 *******************************************************************************/
 #include <math.h>
+#include <limits.h>
+#include <stddef.h>
 /******************************************************************************
 * Constants
 *******************************************************************************/
 /* return status for top level functions */
 #define STATUS_OK 	0
 #define STATUS_ERR	1
+#define STATUS_FALLBACK 2 /*a file was not written this way, and should be written another way (see output in files.c)*/
+
+#define ASM_VERSION "1.5.4" /*the version of the assembler (a part of the key of the cache, see cache.c)*/
 
 /*argument amount limits*/
 enum ARG_LIMITS {
-    MIN_ARGUMENTS =  2,
-    MAX_ARGUMENTS  = 4
+    MIN_ARGUMENTS =  2
 };
 
 /*boolean enum (FALSE = 0, TRUE = 1):*/
@@ -67,6 +71,12 @@ enum CHAR_LIMITS{
     MAX_LABEL = 31
 };
 
+/*initial number of nodes in the external label list and the entry list (they double every time they fill up)*/
+#define EXT_LIST_INIT   16
+#define ENTRY_LIST_INIT 16
+#define XREF_LIST_INIT  16
+#define PATCH_LIST_INIT 16
+
 /*for output() function*/
 enum BYTES_TO_PRINT {
     ONE_BYTE = 1,
@@ -74,11 +84,37 @@ enum BYTES_TO_PRINT {
     WORD = 4
 };
 
+/*positions of the fields in a machine word:
+ *R orders: opcode(31-26) rs(25-21) rt(20-16) rd(15-11) funct(10-6) zeros(5-0)
+ *I orders: opcode(31-26) rs(25-21) rt(20-16) immed(15-0)
+ *J orders: opcode(31-26) reg(25) address(24-0)*/
+enum FIELD_SHIFTS {
+    FUNCT_SHIFT = 6,
+    RD_SHIFT = 11,
+    RT_SHIFT = 16,
+    RS_SHIFT = 21,
+    REG_SHIFT = 25,
+    OPCODE_SHIFT = 26
+};
+#define OPCODE_MASK     0x3FUL
+#define REG_MASK        0x1FUL
+#define FUNCT_MASK      0x1FUL
+#define IMMED_MASK      0xFFFFUL
+#define ADDRESS_MASK    0x1FFFFFFUL
+
+#define CODE_BASE 100 /*address of the first order*/
+
+/*the format of the lines of the object file (see write_to_ob_file in files.c)*/
+#define ADDRESS_DIGITS  4 /*addresses are printed with at least 4 digits (%04lu)*/
+#define CODE_LINE_REST  13 /*the length of a code line after the address: " XX XX XX XX\n"*/
+#define BYTE_COLUMNS    3 /*the length of one byte in a line: " XX"*/
+
 #define NOT_REG -1
 #define REG_MIN 0
 #define REG_MAX 31
 #define NON_VALID_OPERAND -1
 #define NUM_ORDERS  27
+#define SYMBOL_BUCKETS 1024 /*number of buckets in the symbol hash table (a power of 2)*/
 #define NON_REAL_OPCODE 64
 /******************************************************************************
 * Macros
@@ -102,100 +138,205 @@ typedef struct order_info {
 /******************************************************************************
 * Typedefs for the Symbol Table
 *******************************************************************************/
-/*symbol node for the symbol table:*/
+/*a label padded with zeros to a fixed width of MAX_LABEL+1 (32) bytes.
+ *since every label fits in it, two keys can be compared as a whole (see same_label in tables.c)
+ *instead of character by character. the words member keeps the key aligned*/
+typedef union label_key {
+    char name[MAX_LABEL+1];
+    unsigned long words[(MAX_LABEL+1)/sizeof(unsigned long)];
+}label_key;
+
+/*symbol node for the symbol table.
+ *the attribute is also the segment of the symbol, and the symbol keeps only its offset in that segment
+ *(from CODE_BASE in the code segment, from 0 in the data segment). the address is worked out when it is needed
+ *(see symbol_address in tables.c), so nothing has to be updated when the final size of the code segment is known*/
 typedef struct symbol{
+    label_key symbol;
     struct symbol *next;
-    long unsigned address;
+    struct symbol *hash_next; /*next symbol in the same bucket of the symbol hash table*/
+    long unsigned offset; /*offset of the symbol in its segment (0 for external symbols)*/
     int attribute;
-    char *symbol;
     boolean is_entry;
 }symbol_node;
 
 /******************************************************************************
 * Typedefs for the Orders
 *******************************************************************************/
-/*unions, structs and functions related to the binary image of the source file:*/
-typedef struct line_in_binary{
-    unsigned b1:8;
-    unsigned b2:8;
-    unsigned b3:8;
-    unsigned b4:8;
-}word;
-
-typedef struct type_r_cmd{
-    unsigned zeros:6;
-    unsigned funct:5;
-    unsigned rd:5;
-    unsigned rt:5;
-    unsigned rs:5;
-    unsigned opcode:6;
-}r_command;
+/*a machine word (32 bits). orders are built in it with shifts and masks (see the encoders in tables.c),
+ *so the layout does not depend on how the compiler arranges bit fields.
+ *the code image is an array of machine words. the address of an order is not kept: the order in index i
+ *is at address CODE_BASE + 4*i*/
+#if UINT_MAX >= 0xFFFFFFFFUL
+typedef unsigned int machine_word;
+#else
+typedef unsigned long machine_word;
+#endif
+
+/*missing info for an order that was already written to a temporary file (see spill.c)*/
+typedef struct patch {
+    unsigned long index; /*index of the order in the code image*/
+    machine_word word; /*the complete machine word of the order*/
+}patch_node;
 
-typedef struct type_i_cmd{
-    int immed:16;
-    unsigned rt:5;
-    unsigned rs:5;
-    unsigned opcode:6;
-}i_command;
+/******************************************************************************
+* Typedefs for Data Directives
+*******************************************************************************/
+/*a cell of the data image. its address is not kept: the data segment starts at ICF (see pass_one.c),
+ *and every cell starts right after the one before it*/
+typedef struct data_img {
+    unsigned long machine_code; /*the value of the data. only the lowest bytes_taken bytes are used*/
+    unsigned bytes_taken:3; /*1,2 or 4*/
+} data_image;
 
-typedef struct type_j_cmd{
-    unsigned address:25;
-    unsigned reg:1;
-    unsigned opcode:6;
-}j_command;
+/******************************************************************************
+* Typedefs for The External Label List
+*******************************************************************************/
+/*external label node (for the external label list).
+ *the external label list is a vector: the nodes are kept one after another in one growing array*/
+typedef struct external_label_list {
+    unsigned long address;
+    label_key label;
+}ext_node;
 
-typedef union cmd_in_binary{
-    r_command r_cmd;
-    i_command i_cmd;
-    j_command j_cmd;
-    word w;
-}cmd_in_binary;
+/******************************************************************************
+* Typedefs for The Cross Reference List
+*******************************************************************************/
+/*the kinds of references to a symbol*/
+enum XREF_KINDS {
+    XREF_BRANCH = 1, /*operand of a conditional branch order*/
+    XREF_JUMP = 2, /*operand of a J order*/
+    XREF_ENTRY = 3 /*operand of an .entry directive*/
+};
 
-typedef struct cmd_img{
-    cmd_in_binary machine_code;
-    unsigned address:25;
-}command_image;
+/*cross reference node: one use of a symbol in the source file (for the cross reference list, which is a vector)*/
+typedef struct cross_reference {
+    symbol_node *symbol;
+    unsigned long address; /*address of the order (0 for .entry)*/
+    unsigned long line; /*line number in the source file*/
+    int kind;
+}xref_node;
 
 /******************************************************************************
-* Typedefs for Data Directives
+* Typedefs for Output in Memory
 *******************************************************************************/
-typedef struct two_bytes{
-    unsigned b1:8;
-    unsigned b2:8;
-}half_word;
+#define OUTPUT_FILES    3 /*the .ob, .ent and .ext files*/
 
-typedef union dh_in_binary{
-    int img:16;
-    half_word h;
-}dh_img;
+/*the contents of an output file, formatted into memory (see format_output in files.c)*/
+typedef struct output_section {
+    char *kind; /*the extension of the file, without the '.'*/
+    char *contents;
+    unsigned long size;
+}output_section;
 
-typedef union dw_in_binary{
-    int img:32;
-    word w;
-}dw_img;
+/******************************************************************************
+* Typedefs for the Output Hash
+*******************************************************************************/
+#define XXH_STRIPE      16 /*XXH32 takes 16 bytes at a time (4 for each of its 4 lanes)*/
 
-/*this union unites all the options for printable, dividable data*/
-typedef union data_in_binary{
-    unsigned b:8;
-    dh_img dh;
-    dw_img dw;
-}data_in_binary;
+/*the state of an XXH32 hash (see hash.c). the numbers are 32 bit*/
+typedef struct xxh32_state {
+    unsigned long v[4]; /*the accumulators of the lanes*/
+    unsigned long seed;
+    unsigned long total; /*number of bytes added*/
+    unsigned char buffer[XXH_STRIPE]; /*bytes that are not a whole stripe yet*/
+    int buffered; /*number of bytes in the buffer*/
+}xxh32_state;
 
-typedef struct data_img {
-    data_in_binary machine_code; /*all the info about the data*/
-    unsigned address:25; /*directive address*/
-    unsigned bytes_taken:3; /*1,2 or 4*/
-} data_image;
+/******************************************************************************
+* Typedefs for the Parallel Object File
+*******************************************************************************/
+/*a range of the code image or data image, formatted into a buffer of its own (see parallel_files.c)*/
+typedef struct ob_chunk {
+    int segment; /*CODE or DATA*/
+    unsigned long first; /*index of the first order or data cell*/
+    unsigned long count; /*number of orders or data cells*/
+    unsigned long first_byte; /*number of bytes of the data image before this chunk (only for DATA)*/
+    char *buffer;
+    unsigned long size; /*length of the chunk in the object file*/
+    unsigned long written; /*number of characters formatted into the buffer*/
+}ob_chunk;
+
+/*the chunks one thread formats (see format_worker in parallel_files.c). it is set before the thread starts*/
+typedef struct format_job {
+    int id; /*the number of the worker (0 is the main thread)*/
+    int workers; /*number of workers: the stride between the chunks of one worker*/
+}format_job;
 
 /******************************************************************************
-* Typedefs for The External Label List
+* Typedefs for Memory Management
 *******************************************************************************/
-/*external label node (for the external label list)*/
-typedef struct external_label_list {
-    unsigned address:25;
-    char *label;
-    struct external_label_list *next;
-}ext_node;
+/*a chunk of memory owned by an arena. the memory for allocations comes right after this header*/
+typedef struct arena_chunk {
+    struct arena_chunk *next;
+    size_t size; /*number of bytes for allocations in this chunk*/
+    size_t used; /*number of bytes allocated from this chunk*/
+}arena_chunk;
+
+/*the parts of the assembler that memory is counted for (see mem_stats.c)*/
+enum MEM_SUBSYSTEMS {
+    MEM_SYMBOLS, /*the symbol table, the entry list and the cross reference list*/
+    MEM_IMAGES, /*the code image and data image tables, and the patch list*/
+    MEM_EXTERNAL, /*the external label list*/
+    MEM_SCRATCH, /*buffers used while analyzing one line (the line arena)*/
+    MEM_BUFFERS, /*the rest of the file arena: line buffers, file names and indexes of the binary files*/
+    MEM_HEAP, /*not a subsystem: all the memory taken from the system (arena chunks and image tables)*/
+    MEM_COUNTERS /*number of counters*/
+};
+
+/*an arena: allocations are taken one after another from a list of chunks, and are freed all at once (see memory_mgmt.c)*/
+typedef struct arena {
+    arena_chunk *first;
+    arena_chunk *current; /*the chunk that allocations are taken from (NULL after a reset)*/
+    void *last; /*the last allocation (it can grow in place)*/
+    size_t chunk_size; /*default size of a new chunk*/
+    int subsystem; /*the subsystem that allocations are counted for, unless another one is given (see arena_alloc_for)*/
+    unsigned long in_use[MEM_HEAP]; /*bytes allocated for each subsystem since the last reset*/
+}arena;
+
+/*memory counter of one subsystem (see mem_stats.c)*/
+typedef struct mem_counter {
+    unsigned long allocations; /*number of allocations*/
+    unsigned long bytes; /*total bytes allocated*/
+    unsigned long in_use; /*bytes allocated and not freed yet*/
+    unsigned long peak; /*the highest value of in_use*/
+}mem_counter;
+
+/******************************************************************************
+* Typedefs for Command Line Options
+*******************************************************************************/
+/*options that change the output of the assembler (see set_option in files.c)*/
+typedef struct options {
+    boolean ext_grouped; /*--ext-grouped: the .ext file is sorted by label, then by address*/
+    boolean ent_sorted; /*--ent-sorted: the .ent file is sorted by address instead of the order of the .entry directives*/
+    boolean sym_file; /*--sym: a binary symbol database (.sym file) is made too*/
+    boolean xref_file; /*--xref: a binary cross reference file (.xrf file) is made too*/
+    unsigned long max_memory; /*--max-memory=N: bytes of memory for the code and data images (0 - no limit, see spill.c)*/
+    int mem_stats; /*--mem-stats: memory usage is reported at exit (see MEM_STATS_FORMATS)*/
+    int format; /*--format=F: the format of the object file (see OBJECT_FORMATS)*/
+    boolean stream; /*--stream: the .ob file is written during the 2nd pass (see stream_start in files.c)*/
+    boolean to_stdout; /*--stdout: the output is written to the standard output (see write_framed_output in files.c)*/
+    boolean io_uring; /*--io-uring: the output files are written in batches (see uring_files.c)*/
+    boolean print_hash; /*--print-hash: the hash of the output of every source file is printed (see hash.c)*/
+    char *serve_path; /*--serve=SOCKET: source files are assembled on requests to a unix socket (see server.c). NULL if not used*/
+    char *cache_dir; /*--cache-dir=DIR: the output of source files assembled before is taken from DIR (see cache.c). NULL if not used*/
+    boolean write_if_changed; /*--write-if-changed: output files that would not change are not written (see write_changed_output in files.c)*/
+    boolean hash_header; /*--hash-header: the hash is added to the first line of the .ob file (see ob_header in mapped_files.c)*/
+}asm_options;
+
+/*formats of the object file (see output in files.c)*/
+enum OBJECT_FORMATS {
+    FORMAT_TEXT = 0, /*--format=text (the default): the .ob file*/
+    FORMAT_BIN = 1, /*--format=bin: the .bin file (see write_bin_file in binary_files.c)*/
+    FORMAT_IHEX = 2, /*--format=ihex: an Intel HEX .hex file (see hex_files.c)*/
+    FORMAT_SREC = 3 /*--format=srec: a Motorola S-record .srec file (see hex_files.c)*/
+};
+
+/*formats of the memory usage report (see print_mem_stats in mem_stats.c)*/
+enum MEM_STATS_FORMATS {
+    MEM_STATS_NONE = 0,
+    MEM_STATS_TEXT = 1, /*--mem-stats*/
+    MEM_STATS_JSON = 2 /*--mem-stats=json*/
+};
 
 /******************************************************************************
 * Function Prototypes
@@ -235,38 +376,168 @@ int num_ops_expected(unsigned opcode);
 int complete_missing_info(char *label, char order_type, unsigned long IC);
 unsigned get_opcode(char *line);
 void cmd_to_info(char *line, unsigned IC);
+machine_word encode_r(unsigned opcode, unsigned rs, unsigned rt, unsigned rd, unsigned funct);
+machine_word encode_i(unsigned opcode, unsigned rs, unsigned rt, long immed);
+machine_word encode_j(unsigned opcode, int reg, unsigned long address);
+machine_word set_immed(machine_word w, long immed);
+machine_word set_address(machine_word w, unsigned long address);
+int is_reg_j(machine_word w);
+void to_bytes(unsigned char *bytes, unsigned long value, int n);
 
 /******************************************************************************
 * Function Prototypes for Data Directive Lines
 *******************************************************************************/
 void data_to_info(char *line);
-void update_data_img(unsigned ICF);
 
 /******************************************************************************
 * Function Prototypes for the Symbol Table
 *******************************************************************************/
-int add_symbol(unsigned address, char *symbol, int attribute, int is_entry);
-void update_symbol_table(unsigned long ICF);
+void make_label_key(label_key *key, char *label);
+int same_label(const label_key *a, const label_key *b);
+unsigned long hash_label(const label_key *key);
+symbol_node *find_symbol(char *symbol);
+int add_symbol(unsigned long offset, char *symbol, int attribute, int is_entry);
+unsigned long symbol_address(const symbol_node *symbol);
 int add_ent(char *symbol);
+void sort_entry_list();
+
+/******************************************************************************
+* Function Prototypes for the Main Program
+*******************************************************************************/
+int assemble(char *curr_file);
 
 /******************************************************************************
 * Function Prototypes for Files
 *******************************************************************************/
 char* filename(char* name);
+char *output_file_name(char *file_name, char *extension, arena *a);
 int output(char *file_name);
-int num_files (int argc);
+int is_option(char *arg);
+int set_option(char *arg);
+int num_files (int argc, char **argv);
+int check_options();
+int stream_start(char *file_name);
+void stream_code(unsigned long final);
+int stream_end();
+void stream_abort();
+int format_output(char *file_name, arena *a, output_section *sections);
+int write_sections(char *file_name, output_section *sections, int n);
+
+/******************************************************************************
+* Function Prototypes for Binary Files
+*******************************************************************************/
+int write_sym_file(char *file_name);
+int write_xref_file(char *file_name);
+int write_bin_file(char *file_name);
+
+/******************************************************************************
+* Function Prototypes for Hex Object Files
+*******************************************************************************/
+int write_hex_file(char *file_name);
+
+/******************************************************************************
+* Function Prototypes for the Memory-Mapped Object File
+*******************************************************************************/
+int address_width(unsigned long address);
+unsigned long addresses_width(unsigned long first, unsigned long count);
+int put_decimal(char *dest, unsigned long x, int width);
+int put_byte(char *dest, unsigned char byte);
+char *format_code(char *dest);
+char *format_data(char *dest);
+int ob_header(char *dest);
+unsigned long ob_header_size();
+unsigned long code_section_size();
+unsigned long data_section_size();
+int write_mapped_ob_file(char *ob_fname);
+
+/******************************************************************************
+* Function Prototypes for the Parallel Object File
+*******************************************************************************/
+int write_parallel_ob_file(char *ob_fname);
+
+/******************************************************************************
+* Function Prototypes for Batched Output Files
+*******************************************************************************/
+int queue_output_files(char *file_name);
+int finish_output_files();
 
 /******************************************************************************
 * Function Prototypes for the External Label List
 *******************************************************************************/
 void add_to_ext_list(unsigned address, char *label);
+void group_ext_list();
+
+/******************************************************************************
+* Function Prototypes for the Cross Reference List
+*******************************************************************************/
+void add_xref(char *label, unsigned long address, unsigned long line, int kind);
+void sort_xref_list();
+
+/******************************************************************************
+* Function Prototypes for Memory-Bounded Images
+*******************************************************************************/
+void spill_code();
+void spill_data();
+unsigned long code_length();
+unsigned long data_length();
+machine_word get_code_word(unsigned long index);
+void set_code_word(unsigned long index, machine_word word);
+void start_images();
+int next_code_word(machine_word *word);
+int next_data_cell(data_image *cell);
+void spill_reset();
 
 /******************************************************************************
 * Function Prototypes for Memory Management
 *******************************************************************************/
+void fatal_stop();
 void alloc_check(void* x);
+void *arena_alloc(arena *a, size_t size);
+void *arena_alloc_for(arena *a, size_t size, int subsystem);
+void *arena_grow(arena *a, void *ptr, size_t old_size, size_t new_size, int subsystem);
+void arena_reset(arena *a);
+void arena_free(arena *a);
+void *grow_vector(void *vec, unsigned long needed, unsigned long *capacity, unsigned long init, size_t size, int subsystem);
+void *grow_image(void *img, unsigned long needed, unsigned long *capacity, size_t size);
 void mem_allocate();
 void mem_deallocate();
+void mem_release();
+
+/******************************************************************************
+* Function Prototypes for Memory Usage Statistics
+*******************************************************************************/
+void mem_stat_alloc(int subsystem, unsigned long bytes);
+void mem_stat_free(int subsystem, unsigned long bytes);
+void print_mem_stats(FILE *fp, int format);
+
+/******************************************************************************
+* Function Prototypes for the Output Hash
+*******************************************************************************/
+void xxh32_reset(xxh32_state *state, unsigned long seed);
+void xxh32_update(xxh32_state *state, const unsigned char *bytes, unsigned long length);
+unsigned long xxh32_digest(xxh32_state *state);
+unsigned long hash_output();
+void print_hash(char *file_name);
+
+/******************************************************************************
+* Function Prototypes for the Assembly Cache
+*******************************************************************************/
+int cache_start();
+int cache_fetch(char *file_name);
+void cache_store(char *file_name);
+
+/******************************************************************************
+* Function Prototypes for the Server
+*******************************************************************************/
+int serve(char *socket_path);
+
+/******************************************************************************
+* Function Prototypes for the Library
+*******************************************************************************/
+FILE *open_source(char *file_name);
+void close_source(FILE *fp);
+void callback_error();
+void callback_records(unsigned long final);
 
 /******************************************************************************
 * The Two Assembler Passes Function Prototypes
@@ -0,0 +1,392 @@
+/*******************************************************************************
+* Title                 :   Binary output files
+* Filename              :   binary_files.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file binary_files.c
+ * \brief This module creates the optional binary output files.
+ * unlike the text files made by files.c, these files are meant to be read by other programs
+ * (a linker, a debugger, a profiler) without parsing: every number in them is an unsigned 32 bit
+ * little endian integer, so a program can map the file to memory and use it as it is.
+ * 1. a .sym file (--sym) - a symbol database with every symbol in the symbol table
+ * 2. a .xrf file (--xref) - a cross reference file with every use of every symbol
+ * 3. a .bin file (--format=bin) - a binary object file, made instead of the .ob file
+ */
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define NO_RECORD       0xFFFFFFFFUL /*end of a bucket in a hash index*/
+#define SYM_VERSION     1
+#define SYM_HEADER_SIZE 32
+#define SYM_RECORD_SIZE 20
+#define XREF_VERSION    1
+#define XREF_HEADER_SIZE    32
+#define XREF_SYMBOL_SIZE    16
+#define XREF_RECORD_SIZE    12
+#define BIN_VERSION     1
+#define BIN_HEADER_SIZE 52
+#define BIN_CHECKSUM_OFFSET 48 /*where the checksum is in the header of the .bin file*/
+#define BIN_RECORD_SIZE 12 /*size of an entry or external record in the .bin file*/
+#define ADLER_MOD       65521 /*the largest prime below 2^16 (see Adler-32)*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern symbol_node *symbol_table;
+extern arena file_arena;
+extern asm_options options;
+extern xref_node *xref_list;
+extern unsigned long xref_list_length;
+extern symbol_node **entry_list;
+extern unsigned long entry_list_length;
+extern ext_node *external_list;
+extern unsigned long ext_list_length;
+extern unsigned long ICF, DCF;
+static unsigned long adler_a, adler_b; /*the Adler-32 checksum of what was written to the .bin file (see put_summed)*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : put_u32(FILE *fp, unsigned long x);
+*//**
+* \section Description: writes a 32 bit number to a binary file in the little endian method,
+*                       no matter what the byte order of this computer is
+*
+* \param  		fp - the binary file
+* \param        x - the number
+*******************************************************************************/
+void put_u32(FILE *fp, unsigned long x) {
+    putc((int)(x & 0xFF), fp);
+    putc((int)((x >> 8) & 0xFF), fp);
+    putc((int)((x >> 16) & 0xFF), fp);
+    putc((int)((x >> 24) & 0xFF), fp);
+}
+
+/******************************************************************************
+* Function : open_binary_file(char *fname);
+*//**
+* \section Description: opens a binary output file
+*
+* \param  		fname - the name of the output file (see output_file_name in files.c)
+* \return       pointer to the file. NULL if it cannot be made (an error is printed)
+*******************************************************************************/
+FILE *open_binary_file(char *fname) {
+    FILE *fp;
+    if((fp = fopen(fname,"wb")) == NULL)
+        fprintf(stderr,"error: cannot make output file [%s]",fname);
+    return fp;
+}
+
+/******************************************************************************
+* Function : close_binary_file(FILE *fp, char *fname);
+*//**
+* \section Description: closes a binary output file, and checks that everything was written to it
+*
+* \param  		fp - the binary file
+* \param        fname - the name of the binary file
+* \return       STATUS_OK if the file was written. otherwise: STATUS_ERR
+*******************************************************************************/
+int close_binary_file(FILE *fp, char *fname) {
+    int err = ferror(fp);
+    if(fclose(fp) != 0 || err) {
+        fprintf(stderr,"error: cannot write output file [%s]",fname);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : write_sym_file(char *file_name);
+*//**
+* \section Description: writes the symbol database (.sym file)
+*
+* \param  		file_name - the name of the source file (without .as)
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+* \note         the format of the .sym file is as follows (all the numbers are 32 bit, little endian):
+*               header:  "ASYM", version, number of symbols, number of buckets,
+*                        offset of the records, offset of the buckets, offset of the string pool, size of the string pool.
+*               records: one record of 20 bytes for each symbol, in the order of the symbol table:
+*                        offset of the name in the string pool, length of the name, address,
+*                        one byte for the attribute (1 - code, 2 - data, 3 - external), one byte for the entry flag,
+*                        two zero bytes, and the index of the next record in the same bucket (0xFFFFFFFF if there is none).
+*               buckets: the index of the first record in each bucket (0xFFFFFFFF if the bucket is empty).
+*                        the number of buckets is a power of 2, and a symbol is in bucket hash & (buckets-1),
+*                        where hash is the 32 bit FNV-1a hash of its name (see hash_label in tables.c).
+*               string pool: the names of the symbols, each followed by a null character.
+*******************************************************************************/
+int write_sym_file(char *file_name) {
+    FILE *sym_file;
+    char *sym_fname;
+    symbol_node *curr;
+    unsigned long num_symbols = 0, num_buckets = 1, strings_size = 0;
+    unsigned long i, bucket, name_offset;
+    unsigned long *buckets, *next_record;
+
+    for(curr = symbol_table; curr != NULL; curr = curr->next) {
+        num_symbols++;
+        strings_size += strlen(curr->symbol.name)+1;
+    }
+    while(num_buckets < num_symbols)
+        num_buckets *= 2;
+    /*building the hash index. a symbol is added at the head of its bucket, so the records are chained backwards*/
+    buckets = (unsigned long*) arena_alloc(&file_arena, num_buckets * sizeof(unsigned long));
+    next_record = (unsigned long*) arena_alloc(&file_arena, (num_symbols+1) * sizeof(unsigned long));
+    for(i = 0; i < num_buckets; i++)
+        buckets[i] = NO_RECORD;
+    for(curr = symbol_table, i = 0; curr != NULL; curr = curr->next, i++) {
+        bucket = hash_label(&curr->symbol) & (num_buckets-1);
+        next_record[i] = buckets[bucket];
+        buckets[bucket] = i;
+    }
+
+    sym_fname = output_file_name(file_name, "sym", &file_arena);
+    if((sym_file = open_binary_file(sym_fname)) == NULL)
+        return STATUS_ERR;
+    /*header*/
+    fputs("ASYM", sym_file);
+    put_u32(sym_file, SYM_VERSION);
+    put_u32(sym_file, num_symbols);
+    put_u32(sym_file, num_buckets);
+    put_u32(sym_file, SYM_HEADER_SIZE);
+    put_u32(sym_file, SYM_HEADER_SIZE + num_symbols*SYM_RECORD_SIZE);
+    put_u32(sym_file, SYM_HEADER_SIZE + num_symbols*SYM_RECORD_SIZE + num_buckets*4);
+    put_u32(sym_file, strings_size);
+    /*records*/
+    name_offset = 0;
+    for(curr = symbol_table, i = 0; curr != NULL; curr = curr->next, i++) {
+        put_u32(sym_file, name_offset);
+        put_u32(sym_file, strlen(curr->symbol.name));
+        put_u32(sym_file, symbol_address(curr));
+        putc(curr->attribute, sym_file);
+        putc(curr->is_entry, sym_file);
+        putc(0, sym_file);
+        putc(0, sym_file);
+        put_u32(sym_file, next_record[i]);
+        name_offset += strlen(curr->symbol.name)+1;
+    }
+    /*buckets*/
+    for(i = 0; i < num_buckets; i++)
+        put_u32(sym_file, buckets[i]);
+    /*string pool*/
+    for(curr = symbol_table; curr != NULL; curr = curr->next)
+        fwrite(curr->symbol.name, 1, strlen(curr->symbol.name)+1, sym_file);
+
+    return close_binary_file(sym_file, sym_fname);
+}
+
+/******************************************************************************
+* Function : write_xref_file(char *file_name);
+*//**
+* \section Description: writes the cross reference file (.xrf file)
+*
+* \param  		file_name - the name of the source file (without .as)
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+* \note         the format of the .xrf file is as follows (all the numbers are 32 bit, little endian):
+*               header:  "AXRF", version, number of symbols, number of references,
+*                        offset of the symbols, offset of the references, offset of the string pool, size of the string pool.
+*               symbols: one entry of 16 bytes for each symbol that is used at least once, sorted by name
+*                        (so it can be searched with a binary search): offset of the name in the string pool,
+*                        length of the name, index of its first reference, number of references.
+*               references: one entry of 12 bytes for each use, grouped by symbol and sorted by line number:
+*                        address of the order (0 for .entry), line number, kind (1 - conditional branch, 2 - J order, 3 - .entry).
+*               string pool: the names of the symbols, each followed by a null character.
+*******************************************************************************/
+int write_xref_file(char *file_name) {
+    FILE *xref_file;
+    char *xref_fname;
+    unsigned long num_symbols = 0, strings_size = 0;
+    unsigned long i, first, name_offset;
+
+    sort_xref_list();
+    for(i = 0; i < xref_list_length; i++) {
+        if(i == 0 || xref_list[i].symbol != xref_list[i-1].symbol) {
+            num_symbols++;
+            strings_size += strlen(xref_list[i].symbol->symbol.name)+1;
+        }
+    }
+    xref_fname = output_file_name(file_name, "xrf", &file_arena);
+    if((xref_file = open_binary_file(xref_fname)) == NULL)
+        return STATUS_ERR;
+    /*header*/
+    fputs("AXRF", xref_file);
+    put_u32(xref_file, XREF_VERSION);
+    put_u32(xref_file, num_symbols);
+    put_u32(xref_file, xref_list_length);
+    put_u32(xref_file, XREF_HEADER_SIZE);
+    put_u32(xref_file, XREF_HEADER_SIZE + num_symbols*XREF_SYMBOL_SIZE);
+    put_u32(xref_file, XREF_HEADER_SIZE + num_symbols*XREF_SYMBOL_SIZE + xref_list_length*XREF_RECORD_SIZE);
+    put_u32(xref_file, strings_size);
+    /*symbols (each group of references to the same symbol starts at "first")*/
+    name_offset = 0;
+    for(first = 0; first < xref_list_length; first = i) {
+        for(i = first+1; i < xref_list_length && xref_list[i].symbol == xref_list[first].symbol; i++);
+        put_u32(xref_file, name_offset);
+        put_u32(xref_file, strlen(xref_list[first].symbol->symbol.name));
+        put_u32(xref_file, first);
+        put_u32(xref_file, i-first);
+        name_offset += strlen(xref_list[first].symbol->symbol.name)+1;
+    }
+    /*references*/
+    for(i = 0; i < xref_list_length; i++) {
+        put_u32(xref_file, xref_list[i].address);
+        put_u32(xref_file, xref_list[i].line);
+        put_u32(xref_file, xref_list[i].kind);
+    }
+    /*string pool*/
+    for(i = 0; i < xref_list_length; i++) {
+        if(i == 0 || xref_list[i].symbol != xref_list[i-1].symbol)
+            fwrite(xref_list[i].symbol->symbol.name, 1, strlen(xref_list[i].symbol->symbol.name)+1, xref_file);
+    }
+    return close_binary_file(xref_file, xref_fname);
+}
+
+/******************************************************************************
+* Function : put_summed(FILE *fp, int c);
+*//**
+* \section Description: writes a byte to the .bin file, and adds it to the Adler-32 checksum
+*
+* \param  		fp - the binary file
+* \param        c - the byte
+*******************************************************************************/
+void put_summed(FILE *fp, int c) {
+    putc(c, fp);
+    adler_a = (adler_a + (unsigned char)c) % ADLER_MOD;
+    adler_b = (adler_b + adler_a) % ADLER_MOD;
+}
+
+/******************************************************************************
+* Function : put_summed_u32(FILE *fp, unsigned long x);
+*//**
+* \section Description: writes a 32 bit little endian number to the .bin file (like put_u32),
+*                       and adds it to the Adler-32 checksum
+*
+* \param  		fp - the binary file
+* \param        x - the number
+*******************************************************************************/
+void put_summed_u32(FILE *fp, unsigned long x) {
+    put_summed(fp, (int)(x & 0xFF));
+    put_summed(fp, (int)((x >> 8) & 0xFF));
+    put_summed(fp, (int)((x >> 16) & 0xFF));
+    put_summed(fp, (int)((x >> 24) & 0xFF));
+}
+
+/******************************************************************************
+* Function : write_bin_file(char *file_name);
+*//**
+* \section Description: writes the binary object file (.bin file). it has the same code and data images as the .ob file,
+*                       but as raw bytes, so a loader can map the file to memory and use the images as they are.
+*                       the entry points and the uses of external labels are in it too
+*
+* \param  		file_name - the name of the source file (without .as)
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+* \note         the format of the .bin file is as follows (all the numbers are 32 bit, little endian):
+*               header:  "AOBJ", version, base address (the address of the first order), size of the code image,
+*                        size of the data image, address of the data image (ICF), number of entry points,
+*                        number of uses of external labels, offset of the entry points, offset of the external labels,
+*                        offset of the string pool, size of the string pool, checksum.
+*                        the checksum is the Adler-32 checksum of everything after the header.
+*               code:    the code image, right after the header (so it starts at offset 52). 4 bytes for each order.
+*               data:    the data image, right after the code image.
+*               entry points: starting at the next offset divisible by 4 (the bytes before it are zero).
+*                        one record of 12 bytes for each entry point: offset of the name in the string pool,
+*                        length of the name, address. in the order of the .ent file.
+*               external labels: one record of 12 bytes for each use: offset of the name in the string pool,
+*                        length of the name, address of the order. in the order of the .ext file.
+*               string pool: the names of the entry points and then of the external labels, each followed by a null character.
+*******************************************************************************/
+int write_bin_file(char *file_name) {
+    FILE *bin_file;
+    char *bin_fname;
+    unsigned long tables_offset, strings_size = 0, name_offset = 0, i;
+    int j;
+    unsigned char bytes[WORD];
+    machine_word code_word;
+    data_image data_cell;
+
+    if(options.ent_sorted)
+        sort_entry_list();
+    if(options.ext_grouped)
+        group_ext_list();
+    for(i = 0; i < entry_list_length; i++)
+        strings_size += strlen(entry_list[i]->symbol.name)+1;
+    for(i = 0; i < ext_list_length; i++)
+        strings_size += strlen(external_list[i].label.name)+1;
+    tables_offset = BIN_HEADER_SIZE + (ICF-CODE_BASE) + (DCF+WORD-1)/WORD*WORD;
+
+    bin_fname = output_file_name(file_name, "bin", &file_arena);
+    if((bin_file = open_binary_file(bin_fname)) == NULL)
+        return STATUS_ERR;
+    /*header (the checksum is written last)*/
+    fputs("AOBJ", bin_file);
+    put_u32(bin_file, BIN_VERSION);
+    put_u32(bin_file, CODE_BASE);
+    put_u32(bin_file, ICF-CODE_BASE);
+    put_u32(bin_file, DCF);
+    put_u32(bin_file, ICF);
+    put_u32(bin_file, entry_list_length);
+    put_u32(bin_file, ext_list_length);
+    put_u32(bin_file, tables_offset);
+    put_u32(bin_file, tables_offset + entry_list_length*BIN_RECORD_SIZE);
+    put_u32(bin_file, tables_offset + (entry_list_length+ext_list_length)*BIN_RECORD_SIZE);
+    put_u32(bin_file, strings_size);
+    put_u32(bin_file, 0);
+    adler_a = 1;
+    adler_b = 0;
+    /*code and data images (some of them may be in temporary files, see spill.c)*/
+    start_images();
+    while(next_code_word(&code_word)) {
+        to_bytes(bytes, code_word, WORD);
+        for(j = 0; j < WORD; j++)
+            put_summed(bin_file, bytes[j]);
+    }
+    while(next_data_cell(&data_cell)) {
+        to_bytes(bytes, data_cell.machine_code, data_cell.bytes_taken);
+        for(j = 0; j < data_cell.bytes_taken; j++)
+            put_summed(bin_file, bytes[j]);
+    }
+    for(i = DCF; i % WORD != 0; i++)
+        put_summed(bin_file, 0);
+    /*entry points and external labels*/
+    for(i = 0; i < entry_list_length; i++) {
+        put_summed_u32(bin_file, name_offset);
+        put_summed_u32(bin_file, strlen(entry_list[i]->symbol.name));
+        put_summed_u32(bin_file, symbol_address(entry_list[i]));
+        name_offset += strlen(entry_list[i]->symbol.name)+1;
+    }
+    for(i = 0; i < ext_list_length; i++) {
+        put_summed_u32(bin_file, name_offset);
+        put_summed_u32(bin_file, strlen(external_list[i].label.name));
+        put_summed_u32(bin_file, external_list[i].address);
+        name_offset += strlen(external_list[i].label.name)+1;
+    }
+    /*string pool*/
+    for(i = 0; i < entry_list_length; i++) {
+        for(j = 0; entry_list[i]->symbol.name[j] != '\0'; j++)
+            put_summed(bin_file, entry_list[i]->symbol.name[j]);
+        put_summed(bin_file, '\0');
+    }
+    for(i = 0; i < ext_list_length; i++) {
+        for(j = 0; external_list[i].label.name[j] != '\0'; j++)
+            put_summed(bin_file, external_list[i].label.name[j]);
+        put_summed(bin_file, '\0');
+    }
+    /*the checksum*/
+    if(fseek(bin_file, BIN_CHECKSUM_OFFSET, SEEK_SET) == 0)
+        put_u32(bin_file, (adler_b << 16) | adler_a);
+    return close_binary_file(bin_file, bin_fname);
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Title                 :   Assembly cache
+* Filename              :   cache.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file cache.c
+ * \brief This module keeps the output of source files in a cache directory (--cache-dir=DIR), so a source file
+ * that was assembled before (in any directory, under any name) is not assembled again: its .ob, .ent and .ext
+ * files are written from the cache, with no 1st and 2nd pass.
+ * an entry of the cache is a file in DIR, named by its key: 16 hex digits and ".aoc". the key is a 64 bit hash
+ * (two XXH32 hashes with different seeds, see hash.c) of the version of the assembler, the options that change
+ * the output, and the bytes of the source file.
+ * an entry is written to a temporary file (with the process id in its name) and renamed to its name, so a number
+ * of assemblers can share one cache directory: each of them sees an entry either whole or not at all.
+ * an entry that cannot be read (or does not match the length of the source file) is ignored,
+ * and an entry that cannot be written is skipped, so the cache never fails an assembly.
+ */
+/*getpid and mkdir are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "assembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define CACHE_MAGIC     "AOC1" /*the start of the first line of an entry*/
+#define KEY_DIGITS      16
+#define KEY_SEED        0x9E3779B1UL /*the seed of the second half of the key (the first has seed 0)*/
+#define SOURCE_CHUNK    4096 /*the source file is read this many bytes at a time*/
+#define CACHE_LINE_MAX  64 /*the longest line before the contents in an entry*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern arena file_arena;
+extern unsigned long output_hash_value;
+static char cache_key[KEY_DIGITS+1]; /*the key of the current source file ("" if it has none)*/
+static unsigned long source_length; /*the length of the current source file*/
+/*the kinds of the sections of an entry, in the order they are written (see format_output in files.c)*/
+static char *cache_kinds[OUTPUT_FILES] = {"ob", "ent", "ext"};
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : cache_start();
+*//**
+* \section Description: makes the cache directory if it does not exist yet. used once, before the first source file
+*
+* \return       STATUS_OK if the cache directory can be used. otherwise: STATUS_ERR (an error is printed)
+*******************************************************************************/
+int cache_start() {
+    struct stat info;
+    if(mkdir(options.cache_dir, 0777) != 0 && errno != EEXIST) {
+        fprintf(stderr,"error: cannot make the cache directory [%s]\n",options.cache_dir);
+        return STATUS_ERR;
+    }
+    if(stat(options.cache_dir, &info) != 0 || !S_ISDIR(info.st_mode)) {
+        fprintf(stderr,"error: the cache directory is not a directory [%s]\n",options.cache_dir);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : make_key(char *file_name);
+*//**
+* \section Description: computes the key of a source file (see \brief) into cache_key
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if the key was computed. STATUS_ERR if the source file cannot be read
+*******************************************************************************/
+int make_key(char *file_name) {
+    FILE *fp;
+    xxh32_state low, high;
+    unsigned char buffer[SOURCE_CHUNK];
+    char settings[CACHE_LINE_MAX];
+    size_t n;
+    int err;
+    cache_key[0] = '\0';
+    if((fp = fopen(file_name,"rb")) == NULL)
+        return STATUS_ERR;
+    /*only the options that change the .ob, .ent and .ext files*/
+    n = sprintf(settings, "%s %d %d %d", ASM_VERSION, options.ent_sorted, options.ext_grouped, options.hash_header) + 1;
+    xxh32_reset(&low, 0);
+    xxh32_reset(&high, KEY_SEED);
+    xxh32_update(&low, (unsigned char*)settings, n);
+    xxh32_update(&high, (unsigned char*)settings, n);
+    source_length = 0;
+    while((n = fread(buffer, 1, SOURCE_CHUNK, fp)) > 0) {
+        xxh32_update(&low, buffer, n);
+        xxh32_update(&high, buffer, n);
+        source_length += n;
+    }
+    err = ferror(fp);
+    fclose(fp);
+    if(err)
+        return STATUS_ERR;
+    sprintf(cache_key, "%08lx%08lx", xxh32_digest(&high), xxh32_digest(&low));
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : entry_name(char *suffix);
+*//**
+* \param  		suffix - added after the key (for example ".aoc")
+* \return       the path of the entry of the current source file in the cache directory (in the file arena)
+*******************************************************************************/
+char *entry_name(char *suffix) {
+    char *name = (char*) arena_alloc(&file_arena, strlen(options.cache_dir) + KEY_DIGITS + strlen(suffix) + 2);
+    sprintf(name, "%s/%s%s", options.cache_dir, cache_key, suffix);
+    return name;
+}
+
+/******************************************************************************
+* Function : read_entry(char *name, output_section *sections);
+*//**
+* \section Description: reads an entry of the cache into the file arena, and finds its sections
+*
+* \param  		name - the path of the entry
+* \param        sections - the contents of each file are put here (like format_output in files.c)
+* \return       the number of sections. 0 if there is no such entry, or it is not valid
+*******************************************************************************/
+int read_entry(char *name, output_section *sections) {
+    FILE *fp;
+    char *contents, *p, *end, kind[4];
+    unsigned long size, entry_source_length, length;
+    int n = 0, used, i;
+    long file_size;
+    if((fp = fopen(name,"rb")) == NULL)
+        return 0;
+    if(fseek(fp, 0, SEEK_END) != 0 || (file_size = ftell(fp)) < 0 || fseek(fp, 0, SEEK_SET) != 0) {
+        fclose(fp);
+        return 0;
+    }
+    size = (unsigned long)file_size;
+    contents = (char*) arena_alloc(&file_arena, size+1);
+    if(fread(contents, 1, size, fp) != size) {
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+    contents[size] = '\0'; /*for sscanf*/
+    end = contents + size;
+    /*first line: AOC1 <length of the source file> <hash of the output>*/
+    /*(the new line is checked apart: in a format of sscanf, it would skip the spaces at the start of the contents too)*/
+    if(sscanf(contents, CACHE_MAGIC " %lu %lx%n", &entry_source_length, &output_hash_value, &used) != 2
+       || contents[used] != '\n' || entry_source_length != source_length)
+        return 0;
+    /*sections: @<kind> <length>, a new line, and the contents*/
+    for(p = contents + used + 1; p < end; p += length) {
+        if(n == OUTPUT_FILES || sscanf(p, "@%3s %lu%n", kind, &length, &used) != 2 || p[used] != '\n')
+            return 0;
+        p += used + 1;
+        if(length > (unsigned long)(end - p))
+            return 0;
+        for(i = 0; i < OUTPUT_FILES && strcmp(kind, cache_kinds[i]) != 0; i++);
+        if(i == OUTPUT_FILES)
+            return 0;
+        sections[n].kind = cache_kinds[i];
+        sections[n].contents = p;
+        sections[n++].size = length;
+    }
+    return n;
+}
+
+/******************************************************************************
+* Function : cache_fetch(char *file_name);
+*//**
+* \section Description: looks for a source file in the cache. if it is there, its output files are written
+*                       from the cache (see write_sections in files.c), and it is not assembled
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if the output was written from the cache. STATUS_ERR if it was found, but could not be written.
+*               STATUS_FALLBACK if it is not in the cache, so it should be assembled
+*******************************************************************************/
+int cache_fetch(char *file_name) {
+    output_section sections[OUTPUT_FILES];
+    int n;
+    if(make_key(file_name) == STATUS_ERR)
+        return STATUS_FALLBACK; /*the 1st pass reports it*/
+    if((n = read_entry(entry_name(".aoc"), sections)) == 0)
+        return STATUS_FALLBACK;
+    if(write_sections(file_name, sections, n) == STATUS_ERR)
+        return STATUS_ERR;
+    if(options.print_hash)
+        print_hash(file_name);
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : cache_store(char *file_name);
+*//**
+* \section Description: adds the output of a source file that was assembled to the cache (see \brief).
+*                       used after output, when the images and the tables are still there
+*
+* \param  		file_name - the name of the source file
+*******************************************************************************/
+void cache_store(char *file_name) {
+    output_section sections[OUTPUT_FILES];
+    char pid[CACHE_LINE_MAX], *tmp_name, *name;
+    FILE *fp;
+    int i, n, err;
+    if(cache_key[0] == '\0')
+        return;
+    hash_output();
+    if((n = format_output(file_name, &file_arena, sections)) == 0)
+        return;
+    sprintf(pid, ".%ld.tmp", (long)getpid()); /*every process has a temporary file of its own*/
+    tmp_name = entry_name(pid);
+    name = entry_name(".aoc");
+    if((fp = fopen(tmp_name,"wb")) == NULL)
+        return;
+    fprintf(fp, CACHE_MAGIC " %lu %08lx\n", source_length, output_hash_value);
+    for(i = 0; i < n; i++) {
+        fprintf(fp, "@%s %lu\n", sections[i].kind, sections[i].size);
+        fwrite(sections[i].contents, 1, sections[i].size, fp);
+    }
+    err = ferror(fp);
+    if(fclose(fp) != 0 || err || rename(tmp_name, name) != 0)
+        remove(tmp_name);
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
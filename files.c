@@ -7,10 +7,16 @@
 /** \file files.c
  * \brief If there are no errors in the 1st and 2nd pass on
  * this current file, files.c will create all the output files needed
- * 1. a .ob file - for the code and data image
+ * 1. a .ob file - for the code and data image (or a binary .bin file with --format=bin, made by binary_files.c,
+ *    or a .hex or .srec file with --format=ihex or --format=srec, made by hex_files.c)
  * 2. an .ent file - for all the labels that are entry points (if there are any)
  * 3. an .ext file - for all the external labels used as operands (if there are any)
+ * the optional binary output files are made by binary_files.c.
+ * with --stdout, the .ob, .ent and .ext files are not made: they are written to the standard output instead,
+ * as sections of one stream (see write_framed_output)
  */
+/*getpid is POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
 /******************************************************************************
 * Includes
 *******************************************************************************/
@@ -18,25 +24,46 @@
 #include "assembler.h"
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define STREAM_LINES    256 /*the streamed object file is flushed after at least this many lines of code*/
+#define TABLE_LINE_MAX  (MAX_LABEL+24) /*the longest line of the .ent and .ext files: a label, a space, an address and '\n'*/
+#define COMPARE_CHUNK   4096 /*an existing output file is read this many bytes at a time (see same_contents)*/
+#define TMP_SUFFIX_MAX  32 /*the longest suffix of a temporary file: ".", the process id and ".tmp"*/
 
 /******************************************************************************
 * Module Variable Definitions
 *******************************************************************************/
 extern symbol_node *symbol_table;
 extern ext_node *external_list;
-extern command_image *code_img;
-extern data_image *data_img;
+extern unsigned long ext_list_length;
 extern long unsigned int ICF,DCF;
-extern unsigned long code_img_length;
-extern unsigned long data_img_length;
-extern int data_exists,entries_exist;
+extern int data_exists;
+extern symbol_node **entry_list;
+extern unsigned long entry_list_length;
+asm_options options; /*command line options (see set_option)*/
+extern arena file_arena;
+/*the object file while it is streamed (see stream_start)*/
+static FILE *stream_file = NULL;
+static char *stream_fname; /*allocated from file_arena, like the names of the other output files*/
+static unsigned long streamed; /*number of orders already written to the streamed object file*/
 
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
 int write_to_ob_file(FILE *ob_file, char *ob_fname);
+void write_ob_code(FILE *ob_file, unsigned long from, unsigned long to);
+int write_ob_data(FILE *ob_file, char *ob_fname);
 void write_to_ent_file(FILE *ent_file);
 void write_to_ext_file(FILE *ext_file);
+int write_framed_output(char *file_name);
+int write_output(char *file_name);
+boolean same_contents(char *fname, char *contents, unsigned long size);
+int replace_file(char *fname, char *contents, unsigned long size);
+int write_changed_output(char *file_name);
 /******************************************************************************
 * Function Definitions
 *******************************************************************************/
@@ -61,25 +88,250 @@ char* filename(char* name){
 }
 
 /******************************************************************************
-* Function : num_files(int argc)
+* Function : output_file_name(char *file_name, char *extension, arena *a)
+*//**
+* \section Description: makes the name of an output file of a source file: the name of the source file up to its
+*                       first '.' (after the ones it starts with, like strtok in write_output), a '.' and the extension.
+*                       all the output files of a source file are named by it, however they are written
+*
+* \param  		file_name - the name of the source file
+* \param        extension - the extension of the output file (without the '.')
+* \param        a - the arena the name is allocated from
+* \return       the name of the output file
+*******************************************************************************/
+char *output_file_name(char *file_name, char *extension, arena *a) {
+    char *base = file_name + strspn(file_name, ".");
+    size_t base_length = strcspn(base, ".");
+    char *name = (char*) arena_alloc(a, base_length + strlen(extension) + 2);
+    strncpy(name, base, base_length);
+    name[base_length] = '.';
+    strcpy(name + base_length + 1, extension);
+    return name;
+}
+
+/******************************************************************************
+* Function : is_option(char *arg)
 *//**
-* \section Description: This function checks for the number of arguments and makes sure
-*                       it is not below 2 or over 4. otherwise, ut prints an error
+* \section Description: This function checks if a command line argument is an option (starts with "--")
+*                       rather than an input file
 *
-*  The assembler works with 1-3 files of input - hence argc should be between 2 and 4.
-*  This function is used to make sure that there is at least 1 input file, and at most 3
+* \param  		arg - the command line argument
+*
+* \return 		TRUE if the argument is an option
+*******************************************************************************/
+int is_option(char *arg) {
+    return strncmp(arg,"--",2) == 0;
+}
+
+/******************************************************************************
+* Function : set_max_memory(char *size)
+*//**
+* \section Description: This function reads the memory limit given with --max-memory=N.
+*                       N is a positive number of bytes, and may end with K, M or G (kilobytes, megabytes or gigabytes)
+*
+* \param  		size - the number after "--max-memory="
+*
+* \return 		STATUS_OK if the number is valid. STATUS_ERR if not (an error is printed)
+*******************************************************************************/
+int set_max_memory(char *size) {
+    char *end;
+    unsigned long bytes = strtoul(size, &end, 10);
+    switch(*end) {
+        case 'G':
+            bytes *= 1024; /*falls through*/
+        case 'M':
+            bytes *= 1024; /*falls through*/
+        case 'K':
+            bytes *= 1024;
+            end++;
+    }
+    if(end == size || *end != '\0' || bytes == 0) {
+        fprintf(stderr,"error: invalid memory limit (%s)\n",size);
+        return STATUS_ERR;
+    }
+    options.max_memory = bytes;
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : set_option(char *arg)
+*//**
+* \section Description: This function turns on the option given in the command line.
+*                       if the option does not exist, it prints an error
+*
+*  the options are:
+*  --ext-grouped - the .ext file is sorted by label, then by address
+*  --ent-sorted - the .ent file is sorted by address
+*  --sym - a binary symbol database (.sym file) is made too (see binary_files.c)
+*  --xref - a binary cross reference file (.xrf file) is made too (see binary_files.c)
+*  --max-memory=N - the code and data images use about N bytes of memory (N may end with K, M or G),
+*                   and the rest is kept in temporary files (see spill.c)
+*  --mem-stats - the memory used by each subsystem is printed at exit (see mem_stats.c).
+*                --mem-stats=json prints it as a JSON object
+*  --format=F - the format of the object file: text (the .ob file, the default),
+*               bin (a binary .bin file instead, see binary_files.c),
+*               ihex or srec (an Intel HEX .hex file or a Motorola S-record .srec file instead, see hex_files.c)
+*  --stream - the .ob file is written while the 2nd pass goes on (see stream_start)
+*  --stdout - the .ob, .ent and .ext files are written to the standard output as one stream (see write_framed_output)
+*  --io-uring - the .ob, .ent and .ext files of many source files are written in batches (see uring_files.c)
+*  --print-hash - the hash of the output of every source file is printed (see hash.c)
+*  --hash-header - the hash is added to the first line of the .ob file, after the sizes of the images
+*  --write-if-changed - an output file that would not change is not written again (see write_changed_output)
+*  --serve=SOCKET - there are no input files: source files are assembled on requests to a unix socket (see server.c)
+*  --cache-dir=DIR - the output of source files assembled before is taken from a cache in DIR (see cache.c)
+*
+* \param  		arg - the command line argument (an option)
+*
+* \return 		STATUS_OK if the option exists. STATUS_ERR if not
+*******************************************************************************/
+int set_option(char *arg) {
+    if(strcmp(arg,"--ext-grouped") == 0) {
+        options.ext_grouped = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--ent-sorted") == 0) {
+        options.ent_sorted = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--sym") == 0) {
+        options.sym_file = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--xref") == 0) {
+        options.xref_file = TRUE;
+        return STATUS_OK;
+    }
+    if(strncmp(arg,"--max-memory=",13) == 0) {
+        return set_max_memory(arg+13);
+    }
+    if(strcmp(arg,"--mem-stats") == 0 || strcmp(arg,"--mem-stats=text") == 0) {
+        options.mem_stats = MEM_STATS_TEXT;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--mem-stats=json") == 0) {
+        options.mem_stats = MEM_STATS_JSON;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--stdout") == 0) {
+        options.to_stdout = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--io-uring") == 0) {
+        options.io_uring = TRUE;
+        return STATUS_OK;
+    }
+    if(strncmp(arg,"--serve=",8) == 0 && arg[8] != '\0') {
+        options.serve_path = arg+8;
+        return STATUS_OK;
+    }
+    if(strncmp(arg,"--cache-dir=",12) == 0 && arg[12] != '\0') {
+        options.cache_dir = arg+12;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--write-if-changed") == 0) {
+        options.write_if_changed = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--print-hash") == 0) {
+        options.print_hash = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--hash-header") == 0) {
+        options.hash_header = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--stream") == 0) {
+        options.stream = TRUE;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--format=text") == 0) {
+        options.format = FORMAT_TEXT;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--format=bin") == 0) {
+        options.format = FORMAT_BIN;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--format=ihex") == 0) {
+        options.format = FORMAT_IHEX;
+        return STATUS_OK;
+    }
+    if(strcmp(arg,"--format=srec") == 0) {
+        options.format = FORMAT_SREC;
+        return STATUS_OK;
+    }
+    fprintf(stderr,"error: unknown option (%s)\n",arg);
+    return STATUS_ERR;
+}
+
+/******************************************************************************
+* Function : num_files(int argc, char **argv)
+*//**
+* \section Description: This function checks that there is at least one input file. otherwise, ut prints an error
+*
+*  options are not counted as input files.
 *
 * \param  		argc - the number of arguments in the command line
+* \param        argv - the arguments in the command line
 *
-* \return 		STATUS_OK if there is at least 1 input file, and at most 3. STATUS_ERR if not
+* \return 		STATUS_OK if there is at least 1 input file. STATUS_ERR if not
 *******************************************************************************/
-int num_files (int argc) {
+int num_files (int argc, char **argv) {
+    int i;
+    for(i = 1; i < argc; i++) { /*options are not input files*/
+        if(is_option(argv[i]))
+            argc--;
+    }
     if(argc<MIN_ARGUMENTS) {
         fprintf(stderr,"error: no input files\n");
         return STATUS_ERR;
     }
-    if(argc>MAX_ARGUMENTS) {
-        fprintf(stderr,"error: too many input files (more than 3)\n");
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : check_options()
+*//**
+* \section Description: This function checks that the options given can be used together (after all of them are set)
+*
+* \return 		STATUS_OK if they can. STATUS_ERR if not (an error is printed)
+*******************************************************************************/
+int check_options() {
+    if(options.to_stdout && options.format != FORMAT_TEXT) {
+        fprintf(stderr,"error: --stdout writes only the text object file, and cannot be used with --format\n");
+        return STATUS_ERR;
+    }
+    if(options.to_stdout && options.stream) {
+        fprintf(stderr,"error: --stdout and --stream cannot be used together\n");
+        return STATUS_ERR;
+    }
+    if(options.stream && options.format != FORMAT_TEXT) {
+        fprintf(stderr,"error: --stream writes only the text object file, and cannot be used with --format\n");
+        return STATUS_ERR;
+    }
+    if(options.hash_header && options.stream) {
+        fprintf(stderr,"error: --hash-header cannot be used with --stream (the first line is written before the hash is known)\n");
+        return STATUS_ERR;
+    }
+    if(options.write_if_changed && (options.to_stdout || options.stream || options.io_uring || options.format != FORMAT_TEXT)) {
+        fprintf(stderr,"error: --write-if-changed cannot be used with --stdout, --stream, --io-uring or --format\n");
+        return STATUS_ERR;
+    }
+    if(options.serve_path != NULL && (options.to_stdout || options.stream || options.io_uring || options.format != FORMAT_TEXT
+                                      || options.sym_file || options.xref_file || options.write_if_changed || options.cache_dir != NULL)) {
+        fprintf(stderr,"error: --serve sends the output back on the socket, and cannot be used with --stdout, --stream, "
+                       "--io-uring, --format, --sym, --xref, --write-if-changed or --cache-dir\n");
+        return STATUS_ERR;
+    }
+    if(options.cache_dir != NULL && (options.to_stdout || options.stream || options.io_uring || options.format != FORMAT_TEXT
+                                     || options.sym_file || options.xref_file)) {
+        fprintf(stderr,"error: --cache-dir cannot be used with --stdout, --stream, --io-uring, --format, --sym or --xref\n");
+        return STATUS_ERR;
+    }
+    if(options.cache_dir != NULL && cache_start() == STATUS_ERR)
+        return STATUS_ERR;
+    if(options.io_uring && (options.to_stdout || options.stream || options.format != FORMAT_TEXT)) {
+        fprintf(stderr,"error: --io-uring cannot be used with --stdout, --stream or --format\n");
         return STATUS_ERR;
     }
     return STATUS_OK;
@@ -110,74 +362,119 @@ void new_line_check(int *space_count,unsigned long *address, FILE *ob_file) {
 /******************************************************************************
 * Function : output(char *file_name)
 *//**
-* \section Description: creates output files (see \brief)
+* \section Description: creates output files (see write_output), with the hash of the output if it is needed (see hash.c)
 *
 * \param  		file_name - the name of the source file
 * \return       STATUS_OK if no error was found. otherwise:  STATUS_ERR
 *
 *******************************************************************************/
 int output(char *file_name) {
+    boolean streamed_ob = (stream_file != NULL);
+    int err;
+    /*a streamed object file is still reading the images, so it is hashed after it is written*/
+    if((options.print_hash || options.hash_header) && !streamed_ob)
+        hash_output();
+    err = write_output(file_name);
+    if(err == STATUS_OK && options.print_hash) {
+        if(streamed_ob)
+            hash_output();
+        print_hash(file_name);
+    }
+    return err;
+}
+
+/******************************************************************************
+* Function : write_output(char *file_name)
+*//**
+* \section Description: creates output files (see \brief)
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if no error was found. otherwise:  STATUS_ERR
+*
+*******************************************************************************/
+int write_output(char *file_name) {
     FILE *ob_file;
     FILE *ent_file;
     FILE *ext_file;
-    char *ob_fname = (char*) malloc (MAX_FILE_NAME);
-    char *ent_fname = (char*) malloc (MAX_FILE_NAME);
-    char *ext_fname = (char*) malloc (MAX_FILE_NAME);
-    int err_ob_file = STATUS_OK;
+    char *ob_fname, *ent_fname, *ext_fname;
+    int err_ob_file = STATUS_FALLBACK, write_err;
+    /*the .ob, .ent and .ext files formatted in memory first (see format_output)*/
+    if(options.to_stdout)
+        err_ob_file = write_framed_output(file_name);
+    else if(options.write_if_changed)
+        err_ob_file = write_changed_output(file_name);
+    else if(options.io_uring)
+        err_ob_file = queue_output_files(file_name);
+    if(err_ob_file != STATUS_FALLBACK) {
+        file_name = strtok(file_name,".");
+        if(err_ob_file == STATUS_OK && options.sym_file)
+            err_ob_file = write_sym_file(file_name);
+        if(err_ob_file == STATUS_OK && options.xref_file)
+            err_ob_file = write_xref_file(file_name);
+        return err_ob_file;
+    }
+    err_ob_file = STATUS_OK;
     /*making all the needed file names*/
-    alloc_check(ob_fname);
-    alloc_check(ent_fname);
-    alloc_check(ext_fname);
+    ob_fname = output_file_name(file_name, "ob", &file_arena);
+    ent_fname = output_file_name(file_name, "ent", &file_arena);
+    ext_fname = output_file_name(file_name, "ext", &file_arena);
     file_name=strtok(file_name,".");
-    strcpy(ob_fname,file_name);
-    strcpy(ent_fname,file_name);
-    strcpy(ext_fname,file_name);
-    strcat(ob_fname,".ob");
-    strcat(ent_fname,".ent");
-    strcat(ext_fname,".ext");
 
     /*do not open file if there are no entry points (ent) or external symbols (ext)*/
     /*checking for entries*/
-    if(entries_exist == TRUE) {
+    if(entry_list_length > 0) {
         ent_file = fopen(ent_fname,"w");
         /*writing to ent file*/
         if(ent_file == NULL) {
             fprintf(stderr,"error: cannot make output file [%s]",ent_fname);
-            free(ob_fname);
-            free(ent_fname);
-            free(ext_fname);
+            stream_abort();
             return STATUS_ERR;
         }
         write_to_ent_file(ent_file);
+        fclose(ent_file);
     }
 
     /*checking if the external labels*/
-    if(external_list != NULL) {
+    if(ext_list_length > 0) {
         ext_file = fopen(ext_fname,"w");
         /*write to ext file*/
         if(ext_file == NULL) {
             fprintf(stderr,"error: cannot make output file [%s]",ext_fname);
-            free(ob_fname);
-            free(ent_fname);
-            free(ext_fname);
+            stream_abort();
             return STATUS_ERR;
         }
         write_to_ext_file(ext_file);
+        fclose(ext_file);
     }
 
-    ob_file = fopen(ob_fname,"w");
-    /*writing to object file*/
-    if(ob_file == NULL) {
-        fprintf(stderr,"error: cannot make output file [%s]",ob_fname);
-        free(ent_fname);
-        free(ob_fname);
-        free(ext_fname);
-        return STATUS_ERR;
+    /*writing to object file. a big one is formatted by a number of threads (see parallel_files.c),
+     *and otherwise it is formatted straight into memory mapped from it, if it can be (see mapped_files.c)*/
+    if(stream_file != NULL)
+        err_ob_file = stream_end();
+    else if(options.format == FORMAT_BIN)
+        err_ob_file = write_bin_file(file_name);
+    else if(options.format != FORMAT_TEXT)
+        err_ob_file = write_hex_file(file_name);
+    else err_ob_file = write_parallel_ob_file(ob_fname);
+    if(err_ob_file == STATUS_FALLBACK)
+        err_ob_file = write_mapped_ob_file(ob_fname);
+    if(err_ob_file == STATUS_FALLBACK) {
+        ob_file = fopen(ob_fname,"w");
+        if(ob_file == NULL) {
+            fprintf(stderr,"error: cannot make output file [%s]",ob_fname);
+            return STATUS_ERR;
+        }
+        err_ob_file = write_to_ob_file(ob_file,ob_fname);
+        write_err = ferror(ob_file);
+        if((fclose(ob_file) != 0 || write_err) && err_ob_file == STATUS_OK) { /*a full disk, for example*/
+            fprintf(stderr,"error: cannot write output file [%s]\n",ob_fname);
+            err_ob_file = STATUS_ERR;
+        }
     }
-    err_ob_file = write_to_ob_file(ob_file,ob_fname);
-    free(ob_fname);
-    free(ent_fname);
-    free(ext_fname);
+    if(err_ob_file == STATUS_OK && options.sym_file)
+        err_ob_file = write_sym_file(file_name);
+    if(err_ob_file == STATUS_OK && options.xref_file)
+        err_ob_file = write_xref_file(file_name);
     return err_ob_file;
 }
 
@@ -191,64 +488,77 @@ int output(char *file_name) {
 *
 * \note         the format of the object file is as follows:
 *               at the beginning of the file, the number of bytes used for code and data (separately) is shown.
-*               for code ICF-100, for data, DCF.
+*               for code ICF-100 (ICF-CODE_BASE), for data, DCF.
 *               then for each line in the binary image, the binary image is printed in the little endian method in hex base.
 *               to the left of the image, the address for that image is shown
 *               to code it this way we need to do a loop in the loop for data
-*               using the partition to bytes made by the unions and structs
+*               using the partition to bytes made by to_bytes (see tables.c)
 *******************************************************************************/
 int write_to_ob_file(FILE *ob_file, char *ob_fname) {
-    int i;
+    char header[MAX_LINE];
+    /*writing title*/
+    ob_header(header);
+    fputs(header,ob_file);
+    /*reading the images from the start (some of them may be in temporary files, see spill.c)*/
+    start_images();
+    write_ob_code(ob_file, 0, code_length());
+    return write_ob_data(ob_file, ob_fname);
+}
+
+/******************************************************************************
+* Function : write_ob_code(FILE *ob_file, unsigned long from, unsigned long to);
+*//**
+* \section Description: writes a range of the code image to the object file, one line for each order.
+*                       the orders are read with next_code_word, so the range must start right after the last order read
+*
+* \param  		ob_file - pointer to the object file
+* \param        from - the index of the first order
+* \param        to - the index after the last order
+*******************************************************************************/
+void write_ob_code(FILE *ob_file, unsigned long from, unsigned long to) {
+    unsigned long curr_address = CODE_BASE + from*WORD;
+    unsigned char bytes[WORD];
+    machine_word code_word;
+    /*the address of each order is 4 bytes after the address of the order before it*/
+    for(; from < to && next_code_word(&code_word); from++) {
+        to_bytes(bytes, code_word, WORD);
+        fprintf(ob_file,"%04lu %02X %02X %02X %02X\n", curr_address, bytes[0], bytes[1], bytes[2], bytes[3]);
+        curr_address += WORD;
+    }
+}
+
+/******************************************************************************
+* Function : write_ob_data(FILE *ob_file, char *ob_fname);
+*//**
+* \section Description: writes the data image to the object file, after the code image
+*
+* \param  		ob_file - pointer to the object file
+* \param        ob_fname - the name of the object file
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*******************************************************************************/
+int write_ob_data(FILE *ob_file, char *ob_fname) {
+    int j;
     unsigned long curr_address;
     int bytes_taken;
     int space_count = 0;
-    /*writing title*/
-    fprintf(ob_file,"     %lu %lu\n",ICF-100,DCF);
-    /*writing code image*/
-    for(i=0;i<code_img_length;i++) {
-        fprintf(ob_file,"%04d %02X %02X %02X %02X\n", code_img[i].address, code_img[i].machine_code.w.b1, code_img[i].machine_code.w.b2, code_img[i].machine_code.w.b3, code_img[i].machine_code.w.b4);
-    }
+    unsigned char bytes[WORD];
+    data_image data_cell;
     if (data_exists) {
-        /*writing data image*/
         curr_address = ICF;
-        for (i = 0; i < data_img_length; i++) {
-            if (i == 0) {
-                fprintf(ob_file, "%04lu", curr_address);
-                curr_address += WORD;
+        fprintf(ob_file, "%04lu", curr_address);
+        curr_address += WORD;
+        while(next_data_cell(&data_cell)) {
+            bytes_taken = data_cell.bytes_taken;
+            /*always should be 1,2, or 4*/
+            if(bytes_taken != ONE_BYTE && bytes_taken != HALF_WORD && bytes_taken != WORD) {
+                fprintf(stderr, "this should not happen (data printing for %s)\n", ob_fname);
+                return STATUS_ERR;
             }
-            bytes_taken = data_img[i].bytes_taken;
-            switch (bytes_taken) { /*checks how many bytes was taken by each member of data_img to access the right member(s) for printing*/
-                case ONE_BYTE:
-                    new_line_check(&space_count, &curr_address, ob_file);
-                    fprintf(ob_file, " %02X", data_img[i].machine_code.b);
-                    space_count++;
-                    break;
-                    case HALF_WORD:
-                        new_line_check(&space_count, &curr_address, ob_file);
-                        fprintf(ob_file, " %02X", data_img[i].machine_code.dh.h.b1);
-                        space_count++;
-                        new_line_check(&space_count, &curr_address, ob_file);
-                        fprintf(ob_file, " %02X", data_img[i].machine_code.dh.h.b2);
-                        space_count++;
-                        break;
-                        case WORD:
-                            new_line_check(&space_count, &curr_address, ob_file);
-                            fprintf(ob_file, " %02X", data_img[i].machine_code.dw.w.b1);
-                            space_count++;
-                            new_line_check(&space_count, &curr_address, ob_file);
-                            fprintf(ob_file, " %02X", data_img[i].machine_code.dw.w.b2);
-                            space_count++;
-                            new_line_check(&space_count, &curr_address, ob_file);
-                            fprintf(ob_file, " %02X", data_img[i].machine_code.dw.w.b3);
-                            space_count++;
-                            new_line_check(&space_count, &curr_address, ob_file);
-                            fprintf(ob_file, " %02X", data_img[i].machine_code.dw.w.b4);
-                            space_count++;
-                            break;
-                            /*always should be 1,2, or 4*/
-                            default:
-                                fprintf(stderr, "this should not happen (data printing for %s)\n", ob_fname);
-                                return STATUS_ERR;
+            to_bytes(bytes, data_cell.machine_code, bytes_taken);
+            for(j = 0; j < bytes_taken; j++) {
+                new_line_check(&space_count, &curr_address, ob_file);
+                fprintf(ob_file, " %02X", bytes[j]);
+                space_count++;
             }
         }
     }
@@ -265,15 +575,15 @@ int write_to_ob_file(FILE *ob_file, char *ob_fname) {
 * \note         the format of the entry file is as follows:
 *               for each label (that opens a line) that is an entry point
 *               (\example - "K: .dw 31,-12" and also ".entry K" in the same file)
-*               the entry file will contain the label and its address
+*               the entry file will contain the label and its address.
+*               the lines are in the order of the .entry directives, or sorted by address with --ent-sorted
 *******************************************************************************/
 void write_to_ent_file(FILE *ent_file) {
-    symbol_node *curr_1 = symbol_table;
-    while(curr_1!=NULL)  {
-        if(curr_1->is_entry == TRUE) { /*if the symbol is an entry point, print symbol and address*/
-            fprintf(ent_file,"%s %04lu\n", curr_1->symbol, curr_1->address);
-        }
-        curr_1 = curr_1 ->next;
+    unsigned long i;
+    if(options.ent_sorted)
+        sort_entry_list();
+    for(i = 0; i < entry_list_length; i++) { /*print symbol and address for each entry point*/
+        fprintf(ent_file,"%s %04lu\n", entry_list[i]->symbol.name, symbol_address(entry_list[i]));
     }
 }
 
@@ -286,14 +596,298 @@ void write_to_ent_file(FILE *ent_file) {
 *
 * \note         the format of the external file is as follows:
 *               for each external label that is used as an operand in J orders,
-*               the file will contain the label and the address of the order
+*               the file will contain the label and the address of the order.
+*               the lines are in the order of the source file, or grouped by label (then by address) with --ext-grouped
 *******************************************************************************/
 void write_to_ext_file(FILE *ext_file) {
-    ext_node *curr_2 = external_list;
-    while(curr_2!=NULL) { /*if the symbol is external, print symbol and address*/
-        fprintf(ext_file,"%s %04d\n",curr_2->label, curr_2->address);
-        curr_2 = curr_2->next;
+    unsigned long i;
+    if(options.ext_grouped)
+        group_ext_list();
+    for(i = 0; i < ext_list_length; i++) { /*print symbol and address for each use of an external label*/
+        fprintf(ext_file,"%s %04lu\n",external_list[i].label.name, external_list[i].address);
+    }
+}
+
+/******************************************************************************
+* Function : stream_start(char *file_name)
+*//**
+* \section Description: starts streaming the object file (--stream). it is called after the 1st pass, when ICF and DCF
+*                       are known, and writes the first line of the object file right away. during the 2nd pass, every order
+*                       it passed is final, so the lines of the code image are written as it goes (see stream_code),
+*                       and the rest of the file is written by output (see stream_end).
+*                       a program reading the object file (through a pipe, for example) can start before the assembler is done.
+*                       only the .ob file is streamed (--stream cannot be used with --format, see check_options)
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if the object file was made. otherwise: STATUS_ERR
+*******************************************************************************/
+int stream_start(char *file_name) {
+    stream_fname = output_file_name(file_name, "ob", &file_arena); /*the same name write_output gives the object file*/
+    if((stream_file = fopen(stream_fname, "w")) == NULL) {
+        fprintf(stderr,"error: cannot make output file [%s]",stream_fname);
+        return STATUS_ERR;
+    }
+    fprintf(stream_file,"     %lu %lu\n",ICF-CODE_BASE,DCF);
+    fflush(stream_file);
+    streamed = 0;
+    start_images();
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : stream_code(unsigned long final)
+*//**
+* \section Description: writes the lines of the code image that became final to the streamed object file.
+*                       the file is flushed every STREAM_LINES lines, so the lines do not wait in the buffer
+*
+* \param  		final - the number of orders that are final (the 2nd pass is past them)
+*******************************************************************************/
+void stream_code(unsigned long final) {
+    if(stream_file == NULL || final - streamed < STREAM_LINES)
+        return;
+    write_ob_code(stream_file, streamed, final);
+    streamed = final;
+    fflush(stream_file);
+}
+
+/******************************************************************************
+* Function : stream_end()
+*//**
+* \section Description: writes the rest of the code image and the data image to the streamed object file, and closes it
+*
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*******************************************************************************/
+int stream_end() {
+    int err;
+    write_ob_code(stream_file, streamed, code_length());
+    err = write_ob_data(stream_file, stream_fname);
+    if(ferror(stream_file))
+        err = STATUS_ERR;
+    if(fclose(stream_file) != 0 || err == STATUS_ERR) {
+        fprintf(stderr,"error: cannot write output file [%s]",stream_fname);
+        err = STATUS_ERR;
+    }
+    stream_file = NULL;
+    return err;
+}
+
+/******************************************************************************
+* Function : stream_abort()
+*//**
+* \section Description: closes the streamed object file and removes it, when an error was found in the 2nd pass.
+*                       there are no output files for a source file with errors, even if a part of it was already streamed
+*******************************************************************************/
+void stream_abort() {
+    if(stream_file == NULL)
+        return;
+    fclose(stream_file);
+    remove(stream_fname);
+    stream_file = NULL;
+}
+
+/******************************************************************************
+* Function : format_output(char *file_name, arena *a, output_section *sections)
+*//**
+* \section Description: formats the .ob file, and the .ent and .ext files if they are needed, into memory.
+*                       used when the output is not written with stdio (see write_framed_output, and uring_files.c)
+*
+* \param  		file_name - the name of the source file
+* \param        a - the arena the contents are allocated from
+* \param        sections - the contents of each file are put here (at most 3), with the extension of the file as kind
+* \return       the number of files formatted. 0 if an error was found (it is printed)
+*******************************************************************************/
+int format_output(char *file_name, arena *a, output_section *sections) {
+    unsigned long header_size = ob_header_size(), i;
+    unsigned long size = header_size + code_section_size() + data_section_size();
+    char *contents = (char*) arena_alloc(a, size+1); /*sprintf adds a null character*/
+    char *end;
+    int n = 0;
+
+    /*the object file (like write_mapped_ob_file)*/
+    ob_header(contents);
+    start_images();
+    end = format_data(format_code(contents + header_size));
+    if(end == NULL) {
+        fprintf(stderr, "this should not happen (data printing for %s)\n", file_name);
+        return 0;
+    }
+    if(end != contents + size) {
+        fprintf(stderr, "error: this should not happen (algorithm flaw in assembler) [%s]\n", file_name);
+        return 0;
+    }
+    sections[n].kind = "ob";
+    sections[n].contents = contents;
+    sections[n++].size = size;
+    /*the entry points (like write_to_ent_file)*/
+    if(entry_list_length > 0) {
+        if(options.ent_sorted)
+            sort_entry_list();
+        end = contents = (char*) arena_alloc(a, entry_list_length * TABLE_LINE_MAX);
+        for(i = 0; i < entry_list_length; i++)
+            end += sprintf(end, "%s %04lu\n", entry_list[i]->symbol.name, symbol_address(entry_list[i]));
+        sections[n].kind = "ent";
+        sections[n].contents = contents;
+        sections[n++].size = end - contents;
     }
+    /*the uses of external labels (like write_to_ext_file)*/
+    if(ext_list_length > 0) {
+        if(options.ext_grouped)
+            group_ext_list();
+        end = contents = (char*) arena_alloc(a, ext_list_length * TABLE_LINE_MAX);
+        for(i = 0; i < ext_list_length; i++)
+            end += sprintf(end, "%s %04lu\n", external_list[i].label.name, external_list[i].address);
+        sections[n].kind = "ext";
+        sections[n].contents = contents;
+        sections[n++].size = end - contents;
+    }
+    return n;
+}
+
+/******************************************************************************
+* Function : write_framed_output(char *file_name)
+*//**
+* \section Description: writes the output of a source file to the standard output (--stdout), instead of
+*                       making the .ob, .ent and .ext files. the output of all the source files is one stream,
+*                       so it can be piped to another program without using the file system.
+*                       every section is formatted into memory first, so its length is known before it is written
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+* \note         the stream is made of sections. each section starts with a line: '@', the kind of the section,
+*               a space, the name of the source file (without .as), a space, and the length of the contents in bytes.
+*               then come the contents, exactly that many bytes, which are the same as the file of that kind would be.
+*               the kinds are "ob" (always), "ent" (if there are entry points) and "ext" (if external labels are used),
+*               in this order for each source file that has no errors.
+*******************************************************************************/
+int write_framed_output(char *file_name) {
+    output_section sections[OUTPUT_FILES];
+    int i, n = format_output(file_name, &file_arena, sections);
+    if(n == 0)
+        return STATUS_ERR;
+    for(i = 0; i < n; i++) {
+        printf("@%s %.*s %lu\n", sections[i].kind, (int)(strlen(file_name)-3), file_name, sections[i].size); /*the name without .as*/
+        fwrite(sections[i].contents, 1, sections[i].size, stdout);
+    }
+    if(fflush(stdout) != 0 || ferror(stdout)) {
+        fprintf(stderr,"error: cannot write to the standard output");
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : same_contents(char *fname, char *contents, unsigned long size)
+*//**
+* \section Description: checks if a file already has the contents given. the sizes are compared first,
+*                       so a file that changed length is not read at all, and then the bytes of the file are
+*                       compared with the contents, COMPARE_CHUNK bytes at a time
+*
+* \param  		fname - the name of the file
+* \param        contents - the contents
+* \param        size - the length of the contents
+* \return       TRUE if the file exists and has the same contents. otherwise: FALSE
+*******************************************************************************/
+boolean same_contents(char *fname, char *contents, unsigned long size) {
+    FILE *fp;
+    char buffer[COMPARE_CHUNK];
+    unsigned long offset = 0;
+    size_t n;
+    boolean same = TRUE;
+    if((fp = fopen(fname,"rb")) == NULL)
+        return FALSE;
+    if(fseek(fp, 0, SEEK_END) != 0 || ftell(fp) != (long)size || fseek(fp, 0, SEEK_SET) != 0) {
+        fclose(fp);
+        return FALSE;
+    }
+    while(same && (n = fread(buffer, 1, COMPARE_CHUNK, fp)) > 0) {
+        same = (offset + n <= size && memcmp(buffer, contents + offset, n) == 0);
+        offset += n;
+    }
+    if(ferror(fp) || offset != size)
+        same = FALSE;
+    fclose(fp);
+    return same;
+}
+
+/******************************************************************************
+* Function : replace_file(char *fname, char *contents, unsigned long size)
+*//**
+* \section Description: writes a file atomically: the contents are written to a temporary file next to it
+*                       (the name of the file, the process id and ".tmp"), which is then renamed over it. a program
+*                       reading the file sees either the old contents or the new ones, never a part of them, and two
+*                       assemblers writing the same file at once never write into the same temporary file.
+*                       the temporary file is removed if anything fails
+*
+* \param  		fname - the name of the file
+* \param        contents - the contents
+* \param        size - the length of the contents
+* \return       STATUS_OK if the file was written. otherwise: STATUS_ERR (an error is printed)
+*******************************************************************************/
+int replace_file(char *fname, char *contents, unsigned long size) {
+    FILE *fp;
+    char pid[TMP_SUFFIX_MAX], *tmp_fname;
+    int err;
+    sprintf(pid, ".%ld.tmp", (long)getpid()); /*every process has a temporary file of its own*/
+    tmp_fname = (char*) arena_alloc(&file_arena, strlen(fname)+strlen(pid)+1);
+    strcpy(tmp_fname, fname);
+    strcat(tmp_fname, pid);
+    if((fp = fopen(tmp_fname,"wb")) == NULL) {
+        fprintf(stderr,"error: cannot make output file [%s]\n",tmp_fname);
+        remove(tmp_fname);
+        return STATUS_ERR;
+    }
+    fwrite(contents, 1, size, fp);
+    err = ferror(fp);
+    if(fclose(fp) != 0 || err || rename(tmp_fname, fname) != 0) {
+        fprintf(stderr,"error: cannot write output file [%s]\n",fname);
+        remove(tmp_fname);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : write_changed_output(char *file_name)
+*//**
+* \section Description: makes the .ob, .ent and .ext files of a source file like output does, but does not
+*                       write a file that already has the same contents (--write-if-changed). so the modification
+*                       time of a file changes only when its contents change, and a build system does not rebuild
+*                       what depends on it after a change that did not change the output (a comment, for example).
+*                       a file that changed is replaced atomically (see replace_file)
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*******************************************************************************/
+int write_changed_output(char *file_name) {
+    output_section sections[OUTPUT_FILES];
+    int n = format_output(file_name, &file_arena, sections);
+    if(n == 0)
+        return STATUS_ERR;
+    return write_sections(file_name, sections, n);
+}
+
+/******************************************************************************
+* Function : write_sections(char *file_name, output_section *sections, int n)
+*//**
+* \section Description: writes output files formatted in memory, each one replaced atomically (see replace_file).
+*                       with --write-if-changed, a file that already has the same contents is not written
+*
+* \param  		file_name - the name of the source file
+* \param        sections - the contents of the files (see format_output)
+* \param        n - the number of files
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*******************************************************************************/
+int write_sections(char *file_name, output_section *sections, int n) {
+    char *fname;
+    int i;
+    for(i = 0; i < n; i++) {
+        fname = output_file_name(file_name, sections[i].kind, &file_arena);
+        if(!(options.write_if_changed && same_contents(fname, sections[i].contents, sections[i].size))
+           && replace_file(fname, sections[i].contents, sections[i].size) == STATUS_ERR)
+            return STATUS_ERR;
+    }
+    return STATUS_OK;
 }
 
 /*************** END OF FUNCTIONS ***************************************************************************/
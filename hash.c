@@ -0,0 +1,214 @@
+/*******************************************************************************
+* Title                 :   Output hash
+* Filename              :   hash.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file hash.c
+ * \brief This module computes a hash of the output of a source file (--print-hash, --hash-header),
+ * so a build system can tell whether the output changed without reading the files again.
+ * the hash is XXH32 (xxHash, 32 bit, seed 0): it is fast and not cryptographic.
+ * it covers what the output means, not how it is formatted, so it is the same for every --format:
+ * 1. the code image - 4 bytes for each order, in the order of the .ob file
+ * 2. the data image - DCF bytes
+ * 3. the entry points - for each one, in the order of the .ent file: the name, a null character, and the address
+ * 4. the uses of external labels - for each one, in the order of the .ext file: the name, a null character, and the address
+ * the addresses are 4 bytes, little endian.
+ */
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "assembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define XXH_PRIME1  0x9E3779B1UL
+#define XXH_PRIME2  0x85EBCA77UL
+#define XXH_PRIME3  0xC2B2AE3DUL
+#define XXH_PRIME4  0x27D4EB2FUL
+#define XXH_PRIME5  0x165667B1UL
+#define U32_MASK    0xFFFFFFFFUL /*unsigned long may be longer than 32 bits*/
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define rotl32(X,R)     ((((X) << (R)) | ((X) >> (32-(R)))) & U32_MASK)
+#define read_u32(P)     ((unsigned long)(P)[0] | (unsigned long)(P)[1] << 8 | (unsigned long)(P)[2] << 16 | (unsigned long)(P)[3] << 24)
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern symbol_node **entry_list;
+extern unsigned long entry_list_length;
+extern ext_node *external_list;
+extern unsigned long ext_list_length;
+unsigned long output_hash_value = 0; /*the hash of the output of the current source file (see hash_output)*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : xxh32_round(unsigned long acc, unsigned long input);
+*//**
+* \return       the accumulator of a lane after a 4 byte input
+*******************************************************************************/
+unsigned long xxh32_round(unsigned long acc, unsigned long input) {
+    acc = (acc + input * XXH_PRIME2) & U32_MASK;
+    acc = rotl32(acc, 13);
+    return (acc * XXH_PRIME1) & U32_MASK;
+}
+
+/******************************************************************************
+* Function : xxh32_reset(xxh32_state *state, unsigned long seed);
+*//**
+* \section Description: starts a new hash
+*
+* \param  		state - the state of the hash
+* \param        seed - the seed
+*******************************************************************************/
+void xxh32_reset(xxh32_state *state, unsigned long seed) {
+    state->v[0] = (seed + XXH_PRIME1 + XXH_PRIME2) & U32_MASK;
+    state->v[1] = (seed + XXH_PRIME2) & U32_MASK;
+    state->v[2] = seed & U32_MASK;
+    state->v[3] = (seed - XXH_PRIME1) & U32_MASK;
+    state->seed = seed & U32_MASK;
+    state->total = 0;
+    state->buffered = 0;
+}
+
+/******************************************************************************
+* Function : xxh32_update(xxh32_state *state, const unsigned char *bytes, unsigned long length);
+*//**
+* \section Description: adds bytes to a hash. the bytes are taken 16 at a time (4 bytes for each lane),
+*                       and the rest waits in the state for the next bytes
+*
+* \param  		state - the state of the hash
+* \param        bytes - the bytes
+* \param        length - number of bytes
+*******************************************************************************/
+void xxh32_update(xxh32_state *state, const unsigned char *bytes, unsigned long length) {
+    const unsigned char *end = bytes + length;
+    state->total += length;
+    if(state->buffered + length < XXH_STRIPE) {
+        memcpy(state->buffer + state->buffered, bytes, length);
+        state->buffered += (int)length;
+        return;
+    }
+    if(state->buffered > 0) { /*completing the stripe that waits in the state*/
+        memcpy(state->buffer + state->buffered, bytes, XXH_STRIPE - state->buffered);
+        bytes += XXH_STRIPE - state->buffered;
+        state->v[0] = xxh32_round(state->v[0], read_u32(state->buffer));
+        state->v[1] = xxh32_round(state->v[1], read_u32(state->buffer+4));
+        state->v[2] = xxh32_round(state->v[2], read_u32(state->buffer+8));
+        state->v[3] = xxh32_round(state->v[3], read_u32(state->buffer+12));
+        state->buffered = 0;
+    }
+    for(; end - bytes >= XXH_STRIPE; bytes += XXH_STRIPE) {
+        state->v[0] = xxh32_round(state->v[0], read_u32(bytes));
+        state->v[1] = xxh32_round(state->v[1], read_u32(bytes+4));
+        state->v[2] = xxh32_round(state->v[2], read_u32(bytes+8));
+        state->v[3] = xxh32_round(state->v[3], read_u32(bytes+12));
+    }
+    memcpy(state->buffer, bytes, end - bytes);
+    state->buffered = (int)(end - bytes);
+}
+
+/******************************************************************************
+* Function : xxh32_digest(xxh32_state *state);
+*//**
+* \param  		state - the state of the hash (it is not changed, so more bytes can be added after)
+* \return       the hash of all the bytes added since xxh32_reset
+*******************************************************************************/
+unsigned long xxh32_digest(xxh32_state *state) {
+    unsigned long h;
+    int i = 0;
+    if(state->total >= XXH_STRIPE)
+        h = rotl32(state->v[0], 1) + rotl32(state->v[1], 7) + rotl32(state->v[2], 12) + rotl32(state->v[3], 18);
+    else h = state->seed + XXH_PRIME5;
+    h = (h + state->total) & U32_MASK;
+    for(; i + 4 <= state->buffered; i += 4) {
+        h = (h + read_u32(state->buffer+i) * XXH_PRIME3) & U32_MASK;
+        h = (rotl32(h, 17) * XXH_PRIME4) & U32_MASK;
+    }
+    for(; i < state->buffered; i++) {
+        h = (h + state->buffer[i] * XXH_PRIME5) & U32_MASK;
+        h = (rotl32(h, 11) * XXH_PRIME1) & U32_MASK;
+    }
+    h ^= h >> 15;
+    h = (h * XXH_PRIME2) & U32_MASK;
+    h ^= h >> 13;
+    h = (h * XXH_PRIME3) & U32_MASK;
+    h ^= h >> 16;
+    return h;
+}
+
+/******************************************************************************
+* Function : hash_name_address(xxh32_state *state, char *name, unsigned long address);
+*//**
+* \section Description: adds an entry point or a use of an external label to a hash (see \brief)
+*******************************************************************************/
+void hash_name_address(xxh32_state *state, char *name, unsigned long address) {
+    unsigned char bytes[WORD];
+    xxh32_update(state, (unsigned char*)name, strlen(name)+1);
+    bytes[0] = (unsigned char)address;
+    bytes[1] = (unsigned char)(address >> 8);
+    bytes[2] = (unsigned char)(address >> 16);
+    bytes[3] = (unsigned char)(address >> 24);
+    xxh32_update(state, bytes, WORD);
+}
+
+/******************************************************************************
+* Function : hash_output();
+*//**
+* \section Description: computes the hash of the output of the current source file (see \brief), and keeps it
+*                       in output_hash_value (the .ob file has it in its first line with --hash-header).
+*                       the images are read from the start (see spill.c), so it must not be used while
+*                       they are being read by a writer
+*
+* \return       the hash
+*******************************************************************************/
+unsigned long hash_output() {
+    xxh32_state state;
+    unsigned char bytes[WORD];
+    machine_word code_word;
+    data_image data_cell;
+    unsigned long i;
+    xxh32_reset(&state, 0);
+    start_images();
+    while(next_code_word(&code_word)) {
+        to_bytes(bytes, code_word, WORD);
+        xxh32_update(&state, bytes, WORD);
+    }
+    while(next_data_cell(&data_cell)) {
+        to_bytes(bytes, data_cell.machine_code, data_cell.bytes_taken);
+        xxh32_update(&state, bytes, data_cell.bytes_taken);
+    }
+    /*in the order of the files*/
+    if(options.ent_sorted)
+        sort_entry_list();
+    if(options.ext_grouped)
+        group_ext_list();
+    for(i = 0; i < entry_list_length; i++)
+        hash_name_address(&state, entry_list[i]->symbol.name, symbol_address(entry_list[i]));
+    for(i = 0; i < ext_list_length; i++)
+        hash_name_address(&state, external_list[i].label.name, external_list[i].address);
+    return output_hash_value = xxh32_digest(&state);
+}
+
+/******************************************************************************
+* Function : print_hash(char *file_name);
+*//**
+* \section Description: prints the hash of the output of a source file (--print-hash): 8 hex digits, a space and
+*                       the name of the source file without .as. it goes to the standard error with --stdout
+*
+* \param  		file_name - the name of the source file
+*******************************************************************************/
+void print_hash(char *file_name) {
+    fprintf(options.to_stdout ? stderr : stdout, "%08lx %.*s\n", output_hash_value, (int)strcspn(file_name, "."), file_name);
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Title                 :   Hex object files
+* Filename              :   hex_files.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file hex_files.c
+ * \brief This module writes the code and data images in the hex formats that programmers and loaders read,
+ * instead of the .ob file:
+ * 1. a .hex file (--format=ihex) - Intel HEX, with 32 bit addresses (extended linear address records)
+ * 2. a .srec file (--format=srec) - Motorola S-records, with the shortest addresses that fit the images
+ * the images are one range of memory: the code image at CODE_BASE, and the data image right after it (at ICF).
+ * they are read once, from the start (see spill.c), and put in records of at most 16 bytes. every record
+ * is formatted into a line with the hex_digits table (see mapped_files.c), and its checksum is summed
+ * while its bytes are added. the .ent and .ext files are still made as text (see output in files.c).
+ */
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "assembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define RECORD_BYTES    16 /*the most data bytes in a record*/
+#define RECORD_LINE_MAX (2*(RECORD_BYTES+8)+4) /*a record: start code, type, count, address, data, checksum, new line*/
+#define IHEX_DATA       0x00
+#define IHEX_EOF        0x01
+#define IHEX_EXTENDED   0x04 /*extended linear address: the upper 16 bits of the addresses after it*/
+#define IHEX_START      0x05 /*start linear address: where execution starts*/
+#define SREC_COUNT_MAX  0xFFFFUL /*the most data records an S5 record can count (an S6 record counts up to 0xFFFFFF)*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern arena file_arena;
+extern unsigned long ICF, DCF;
+extern const char hex_digits[];
+static FILE *hex_file;
+static int hex_format; /*FORMAT_IHEX or FORMAT_SREC*/
+static int srec_address_bytes; /*2, 3 or 4: the size of the addresses in the S-records (S1/S9, S2/S8 or S3/S7)*/
+static unsigned char record[RECORD_BYTES]; /*the data bytes of the next data record*/
+static int record_length = 0;
+static unsigned long record_address; /*the address of the first byte in the record*/
+static unsigned long upper_address; /*the upper 16 bits of the addresses, given by the last extended linear address record*/
+static unsigned long data_records; /*number of data records written (the S5/S6 record counts them)*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : put_hex(char *dest, unsigned long x, int bytes, unsigned *sum);
+*//**
+* \section Description: writes a number as hex digits, the most significant byte first,
+*                       and adds each of its bytes to a checksum
+*
+* \param  		dest - where the digits are written (no null character is added)
+* \param        x - the number
+* \param        bytes - number of bytes of the number to write (2 digits each)
+* \param        sum - the checksum of the record
+* \return       the number of characters written
+*******************************************************************************/
+int put_hex(char *dest, unsigned long x, int bytes, unsigned *sum) {
+    int i;
+    unsigned byte;
+    for(i = 0; i < bytes; i++) {
+        byte = (unsigned)(x >> (8*(bytes-1-i))) & 0xFF;
+        dest[2*i] = hex_digits[byte >> 4];
+        dest[2*i+1] = hex_digits[byte & 0xF];
+        *sum += byte;
+    }
+    return 2*bytes;
+}
+
+/******************************************************************************
+* Function : put_record(int type, unsigned long address, unsigned char *bytes, int length);
+*//**
+* \section Description: writes one record to the hex file, with its checksum
+*
+* \param  		type - the type of the record (for S-records, the digit after the 'S')
+* \param        address - the address field of the record (16 bits in Intel HEX. srec_address_bytes in S-records,
+*                         except for S0 and S5 records, which have 16 bits, and S6, which has 24)
+* \param        bytes - the data of the record
+* \param        length - the number of data bytes
+*******************************************************************************/
+void put_record(int type, unsigned long address, unsigned char *bytes, int length) {
+    char line[RECORD_LINE_MAX], *end = line;
+    unsigned sum = 0, unused = 0;
+    int i, address_bytes;
+    if(hex_format == FORMAT_IHEX) {
+        /*:LLAAAATT<data>CC - the checksum makes the sum of all the bytes 0*/
+        *end++ = ':';
+        end += put_hex(end, (unsigned long)length, 1, &sum);
+        end += put_hex(end, address & 0xFFFF, 2, &sum);
+        end += put_hex(end, (unsigned long)type, 1, &sum);
+        for(i = 0; i < length; i++)
+            end += put_hex(end, bytes[i], 1, &sum);
+        end += put_hex(end, (0x100 - (sum & 0xFF)) & 0xFF, 1, &unused);
+    } else {
+        /*StLLAA..<data>CC - the count includes the address and the checksum, which is the ones' complement of the sum*/
+        if(type == 0 || type == 5)
+            address_bytes = 2;
+        else if(type == 6)
+            address_bytes = 3;
+        else address_bytes = srec_address_bytes;
+        *end++ = 'S';
+        *end++ = (char)('0' + type);
+        end += put_hex(end, (unsigned long)(address_bytes + length + 1), 1, &sum);
+        end += put_hex(end, address, address_bytes, &sum);
+        for(i = 0; i < length; i++)
+            end += put_hex(end, bytes[i], 1, &sum);
+        end += put_hex(end, ~sum & 0xFF, 1, &unused);
+    }
+    *end++ = '\n';
+    fwrite(line, 1, end-line, hex_file);
+}
+
+/******************************************************************************
+* Function : flush_record();
+*//**
+* \section Description: writes the data record that was collected, if it has any bytes
+*******************************************************************************/
+void flush_record() {
+    unsigned char upper[2];
+    if(record_length == 0)
+        return;
+    if(hex_format == FORMAT_IHEX) {
+        if((record_address >> 16) != upper_address) {
+            upper_address = record_address >> 16;
+            upper[0] = (unsigned char)(upper_address >> 8);
+            upper[1] = (unsigned char)upper_address;
+            put_record(IHEX_EXTENDED, 0, upper, 2);
+        }
+        put_record(IHEX_DATA, record_address, record, record_length);
+    } else {
+        put_record(srec_address_bytes - 1, record_address, record, record_length);
+    }
+    data_records++;
+    record_address += record_length;
+    record_length = 0;
+}
+
+/******************************************************************************
+* Function : add_bytes(unsigned char *bytes, int length);
+*//**
+* \section Description: adds bytes of the images to the data records. a record ends when it is full,
+*                       and in Intel HEX also where the upper 16 bits of the address change
+*
+* \param  		bytes - the bytes
+* \param        length - the number of bytes
+*******************************************************************************/
+void add_bytes(unsigned char *bytes, int length) {
+    int i;
+    for(i = 0; i < length; i++) {
+        record[record_length++] = bytes[i];
+        if(record_length == RECORD_BYTES
+           || (hex_format == FORMAT_IHEX && ((record_address + record_length) & 0xFFFF) == 0))
+            flush_record();
+    }
+}
+
+/******************************************************************************
+* Function : write_hex_file(char *file_name);
+*//**
+* \section Description: writes the object file in the format chosen with --format (see \brief)
+*
+* \param  		file_name - the name of the source file (without .as)
+* \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+* \note         a .hex file has an extended linear address record before the first data record, and before
+*               every record whose address has other upper 16 bits. after the data records comes a start
+*               linear address record with CODE_BASE, and an end of file record.
+*               a .srec file starts with an S0 record with the name of the source file. the data records are
+*               S1, S2 or S3, by the size of the last address. after them comes an S5 (or S6) record with the
+*               number of data records, and an S9, S8 or S7 record with CODE_BASE as the start address.
+*******************************************************************************/
+int write_hex_file(char *file_name) {
+    char *hex_fname;
+    unsigned char bytes[WORD];
+    unsigned long end_address = ICF + DCF;
+    machine_word code_word;
+    data_image data_cell;
+    int err;
+
+    hex_format = options.format;
+    if(end_address > 0xFFFFFFFFUL) {
+        fprintf(stderr,"error: the images are too big for a hex file [%s]\n",file_name);
+        return STATUS_ERR;
+    }
+    hex_fname = output_file_name(file_name, (hex_format == FORMAT_IHEX) ? "hex" : "srec", &file_arena);
+    if((hex_file = fopen(hex_fname,"w")) == NULL) {
+        fprintf(stderr,"error: cannot make output file [%s]",hex_fname);
+        return STATUS_ERR;
+    }
+    if(end_address <= 0x10000UL)
+        srec_address_bytes = 2;
+    else if(end_address <= 0x1000000UL)
+        srec_address_bytes = 3;
+    else srec_address_bytes = 4;
+    if(hex_format == FORMAT_SREC)
+        put_record(0, 0, (unsigned char*)file_name, (strlen(file_name) > RECORD_BYTES) ? RECORD_BYTES : (int)strlen(file_name));
+    record_length = 0;
+    record_address = CODE_BASE;
+    upper_address = (unsigned long)-1; /*so the first data record gets an extended linear address record*/
+    data_records = 0;
+    /*code and data images (some of them may be in temporary files, see spill.c)*/
+    start_images();
+    while(next_code_word(&code_word)) {
+        to_bytes(bytes, code_word, WORD);
+        add_bytes(bytes, WORD);
+    }
+    while(next_data_cell(&data_cell)) {
+        to_bytes(bytes, data_cell.machine_code, data_cell.bytes_taken);
+        add_bytes(bytes, data_cell.bytes_taken);
+    }
+    flush_record();
+    if(hex_format == FORMAT_IHEX) {
+        bytes[0] = (unsigned char)(CODE_BASE >> 24);
+        bytes[1] = (unsigned char)(CODE_BASE >> 16);
+        bytes[2] = (unsigned char)(CODE_BASE >> 8);
+        bytes[3] = (unsigned char)CODE_BASE;
+        put_record(IHEX_START, 0, bytes, WORD);
+        put_record(IHEX_EOF, 0, bytes, 0);
+    } else {
+        put_record((data_records <= SREC_COUNT_MAX) ? 5 : 6, data_records, bytes, 0);
+        put_record(11 - srec_address_bytes, CODE_BASE, bytes, 0); /*S9, S8 or S7*/
+    }
+    err = ferror(hex_file);
+    if(fclose(hex_file) != 0 || err) {
+        fprintf(stderr,"error: cannot write output file [%s]",hex_fname);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
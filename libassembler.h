@@ -0,0 +1,87 @@
+/****************************************************************************
+* Title                 :   Header File for the Assembler Library
+* Filename              :   libassembler.h
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*****************************************************************************/
+/** \file libassembler.h
+ *  \brief This is the header file of the assembler library (libassembler.a, libassembler.so).
+ *
+ *  The library assembles a source file that is in memory, into memory: the code and data images, the entry points,
+ *  the uses of external labels and the errors, with no files read or written (see library.c).
+ *  asm_assemble_stream gives the same output to callbacks, record by record, as soon as each one is final.
+ *  This is the only header a program that uses the library needs (assembler.h is the header of the assembler itself).
+ */
+#ifndef LIBASSEMBLER_H
+#define LIBASSEMBLER_H
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stddef.h>
+/******************************************************************************
+* Constants
+*******************************************************************************/
+/* return status of asm_assemble (the same as the assembler's) */
+#define ASM_STATUS_OK   0
+#define ASM_STATUS_ERR  1
+
+/* flags of asm_assemble: the options that change the output (like --ent-sorted and --ext-grouped) */
+#define ASM_ENT_SORTED  0x1 /*the entry points are sorted by address instead of the order of the .entry directives*/
+#define ASM_EXT_GROUPED 0x2 /*the uses of external labels are sorted by label, then by address*/
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+/*an entry point, or a use of an external label*/
+typedef struct asm_symbol {
+    char *name;
+    unsigned long address;
+}asm_symbol;
+
+/*an error in the source*/
+typedef struct asm_diagnostic {
+    unsigned long line; /*the number of the line of the error (from 1). 0 if the error is not in one line*/
+    char *message; /*for example: "error: label used as operand does not exist"*/
+}asm_diagnostic;
+
+/*the output of asm_assemble. all of it is in one block of memory, given back with asm_free_result.
+ *if there is an error, there is no output: only the diagnostics*/
+typedef struct asm_result {
+    int status; /*ASM_STATUS_OK or ASM_STATUS_ERR*/
+    unsigned long code_address; /*the address of the first byte of the code image (100)*/
+    unsigned char *code; /*the code image: 4 bytes for each order, little endian (like the .ob file)*/
+    unsigned long code_size;
+    unsigned long data_address; /*the address of the first byte of the data image (right after the code image)*/
+    unsigned char *data; /*the data image*/
+    unsigned long data_size;
+    asm_symbol *entries; /*in the order of the .ent file*/
+    unsigned long entry_count;
+    asm_symbol *externals; /*in the order of the .ext file*/
+    unsigned long external_count;
+    asm_diagnostic *diagnostics; /*in the order they were found*/
+    unsigned long diagnostic_count;
+    void *memory; /*the block that has all of the above*/
+}asm_result;
+
+/*the callbacks of asm_assemble_stream. each record is given as soon as it is final (see library.c),
+ *with the context given in the structure. any of them can be NULL, but the structure must be given
+ *(asm_assemble_stream returns ASM_STATUS_ERR for NULL)*/
+typedef struct asm_callbacks {
+    void *context;
+    void (*on_code_word)(void *context, unsigned long address, unsigned long word); /*an order (4 bytes)*/
+    void (*on_data_bytes)(void *context, unsigned long address, const unsigned char *bytes, unsigned long length); /*a part of the data image*/
+    void (*on_entry)(void *context, const char *name, unsigned long address); /*an entry point*/
+    void (*on_external)(void *context, const char *name, unsigned long address); /*a use of an external label*/
+    void (*on_diagnostic)(void *context, unsigned long line, const char *message); /*an error (line 0: not in one line)*/
+}asm_callbacks;
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+int asm_assemble(const char *source, size_t length, unsigned flags, asm_result *result);
+void asm_free_result(asm_result *result);
+int asm_assemble_stream(const char *source, size_t length, unsigned flags, const asm_callbacks *callbacks);
+void asm_release();
+
+#endif
+/*** End of File **************************************************************/
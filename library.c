@@ -0,0 +1,502 @@
+/*******************************************************************************
+* Title                 :   Assembler library
+* Filename              :   library.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file library.c
+ * \brief This module is the assembler library (libassembler.a, libassembler.so, see libassembler.h):
+ * a program (for example a test harness that assembles many small snippets) calls asm_assemble with a source
+ * file that is in its memory, and gets its output in memory, with no process started and no file read or written.
+ * 1. the source is read by the two passes as usual, from a stream on its buffer (see open_source)
+ * 2. the errors are printed to a stream on a buffer instead of the standard error (see diag_file in line_analysis.c),
+ *    and each line of it is made into a diagnostic: the message, and the line number from "[source | N]"
+ * 3. the images and the lists are copied into one block of memory, which the caller gives back with asm_free_result
+ * asm_assemble_stream gives the same output to callbacks instead (see asm_callbacks in libassembler.h), each record
+ * as soon as it is final, so a program (a simulator, a linker) does not wait for the whole result:
+ * 1. the data image, after the 1st pass (its addresses start at ICF, which is known only then), in chunks
+ * 2. every order, in the 2nd pass, right after its line (the same point --stream writes it at, see stream_code in files.c)
+ * 3. the entry points and the uses of external labels, in the 2nd pass, after the line that adds them. with
+ *    ASM_ENT_SORTED or ASM_EXT_GROUPED they are sorted, so they come after the 2nd pass
+ * 4. every error, when the line it is in is reported (see pass_one_error)
+ * the records of a source file with errors are not all given (nothing after the first error in the 2nd pass),
+ * and the status says so: they should not be used.
+ * the memory of the assembler is kept from one call to the next (see memory_mgmt.c), until asm_release.
+ * the assembler keeps its state in global variables, so asm_assemble cannot be called by two threads at a time.
+ * an error the assembler cannot go on from (no memory left) does not end the program: the call returns
+ * ASM_STATUS_ERR (see fatal_stop in memory_mgmt.c), and the memory of the assembler is given back.
+ * only the asm_ functions are exported from libassembler.so (see libassembler.map), and the objects of
+ * libassembler.a are linked into one, with only them global (see the makefile).
+ */
+/*fmemopen and open_memstream are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200809L
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assembler.h"
+#include "libassembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define LIBRARY_SOURCE_NAME "source" /*the name of the source file in the errors (see pass_one_error)*/
+#define DATA_CHUNK          256 /*the data image is given to on_data_bytes this many bytes at a time*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern FILE *diag_file;
+extern unsigned long ICF, DCF;
+extern symbol_node **entry_list;
+extern unsigned long entry_list_length;
+extern ext_node *external_list;
+extern unsigned long ext_list_length;
+extern arena line_arena;
+extern int err2;
+extern jmp_buf *fatal_jump;
+static FILE *source_stream = NULL; /*the stream on the source while a pass reads it (closed after a fatal error)*/
+static const char *memory_source = NULL; /*the source given to asm_assemble (NULL when the source is a file)*/
+static size_t memory_source_size = 0;
+static boolean library_ready = FALSE; /*the memory of the assembler was allocated (see mem_allocate)*/
+static char *diag_text = NULL; /*the errors printed to diag_file, while a source is assembled*/
+static size_t diag_size = 0;
+static const asm_callbacks *callbacks = NULL; /*the callbacks of asm_assemble_stream (NULL otherwise)*/
+static size_t diag_reported; /*the length of the errors given to on_diagnostic*/
+static unsigned long code_reported, entries_reported, externals_reported; /*the records given to the callbacks*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : open_source(char *file_name);
+*//**
+* \section Description: opens the source file for a pass. in asm_assemble, it is a stream on the source
+*                       given to it, and the file name is not used
+*
+* \param  		file_name - the name of the source file
+* \return       the stream. NULL if it cannot be opened
+*******************************************************************************/
+FILE *open_source(char *file_name) {
+    static char empty_source[] = "\n";
+    if(memory_source == NULL)
+        return fopen(file_name,"r");
+    if(memory_source_size == 0) /*fmemopen may not take an empty buffer, and an empty line is the same as nothing*/
+        source_stream = fmemopen(empty_source, 1, "r");
+    else source_stream = fmemopen((void*)memory_source, memory_source_size, "r");
+    return source_stream;
+}
+
+/******************************************************************************
+* Function : close_source(FILE *fp);
+*//**
+* \section Description: closes the source file after a pass
+*
+* \param  		fp - the stream given by open_source
+*******************************************************************************/
+void close_source(FILE *fp) {
+    if(fp == source_stream)
+        source_stream = NULL;
+    fclose(fp);
+}
+
+/******************************************************************************
+* Function : parse_diagnostic(char *text, asm_diagnostic *diagnostic);
+*//**
+* \section Description: makes one line of the errors into a diagnostic. the line number is taken from its end
+*                       ("[source | N]", see pass_one_error), and the message is the rest of it
+*
+* \param  		text - the line (without '\n'). it is changed: the message ends where the line number starts
+* \param        diagnostic - the diagnostic
+*******************************************************************************/
+void parse_diagnostic(char *text, asm_diagnostic *diagnostic) {
+    char *end = strrchr(text, '[');
+    unsigned long line;
+    int used = 0;
+    diagnostic->line = 0;
+    if(end != NULL && sscanf(end, "[" LIBRARY_SOURCE_NAME " | %lu]%n", &line, &used) == 1 && end[used] == '\0') {
+        diagnostic->line = line;
+        *end = '\0';
+    } else end = text + strlen(text);
+    while(end > text && (end[-1] == ' ' || end[-1] == '\t'))
+        *--end = '\0';
+    diagnostic->message = text;
+}
+
+/******************************************************************************
+* Function : copy_symbols(asm_symbol *dest, char **strings, int entries);
+*//**
+* \section Description: copies the entry list or the external label list to the result
+*
+* \param  		dest - the symbols of the result
+* \param        strings - where the names are copied (moved past them)
+* \param        entries - TRUE for the entry list, FALSE for the external label list
+*******************************************************************************/
+void copy_symbols(asm_symbol *dest, char **strings, int entries) {
+    unsigned long i, length = entries ? entry_list_length : ext_list_length;
+    char *name;
+    for(i = 0; i < length; i++) {
+        name = entries ? entry_list[i]->symbol.name : external_list[i].label.name;
+        dest[i].name = strcpy(*strings, name);
+        dest[i].address = entries ? symbol_address(entry_list[i]) : external_list[i].address;
+        *strings += strlen(name) + 1;
+    }
+}
+
+/******************************************************************************
+* Function : make_result(int err, char *diag_text, size_t diag_size, asm_result *result);
+*//**
+* \section Description: copies the output of the source (if it has no errors) and its diagnostics to the result,
+*                       in one block of memory (see \brief). the symbols and the diagnostics are first in it,
+*                       so they are aligned, and the bytes and the names come after them
+*
+* \param  		err - STATUS_OK if no error was found
+* \param        diag_text - the errors, as printed
+* \param        diag_size - the length of the errors
+* \param        result - the result
+*******************************************************************************/
+void make_result(int err, char *diag_text, size_t diag_size, asm_result *result) {
+    unsigned long i, lines = 0, strings_size = diag_size + 1;
+    char *strings, *p, *next;
+    unsigned char *bytes;
+    machine_word code_word;
+    data_image data_cell;
+
+    result->status = err;
+    result->code_address = CODE_BASE;
+    if(err == STATUS_OK) {
+        if(options.ent_sorted)
+            sort_entry_list();
+        if(options.ext_grouped)
+            group_ext_list();
+        result->code_size = ICF - CODE_BASE;
+        result->data_address = ICF;
+        result->data_size = DCF;
+        result->entry_count = entry_list_length;
+        result->external_count = ext_list_length;
+        for(i = 0; i < entry_list_length; i++)
+            strings_size += strlen(entry_list[i]->symbol.name) + 1;
+        for(i = 0; i < ext_list_length; i++)
+            strings_size += strlen(external_list[i].label.name) + 1;
+    }
+    for(p = diag_text; p < diag_text + diag_size; p++)
+        if(*p == '\n')
+            lines++;
+    if(diag_size > 0 && diag_text[diag_size-1] != '\n')
+        lines++;
+    result->memory = malloc((result->entry_count + result->external_count) * sizeof(asm_symbol)
+                            + lines * sizeof(asm_diagnostic) + result->code_size + result->data_size + strings_size);
+    alloc_check(result->memory);
+    result->entries = (asm_symbol*) result->memory;
+    result->externals = result->entries + result->entry_count;
+    result->diagnostics = (asm_diagnostic*) (result->externals + result->external_count);
+    result->code = (unsigned char*) (result->diagnostics + lines);
+    result->data = result->code + result->code_size;
+    strings = (char*) (result->data + result->data_size);
+
+    if(err == STATUS_OK) {
+        /*code and data images (some of them may be in temporary files, see spill.c)*/
+        bytes = result->code;
+        start_images();
+        while(next_code_word(&code_word)) {
+            to_bytes(bytes, code_word, WORD);
+            bytes += WORD;
+        }
+        while(next_data_cell(&data_cell)) {
+            to_bytes(bytes, data_cell.machine_code, data_cell.bytes_taken);
+            bytes += data_cell.bytes_taken;
+        }
+        copy_symbols(result->entries, &strings, TRUE);
+        copy_symbols(result->externals, &strings, FALSE);
+    }
+    /*one diagnostic for each line of the errors (the empty ones are skipped)*/
+    if(diag_size > 0)
+        memcpy(strings, diag_text, diag_size);
+    strings[diag_size] = '\0';
+    for(p = strings; *p != '\0'; p = next) {
+        if((next = strchr(p, '\n')) != NULL)
+            *next++ = '\0';
+        else next = p + strlen(p);
+        parse_diagnostic(p, &result->diagnostics[result->diagnostic_count]);
+        if(*result->diagnostics[result->diagnostic_count].message != '\0' || result->diagnostics[result->diagnostic_count].line != 0)
+            result->diagnostic_count++;
+    }
+}
+
+/******************************************************************************
+* Function : start_source(const char *source, size_t length, unsigned flags, jmp_buf *on_fatal);
+*//**
+* \section Description: gets the assembler ready for a source in memory: the buffer of the errors, its memory,
+*                       its options and the tables
+*
+* \param  		source - the source
+* \param        length - the length of the source
+* \param        flags - ASM_ENT_SORTED, ASM_EXT_GROUPED (see libassembler.h)
+* \param        on_fatal - where a fatal error goes back to from here on (see fatal_stop in memory_mgmt.c)
+* \return       STATUS_OK if it is ready. otherwise: STATUS_ERR
+*******************************************************************************/
+int start_source(const char *source, size_t length, unsigned flags, jmp_buf *on_fatal) {
+    diag_text = NULL;
+    diag_size = 0;
+    if((diag_file = open_memstream(&diag_text, &diag_size)) == NULL) {
+        diag_file = stderr;
+        return STATUS_ERR;
+    }
+    fatal_jump = on_fatal;
+    if(!library_ready) {
+        mem_allocate(); /*the memory is kept from one call to the next (see memory_mgmt.c)*/
+        library_ready = TRUE;
+    }
+    memset(&options, 0, sizeof(asm_options));
+    options.ent_sorted = (flags & ASM_ENT_SORTED) != 0;
+    options.ext_grouped = (flags & ASM_EXT_GROUPED) != 0;
+    memory_source = source;
+    memory_source_size = length;
+    initialize_tables();
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : end_source(int fatal);
+*//**
+* \section Description: the source in memory was assembled: the errors go to the standard error again,
+*                       and the memory of the source is freed, for the next one (see mem_deallocate).
+*                       after a fatal error, the stream of a pass is closed too, and all of the memory is given back
+*
+* \param  		fatal - TRUE after a fatal error (see fatal_stop in memory_mgmt.c)
+*******************************************************************************/
+void end_source(int fatal) {
+    fatal_jump = NULL;
+    callbacks = NULL;
+    memory_source = NULL;
+    fclose(diag_file);
+    diag_file = stderr;
+    free(diag_text);
+    diag_text = NULL;
+    if(fatal) {
+        if(source_stream != NULL)
+            fclose(source_stream);
+        source_stream = NULL;
+        mem_release();
+        library_ready = FALSE;
+    } else mem_deallocate();
+}
+
+/******************************************************************************
+* Function : asm_assemble(const char *source, size_t length, unsigned flags, asm_result *result);
+*//**
+* \section Description: assembles a source file that is in memory, into memory (see \brief)
+*
+* \param  		source - the source (it does not have to end with a null character)
+* \param        length - the length of the source
+* \param        flags - ASM_ENT_SORTED, ASM_EXT_GROUPED (see libassembler.h)
+* \param        result - the output and the diagnostics are put here. it must be given to asm_free_result after
+* \return       ASM_STATUS_OK if no error was found. otherwise: ASM_STATUS_ERR
+*******************************************************************************/
+int asm_assemble(const char *source, size_t length, unsigned flags, asm_result *result) {
+    char name[] = LIBRARY_SOURCE_NAME;
+    jmp_buf on_fatal;
+    int err;
+
+    memset(result, 0, sizeof(asm_result));
+    if(setjmp(on_fatal) != 0) { /*no memory left: there is no output*/
+        end_source(TRUE);
+        free(result->memory);
+        memset(result, 0, sizeof(asm_result));
+        result->status = STATUS_ERR;
+        return STATUS_ERR;
+    }
+    if(start_source(source, length, flags, &on_fatal) == STATUS_ERR) {
+        result->status = STATUS_ERR;
+        return STATUS_ERR;
+    }
+    err = pass_one(name);
+    if(err == STATUS_OK)
+        err = pass_two(name);
+    fflush(diag_file); /*diag_text has all the errors now*/
+    make_result(err, diag_text, diag_size, result);
+    end_source(FALSE);
+    return err;
+}
+
+/******************************************************************************
+* Function : report_diagnostics(int all);
+*//**
+* \section Description: gives the errors printed since the last ones given to on_diagnostic, one line each
+*
+* \param  		all - TRUE to give the last line too, if it has no '\n' (at the end of the source)
+*******************************************************************************/
+void report_diagnostics(int all) {
+    asm_diagnostic diagnostic;
+    char *text, *p, *next;
+    size_t length;
+    fflush(diag_file);
+    length = diag_size - diag_reported;
+    if(!all) /*only whole lines*/
+        while(length > 0 && diag_text[diag_reported + length - 1] != '\n')
+            length--;
+    if(length == 0)
+        return;
+    /*a copy, because parse_diagnostic changes it*/
+    text = (char*) arena_alloc(&line_arena, length + 1);
+    memcpy(text, diag_text + diag_reported, length);
+    text[length] = '\0';
+    diag_reported += length;
+    for(p = text; *p != '\0'; p = next) {
+        if((next = strchr(p, '\n')) != NULL)
+            *next++ = '\0';
+        else next = p + strlen(p);
+        parse_diagnostic(p, &diagnostic);
+        if(*diagnostic.message != '\0' || diagnostic.line != 0)
+            callbacks->on_diagnostic(callbacks->context, diagnostic.line, diagnostic.message);
+    }
+}
+
+/******************************************************************************
+* Function : callback_error();
+*//**
+* \section Description: used by pass_one_error and pass_two_error, after an error in a line is printed:
+*                       in asm_assemble_stream, it is given to on_diagnostic right away
+*******************************************************************************/
+void callback_error() {
+    if(callbacks != NULL && callbacks->on_diagnostic != NULL)
+        report_diagnostics(FALSE);
+}
+
+/******************************************************************************
+* Function : report_data();
+*//**
+* \section Description: gives the data image to on_data_bytes, DATA_CHUNK bytes at a time (see \brief)
+*******************************************************************************/
+void report_data() {
+    unsigned char chunk[DATA_CHUNK];
+    unsigned long address = ICF;
+    data_image data_cell;
+    int n = 0;
+    start_images();
+    while(next_data_cell(&data_cell)) {
+        if(n + data_cell.bytes_taken > DATA_CHUNK) {
+            callbacks->on_data_bytes(callbacks->context, address, chunk, n);
+            address += n;
+            n = 0;
+        }
+        to_bytes(chunk + n, data_cell.machine_code, data_cell.bytes_taken);
+        n += data_cell.bytes_taken;
+    }
+    if(n > 0)
+        callbacks->on_data_bytes(callbacks->context, address, chunk, n);
+}
+
+/******************************************************************************
+* Function : report_lists(int sorted);
+*//**
+* \section Description: gives the entry points and the uses of external labels that were added since the last
+*                       ones given to on_entry and on_external
+*
+* \param  		sorted - TRUE after the 2nd pass, when the lists are sorted (with ASM_ENT_SORTED, ASM_EXT_GROUPED):
+*                        only then a sorted list is given
+*******************************************************************************/
+void report_lists(int sorted) {
+    for(; (sorted || !options.ent_sorted) && entries_reported < entry_list_length; entries_reported++)
+        if(callbacks->on_entry != NULL)
+            callbacks->on_entry(callbacks->context, entry_list[entries_reported]->symbol.name,
+                                symbol_address(entry_list[entries_reported]));
+    for(; (sorted || !options.ext_grouped) && externals_reported < ext_list_length; externals_reported++)
+        if(callbacks->on_external != NULL)
+            callbacks->on_external(callbacks->context, external_list[externals_reported].label.name,
+                                   external_list[externals_reported].address);
+}
+
+/******************************************************************************
+* Function : callback_records(unsigned long final);
+*//**
+* \section Description: used by pass_two after every line: in asm_assemble_stream, the orders, entry points
+*                       and uses of external labels that became final on the line are given to the callbacks
+*                       (see \brief). nothing is given after an error
+*
+* \param  		final - the number of orders that are final (the 2nd pass is past them)
+*******************************************************************************/
+void callback_records(unsigned long final) {
+    if(callbacks == NULL || err2 == STATUS_ERR)
+        return;
+    for(; code_reported < final; code_reported++)
+        if(callbacks->on_code_word != NULL)
+            callbacks->on_code_word(callbacks->context, CODE_BASE + code_reported*WORD, get_code_word(code_reported));
+    report_lists(FALSE);
+}
+
+/******************************************************************************
+* Function : asm_assemble_stream(const char *source, size_t length, unsigned flags, const asm_callbacks *handlers);
+*//**
+* \section Description: assembles a source file that is in memory, and gives its output and its errors to
+*                       callbacks, as soon as they are final (see \brief)
+*
+* \param  		source - the source (it does not have to end with a null character)
+* \param        length - the length of the source
+* \param        flags - ASM_ENT_SORTED, ASM_EXT_GROUPED (see libassembler.h)
+* \param        handlers - the callbacks (any of them can be NULL, but not the structure itself)
+* \return       ASM_STATUS_OK if no error was found. otherwise (or if handlers is NULL): ASM_STATUS_ERR
+*******************************************************************************/
+int asm_assemble_stream(const char *source, size_t length, unsigned flags, const asm_callbacks *handlers) {
+    char name[] = LIBRARY_SOURCE_NAME;
+    jmp_buf on_fatal;
+    int err;
+
+    if(handlers == NULL)
+        return STATUS_ERR;
+    if(setjmp(on_fatal) != 0) { /*no memory left: the records given so far should not be used*/
+        end_source(TRUE);
+        return STATUS_ERR;
+    }
+    if(start_source(source, length, flags, &on_fatal) == STATUS_ERR)
+        return STATUS_ERR;
+    callbacks = handlers;
+    diag_reported = 0;
+    code_reported = entries_reported = externals_reported = 0;
+    err = pass_one(name);
+    if(err == STATUS_OK) {
+        if(callbacks->on_data_bytes != NULL)
+            report_data();
+        err = pass_two(name);
+    }
+    if(err == STATUS_OK) {
+        if(options.ent_sorted)
+            sort_entry_list();
+        if(options.ext_grouped)
+            group_ext_list();
+        report_lists(TRUE);
+    }
+    /*the errors that are not in a line*/
+    if(callbacks->on_diagnostic != NULL)
+        report_diagnostics(TRUE);
+    end_source(FALSE);
+    return err;
+}
+
+/******************************************************************************
+* Function : asm_free_result(asm_result *result);
+*//**
+* \section Description: gives back the memory of a result of asm_assemble
+*******************************************************************************/
+void asm_free_result(asm_result *result) {
+    free(result->memory);
+    memset(result, 0, sizeof(asm_result));
+}
+
+/******************************************************************************
+* Function : asm_release();
+*//**
+* \section Description: gives all the memory of the assembler back to the system (see mem_release).
+*                       asm_assemble can still be used after it, and allocates the memory again
+*******************************************************************************/
+void asm_release() {
+    if(library_ready)
+        mem_release();
+    library_ready = FALSE;
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -16,6 +16,11 @@
 #include <stdlib.h>
 #include "assembler.h"
 /******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern arena line_arena;
+FILE *diag_file; /*where the errors in the source file are printed: the standard error, or a buffer (see library.c)*/
+/******************************************************************************
 * Function Definitions
 *******************************************************************************/
 /******************************************************************************
@@ -33,7 +38,7 @@
 int length_check(char *line) {
     /*subtracting the newline character from the character count, then checking if there are characters in the line than the maximum allowed*/
     if(strlen(line)-1 > MAX_LINE) {
-        fprintf(stderr,"error: line length above maximum (80 characters) ");
+        fprintf(diag_file,"error: line length above maximum (80 characters) ");
         return FALSE;
     }
     /*there are 80 or fewer characters in this line -> no error*/
@@ -150,8 +155,7 @@ int meaningless(char *line) {
 int start_label(char *line) {
     int i = 0;
     char *word;
-    word = (char*) malloc (sizeof(char) * MAX_LINE+1);
-    alloc_check(word);
+    word = (char*) arena_alloc(&line_arena, MAX_LINE+1);
     /*scanning the 1st field into word*/
     while(!isspace((int)line[i])) {
         word[i] = line[i];
@@ -159,16 +163,13 @@ int start_label(char *line) {
     }
     word[i] = '\0';
     if(word[i-1] != ':') {
-        free(word);
         return FALSE;
     }
     strtok(word,":");
     /*checking if the string before ':' is a valid label*/
     if(!is_label(word,FALSE)) {
-        free(word);
         return FALSE;
     }
-    free(word);
     return TRUE;
 }
 
@@ -193,20 +194,20 @@ int is_label(char *line, int err) {
     int i = 0;
     if(!isalpha((int)ptr[0])) {
         if(err == TRUE)
-            fprintf(stderr, "error: a label should start with a letter ");
+            fprintf(diag_file, "error: a label should start with a letter ");
         return FALSE;
     }
 
     while(!isspace((int)ptr[i]) && ptr[i] != '\0' && !endline(ptr[i])) {
         if(!isalnum((int)ptr[i]) && !endline(ptr[i])) {
             if(err == TRUE)
-                fprintf(stderr,"error: label contains illegal characters. a proper label should contain only alphanumeric characters ");
+                fprintf(diag_file,"error: label contains illegal characters. a proper label should contain only alphanumeric characters ");
             return FALSE;
         }
         i++;
     }
     if(i>MAX_LABEL) {
-        fprintf(stderr,"error: label length above 31 characters ");
+        fprintf(diag_file,"error: label length above 31 characters ");
         return FALSE;
     }
     return TRUE;
@@ -243,8 +244,7 @@ void scan_label (char *line, char *label) {
 int is_data(char *line) {
     int i = 0;
     int ret_val = FALSE;
-    char *word = (char*) malloc(sizeof(char) * (MAX_LINE+1));
-    alloc_check(word);
+    char *word = (char*) arena_alloc(&line_arena, MAX_LINE+1);
     while(!isspace((int)line[i])) {
         word[i] = line[i];
         i++;
@@ -258,7 +258,6 @@ int is_data(char *line) {
         ret_val = ASCIZ;
     if(strcmp(word,".dw")==0)
         ret_val = DW;
-    free(word);
     return ret_val;
 }
 
@@ -274,8 +273,7 @@ int is_data(char *line) {
 int ent_ext(char *line) {
     int i = 0;
     int ret_val = 0;
-    char *word = (char*) malloc(sizeof(char) * (MAX_LINE+1));
-    alloc_check(word);
+    char *word = (char*) arena_alloc(&line_arena, MAX_LINE+1);
     while(!isspace((int)line[i])) {
         word[i] = line[i];
         i++;
@@ -285,7 +283,6 @@ int ent_ext(char *line) {
         ret_val = ENTRY;
     else if(strcmp(word,".extern") ==0)
         ret_val = EXTERN;
-    free(word);
     return ret_val;
 }
 
@@ -306,7 +303,7 @@ int check_ent_ext (char *line) {
     while(spaceln(*ptr))
         ptr++;
     if(empty(ptr)) {
-        fprintf(stderr,"error: this directive requires an operand ");
+        fprintf(diag_file,"error: this directive requires an operand ");
         return FALSE;
     }
     /*looking for label*/
@@ -319,7 +316,7 @@ int check_ent_ext (char *line) {
     if(empty(ptr))
         return TRUE;
     else {
-        fprintf(stderr,"error: too much operands for this directive ");
+        fprintf(diag_file,"error: too much operands for this directive ");
         return FALSE;
     }
 }
@@ -338,22 +335,22 @@ int check_immed(char *line) {
     char *ptr = line;
 
     if(intlen(ptr)==0) {/*does not point to a number*/
-        fprintf(stderr,"error: a number should be here ");
+        fprintf(diag_file,"error: a number should be here ");
         return FALSE;
     }
     value = atol(ptr);
     if(!in_lim(value,16)) {/*not in 16 bit limits*/
-        fprintf(stderr,"error: immed value should be in 16 bit limits ");
+        fprintf(diag_file,"error: immed value should be in 16 bit limits ");
         return FALSE;
     }
     ptr+=intlen(ptr);
     if(!spaceln(*ptr) && *ptr != ',') { /*operand is not just a number (for example "53x")*/
-        fprintf(stderr,"error: invalid operand (should be a number) ");
+        fprintf(diag_file,"error: invalid operand (should be a number) ");
         return FALSE;
     }
     while(spaceln(*ptr)) ptr++;
     if(*ptr != ',') { /*space separated "two parts" of the operand, which is not valid (for example the non-valid immed value requested "1 1")*/
-        fprintf(stderr,"error: invalid operand (should be a number) ");
+        fprintf(diag_file,"error: invalid operand (should be a number) ");
         return FALSE;
     }
     return TRUE;
@@ -400,7 +397,7 @@ int order_structure(char *line) {
     /*a comma separates every two operands, so for an order with x operands, there are supposed to be x-1 commas*/
     /*checking if there are not enough operands(checking the other way later*/
     if(num_commas(line) < (num_ops_expected(oc)-1)) {
-        fprintf(stderr,"error: not enough operands for this order ");
+        fprintf(diag_file,"error: not enough operands for this order ");
         return FALSE;
     }
     if(next_op(ptr,FALSE) == NON_VALID_OPERAND)
@@ -465,7 +462,7 @@ int order_structure(char *line) {
     if(oc==30) { /*jmp order. a register OR a label needed*/
         int result;
         if (is_label(ptr, FALSE) == FALSE && register_num(ptr, FALSE) == NOT_REG) {
-            fprintf(stderr,"error: this operand is not a label or a register ");
+            fprintf(diag_file,"error: this operand is not a label or a register ");
             return FALSE;
         }
         if (is_label(ptr, FALSE))
@@ -492,7 +489,7 @@ int order_structure(char *line) {
     if(empty(ptr))
         return TRUE;
     else {
-        fprintf(stderr,"error: too many operands ");
+        fprintf(diag_file,"error: too many operands ");
         return FALSE;
     }
 }
@@ -515,23 +512,23 @@ int register_num(char *line, int err) {
 
     if(*ptr != '$') {
         if(err == TRUE)
-            fprintf(stderr, "error: a register should be here (a register starts with a $, followed by an integer between 0 and 31) ");
+            fprintf(diag_file, "error: a register should be here (a register starts with a $, followed by an integer between 0 and 31) ");
         return NOT_REG;
     }
     if(!isdigit((int)*(++ptr))) { /*making sure things like "$+2" activate an error*/
         if(err == TRUE)
-            fprintf(stderr, "error: a register should be here (a register starts with a $, followed by an integer between 0 and 31) ");
+            fprintf(diag_file, "error: a register should be here (a register starts with a $, followed by an integer between 0 and 31) ");
         return NOT_REG;
     }
     reg = atoi(ptr);
     if(!(reg>=REG_MIN && reg<=REG_MAX)) { /*checking for reg limits (0 to 31)*/
         if(err == TRUE)
-            fprintf(stderr, "error: register number %d does not exist ",reg);
+            fprintf(diag_file, "error: register number %d does not exist ",reg);
         return NOT_REG;
     }
     ptr+=intlen(ptr);
     if(*ptr!=(char)0 && !spaceln(*ptr) && *ptr != ',' && !endline(*ptr)) { /*making sure things like "$2x" activate an error*/
-        fprintf(stderr,"error: invalid register. after the register number, there can only be a comma or a space character ");
+        fprintf(diag_file,"error: invalid register. after the register number, there can only be a comma or a space character ");
         return NOT_REG;
     }
     return reg;
@@ -572,8 +569,7 @@ void scan_op(char *line, char *op) {
 int next_op(char *line, int comma) {
     char *ptr = line;
     int distance = 0;
-    char *op = (char *)malloc(MAX_LINE+1);
-    alloc_check(op);
+    char *op = (char *)arena_alloc(&line_arena, MAX_LINE+1);
     scan_op(ptr, op); /*scanning this word to get the length*/
     ptr+=strlen(op); /*skipping this word*/
     distance+=strlen(op); /*adding the correct amount to the distance*/
@@ -582,12 +578,10 @@ int next_op(char *line, int comma) {
         distance++;
     }
     if(!comma) {
-        free(op); /*we have arrived at the next word (for non-comma uses we can return now)*/
-        return distance;
+        return distance; /*we have arrived at the next word (for non-comma uses we can return now)*/
     }
     if(*ptr!=',') {
-        fprintf(stderr,"error: a comma should separate operands ");
-        free(op);
+        fprintf(diag_file,"error: a comma should separate operands ");
         return NON_VALID_OPERAND;
     }
     /*skipping the comma*/
@@ -598,7 +592,6 @@ int next_op(char *line, int comma) {
         distance++;
     }
     /*we have arrived at the next operand (with separating comma)*/
-    free(op);
     return distance;
 }
 
@@ -620,12 +613,12 @@ int compatible_args(char *line) {
     d = is_data(ptr);
     ptr+= next_op(ptr,FALSE);
     if (empty(ptr)) {
-        fprintf(stderr,"error: no arguments in this directive line ");
+        fprintf(diag_file,"error: no arguments in this directive line ");
     }
     if(d == ASCIZ) { /*.asciz*/
         while(spaceln(*ptr)) ptr++;
         if(*ptr!='\"') {
-            fprintf(stderr,"error: .asciz directive should contain a string in double quotation marks ");
+            fprintf(diag_file,"error: .asciz directive should contain a string in double quotation marks ");
             return FALSE;
         }
         ptr++; /*skipping the opening '\"'*/
@@ -634,7 +627,7 @@ int compatible_args(char *line) {
         }
         if(*ptr == '\"')
             return TRUE;
-        fprintf(stderr,"error: no closing \" in .asciz directive ");
+        fprintf(diag_file,"error: no closing \" in .asciz directive ");
         return FALSE;
     }
 
@@ -652,11 +645,11 @@ int compatible_args(char *line) {
             directive_name = ".dw";
             break;
         default:
-            fprintf(stderr,"this should not happen [compatible_args switch]");
+            fprintf(diag_file,"this should not happen [compatible_args switch]");
             return FALSE;
     }
     if(intlen(ptr) == 0) {
-        fprintf(stderr,"error: (%s) only works with integers ",directive_name);
+        fprintf(diag_file,"error: (%s) only works with integers ",directive_name);
         return FALSE;
     }
     for(i=1; i < num_args; i++) {
@@ -664,7 +657,7 @@ int compatible_args(char *line) {
             return FALSE;
         ptr += next_op(ptr, TRUE);
         if(intlen(ptr) == 0) {
-            fprintf(stderr,"error: (%s) only works with integers ",directive_name);
+            fprintf(diag_file,"error: (%s) only works with integers ",directive_name);
             return FALSE;
         }
         if(intlen(ptr) == 0)
@@ -707,7 +700,7 @@ int get_num_args(char *line) {
     int num_args = 1;
     while(spaceln(*ptr)) ptr++;
     if(intlen(ptr) == 0) { /*eliminating things like ".db a,b,c"*/
-        fprintf(stderr,"error: arguments to this directive may only be integers ");
+        fprintf(diag_file,"error: arguments to this directive may only be integers ");
         return 0;
     }
     ptr+=intlen(ptr);
@@ -715,14 +708,14 @@ int get_num_args(char *line) {
         while (spaceln(*ptr)) /*skipping spaces before comma*/
             ptr++;
         if(*ptr != ',') { /*skipping*/
-            fprintf(stderr,"error: invalid argument ");
+            fprintf(diag_file,"error: invalid argument ");
             return 0;
         }
         ptr++;
         while(spaceln(*ptr)) /*skipping spaces after comma*/
             ptr++;
         if(intlen(ptr) == 0) { /*eliminating things like ".db a,b,c"*/
-            fprintf(stderr,"error: arguments to this directive may only be integers ");
+            fprintf(diag_file,"error: arguments to this directive may only be integers ");
             return 0;
         }
         ptr+=intlen(ptr); /*skipping this parameter*/
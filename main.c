@@ -13,14 +13,60 @@
 #include <stdio.h>
 #include "assembler.h"
 /******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern FILE *diag_file;
+/******************************************************************************
 * Function Definitions
 *******************************************************************************/
+/******************************************************************************
+* Function : assemble(char *curr_file)
+*//**
+* \section Description: translates one source file into machine code, and makes its output files.
+*                       the memory of the file is freed after it, for the next one (see mem_deallocate)
+*
+* \param  		curr_file - the name of the source file (it is changed: see output in files.c)
+*
+* \return 		STATUS_OK if no error was found. otherwise: STATUS_ERR
+*
+*******************************************************************************/
+int assemble(char *curr_file) {
+    int err;
+    if (filename(curr_file) == NULL)
+        return STATUS_ERR;
+    /*a source file that was assembled before is taken from the cache (see cache.c)*/
+    if(options.cache_dir != NULL && (err = cache_fetch(curr_file)) != STATUS_FALLBACK) {
+        mem_deallocate();
+        return err;
+    }
+    initialize_tables();
+    err = pass_one(curr_file);
+    if (err == STATUS_ERR) {
+        mem_deallocate();
+        return err;
+    }
+    err = pass_two(curr_file);
+    if (err == STATUS_ERR) {
+        mem_deallocate();
+        return err;
+    }
+    err = output(curr_file);
+    if (err == STATUS_OK && options.cache_dir != NULL)
+        cache_store(curr_file);
+    mem_deallocate();
+    return err;
+}
+
 /******************************************************************************
 * Function : main(int argc, char **argv)
 *//**
 * \section Description Description: The main function of the assembler.
 * it takes each input file (as an argument in argv), and tries to translate it into machine code.
 * if an error occurs in one input file, the assembler will still run perfectly on the rest.
+* the tables are emptied between files, but their memory is used again for the next file.
+* arguments that start with "--" are options (see set_option in files.c), and apply to every input file.
+* with --serve, there are no input files: the source files come from requests on a socket (see server.c).
 *
 * \param  		argc - the number of arguments
 * \param        argv - the arguments
@@ -29,35 +75,27 @@
 *
 *******************************************************************************/
 int main(int argc, char **argv) {
-    int i, err, err_total;
-    char *curr_file;
+    int i, err_total;
     err_total = 0;
-    if(num_files(argc) == STATUS_ERR) return STATUS_ERR;
+    diag_file = stderr;
+    for(i = 1; i< argc; i++) {
+        if(is_option(argv[i]) && set_option(argv[i]) == STATUS_ERR)
+            return STATUS_ERR;
+    }
+    if(check_options() == STATUS_ERR) return STATUS_ERR;
+    if(options.serve_path != NULL) return serve(options.serve_path);
+    if(num_files(argc, argv) == STATUS_ERR) return STATUS_ERR;
+    mem_allocate(); /*the memory is kept from one file to the next (see memory_mgmt.c)*/
     for(i = 1; i< argc; i++) {
-        if ((curr_file = filename(argv[i])) != NULL) {
-            initialize_tables();
-            mem_allocate();
-            err = pass_one(curr_file);
-            if (err == STATUS_ERR) {
-                err_total++;
-                mem_deallocate();
-                continue;
-            }
-            err = pass_two(curr_file);
-            if (err == STATUS_ERR) {
-                err_total++;
-                mem_deallocate();
-                continue;
-            }
-            err = output(curr_file);
-            if (err == STATUS_ERR) {
-                err_total++;
-            }
-            mem_deallocate();
-        } else {
+        if(is_option(argv[i]))
+            continue;
+        if(assemble(argv[i]) == STATUS_ERR)
             err_total++;
-        }
     }
+    err_total += finish_output_files(); /*the last batch of output files (see uring_files.c)*/
+    if(options.mem_stats != MEM_STATS_NONE)
+        print_mem_stats(options.to_stdout ? stderr : stdout, options.mem_stats); /*the standard output may be the output stream*/
+    mem_release();
     return (err_total == 0) ? STATUS_OK : STATUS_ERR;
 }
 
@@ -0,0 +1,326 @@
+/*******************************************************************************
+* Title                 :   Memory-mapped object file
+* Filename              :   mapped_files.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file mapped_files.c
+ * \brief This module writes the object file (.ob) straight into memory mapped from the file.
+ * the size of the object file depends only on ICF, DCF and the format of its lines (see write_to_ob_file in files.c),
+ * so it is calculated first, the file is made exactly that long and mapped, and every line is formatted right into
+ * its place in the mapping, with no stdio buffers and no copies.
+ * the code image and the data image go to ranges of the file that do not overlap, and are read separately
+ * (see spill.c), so when both are big they are formatted at the same time, in two threads.
+ * the blocks of the file are reserved before it is mapped, so a full disk is found before anything is written
+ * (a store to a mapped page with no block behind it would stop the assembler with SIGBUS), and the mapping is
+ * synced before it is unmapped, so an error in writing it back is reported like an error of fwrite.
+ * the result is the same, byte for byte, as the result of write_to_ob_file, which is still used
+ * when the file cannot be mapped or its blocks cannot be reserved (or on systems without mmap).
+ */
+/*mmap, msync, ftruncate, posix_fallocate and the threads are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "assembler.h"
+#ifdef __unix__
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#endif
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define PARALLEL_MIN    65536 /*the code and data ranges are formatted in two threads only if both are at least this long*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern unsigned long ICF, DCF;
+extern unsigned long output_hash_value;
+extern int data_exists;
+const char hex_digits[] = "0123456789ABCDEF";
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : address_width(unsigned long address);
+*//**
+* \return       the number of characters the address takes in the object file (at least 4)
+*******************************************************************************/
+int address_width(unsigned long address) {
+    int width = 1;
+    while(address >= 10) {
+        address /= 10;
+        width++;
+    }
+    return (width < ADDRESS_DIGITS) ? ADDRESS_DIGITS : width;
+}
+
+/******************************************************************************
+* Function : addresses_width(unsigned long first, unsigned long count);
+*//**
+* \section Description: calculates the number of characters taken by the addresses of "count" lines,
+*                       the first at address "first", each 4 bytes after the one before it.
+*                       the lines are counted a range of equal width at a time, not one by one
+*
+* \param  		first - the address of the first line
+* \param        count - the number of lines
+* \return       the number of characters
+*******************************************************************************/
+unsigned long addresses_width(unsigned long first, unsigned long count) {
+    unsigned long total = 0, limit, in_range;
+    int width, i;
+    while(count > 0) {
+        width = address_width(first);
+        for(limit = 1, i = 0; i < width; i++)
+            limit *= 10; /*the first address that is wider*/
+        in_range = (limit - first + WORD-1) / WORD;
+        if(in_range > count)
+            in_range = count;
+        total += in_range * width;
+        first += in_range * WORD;
+        count -= in_range;
+    }
+    return total;
+}
+
+/******************************************************************************
+* Function : put_decimal(char *dest, unsigned long x, int width);
+*//**
+* \section Description: writes a number in decimal base, padded with zeros to "width" digits (like %0*lu)
+*
+* \param  		dest - where the number is written (no null character is added)
+* \param        x - the number
+* \param        width - the number of digits (the number must fit in it)
+* \return       the number of characters written (width)
+*******************************************************************************/
+int put_decimal(char *dest, unsigned long x, int width) {
+    int i;
+    for(i = width-1; i >= 0; i--) {
+        dest[i] = (char)('0' + x % 10);
+        x /= 10;
+    }
+    return width;
+}
+
+/******************************************************************************
+* Function : put_byte(char *dest, unsigned char byte);
+*//**
+* \section Description: writes a byte like " %02X" does
+*
+* \param  		dest - where the byte is written (no null character is added)
+* \param        byte - the byte
+* \return       the number of characters written (3)
+*******************************************************************************/
+int put_byte(char *dest, unsigned char byte) {
+    dest[0] = ' ';
+    dest[1] = hex_digits[byte >> 4];
+    dest[2] = hex_digits[byte & 0xF];
+    return BYTE_COLUMNS;
+}
+
+/******************************************************************************
+* Function : ob_header(char *dest);
+*//**
+* \section Description: writes the first line of the object file: the sizes of the code and data images
+*                       ("     %lu %lu\n"), and with --hash-header, the hash of the output too (see hash.c)
+*
+* \param  		dest - where the line is written (a null character is added after it)
+* \return       the length of the line
+*******************************************************************************/
+int ob_header(char *dest) {
+    if(options.hash_header)
+        return sprintf(dest, "     %lu %lu %08lx\n", ICF-CODE_BASE, DCF, output_hash_value);
+    return sprintf(dest, "     %lu %lu\n", ICF-CODE_BASE, DCF);
+}
+
+/******************************************************************************
+* Function : ob_header_size();
+*//**
+* \return       the length of the first line of the object file (see ob_header)
+*******************************************************************************/
+unsigned long ob_header_size() {
+    char header[MAX_LINE];
+    return (unsigned long)ob_header(header);
+}
+
+/******************************************************************************
+* Function : code_section_size();
+*//**
+* \return       the length of the code image in the object file
+*******************************************************************************/
+unsigned long code_section_size() {
+    return addresses_width(CODE_BASE, code_length()) + CODE_LINE_REST * code_length();
+}
+
+/******************************************************************************
+* Function : data_section_size();
+*//**
+* \return       the length of the data image in the object file. there is a line for every 4 bytes
+*               (at least one line), and no new line character after the last one
+*******************************************************************************/
+unsigned long data_section_size() {
+    unsigned long lines;
+    if(!data_exists)
+        return 0;
+    lines = (DCF == 0) ? 1 : (DCF + WORD-1) / WORD;
+    return addresses_width(ICF, lines) + BYTE_COLUMNS * DCF + (lines-1);
+}
+
+/******************************************************************************
+* Function : format_code(char *dest);
+*//**
+* \section Description: formats the code image into the object file, one line for each order
+*
+* \param  		dest - the start of the code image in the object file
+* \return       the end of what was written
+*******************************************************************************/
+char *format_code(char *dest) {
+    unsigned long address = CODE_BASE;
+    unsigned char bytes[WORD];
+    machine_word word;
+    while(next_code_word(&word)) {
+        to_bytes(bytes, word, WORD);
+        dest += put_decimal(dest, address, address_width(address));
+        dest += put_byte(dest, bytes[0]);
+        dest += put_byte(dest, bytes[1]);
+        dest += put_byte(dest, bytes[2]);
+        dest += put_byte(dest, bytes[3]);
+        *dest++ = '\n';
+        address += WORD;
+    }
+    return dest;
+}
+
+/******************************************************************************
+* Function : format_data(char *dest);
+*//**
+* \section Description: formats the data image into the object file, 4 bytes in a line (like new_line_check in files.c)
+*
+* \param  		dest - the start of the data image in the object file
+* \return       the end of what was written. NULL if a cell of the data image is not valid
+*******************************************************************************/
+char *format_data(char *dest) {
+    unsigned long address = ICF;
+    unsigned char bytes[WORD];
+    data_image cell;
+    int j, space_count = 0;
+    if(!data_exists)
+        return dest;
+    dest += put_decimal(dest, address, address_width(address));
+    address += WORD;
+    while(next_data_cell(&cell)) {
+        /*always should be 1,2, or 4*/
+        if(cell.bytes_taken != ONE_BYTE && cell.bytes_taken != HALF_WORD && cell.bytes_taken != WORD)
+            return NULL;
+        to_bytes(bytes, cell.machine_code, cell.bytes_taken);
+        for(j = 0; j < cell.bytes_taken; j++) {
+            if(space_count == WORD) {
+                *dest++ = '\n';
+                dest += put_decimal(dest, address, address_width(address));
+                address += WORD;
+                space_count = 0;
+            }
+            dest += put_byte(dest, bytes[j]);
+            space_count++;
+        }
+    }
+    return dest;
+}
+
+#ifdef __unix__
+/******************************************************************************
+* Function : data_thread(void *dest);
+*//**
+* \section Description: formats the data image in a thread of its own (see format_data)
+*
+* \param  		dest - the start of the data image in the object file
+* \return       the end of what was written (NULL if there was an error)
+*******************************************************************************/
+void *data_thread(void *dest) {
+    return format_data((char*)dest);
+}
+
+/******************************************************************************
+* Function : write_mapped_ob_file(char *ob_fname);
+*//**
+* \section Description: writes the object file through memory mapped from it (see \brief)
+*
+* \param  		ob_fname - the name of the object file
+* \return       STATUS_OK if the file was written. STATUS_ERR if an error was found (it is printed).
+*               STATUS_FALLBACK if the file cannot be mapped (or its blocks cannot be reserved),
+*               so it should be written with write_to_ob_file
+*******************************************************************************/
+int write_mapped_ob_file(char *ob_fname) {
+    unsigned long header_size = ob_header_size();
+    unsigned long code_size = code_section_size();
+    unsigned long data_size = data_section_size();
+    unsigned long size = header_size + code_size + data_size;
+    char *map, *code_end, *data_end, header[MAX_LINE];
+    pthread_t thread;
+    void *result;
+    int fd, synced, err = STATUS_OK;
+
+    if((off_t)size < 0 || (size_t)size != size)
+        return STATUS_FALLBACK;
+    if((fd = open(ob_fname, O_RDWR | O_CREAT | O_TRUNC, 0666)) < 0)
+        return STATUS_FALLBACK;
+    /*the blocks are reserved first: a store to the mapping cannot find the disk full*/
+    if(ftruncate(fd, (off_t)size) != 0 || posix_fallocate(fd, 0, (off_t)size) != 0) {
+        close(fd);
+        return STATUS_FALLBACK;
+    }
+    map = (char*) mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(map == MAP_FAILED) {
+        close(fd);
+        return STATUS_FALLBACK;
+    }
+    ob_header(header);
+    memcpy(map, header, header_size); /*without the null character*/
+    /*reading the images from the start (some of them may be in temporary files, see spill.c)*/
+    start_images();
+    if(code_size >= PARALLEL_MIN && data_size >= PARALLEL_MIN
+       && pthread_create(&thread, NULL, data_thread, map + header_size + code_size) == 0) {
+        code_end = format_code(map + header_size);
+        pthread_join(thread, &result);
+        data_end = (char*)result;
+    } else {
+        code_end = format_code(map + header_size);
+        data_end = format_data(map + header_size + code_size);
+    }
+    if(data_end == NULL) {
+        fprintf(stderr, "this should not happen (data printing for %s)\n", ob_fname);
+        err = STATUS_ERR;
+    } else if(code_end != map + header_size + code_size || data_end != map + size) {
+        fprintf(stderr, "error: this should not happen (algorithm flaw in assembler) [%s]\n", ob_fname);
+        err = STATUS_ERR;
+    }
+    synced = msync(map, (size_t)size, MS_SYNC); /*an error in writing the pages back is found only here*/
+    if(munmap(map, (size_t)size) != 0 || close(fd) != 0 || synced != 0) {
+        fprintf(stderr, "error: cannot write output file [%s]", ob_fname);
+        err = STATUS_ERR;
+    }
+    return err;
+}
+#else
+/******************************************************************************
+* Function : write_mapped_ob_file(char *ob_fname);
+*//**
+* \section Description: on systems without mmap, the object file is always written with write_to_ob_file
+*
+* \return       STATUS_FALLBACK
+*******************************************************************************/
+int write_mapped_ob_file(char *ob_fname) {
+    return STATUS_FALLBACK;
+}
+#endif
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Title                 :   Memory usage statistics
+* Filename              :   mem_stats.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file mem_stats.c
+ * \brief This module counts the memory used by each subsystem of the assembler (--mem-stats).
+ * memory_mgmt.c reports every allocation to it (and every reset or free), so for each subsystem it knows
+ * the number of allocations, the total bytes allocated and the peak of the bytes in use at the same time.
+ * the "heap" counter is not a subsystem: it counts the memory taken from the system itself (the arena chunks
+ * and the image tables), so its peak is the peak memory of the assembler, not counting the C library and the stack.
+ * the counters keep going from one source file to the next, and are reported once, at exit.
+ * the report ends with the peak resident memory of the whole process (getrusage): it counts everything the heap
+ * counter does not (the C library, the stack, the program itself), so the two can be compared.
+ */
+/*getrusage is XSI, not ANSI C*/
+#define _XOPEN_SOURCE 500
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include "assembler.h"
+#ifdef __unix__
+#include <sys/resource.h>
+#endif
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static mem_counter mem_counters[MEM_COUNTERS]; /*one counter for each subsystem, and one for the heap*/
+/*names of the counters in the report, in the order of MEM_SUBSYSTEMS*/
+static const char *mem_names[MEM_COUNTERS] = {"symbols", "images", "external", "scratch", "buffers", "heap"};
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : mem_stat_alloc(int subsystem, unsigned long bytes);
+*//**
+* \section Description: counts an allocation for a subsystem
+*
+* \param  		subsystem - the subsystem (see MEM_SUBSYSTEMS in assembler.h)
+* \param        bytes - the number of bytes allocated
+*******************************************************************************/
+void mem_stat_alloc(int subsystem, unsigned long bytes) {
+    mem_counter *counter = &mem_counters[subsystem];
+    counter->allocations++;
+    counter->bytes += bytes;
+    counter->in_use += bytes;
+    if(counter->in_use > counter->peak)
+        counter->peak = counter->in_use;
+}
+
+/******************************************************************************
+* Function : mem_stat_free(int subsystem, unsigned long bytes);
+*//**
+* \section Description: counts memory of a subsystem that was freed
+*
+* \param  		subsystem - the subsystem (see MEM_SUBSYSTEMS in assembler.h)
+* \param        bytes - the number of bytes freed
+*******************************************************************************/
+void mem_stat_free(int subsystem, unsigned long bytes) {
+    mem_counter *counter = &mem_counters[subsystem];
+    counter->in_use = (bytes > counter->in_use) ? 0 : counter->in_use - bytes;
+}
+
+/******************************************************************************
+* Function : peak_resident();
+*//**
+* \return       the peak resident memory of the process in bytes (ru_maxrss). 0 if it is not known
+*******************************************************************************/
+unsigned long peak_resident() {
+#ifdef __unix__
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return (unsigned long)usage.ru_maxrss; /*in bytes*/
+#else
+    return (unsigned long)usage.ru_maxrss * 1024; /*in kilobytes*/
+#endif
+#else
+    return 0;
+#endif
+}
+
+/******************************************************************************
+* Function : print_mem_stats(FILE *fp, int format);
+*//**
+* \section Description: prints the memory usage report
+*
+* \param  		fp - where the report is printed
+* \param        format - MEM_STATS_TEXT for a table, MEM_STATS_JSON for a JSON object:
+*               {"subsystems":{"symbols":{"allocations":N,"bytes":N,"peak":N},...},"heap":{"allocations":N,"bytes":N,"peak":N},
+*               "peak_resident":N}
+*******************************************************************************/
+void print_mem_stats(FILE *fp, int format) {
+    int i;
+    if(format == MEM_STATS_JSON) {
+        fprintf(fp, "{\"subsystems\":{");
+        for(i = 0; i < MEM_HEAP; i++) {
+            fprintf(fp, "%s\"%s\":{\"allocations\":%lu,\"bytes\":%lu,\"peak\":%lu}", (i == 0) ? "" : ",",
+                    mem_names[i], mem_counters[i].allocations, mem_counters[i].bytes, mem_counters[i].peak);
+        }
+        fprintf(fp, "},\"heap\":{\"allocations\":%lu,\"bytes\":%lu,\"peak\":%lu},\"peak_resident\":%lu}\n",
+                mem_counters[MEM_HEAP].allocations, mem_counters[MEM_HEAP].bytes, mem_counters[MEM_HEAP].peak,
+                peak_resident());
+        return;
+    }
+    fprintf(fp, "%-10s %12s %14s %14s\n", "memory", "allocations", "bytes", "peak bytes");
+    for(i = 0; i < MEM_COUNTERS; i++) {
+        fprintf(fp, "%-10s %12lu %14lu %14lu\n", mem_names[i],
+                mem_counters[i].allocations, mem_counters[i].bytes, mem_counters[i].peak);
+    }
+    fprintf(fp, "%-10s %12s %14s %14lu\n", "resident", "", "", peak_resident());
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
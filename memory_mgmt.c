@@ -4,35 +4,71 @@
 * Author                :   Itai Kimelman
 * Version               :   1.5.4
 *******************************************************************************/
-
+/** \file memory_mgmt.c
+ * \brief This module manages the memory of the assembler.
+ * besides the code image and data image tables, all the memory is allocated from two arenas: the file arena, for everything
+ * that is kept until the end of the current source file (the symbol table, the lists and the buffers of the passes),
+ * and the line arena, for the scratch buffers used while analyzing one line. an arena is freed all at once, so there is
+ * no need to free each allocation.
+ * the memory is kept from one source file to the next: the arenas are reset but keep their chunks, and the code image
+ * and data image tables are emptied but keep their capacity, so the next file does not have to allocate it all again.
+ * every allocation is counted for the subsystem that uses it (see mem_stats.c)
+ */
 /******************************************************************************
 * Includes
 *******************************************************************************/
+#include <setjmp.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "assembler.h"
 /******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define ARENA_ALIGN         16 /*every allocation in an arena starts at a multiple of this*/
+#define FILE_ARENA_CHUNK    65536 /*default size of a chunk in the file arena*/
+#define LINE_ARENA_CHUNK    4096 /*default size of a chunk in the line arena*/
+#define IMG_INIT            64 /*initial number of cells in the code image and data image tables (they double every time they fill up)*/
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define align_up(X)     (((X) + ARENA_ALIGN-1) & ~(size_t)(ARENA_ALIGN-1))
+#define chunk_data(C)   ((char*)(C) + align_up(sizeof(arena_chunk)))
+/******************************************************************************
 * Module Variable Definitions
 *******************************************************************************/
-extern symbol_node *symbol_table;
-extern ext_node *external_list;
-extern command_image *code_img;
+arena file_arena = {NULL, NULL, NULL, FILE_ARENA_CHUNK, MEM_BUFFERS}; /*everything that lives until the end of the current source file*/
+arena line_arena = {NULL, NULL, NULL, LINE_ARENA_CHUNK, MEM_SCRATCH}; /*scratch buffers that live until the end of the current line*/
+
+extern machine_word *code_img;
 extern data_image *data_img;
 extern unsigned long code_img_length, data_img_length;
+extern unsigned long code_img_capacity, data_img_capacity;
+extern FILE *diag_file;
+jmp_buf *fatal_jump = NULL; /*where fatal_stop goes back to in the library (see library.c). NULL: the program ends*/
 
 /******************************************************************************
-* Function Forward Declarations
+* Function Definitions
 *******************************************************************************/
-void deallocate_external_list();
-void deallocate_symbol_table();
 /******************************************************************************
-* Function Definitions
+* Function : fatal_stop();
+*//**
+* \section Description: stops the assembler after an error it cannot go on from (see alloc_check, spill_check).
+*                       the program is terminated, unless the library is running: then the call to the library
+*                       returns an error instead (see fatal_jump), so the program that uses it goes on
 *******************************************************************************/
+void fatal_stop() {
+    if(fatal_jump != NULL)
+        longjmp(*fatal_jump, 1);
+    mem_release();
+    exit(STATUS_ERR);
+}
+
 /******************************************************************************
 * Function : alloc_check(void *);
 *//**
 * \section Description:
-* this function checks if the pointer given points to NULL, and terminates the program if it is
+* this function checks if the pointer given points to NULL, and stops the assembler if it is (see fatal_stop)
 * This function is used to check if memory allocation failed after using malloc, calloc or realloc
 *
 * \param  		x the pointer given (and allocated before)
@@ -40,31 +76,221 @@ void deallocate_symbol_table();
 *******************************************************************************/
 void alloc_check(void * x) {
     if(x == NULL) {
-        fprintf(stderr,"memory allocation problems\n");
-        mem_deallocate();
-        exit(STATUS_ERR);
+        fprintf(diag_file,"memory allocation problems\n");
+        fatal_stop();
+    }
+}
+
+/******************************************************************************
+* Function : arena_alloc(arena *a, size_t size);
+*//**
+* \section Description:
+* this function allocates memory from an arena by moving the position in the current chunk.
+* if the current chunk is full, the arena moves to the next chunk it already has (if it is big enough),
+* or gets a new chunk with malloc. memory from an arena is never freed on its own - only
+* all at once, by arena_reset or arena_free
+*
+* \param  		a - the arena
+* \param        size - the number of bytes requested
+* \return       pointer to the memory (never NULL: the program terminates if there is no memory left)
+*
+*******************************************************************************/
+void *arena_alloc(arena *a, size_t size) {
+    return arena_alloc_for(a, size, a->subsystem);
+}
+
+/******************************************************************************
+* Function : arena_alloc_for(arena *a, size_t size, int subsystem);
+*//**
+* \section Description:
+* this function allocates memory from an arena (see arena_alloc), and counts it for the subsystem given
+* instead of the subsystem of the arena (see mem_stats.c)
+*
+* \param  		a - the arena
+* \param        size - the number of bytes requested
+* \param        subsystem - the subsystem that uses the memory (see MEM_SUBSYSTEMS in assembler.h)
+* \return       pointer to the memory (never NULL: the program terminates if there is no memory left)
+*
+*******************************************************************************/
+void *arena_alloc_for(arena *a, size_t size, int subsystem) {
+    arena_chunk *chunk;
+    void *ptr;
+    size = align_up(size);
+    if(a->current == NULL || a->current->used + size > a->current->size) {
+        /*looking for a chunk that was kept from before the last reset*/
+        chunk = (a->current == NULL) ? a->first : a->current->next;
+        if(chunk != NULL && chunk->size >= size) {
+            chunk->used = 0;
+        } else {
+            chunk = (arena_chunk*) malloc(align_up(sizeof(arena_chunk)) + ((size > a->chunk_size) ? size : a->chunk_size));
+            alloc_check(chunk);
+            chunk->size = (size > a->chunk_size) ? size : a->chunk_size;
+            chunk->used = 0;
+            mem_stat_alloc(MEM_HEAP, align_up(sizeof(arena_chunk)) + chunk->size);
+            /*the new chunk goes after the current one, so the chunks kept after it will still be used*/
+            if(a->current == NULL) {
+                chunk->next = a->first;
+                a->first = chunk;
+            } else {
+                chunk->next = a->current->next;
+                a->current->next = chunk;
+            }
+        }
+        a->current = chunk;
+    }
+    ptr = chunk_data(a->current) + a->current->used;
+    a->current->used += size;
+    a->last = ptr;
+    a->in_use[subsystem] += size;
+    mem_stat_alloc(subsystem, size);
+    return ptr;
+}
+
+/******************************************************************************
+* Function : arena_grow(arena *a, void *ptr, size_t old_size, size_t new_size, int subsystem);
+*//**
+* \section Description:
+* this function makes a block that was allocated from an arena bigger (like realloc).
+* if the block is the last allocation in the current chunk and there is room after it, it grows in place.
+* otherwise, a new block is allocated and the contents are copied into it (the old block is left unused until the arena is reset)
+*
+* \param  		a - the arena
+* \param        ptr - the block (NULL if there is no block yet)
+* \param        old_size - the size of the block
+* \param        new_size - the new size of the block
+* \param        subsystem - the subsystem that uses the block (see MEM_SUBSYSTEMS in assembler.h)
+* \return       pointer to the block
+*
+*******************************************************************************/
+void *arena_grow(arena *a, void *ptr, size_t old_size, size_t new_size, int subsystem) {
+    void *new_ptr;
+    if(ptr != NULL && ptr == a->last) {
+        size_t start = (char*)ptr - chunk_data(a->current);
+        if(start + align_up(new_size) <= a->current->size) {
+            a->current->used = start + align_up(new_size);
+            a->in_use[subsystem] += align_up(new_size) - align_up(old_size);
+            mem_stat_alloc(subsystem, align_up(new_size) - align_up(old_size));
+            return ptr;
+        }
+    }
+    new_ptr = arena_alloc_for(a, new_size, subsystem);
+    if(ptr != NULL)
+        memcpy(new_ptr, ptr, old_size);
+    return new_ptr;
+}
+
+/******************************************************************************
+* Function : arena_reset(arena *a);
+*//**
+* \section Description:
+* this function frees all the memory allocated from an arena at once. the chunks are kept for
+* the next allocations, so resetting an arena does not depend on how much was allocated from it
+*
+* \param  		a - the arena
+*
+*******************************************************************************/
+void arena_reset(arena *a) {
+    int i;
+    a->current = NULL;
+    a->last = NULL;
+    for(i = 0; i < MEM_HEAP; i++) {
+        mem_stat_free(i, a->in_use[i]);
+        a->in_use[i] = 0;
     }
 }
 
+/******************************************************************************
+* Function : arena_free(arena *a);
+*//**
+* \section Description:
+* this function gives all the chunks of an arena back to the system
+*
+* \param  		a - the arena
+*
+*******************************************************************************/
+void arena_free(arena *a) {
+    arena_chunk *curr;
+    while(a->first != NULL) {
+        curr = a->first;
+        a->first = a->first->next;
+        mem_stat_free(MEM_HEAP, align_up(sizeof(arena_chunk)) + curr->size);
+        free(curr);
+    }
+    arena_reset(a);
+}
+
+/******************************************************************************
+* Function : grow_vector(void *vec, unsigned long needed, unsigned long *capacity, unsigned long init, size_t size, int subsystem);
+*//**
+* \section Description:
+* this function makes sure a vector (a growing array allocated from the file arena) has room for "needed" cells.
+* when it is full, its capacity is doubled (starting from init)
+*
+* \param  		vec - the vector (NULL if it was not allocated yet)
+* \param        needed - the number of cells needed
+* \param        capacity - the number of cells allocated for the vector (updated)
+* \param        init - the capacity of a new vector
+* \param        size - the size of a cell
+* \param        subsystem - the subsystem that uses the vector (see MEM_SUBSYSTEMS in assembler.h)
+* \return       pointer to the vector
+*
+*******************************************************************************/
+void *grow_vector(void *vec, unsigned long needed, unsigned long *capacity, unsigned long init, size_t size, int subsystem) {
+    unsigned long new_capacity = (*capacity == 0) ? init : *capacity;
+    if(vec != NULL && needed <= *capacity)
+        return vec;
+    while(new_capacity < needed)
+        new_capacity *= 2;
+    vec = arena_grow(&file_arena, vec, *capacity * size, new_capacity * size, subsystem);
+    *capacity = new_capacity;
+    return vec;
+}
+
+/******************************************************************************
+* Function : grow_image(void *img, unsigned long needed, unsigned long *capacity, size_t size);
+*//**
+* \section Description:
+* this function makes sure the code image or data image table has room for "needed" cells.
+* when it is full, its capacity is doubled. unlike the vectors in the file arena, the tables keep their memory
+* from one source file to the next (see mem_deallocate)
+*
+* \param  		img - the table
+* \param        needed - the number of cells needed
+* \param        capacity - the number of cells allocated for the table (updated)
+* \param        size - the size of a cell
+* \return       pointer to the table
+*
+*******************************************************************************/
+void *grow_image(void *img, unsigned long needed, unsigned long *capacity, size_t size) {
+    unsigned long new_capacity = (*capacity == 0) ? IMG_INIT : *capacity;
+    if(img != NULL && needed <= *capacity)
+        return img;
+    while(new_capacity < needed)
+        new_capacity *= 2;
+    img = realloc(img, new_capacity * size);
+    alloc_check(img);
+    mem_stat_alloc(MEM_IMAGES, (new_capacity - *capacity) * size);
+    mem_stat_alloc(MEM_HEAP, (new_capacity - *capacity) * size);
+    *capacity = new_capacity;
+    return img;
+}
+
 /******************************************************************************
 * Function : mem_allocate();
 *//**
 * \section Description:
 * this functions allocates memory for the code image and data image table
-* This function is used to allocate memory for the code image and data image table
-* before we read the source file.
+* This function is used once, to allocate memory for the code image and data image table
+* before we read the first source file.
 *
 *******************************************************************************/
 void mem_allocate() {
     /*allocating for the code image table*/
     code_img_length = 0;
-    code_img = (command_image*) malloc(sizeof(command_image));
-    alloc_check(code_img);
+    code_img = (machine_word*) grow_image(code_img, IMG_INIT, &code_img_capacity, sizeof(machine_word));
     /*allocating for the data image table*/
     data_img_length = 0;
-    data_img = (data_image*) malloc(sizeof(data_image));
-    alloc_check(data_img);
-
+    data_img = (data_image*) grow_image(data_img, IMG_INIT, &data_img_capacity, sizeof(data_image));
 }
 
 /******************************************************************************
@@ -73,55 +299,39 @@ void mem_allocate() {
 * \section Description:
 * this functions deallocates memory for all of the tables
 * This function is used to deallocate memory for all of the tables before we
-* terminate the program/ go to another source file
+* go to another source file. all of them but the code image and data image tables were allocated
+* from the file arena, so this is done by resetting it (see initialize_tables for the pointers to the tables).
+* the code image and data image tables are emptied, and their memory is used again for the next file
 *
 *******************************************************************************/
 void mem_deallocate() {
-    free(code_img);
-    free(data_img);
-    deallocate_external_list();
-    deallocate_symbol_table();
-}
-
-/******************************************************************************
-* Function : deallocate_external_list();
-*//**
-* \section Description Description:
-* this functions deallocates memory for the external label list
-* This function is used to deallocate memory for the external label list
-* before we terminate the program
-*
-*******************************************************************************/
-void deallocate_external_list(){
-    /*freeing each node*/
-    ext_node *curr;
-    while(external_list!=NULL) {
-        curr = external_list;
-        external_list = external_list->next;
-        free(curr->label);
-        free(curr);
-    }
+    spill_reset();
+    arena_reset(&file_arena);
+    arena_reset(&line_arena);
+    code_img_length = 0;
+    data_img_length = 0;
 }
 
 /******************************************************************************
-* Function : deallocate_symbol_table();
+* Function : mem_release();
 *//**
-* \section Description Description:
-* this functions deallocates memory for the symbol table
-* This function is used to deallocate memory for the symbol table
-* before we terminate the program
-*
-*******************************************************************************/
-void deallocate_symbol_table(){
-    /*freeing each node*/
-    symbol_node *curr;
-    while(symbol_table!=NULL) {
-        curr = symbol_table;
-        symbol_table = symbol_table->next;
-        free(curr->symbol);
-        free(curr);
-    }
-
+* \section Description:
+* this functions gives all the memory of the assembler back to the system.
+* This function is used before we terminate the program
+*
+*******************************************************************************/
+void mem_release() {
+    spill_reset();
+    arena_free(&file_arena);
+    arena_free(&line_arena);
+    mem_stat_free(MEM_IMAGES, code_img_capacity * sizeof(machine_word) + data_img_capacity * sizeof(data_image));
+    mem_stat_free(MEM_HEAP, code_img_capacity * sizeof(machine_word) + data_img_capacity * sizeof(data_image));
+    free(code_img);
+    free(data_img);
+    code_img = NULL;
+    data_img = NULL;
+    code_img_capacity = 0;
+    data_img_capacity = 0;
 }
 
 /*************** END OF FUNCTIONS ***************************************************************************/
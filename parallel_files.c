@@ -0,0 +1,330 @@
+/*******************************************************************************
+* Title                 :   Parallel object file
+* Filename              :   parallel_files.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file parallel_files.c
+ * \brief This module writes a big object file (.ob) with a number of threads.
+ * the code image and the data image are split into chunks of a fixed number of orders or data cells.
+ * where each chunk goes in the object file can be calculated before it is formatted (the address of every line
+ * is known, and so is its width - see mapped_files.c), so every chunk is formatted into a buffer of its own,
+ * by worker threads, in any order. then the buffers are written to the file in order, a batch at a time, with pwritev.
+ * the result is the same, byte for byte, as the result of write_to_ob_file.
+ * this is used only when the images are all in memory (not with --max-memory, see spill.c), when there is more
+ * than one processor, and when the object file is big. otherwise the object file is written by mapped_files.c.
+ */
+/*pwritev is not ANSI C (nor POSIX)*/
+#define _POSIX_C_SOURCE 200112L
+#define _DEFAULT_SOURCE
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include "assembler.h"
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define CHUNK_ORDERS    16384 /*number of orders in a chunk of the code image*/
+#define CHUNK_CELLS     32768 /*number of cells in a chunk of the data image*/
+#define MAX_WORKERS     8 /*the most threads used for formatting*/
+#define IOV_BATCH       64 /*the most buffers written by one pwritev*/
+#define PARALLEL_FILE_MIN   262144 /*smaller object files are not worth the threads*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern unsigned long ICF, DCF;
+extern int data_exists;
+extern arena file_arena;
+extern machine_word *code_img;
+extern data_image *data_img;
+extern unsigned long code_img_length, data_img_length;
+
+static ob_chunk *chunks; /*the chunks of the code image, and then of the data image*/
+static unsigned long chunks_length;
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : code_offset(unsigned long index);
+*//**
+* \return       where the line of the order in index "index" starts in the code image of the object file
+*******************************************************************************/
+unsigned long code_offset(unsigned long index) {
+    return addresses_width(CODE_BASE, index) + CODE_LINE_REST * index;
+}
+
+/******************************************************************************
+* Function : data_offset(unsigned long byte);
+*//**
+* \section Description: calculates where the formatting of a byte of the data image starts in the data image of
+*                       the object file. if the byte starts a line, that is where the new line character before it is
+*
+* \param  		byte - the number of bytes of the data image before it (DCF for the end of the data image)
+* \return       the offset from the start of the data image in the object file
+*******************************************************************************/
+unsigned long data_offset(unsigned long byte) {
+    unsigned long line = byte / WORD;
+    if(byte == 0)
+        return 0;
+    if(byte % WORD == 0)
+        return addresses_width(ICF, line) + BYTE_COLUMNS * byte + (line-1);
+    return addresses_width(ICF, line+1) + BYTE_COLUMNS * byte + line;
+}
+
+/******************************************************************************
+* Function : format_code_chunk(ob_chunk *chunk);
+*//**
+* \section Description: formats a chunk of the code image into its buffer (like format_code in mapped_files.c)
+*
+* \param  		chunk - the chunk
+*******************************************************************************/
+void format_code_chunk(ob_chunk *chunk) {
+    unsigned long i, address = CODE_BASE + chunk->first * WORD;
+    unsigned char bytes[WORD];
+    char *dest = chunk->buffer;
+    for(i = chunk->first; i < chunk->first + chunk->count; i++) {
+        to_bytes(bytes, code_img[i], WORD);
+        dest += put_decimal(dest, address, address_width(address));
+        dest += put_byte(dest, bytes[0]);
+        dest += put_byte(dest, bytes[1]);
+        dest += put_byte(dest, bytes[2]);
+        dest += put_byte(dest, bytes[3]);
+        *dest++ = '\n';
+        address += WORD;
+    }
+    chunk->written = dest - chunk->buffer;
+}
+
+/******************************************************************************
+* Function : format_data_chunk(ob_chunk *chunk);
+*//**
+* \section Description: formats a chunk of the data image into its buffer (like format_data in mapped_files.c).
+*                       the line and the place in it are worked out from the number of bytes before the chunk
+*
+* \param  		chunk - the chunk
+*******************************************************************************/
+void format_data_chunk(ob_chunk *chunk) {
+    unsigned long i, address;
+    unsigned char bytes[WORD];
+    char *dest = chunk->buffer;
+    int j, space_count;
+    if(chunk->first_byte == 0) {
+        dest += put_decimal(dest, ICF, address_width(ICF));
+        address = ICF + WORD;
+        space_count = 0;
+    } else {
+        address = ICF + ((chunk->first_byte-1) / WORD + 1) * WORD; /*the address of the next line*/
+        space_count = (chunk->first_byte-1) % WORD + 1;
+    }
+    for(i = chunk->first; i < chunk->first + chunk->count; i++) {
+        to_bytes(bytes, data_img[i].machine_code, data_img[i].bytes_taken);
+        for(j = 0; j < data_img[i].bytes_taken; j++) {
+            if(space_count == WORD) {
+                *dest++ = '\n';
+                dest += put_decimal(dest, address, address_width(address));
+                address += WORD;
+                space_count = 0;
+            }
+            dest += put_byte(dest, bytes[j]);
+            space_count++;
+        }
+    }
+    chunk->written = dest - chunk->buffer;
+}
+
+/******************************************************************************
+* Function : make_chunks();
+*//**
+* \section Description: splits the code image and data image into chunks, and allocates a buffer for each one
+*                       with the exact length of the chunk in the object file
+*
+* \return       STATUS_OK if the chunks were made. STATUS_ERR if a cell of the data image is not valid
+*******************************************************************************/
+int make_chunks() {
+    unsigned long i, j, byte, data_size = data_section_size();
+    chunks_length = (code_img_length + CHUNK_ORDERS-1) / CHUNK_ORDERS;
+    if(data_exists)
+        chunks_length += (data_img_length == 0) ? 1 : (data_img_length + CHUNK_CELLS-1) / CHUNK_CELLS;
+    chunks = (ob_chunk*) arena_alloc(&file_arena, chunks_length * sizeof(ob_chunk));
+    for(i = 0, j = 0; i < code_img_length; i += CHUNK_ORDERS, j++) {
+        chunks[j].segment = CODE;
+        chunks[j].first = i;
+        chunks[j].count = (code_img_length - i < CHUNK_ORDERS) ? code_img_length - i : CHUNK_ORDERS;
+        chunks[j].size = code_offset(i + chunks[j].count) - code_offset(i);
+    }
+    /*the number of bytes before each chunk of the data image is counted one cell at a time*/
+    for(i = 0, byte = 0; j < chunks_length; j++) {
+        chunks[j].segment = DATA;
+        chunks[j].first = i;
+        chunks[j].first_byte = byte;
+        chunks[j].count = (data_img_length - i < CHUNK_CELLS) ? data_img_length - i : CHUNK_CELLS;
+        for(; i < chunks[j].first + chunks[j].count; i++) {
+            /*always should be 1,2, or 4*/
+            if(data_img[i].bytes_taken != ONE_BYTE && data_img[i].bytes_taken != HALF_WORD && data_img[i].bytes_taken != WORD)
+                return STATUS_ERR;
+            byte += data_img[i].bytes_taken;
+        }
+        chunks[j].size = ((j+1 == chunks_length) ? data_size : data_offset(byte)) - data_offset(chunks[j].first_byte);
+    }
+    for(j = 0; j < chunks_length; j++)
+        chunks[j].buffer = (char*) arena_alloc(&file_arena, chunks[j].size);
+    return STATUS_OK;
+}
+
+#ifdef __linux__
+/******************************************************************************
+* Function : format_worker(void *job);
+*//**
+* \section Description: formats every chunk whose index leaves the remainder "id" when divided by the number of workers.
+*                       the chunks do not share anything, so the workers do not need to wait for each other
+*
+* \param  		job - pointer to the format_job of the worker (it is not changed while the worker runs)
+* \return       NULL
+*******************************************************************************/
+void *format_worker(void *job) {
+    format_job *work = (format_job*)job;
+    unsigned long i;
+    for(i = work->id; i < chunks_length; i += work->workers) {
+        if(chunks[i].segment == CODE)
+            format_code_chunk(&chunks[i]);
+        else format_data_chunk(&chunks[i]);
+    }
+    return NULL;
+}
+
+/******************************************************************************
+* Function : write_batch(int fd, struct iovec *iov, int n, off_t offset);
+*//**
+* \section Description: writes buffers one after another to a file with pwritev, until all of them are written
+*
+* \param  		fd - the file
+* \param        iov - the buffers (changed when only a part of them was written)
+* \param        n - the number of buffers
+* \param        offset - where the first buffer goes in the file
+* \return       STATUS_OK if everything was written. otherwise: STATUS_ERR
+*******************************************************************************/
+int write_batch(int fd, struct iovec *iov, int n, off_t offset) {
+    ssize_t written;
+    while(n > 0) {
+        if((written = pwritev(fd, iov, n, offset)) <= 0)
+            return STATUS_ERR;
+        offset += written;
+        while(n > 0 && (size_t)written >= iov->iov_len) {
+            written -= iov->iov_len;
+            iov++;
+            n--;
+        }
+        if(n > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : write_parallel_ob_file(char *ob_fname);
+*//**
+* \section Description: writes the object file with a number of threads (see \brief)
+*
+* \param  		ob_fname - the name of the object file
+* \return       STATUS_OK if the file was written. STATUS_ERR if an error was found (it is printed).
+*               STATUS_FALLBACK if the object file should be written another way (see output in files.c)
+*******************************************************************************/
+int write_parallel_ob_file(char *ob_fname) {
+    char header[MAX_LINE];
+    unsigned long header_size, i, size, batch_size;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_t threads[MAX_WORKERS];
+    format_job jobs[MAX_WORKERS];
+    struct iovec iov[IOV_BATCH];
+    int fd, n, workers, started, err = STATUS_OK;
+    off_t offset;
+
+    header_size = (unsigned long)ob_header(header);
+    size = header_size + code_section_size() + data_section_size();
+    if(cpus < 2 || size < PARALLEL_FILE_MIN || code_length() != code_img_length || data_length() != data_img_length)
+        return STATUS_FALLBACK;
+    if(make_chunks() == STATUS_ERR) {
+        fprintf(stderr, "this should not happen (data printing for %s)\n", ob_fname);
+        return STATUS_ERR;
+    }
+    workers = (cpus > MAX_WORKERS) ? MAX_WORKERS : (int)cpus;
+    if((unsigned long)workers > chunks_length)
+        workers = (int)chunks_length;
+    /*formatting: the main thread is worker 0. every job is set before any thread starts*/
+    for(i = 0; i < (unsigned long)workers; i++) {
+        jobs[i].id = (int)i;
+        jobs[i].workers = workers;
+    }
+    for(started = 1; started < workers; started++) {
+        if(pthread_create(&threads[started], NULL, format_worker, &jobs[started]) != 0)
+            break;
+    }
+    if(started < workers) {
+        /*the chunks of the thread that was not made would not be formatted: the object file is written another way*/
+        for(i = 1; i < (unsigned long)started; i++)
+            pthread_join(threads[i], NULL);
+        return STATUS_FALLBACK;
+    }
+    format_worker(&jobs[0]);
+    for(i = 1; i < (unsigned long)started; i++)
+        pthread_join(threads[i], NULL);
+    for(i = 0; i < chunks_length; i++) {
+        if(chunks[i].written != chunks[i].size) {
+            fprintf(stderr, "error: this should not happen (algorithm flaw in assembler) [%s]\n", ob_fname);
+            return STATUS_ERR;
+        }
+    }
+
+    if((fd = open(ob_fname, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0)
+        return STATUS_FALLBACK;
+    /*writing the buffers in order, IOV_BATCH at a time*/
+    iov[0].iov_base = header;
+    iov[0].iov_len = header_size;
+    batch_size = header_size;
+    n = 1;
+    offset = 0;
+    for(i = 0; i < chunks_length && err == STATUS_OK; i++) {
+        iov[n].iov_base = chunks[i].buffer;
+        iov[n].iov_len = chunks[i].size;
+        batch_size += chunks[i].size;
+        n++;
+        if(n == IOV_BATCH || i+1 == chunks_length) {
+            err = write_batch(fd, iov, n, offset);
+            offset += batch_size;
+            batch_size = 0;
+            n = 0;
+        }
+    }
+    if(close(fd) != 0 || err == STATUS_ERR) {
+        fprintf(stderr, "error: cannot write output file [%s]", ob_fname);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+#else
+/******************************************************************************
+* Function : write_parallel_ob_file(char *ob_fname);
+*//**
+* \section Description: without pwritev, the object file is written by mapped_files.c
+*
+* \return       STATUS_FALLBACK
+*******************************************************************************/
+int write_parallel_ob_file(char *ob_fname) {
+    return STATUS_FALLBACK;
+}
+#endif
+
+/*************** END OF FUNCTIONS ***************************************************************************/
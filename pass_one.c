@@ -25,11 +25,12 @@
 /******************************************************************************
 * Module Variable Definitions
 *******************************************************************************/
-int err1; /*indicates if there's an error in the current file*/
-int err_ln; /*indicates if there's an error in the current line*/
+static int err1; /*indicates if there's an error in the current file*/
+static int err_ln; /*indicates if there's an error in the current line*/
 unsigned long ICF; /*the final value of IC*/
 unsigned long DC,DCF; /*the current and final value of DC respectfully*/
-extern int data_exists;
+extern arena file_arena, line_arena;
+extern FILE *diag_file;
 /******************************************************************************
 * Function Definitions
 *******************************************************************************/
@@ -46,7 +47,8 @@ extern int data_exists;
 void pass_one_error(char* file_name,unsigned long num_ln) {
     err1 = STATUS_ERR;
     err_ln = STATUS_ERR;
-    fprintf(stderr,"[%s | %lu]\n",file_name,num_ln);
+    fprintf(diag_file,"[%s | %lu]\n",file_name,num_ln);
+    callback_error(); /*see library.c*/
 }
 
 /******************************************************************************
@@ -58,14 +60,14 @@ void pass_one_error(char* file_name,unsigned long num_ln) {
 * \return       STATUS_OK if no error was found. otherwise: STATUS_ERR
 * \note
  * the algorithm for the 1st assembler pass is as follows:
- * 1. initialize IC = 100, DC = 0
+ * 1. initialize IC = 100 (CODE_BASE), DC = 0
  * 2. read the next line. if the file has ended, go to step 17
  * 3. if it's a comment line or an empty line, go to step 2
  * 4. is the 1st field in the line a label? if not, go to step 6
  * 5. turn on the label flag
  * 6. is this a data directive? if not go to step 9
  * 7. if there is a label, add it to the symbol table(if the label already exists, report an error) with the attribute "data"
- * and value DC
+ * and value DC (its offset in the data segment)
  * 8. identify the data directive and code the data requested accordingly into the data image table with value DC.
  * add the right amount to DC. go to step 2
  * 9. is this an .entry or .extern directive? if not go to 12
@@ -73,16 +75,16 @@ void pass_one_error(char* file_name,unsigned long num_ln) {
  * 11. if this is an .extern directive, add the label that shows up as the operand of this directive
  * to the symbol table with the attribute "external" and value 0 (if the label already exists, report an error)
  * 12. this is an order line. if there is a label, add it to the symbol table(if the label already exists, report an error) with the attribute "code"
- * and value IC
+ * and value IC-CODE_BASE (its offset in the code segment)
  * 13. look for the order in the opcode table. if it does not exist, report an error
  * 14. analyze the operand structure of the order. if an error occurs, report it
  * 15. code the order to the binary image of the code as much as possible with value IC.
  * 16. update IC+=4 and go to step 2
  * 17. the file has been read entirely. if there was an error, stop here (there will not be a 2nd pass or output files).
  * 18. save the final value of IC,DC into ICF,DCF accordingly. they will be used to build the output files
- * 19. update the value of every symbol with attribute data by adding ICF to its value
- * 20. update the data image table by adding ICF to each value
- * 21. return FALSE to main (begin the 2nd assembler pass) (no error was found)
+ * 19. return FALSE to main (begin the 2nd assembler pass) (no error was found)
+ * the symbols and the data image keep offsets in their segment, so there is no need to add ICF to them here:
+ * the data segment starts at ICF, and the addresses are worked out from it when they are needed (see symbol_address in tables.c)
 *******************************************************************************/
 int pass_one(char *file_name) {
     unsigned long num_ln = 0;
@@ -93,29 +95,29 @@ int pass_one(char *file_name) {
     FILE *curr_file; /*pointer to file*/
     char *label = NULL; /*saves label (if there is one)*/
     /*step 1:*/
-    IC = 100;
+    IC = CODE_BASE;
     DC = 0;
     err1 = STATUS_OK;
 
-    if((curr_file=fopen(file_name,"r"))==NULL) {
-        fprintf(stderr,"error while opening file %s\n", file_name);
+    if((curr_file=open_source(file_name))==NULL) {
+        fprintf(diag_file,"error while opening file %s\n", file_name);
         err1 = STATUS_ERR;
         return err1;
     }
     if((fseek(curr_file,0,SEEK_SET)) != 0) {
-        fprintf(stderr,"error trying to pass on the file %s\n", file_name);
+        fprintf(diag_file,"error trying to pass on the file %s\n", file_name);
+        close_source(curr_file);
         err1 = STATUS_ERR;
         return err1;
     }
-    line = (char*) malloc(sizeof(char)*(MAX_LINE + 1));
-    alloc_check(line);
-    label = (char*) malloc(sizeof(char)*(MAX_LINE+1));
-    alloc_check(label);
+    line = (char*) arena_alloc(&file_arena, MAX_LINE + 1);
+    label = (char*) arena_alloc(&file_arena, MAX_LINE + 1);
 
     while(TRUE){
         num_ln++;
         err_ln = FALSE;
         label_flag = FALSE;
+        arena_reset(&line_arena); /*the scratch buffers of the last line are not needed anymore*/
         /*step 2:*/
         if(read_line(curr_file, line) == FALSE)
             break;
@@ -177,7 +179,7 @@ int pass_one(char *file_name) {
             } else {
                 /*step 12:*/
                 if(label_flag == TRUE) {
-                    if(add_symbol(IC, label, CODE,FALSE) == FALSE)
+                    if(add_symbol(IC-CODE_BASE, label, CODE,FALSE) == FALSE)
                         pass_one_error(file_name,num_ln);
                 }
                 /*steps 13 and 14:*/
@@ -194,8 +196,7 @@ int pass_one(char *file_name) {
         }
     }
     /*step 17:*/
-    free(line);
-    free (label);
+    close_source(curr_file);
     if(err1 == STATUS_ERR) {
         return err1;
     }
@@ -204,16 +205,11 @@ int pass_one(char *file_name) {
     DCF = DC;
     /*check memory here:*/
     if(!memory_lim(ICF+DCF)) {
-        fprintf(stderr,"error: this file requests more storage than this computer has (it has 2^25 bytes of storage)\n");
+        fprintf(diag_file,"error: this file requests more storage than this computer has (it has 2^25 bytes of storage)\n");
         err1 = STATUS_ERR;
         return err1;
     }
-    /*step 19:*/
-    if(data_exists)
-        update_data_img(ICF);
-    /*step 20:*/
-    update_symbol_table(ICF);
-    /*step 21*/
+    /*step 19*/
     return STATUS_OK;
 }
 
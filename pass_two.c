@@ -18,6 +18,9 @@
 * Module Variable Definitions
 *******************************************************************************/
 int err2;
+extern asm_options options;
+extern arena file_arena, line_arena;
+extern FILE *diag_file;
 
 /******************************************************************************
 * Function Definitions
@@ -35,7 +38,8 @@ int err2;
 *******************************************************************************/
 void pass_two_error(char* file_name,unsigned long num_ln) {
     err2 = STATUS_ERR;
-    fprintf(stderr,"[%s | %lu]\n",file_name,num_ln);
+    fprintf(diag_file,"[%s | %lu]\n",file_name,num_ln);
+    callback_error(); /*see library.c*/
 }
 
 /******************************************************************************
@@ -65,27 +69,33 @@ int pass_two(char *file_name) {
     char *line = NULL;
     char *pos = NULL;
     char *label = NULL;
-    unsigned long IC = 100;
+    unsigned long IC = CODE_BASE;
     unsigned opcode;
     int i;
     char order_type;
     err2 = STATUS_OK;
-    if((curr_file=fopen(file_name,"r"))==NULL) {
-        fprintf(stderr,"error while opening file");
+    if((curr_file=open_source(file_name))==NULL) {
+        fprintf(diag_file,"error while opening file");
         err2 = STATUS_ERR;
         return err2;
     }
     if((fseek(curr_file,0,SEEK_SET)) != 0) {
-        fprintf(stderr,"error trying to pass on the file %s\n", file_name);
+        fprintf(diag_file,"error trying to pass on the file %s\n", file_name);
+        close_source(curr_file);
         err2 = STATUS_ERR;
         return err2;
     }
-    line = (char*) malloc (sizeof(char) * MAX_LINE+1);
-    alloc_check(line);
-    label = (char*) malloc (sizeof(char) * MAX_LABEL+1);
-    alloc_check(label);
+    /*with --stream, the object file is written while this pass goes on*/
+    if(options.stream && stream_start(file_name) == STATUS_ERR) {
+        close_source(curr_file);
+        err2 = STATUS_ERR;
+        return err2;
+    }
+    line = (char*) arena_alloc(&file_arena, MAX_LINE+1);
+    label = (char*) arena_alloc(&file_arena, MAX_LINE+1);
     while(TRUE) {
         num_ln++;
+        arena_reset(&line_arena); /*the scratch buffers of the last line are not needed anymore*/
         /*step 1:*/
         if(read_line(curr_file,line) == FALSE)
             break;
@@ -113,6 +123,8 @@ int pass_two(char *file_name) {
                 scan_label(pos,label); /*keeping the label that shows up as operand to add the attribute "entry" to it*/
                 if (add_ent(label) == FALSE) { /*adding the attribute "entry" to the label*/
                     pass_two_error(file_name, num_ln);
+                } else if(options.xref_file) {
+                    add_xref(label, 0, num_ln, XREF_ENTRY);
                 }
             }
         } else {
@@ -138,13 +150,18 @@ int pass_two(char *file_name) {
                 /*there is missing info in these order (conditional branch or J orders besides "stop")*/
                 if (complete_missing_info(label, order_type, IC) == FALSE)
                     pass_two_error(file_name,num_ln);
+                else if(options.xref_file) /*keeping the use of the label for the cross reference file*/
+                    add_xref(label, IC, num_ln, (order_type == 'I') ? XREF_BRANCH : XREF_JUMP);
             }
             IC+=WORD;
+            stream_code((IC-CODE_BASE)/WORD); /*the orders before IC are final*/
         }
+        callback_records((IC-CODE_BASE)/WORD); /*the output that became final on this line (see library.c)*/
     }
     /*step 9*/
-    free(line);
-    free(label);
+    close_source(curr_file);
+    if(err2 == STATUS_ERR)
+        stream_abort();
     return err2;
 }
 
@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Title                 :   Assembler server
+* Filename              :   server.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file server.c
+ * \brief This module keeps the assembler running as a server on a unix socket (--serve=SOCKET), so a program
+ * that assembles many small source files (an editor, a test runner) does not start a new process for each one.
+ * the server is started once, with its memory allocated (see mem_allocate), and every connection is one request.
+ * the assembler keeps its state in global variables (the tables, the images, the options), so a request
+ * cannot share them with another one: each request is handled in a child process of its own (fork), which
+ * starts with a copy of the warm server, and requests are handled at the same time.
+ *
+ * a request is one line, and for an inline source file, the source itself right after it:
+ *      SOURCE <name>.as <length> [options]     - followed by exactly <length> bytes of source
+ *      PATH <path>.as [options]                - a source file the server can read
+ * the options are the same as in the command line (for example --ent-sorted), except the ones that write files
+ * (--sym, --xref, --stream, --io-uring, --format, --write-if-changed and --cache-dir): the output is only sent back.
+ * the response is made of sections, like the output of --stdout (see write_framed_output in files.c):
+ * the "ob", "ent" and "ext" sections if there are no errors, then a "diag" section with every error message
+ * (what the assembler would print to the standard error), then a "status" section with one character:
+ * '0' if there are no errors, '1' if there are.
+ */
+/*sockets, fork and the signals are POSIX, not ANSI C*/
+#define _POSIX_C_SOURCE 200809L
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assembler.h"
+#ifdef __unix__
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#endif
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define REQUEST_LINE_MAX    4096 /*the longest first line of a request*/
+#define SERVE_BACKLOG       64 /*connections that can wait for the server to accept them*/
+#define TEMP_DIR_TEMPLATE   "/tmp/asm-serve-XXXXXX" /*where an inline source file is kept while it is assembled*/
+#define COPY_CHUNK          4096
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+
+#ifdef __unix__
+static volatile sig_atomic_t stop_serving = 0; /*set by SIGINT or SIGTERM*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : stop_handler(int sig);
+*//**
+* \section Description: stops the server after the request it is accepting (SIGINT or SIGTERM)
+*******************************************************************************/
+void stop_handler(int sig) {
+    stop_serving = 1;
+}
+
+/******************************************************************************
+* Function : read_request_line(int fd, char *line);
+*//**
+* \section Description: reads the first line of a request (one byte at a time, so no byte of the source is read)
+*
+* \param  		fd - the connection
+* \param        line - the line is written here, without '\n'. must have REQUEST_LINE_MAX characters
+* \return       STATUS_OK if a whole line was read. otherwise: STATUS_ERR
+*******************************************************************************/
+int read_request_line(int fd, char *line) {
+    int i;
+    for(i = 0; i < REQUEST_LINE_MAX-1; i++) {
+        if(read(fd, line+i, 1) != 1)
+            return STATUS_ERR;
+        if(line[i] == '\n') {
+            line[i] = '\0';
+            return STATUS_OK;
+        }
+    }
+    return STATUS_ERR;
+}
+
+/******************************************************************************
+* Function : receive_source(int fd, char *fname, unsigned long length);
+*//**
+* \section Description: copies the bytes of an inline source file from the connection to a file
+*
+* \param  		fd - the connection
+* \param        fname - the file
+* \param        length - the number of bytes
+* \return       STATUS_OK if all of them were copied. otherwise: STATUS_ERR
+*******************************************************************************/
+int receive_source(int fd, char *fname, unsigned long length) {
+    char buffer[COPY_CHUNK];
+    FILE *fp;
+    ssize_t n = 0;
+    int err;
+    if((fp = fopen(fname,"wb")) == NULL)
+        return STATUS_ERR;
+    while(length > 0 && (n = read(fd, buffer, (length < COPY_CHUNK) ? length : COPY_CHUNK)) > 0) {
+        fwrite(buffer, 1, n, fp);
+        length -= n;
+    }
+    err = ferror(fp);
+    if(fclose(fp) != 0 || err || length > 0)
+        return STATUS_ERR;
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : handle_request(int fd);
+*//**
+* \section Description: handles one request, in the child process made for it (see \brief).
+*                       the standard output is the connection, and the standard error is a temporary file,
+*                       which is sent back as the "diag" section after the output
+*
+* \param  		fd - the connection
+* \return       STATUS_OK if the source file was assembled with no errors. otherwise: STATUS_ERR
+*******************************************************************************/
+int handle_request(int fd) {
+    char line[REQUEST_LINE_MAX], source[REQUEST_LINE_MAX], temp_dir[] = TEMP_DIR_TEMPLATE, buffer[COPY_CHUNK];
+    char *verb = NULL, *name = NULL, *arg, *end;
+    boolean inline_source = FALSE, in_temp_dir = FALSE;
+    unsigned long length = 0;
+    FILE *diag;
+    size_t n;
+    long diag_size;
+    int err = STATUS_ERR, name_length;
+
+    if((diag = tmpfile()) == NULL || dup2(fd, STDOUT_FILENO) < 0 || dup2(fileno(diag), STDERR_FILENO) < 0)
+        return STATUS_ERR;
+    /*the options of the server are the defaults, and the output always goes back on the connection*/
+    options.serve_path = NULL;
+    options.to_stdout = TRUE;
+    if(read_request_line(fd, line) == STATUS_ERR
+       || (verb = strtok(line, " ")) == NULL || (name = strtok(NULL, " ")) == NULL) {
+        fprintf(stderr,"error: a request should start with SOURCE <name> <length> or PATH <path>\n");
+    } else if(strcmp(verb, "SOURCE") != 0 && strcmp(verb, "PATH") != 0) {
+        fprintf(stderr,"error: unknown request (%s)\n", verb);
+    } else if((inline_source = (strcmp(verb, "SOURCE") == 0))
+              && (strchr(name, '/') != NULL || (arg = strtok(NULL, " ")) == NULL
+                  || (length = strtoul(arg, &end, 10), *end != '\0'))) {
+        fprintf(stderr,"error: SOURCE needs a file name (with no directory) and the length of the source\n");
+    } else {
+        err = STATUS_OK;
+        /*an inline source file is kept in a directory of its own, so its name does not matter*/
+        if(inline_source) {
+            in_temp_dir = (mkdtemp(temp_dir) != NULL && chdir(temp_dir) == 0);
+            if(!in_temp_dir || receive_source(fd, name, length) == STATUS_ERR) {
+                fprintf(stderr,"error: cannot receive the source file [%s]\n", name);
+                err = STATUS_ERR;
+            }
+        }
+        while(err == STATUS_OK && (arg = strtok(NULL, " ")) != NULL) {
+            if(!is_option(arg)) {
+                fprintf(stderr,"error: not an option (%s)\n", arg);
+                err = STATUS_ERR;
+            } else err = set_option(arg);
+        }
+        /*a request gets its output only on the connection: the options that write files are not allowed*/
+        if(err == STATUS_OK && (options.serve_path != NULL || options.sym_file || options.xref_file || options.stream
+                                || options.io_uring || options.format != FORMAT_TEXT || options.write_if_changed
+                                || options.cache_dir != NULL)) {
+            fprintf(stderr,"error: --serve, --sym, --xref, --stream, --io-uring, --format, --write-if-changed and "
+                           "--cache-dir cannot be used in a request\n");
+            err = STATUS_ERR;
+        }
+        if(err == STATUS_OK)
+            err = check_options();
+        if(err == STATUS_OK) {
+            strcpy(source, name); /*assemble changes the name it is given*/
+            err = assemble(source);
+        }
+        if(in_temp_dir) {
+            remove(name);
+            if(chdir("/") == 0)
+                rmdir(temp_dir);
+        }
+    }
+    /*the diagnostics and the status, after the output, named like the output (without .as)*/
+    if(name == NULL)
+        name = "-";
+    name_length = (int)strlen(name);
+    if(name_length > 3 && strcmp(name + name_length - 3, ".as") == 0)
+        name_length -= 3;
+    fflush(stderr);
+    diag_size = ftell(diag);
+    printf("@diag %.*s %ld\n", name_length, name, (diag_size < 0) ? 0L : diag_size);
+    rewind(diag);
+    while((n = fread(buffer, 1, COPY_CHUNK, diag)) > 0)
+        fwrite(buffer, 1, n, stdout);
+    printf("@status %.*s 1\n%c", name_length, name, (err == STATUS_OK) ? '0' : '1');
+    fflush(stdout);
+    /*a request that was not read to its end is read now: closing a socket with bytes waiting in it resets
+     *the connection, and the client could lose the response*/
+    shutdown(STDOUT_FILENO, SHUT_WR);
+    if(fcntl(fd, F_SETFL, O_NONBLOCK) == 0)
+        while(read(fd, buffer, COPY_CHUNK) > 0);
+    return err;
+}
+
+/******************************************************************************
+* Function : serve(char *socket_path);
+*//**
+* \section Description: runs the server (see \brief) until it gets SIGINT or SIGTERM
+*
+* \param  		socket_path - the path of the unix socket (a socket left there by an older server is replaced)
+* \return       STATUS_OK if the server stopped normally. otherwise: STATUS_ERR (an error is printed)
+*******************************************************************************/
+int serve(char *socket_path) {
+    struct sockaddr_un address;
+    struct sigaction action;
+    struct stat info;
+    int listener, connection;
+    pid_t pid;
+
+    if(strlen(socket_path) >= sizeof(address.sun_path)) {
+        fprintf(stderr,"error: the socket path is too long [%s]\n",socket_path);
+        return STATUS_ERR;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+    if(stat(socket_path, &info) == 0 && S_ISSOCK(info.st_mode))
+        unlink(socket_path);
+    if((listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0
+       || bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, SERVE_BACKLOG) != 0) {
+        fprintf(stderr,"error: cannot listen on the socket [%s]\n",socket_path);
+        return STATUS_ERR;
+    }
+    /*the children are not waited for (they are reaped by the system), and a signal stops the server*/
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_IGN;
+    sigaction(SIGCHLD, &action, NULL);
+    action.sa_handler = stop_handler; /*with no SA_RESTART, accept returns when a signal comes*/
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    mem_allocate(); /*every request starts with this memory (see memory_mgmt.c)*/
+    fflush(stdout);
+    while(!stop_serving) {
+        if((connection = accept(listener, NULL, NULL)) < 0) {
+            if(errno == EINTR || errno == ECONNABORTED)
+                continue;
+            fprintf(stderr,"error: cannot accept a connection [%s]\n",socket_path);
+            break;
+        }
+        if((pid = fork()) == 0) {
+            close(listener);
+            exit(handle_request(connection));
+        }
+        if(pid < 0)
+            fprintf(stderr,"error: cannot make a process for a request [%s]\n",socket_path);
+        close(connection);
+    }
+    close(listener);
+    unlink(socket_path);
+    mem_release();
+    return STATUS_OK;
+}
+#else
+/******************************************************************************
+* Function : serve(char *socket_path);
+*//**
+* \section Description: on systems without unix sockets, there is no server
+*
+* \return       STATUS_ERR (an error is printed)
+*******************************************************************************/
+int serve(char *socket_path) {
+    fprintf(stderr,"error: --serve is not supported on this system\n");
+    return STATUS_ERR;
+}
+#endif
+
+/*************** END OF FUNCTIONS ***************************************************************************/
@@ -3,33 +3,40 @@
 # runs assembler on one input file and compares output to expected output files
 # expecting assemlber binary in currend directory
 # expecting input file (.as) and output files (.ob .ent .ext) in ./smoke_test directory
+# the assembler is run once for each of the modes below: every mode must give the same output files
 
 # test settings
 assembler="assembler.exe"
 asm_filename=$1
 EXIT_OK=0
+modes=("" "--max-memory=65536" "--stream" "--io-uring" "--max-memory=65536 --stream" "--max-memory=65536 --io-uring")
+failed=0
 
-echo "1. cleaning up current directory"
-rm $asm_filename.*
+for mode in "${modes[@]}"
+do
+	echo "1. cleaning up current directory"
+	rm $asm_filename.*
 
-echo "2. executing smoke test:"
-# copying input file to current directory
-cp ./smoke_test/$asm_filename.as .
-echo "	running assembler"
-./$assembler $asm_filename.as
-# check exit code
-if [ $? -ne $EXIT_OK ]
-then
-	exit $?
-fi
+	echo "2. executing smoke test: ${mode:-(default)}"
+	# copying input file to current directory
+	cp ./smoke_test/$asm_filename.as .
+	echo "	running assembler"
+	./$assembler $mode $asm_filename.as
+	# check exit code
+	status=$?
+	if [ $status -ne $EXIT_OK ]
+	then
+		exit $status
+	fi
 
-# compare output in current directory to expected output in ./smoke_test directory 
-echo "3. comparing outputs:"
-echo "	comparing .ob file:"
-diff -a -w -s $asm_filename.ob ./smoke_test/$asm_filename.ob
-echo "	comparing .ent file:"
-diff -a -w -s $asm_filename.ent ./smoke_test/$asm_filename.ent
-echo "	comparing .ext file:"
-diff -a -w -s $asm_filename.ext ./smoke_test/$asm_filename.ext
+	# compare output in current directory to expected output in ./smoke_test directory
+	echo "3. comparing outputs:"
+	echo "	comparing .ob file:"
+	diff -a -w -s $asm_filename.ob ./smoke_test/$asm_filename.ob || failed=1
+	echo "	comparing .ent file:"
+	diff -a -w -s $asm_filename.ent ./smoke_test/$asm_filename.ent || failed=1
+	echo "	comparing .ext file:"
+	diff -a -w -s $asm_filename.ext ./smoke_test/$asm_filename.ext || failed=1
+done
 
-exit 0
+exit $failed
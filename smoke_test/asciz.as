@@ -0,0 +1,16 @@
+;file asciz.as
+;.asciz after other data directives
+
+.entry MSG
+.extern ext1
+NUMS: .db 7,-3,12
+MAIN: la MSG
+    add $1,$2,$3
+HALF: .dh 1000,-2
+MSG: .asciz "hello"
+    call ext1
+WORDS: .dw 123456,-1
+TAIL: .asciz "ab"
+    la TAIL
+    stop
+.entry TAIL
@@ -0,0 +1,25614 @@
+;file big.as
+;a big source: its images are big enough for the threads of parallel_files.c,
+;and for --max-memory=65536 to spill them to temporary files (see spill.c)
+
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+L0: add $1,$2,$3
+    ori $4,-100,$5
+    beq $6,$7,L0
+    jmp L1
+    la X0
+    call L0
+    sw $8,0,$9
+    bne $10,$11,L0
+W0: .dw 0,0
+B0: .db 0,0,7
+S0: .asciz "str0"
+    .dh 0
+.entry L0
+.entry W0
+L1: add $8,$9,$10
+    ori $11,-99,$12
+    beq $13,$14,L1
+    jmp L2
+    la X1
+    call L13
+    sw $15,1,$16
+    bne $17,$18,L0
+W1: .dw 1000,-1
+B1: .db 1,-1,7
+L2: add $15,$16,$17
+    ori $18,-98,$19
+    beq $20,$21,L2
+    jmp L3
+    la X2
+    call L26
+    sw $22,2,$23
+    bne $24,$25,L1
+W2: .dw 2000,-2
+B2: .db 2,-2,7
+L3: add $22,$23,$24
+    ori $25,-97,$26
+    beq $27,$28,L3
+    jmp L4
+    la X3
+    call L39
+    sw $29,3,$30
+    bne $31,$0,L2
+W3: .dw 3000,-3
+B3: .db 3,-3,7
+L4: add $29,$30,$31
+    ori $0,-96,$1
+    beq $2,$3,L4
+    jmp L5
+    la X4
+    call L52
+    sw $4,4,$5
+    bne $6,$7,L3
+W4: .dw 4000,-4
+B4: .db 4,-4,7
+L5: add $4,$5,$6
+    ori $7,-95,$8
+    beq $9,$10,L5
+    jmp L6
+    la X5
+    call L65
+    sw $11,5,$12
+    bne $13,$14,L4
+W5: .dw 5000,-5
+B5: .db 5,-5,7
+L6: add $11,$12,$13
+    ori $14,-94,$15
+    beq $16,$17,L6
+    jmp L7
+    la X6
+    call L78
+    sw $18,6,$19
+    bne $20,$21,L5
+W6: .dw 6000,-6
+B6: .db 6,-6,7
+L7: add $18,$19,$20
+    ori $21,-93,$22
+    beq $23,$24,L7
+    jmp L8
+    la X7
+    call L91
+    sw $25,7,$26
+    bne $27,$28,L6
+W7: .dw 7000,-7
+B7: .db 7,-7,7
+L8: add $25,$26,$27
+    ori $28,-92,$29
+    beq $30,$31,L8
+    jmp L9
+    la X0
+    call L104
+    sw $0,8,$1
+    bne $2,$3,L7
+W8: .dw 8000,-8
+B8: .db 8,-8,7
+L9: add $0,$1,$2
+    ori $3,-91,$4
+    beq $5,$6,L9
+    jmp L10
+    la X1
+    call L117
+    sw $7,9,$8
+    bne $9,$10,L8
+W9: .dw 9000,-9
+B9: .db 9,-9,7
+L10: add $7,$8,$9
+    ori $10,-90,$11
+    beq $12,$13,L10
+    jmp L11
+    la X2
+    call L130
+    sw $14,10,$15
+    bne $16,$17,L9
+W10: .dw 10000,-10
+B10: .db 10,-10,7
+S10: .asciz "str10"
+    .dh 10
+L11: add $14,$15,$16
+    ori $17,-89,$18
+    beq $19,$20,L11
+    jmp L12
+    la X3
+    call L143
+    sw $21,11,$22
+    bne $23,$24,L10
+W11: .dw 11000,-11
+B11: .db 11,-11,7
+L12: add $21,$22,$23
+    ori $24,-88,$25
+    beq $26,$27,L12
+    jmp L13
+    la X4
+    call L156
+    sw $28,12,$29
+    bne $30,$31,L11
+W12: .dw 12000,-12
+B12: .db 12,-12,7
+L13: add $28,$29,$30
+    ori $31,-87,$0
+    beq $1,$2,L13
+    jmp L14
+    la X5
+    call L169
+    sw $3,13,$4
+    bne $5,$6,L12
+W13: .dw 13000,-13
+B13: .db 13,-13,7
+L14: add $3,$4,$5
+    ori $6,-86,$7
+    beq $8,$9,L14
+    jmp L15
+    la X6
+    call L182
+    sw $10,14,$11
+    bne $12,$13,L13
+W14: .dw 14000,-14
+B14: .db 14,-14,7
+L15: add $10,$11,$12
+    ori $13,-85,$14
+    beq $15,$16,L15
+    jmp L16
+    la X7
+    call L195
+    sw $17,15,$18
+    bne $19,$20,L14
+W15: .dw 15000,-15
+B15: .db 15,-15,7
+L16: add $17,$18,$19
+    ori $20,-84,$21
+    beq $22,$23,L16
+    jmp L17
+    la X0
+    call L208
+    sw $24,16,$25
+    bne $26,$27,L15
+W16: .dw 16000,-16
+B16: .db 16,-16,7
+L17: add $24,$25,$26
+    ori $27,-83,$28
+    beq $29,$30,L17
+    jmp L18
+    la X1
+    call L221
+    sw $31,17,$0
+    bne $1,$2,L16
+W17: .dw 17000,-17
+B17: .db 17,-17,7
+L18: add $31,$0,$1
+    ori $2,-82,$3
+    beq $4,$5,L18
+    jmp L19
+    la X2
+    call L234
+    sw $6,18,$7
+    bne $8,$9,L17
+W18: .dw 18000,-18
+B18: .db 18,-18,7
+L19: add $6,$7,$8
+    ori $9,-81,$10
+    beq $11,$12,L19
+    jmp L20
+    la X3
+    call L247
+    sw $13,19,$14
+    bne $15,$16,L18
+W19: .dw 19000,-19
+B19: .db 19,-19,7
+L20: add $13,$14,$15
+    ori $16,-80,$17
+    beq $18,$19,L20
+    jmp L21
+    la X4
+    call L260
+    sw $20,20,$21
+    bne $22,$23,L19
+W20: .dw 20000,-20
+B20: .db 20,-20,7
+S20: .asciz "str20"
+    .dh 20
+L21: add $20,$21,$22
+    ori $23,-79,$24
+    beq $25,$26,L21
+    jmp L22
+    la X5
+    call L273
+    sw $27,21,$28
+    bne $29,$30,L20
+W21: .dw 21000,-21
+B21: .db 21,-21,7
+L22: add $27,$28,$29
+    ori $30,-78,$31
+    beq $0,$1,L22
+    jmp L23
+    la X6
+    call L286
+    sw $2,22,$3
+    bne $4,$5,L21
+W22: .dw 22000,-22
+B22: .db 22,-22,7
+L23: add $2,$3,$4
+    ori $5,-77,$6
+    beq $7,$8,L23
+    jmp L24
+    la X7
+    call L299
+    sw $9,23,$10
+    bne $11,$12,L22
+W23: .dw 23000,-23
+B23: .db 23,-23,7
+L24: add $9,$10,$11
+    ori $12,-76,$13
+    beq $14,$15,L24
+    jmp L25
+    la X0
+    call L312
+    sw $16,24,$17
+    bne $18,$19,L23
+W24: .dw 24000,-24
+B24: .db 24,-24,7
+L25: add $16,$17,$18
+    ori $19,-75,$20
+    beq $21,$22,L25
+    jmp L26
+    la X1
+    call L325
+    sw $23,25,$24
+    bne $25,$26,L24
+W25: .dw 25000,-25
+B25: .db 25,-25,7
+L26: add $23,$24,$25
+    ori $26,-74,$27
+    beq $28,$29,L26
+    jmp L27
+    la X2
+    call L338
+    sw $30,26,$31
+    bne $0,$1,L25
+W26: .dw 26000,-26
+B26: .db 26,-26,7
+L27: add $30,$31,$0
+    ori $1,-73,$2
+    beq $3,$4,L27
+    jmp L28
+    la X3
+    call L351
+    sw $5,27,$6
+    bne $7,$8,L26
+W27: .dw 27000,-27
+B27: .db 27,-27,7
+L28: add $5,$6,$7
+    ori $8,-72,$9
+    beq $10,$11,L28
+    jmp L29
+    la X4
+    call L364
+    sw $12,28,$13
+    bne $14,$15,L27
+W28: .dw 28000,-28
+B28: .db 28,-28,7
+L29: add $12,$13,$14
+    ori $15,-71,$16
+    beq $17,$18,L29
+    jmp L30
+    la X5
+    call L377
+    sw $19,29,$20
+    bne $21,$22,L28
+W29: .dw 29000,-29
+B29: .db 29,-29,7
+L30: add $19,$20,$21
+    ori $22,-70,$23
+    beq $24,$25,L30
+    jmp L31
+    la X6
+    call L390
+    sw $26,30,$27
+    bne $28,$29,L29
+W30: .dw 30000,-30
+B30: .db 30,-30,7
+S30: .asciz "str30"
+    .dh 30
+L31: add $26,$27,$28
+    ori $29,-69,$30
+    beq $31,$0,L31
+    jmp L32
+    la X7
+    call L403
+    sw $1,31,$2
+    bne $3,$4,L30
+W31: .dw 31000,-31
+B31: .db 31,-31,7
+L32: add $1,$2,$3
+    ori $4,-68,$5
+    beq $6,$7,L32
+    jmp L33
+    la X0
+    call L416
+    sw $8,32,$9
+    bne $10,$11,L31
+W32: .dw 32000,-32
+B32: .db 32,-32,7
+L33: add $8,$9,$10
+    ori $11,-67,$12
+    beq $13,$14,L33
+    jmp L34
+    la X1
+    call L429
+    sw $15,33,$16
+    bne $17,$18,L32
+W33: .dw 33000,-33
+B33: .db 33,-33,7
+L34: add $15,$16,$17
+    ori $18,-66,$19
+    beq $20,$21,L34
+    jmp L35
+    la X2
+    call L442
+    sw $22,34,$23
+    bne $24,$25,L33
+W34: .dw 34000,-34
+B34: .db 34,-34,7
+L35: add $22,$23,$24
+    ori $25,-65,$26
+    beq $27,$28,L35
+    jmp L36
+    la X3
+    call L455
+    sw $29,35,$30
+    bne $31,$0,L34
+W35: .dw 35000,-35
+B35: .db 35,-35,7
+L36: add $29,$30,$31
+    ori $0,-64,$1
+    beq $2,$3,L36
+    jmp L37
+    la X4
+    call L468
+    sw $4,36,$5
+    bne $6,$7,L35
+W36: .dw 36000,-36
+B36: .db 36,-36,7
+L37: add $4,$5,$6
+    ori $7,-63,$8
+    beq $9,$10,L37
+    jmp L38
+    la X5
+    call L481
+    sw $11,37,$12
+    bne $13,$14,L36
+W37: .dw 37000,-37
+B37: .db 37,-37,7
+L38: add $11,$12,$13
+    ori $14,-62,$15
+    beq $16,$17,L38
+    jmp L39
+    la X6
+    call L494
+    sw $18,38,$19
+    bne $20,$21,L37
+W38: .dw 38000,-38
+B38: .db 38,-38,7
+L39: add $18,$19,$20
+    ori $21,-61,$22
+    beq $23,$24,L39
+    jmp L40
+    la X7
+    call L507
+    sw $25,39,$26
+    bne $27,$28,L38
+W39: .dw 39000,-39
+B39: .db 39,-39,7
+L40: add $25,$26,$27
+    ori $28,-60,$29
+    beq $30,$31,L40
+    jmp L41
+    la X0
+    call L520
+    sw $0,40,$1
+    bne $2,$3,L39
+W40: .dw 40000,-40
+B40: .db 40,-40,7
+S40: .asciz "str40"
+    .dh 40
+L41: add $0,$1,$2
+    ori $3,-59,$4
+    beq $5,$6,L41
+    jmp L42
+    la X1
+    call L533
+    sw $7,41,$8
+    bne $9,$10,L40
+W41: .dw 41000,-41
+B41: .db 41,-41,7
+L42: add $7,$8,$9
+    ori $10,-58,$11
+    beq $12,$13,L42
+    jmp L43
+    la X2
+    call L546
+    sw $14,42,$15
+    bne $16,$17,L41
+W42: .dw 42000,-42
+B42: .db 42,-42,7
+L43: add $14,$15,$16
+    ori $17,-57,$18
+    beq $19,$20,L43
+    jmp L44
+    la X3
+    call L559
+    sw $21,43,$22
+    bne $23,$24,L42
+W43: .dw 43000,-43
+B43: .db 43,-43,7
+L44: add $21,$22,$23
+    ori $24,-56,$25
+    beq $26,$27,L44
+    jmp L45
+    la X4
+    call L572
+    sw $28,44,$29
+    bne $30,$31,L43
+W44: .dw 44000,-44
+B44: .db 44,-44,7
+L45: add $28,$29,$30
+    ori $31,-55,$0
+    beq $1,$2,L45
+    jmp L46
+    la X5
+    call L585
+    sw $3,45,$4
+    bne $5,$6,L44
+W45: .dw 45000,-45
+B45: .db 45,-45,7
+L46: add $3,$4,$5
+    ori $6,-54,$7
+    beq $8,$9,L46
+    jmp L47
+    la X6
+    call L598
+    sw $10,46,$11
+    bne $12,$13,L45
+W46: .dw 46000,-46
+B46: .db 46,-46,7
+L47: add $10,$11,$12
+    ori $13,-53,$14
+    beq $15,$16,L47
+    jmp L48
+    la X7
+    call L611
+    sw $17,47,$18
+    bne $19,$20,L46
+W47: .dw 47000,-47
+B47: .db 47,-47,7
+L48: add $17,$18,$19
+    ori $20,-52,$21
+    beq $22,$23,L48
+    jmp L49
+    la X0
+    call L624
+    sw $24,48,$25
+    bne $26,$27,L47
+W48: .dw 48000,-48
+B48: .db 48,-48,7
+L49: add $24,$25,$26
+    ori $27,-51,$28
+    beq $29,$30,L49
+    jmp L50
+    la X1
+    call L637
+    sw $31,49,$0
+    bne $1,$2,L48
+W49: .dw 49000,-49
+B49: .db 49,-49,7
+L50: add $31,$0,$1
+    ori $2,-50,$3
+    beq $4,$5,L50
+    jmp L51
+    la X2
+    call L650
+    sw $6,50,$7
+    bne $8,$9,L49
+W50: .dw 50000,-50
+B50: .db 50,-50,7
+S50: .asciz "str50"
+    .dh 50
+.entry L50
+.entry W50
+L51: add $6,$7,$8
+    ori $9,-49,$10
+    beq $11,$12,L51
+    jmp L52
+    la X3
+    call L663
+    sw $13,51,$14
+    bne $15,$16,L50
+W51: .dw 51000,-51
+B51: .db 51,-51,7
+L52: add $13,$14,$15
+    ori $16,-48,$17
+    beq $18,$19,L52
+    jmp L53
+    la X4
+    call L676
+    sw $20,52,$21
+    bne $22,$23,L51
+W52: .dw 52000,-52
+B52: .db 52,-52,7
+L53: add $20,$21,$22
+    ori $23,-47,$24
+    beq $25,$26,L53
+    jmp L54
+    la X5
+    call L689
+    sw $27,53,$28
+    bne $29,$30,L52
+W53: .dw 53000,-53
+B53: .db 53,-53,7
+L54: add $27,$28,$29
+    ori $30,-46,$31
+    beq $0,$1,L54
+    jmp L55
+    la X6
+    call L702
+    sw $2,54,$3
+    bne $4,$5,L53
+W54: .dw 54000,-54
+B54: .db 54,-54,7
+L55: add $2,$3,$4
+    ori $5,-45,$6
+    beq $7,$8,L55
+    jmp L56
+    la X7
+    call L715
+    sw $9,55,$10
+    bne $11,$12,L54
+W55: .dw 55000,-55
+B55: .db 55,-55,7
+L56: add $9,$10,$11
+    ori $12,-44,$13
+    beq $14,$15,L56
+    jmp L57
+    la X0
+    call L728
+    sw $16,56,$17
+    bne $18,$19,L55
+W56: .dw 56000,-56
+B56: .db 56,-56,7
+L57: add $16,$17,$18
+    ori $19,-43,$20
+    beq $21,$22,L57
+    jmp L58
+    la X1
+    call L741
+    sw $23,57,$24
+    bne $25,$26,L56
+W57: .dw 57000,-57
+B57: .db 57,-57,7
+L58: add $23,$24,$25
+    ori $26,-42,$27
+    beq $28,$29,L58
+    jmp L59
+    la X2
+    call L754
+    sw $30,58,$31
+    bne $0,$1,L57
+W58: .dw 58000,-58
+B58: .db 58,-58,7
+L59: add $30,$31,$0
+    ori $1,-41,$2
+    beq $3,$4,L59
+    jmp L60
+    la X3
+    call L767
+    sw $5,59,$6
+    bne $7,$8,L58
+W59: .dw 59000,-59
+B59: .db 59,-59,7
+L60: add $5,$6,$7
+    ori $8,-40,$9
+    beq $10,$11,L60
+    jmp L61
+    la X4
+    call L780
+    sw $12,60,$13
+    bne $14,$15,L59
+W60: .dw 60000,-60
+B60: .db 60,-60,7
+S60: .asciz "str60"
+    .dh 60
+L61: add $12,$13,$14
+    ori $15,-39,$16
+    beq $17,$18,L61
+    jmp L62
+    la X5
+    call L793
+    sw $19,61,$20
+    bne $21,$22,L60
+W61: .dw 61000,-61
+B61: .db 61,-61,7
+L62: add $19,$20,$21
+    ori $22,-38,$23
+    beq $24,$25,L62
+    jmp L63
+    la X6
+    call L806
+    sw $26,62,$27
+    bne $28,$29,L61
+W62: .dw 62000,-62
+B62: .db 62,-62,7
+L63: add $26,$27,$28
+    ori $29,-37,$30
+    beq $31,$0,L63
+    jmp L64
+    la X7
+    call L819
+    sw $1,63,$2
+    bne $3,$4,L62
+W63: .dw 63000,-63
+B63: .db 63,-63,7
+L64: add $1,$2,$3
+    ori $4,-36,$5
+    beq $6,$7,L64
+    jmp L65
+    la X0
+    call L832
+    sw $8,64,$9
+    bne $10,$11,L63
+W64: .dw 64000,-64
+B64: .db 64,-64,7
+L65: add $8,$9,$10
+    ori $11,-35,$12
+    beq $13,$14,L65
+    jmp L66
+    la X1
+    call L845
+    sw $15,65,$16
+    bne $17,$18,L64
+W65: .dw 65000,-65
+B65: .db 65,-65,7
+L66: add $15,$16,$17
+    ori $18,-34,$19
+    beq $20,$21,L66
+    jmp L67
+    la X2
+    call L858
+    sw $22,66,$23
+    bne $24,$25,L65
+W66: .dw 66000,-66
+B66: .db 66,-66,7
+L67: add $22,$23,$24
+    ori $25,-33,$26
+    beq $27,$28,L67
+    jmp L68
+    la X3
+    call L871
+    sw $29,67,$30
+    bne $31,$0,L66
+W67: .dw 67000,-67
+B67: .db 67,-67,7
+L68: add $29,$30,$31
+    ori $0,-32,$1
+    beq $2,$3,L68
+    jmp L69
+    la X4
+    call L884
+    sw $4,68,$5
+    bne $6,$7,L67
+W68: .dw 68000,-68
+B68: .db 68,-68,7
+L69: add $4,$5,$6
+    ori $7,-31,$8
+    beq $9,$10,L69
+    jmp L70
+    la X5
+    call L897
+    sw $11,69,$12
+    bne $13,$14,L68
+W69: .dw 69000,-69
+B69: .db 69,-69,7
+L70: add $11,$12,$13
+    ori $14,-30,$15
+    beq $16,$17,L70
+    jmp L71
+    la X6
+    call L910
+    sw $18,70,$19
+    bne $20,$21,L69
+W70: .dw 70000,-70
+B70: .db 70,-70,7
+S70: .asciz "str70"
+    .dh 70
+L71: add $18,$19,$20
+    ori $21,-29,$22
+    beq $23,$24,L71
+    jmp L72
+    la X7
+    call L923
+    sw $25,71,$26
+    bne $27,$28,L70
+W71: .dw 71000,-71
+B71: .db 71,-71,7
+L72: add $25,$26,$27
+    ori $28,-28,$29
+    beq $30,$31,L72
+    jmp L73
+    la X0
+    call L936
+    sw $0,72,$1
+    bne $2,$3,L71
+W72: .dw 72000,-72
+B72: .db 72,-72,7
+L73: add $0,$1,$2
+    ori $3,-27,$4
+    beq $5,$6,L73
+    jmp L74
+    la X1
+    call L949
+    sw $7,73,$8
+    bne $9,$10,L72
+W73: .dw 73000,-73
+B73: .db 73,-73,7
+L74: add $7,$8,$9
+    ori $10,-26,$11
+    beq $12,$13,L74
+    jmp L75
+    la X2
+    call L962
+    sw $14,74,$15
+    bne $16,$17,L73
+W74: .dw 74000,-74
+B74: .db 74,-74,7
+L75: add $14,$15,$16
+    ori $17,-25,$18
+    beq $19,$20,L75
+    jmp L76
+    la X3
+    call L975
+    sw $21,75,$22
+    bne $23,$24,L74
+W75: .dw 75000,-75
+B75: .db 75,-75,7
+L76: add $21,$22,$23
+    ori $24,-24,$25
+    beq $26,$27,L76
+    jmp L77
+    la X4
+    call L988
+    sw $28,76,$29
+    bne $30,$31,L75
+W76: .dw 76000,-76
+B76: .db 76,-76,7
+L77: add $28,$29,$30
+    ori $31,-23,$0
+    beq $1,$2,L77
+    jmp L78
+    la X5
+    call L1001
+    sw $3,77,$4
+    bne $5,$6,L76
+W77: .dw 77000,-77
+B77: .db 77,-77,7
+L78: add $3,$4,$5
+    ori $6,-22,$7
+    beq $8,$9,L78
+    jmp L79
+    la X6
+    call L1014
+    sw $10,78,$11
+    bne $12,$13,L77
+W78: .dw 78000,-78
+B78: .db 78,-78,7
+L79: add $10,$11,$12
+    ori $13,-21,$14
+    beq $15,$16,L79
+    jmp L80
+    la X7
+    call L1027
+    sw $17,79,$18
+    bne $19,$20,L78
+W79: .dw 79000,-79
+B79: .db 79,-79,7
+L80: add $17,$18,$19
+    ori $20,-20,$21
+    beq $22,$23,L80
+    jmp L81
+    la X0
+    call L1040
+    sw $24,80,$25
+    bne $26,$27,L79
+W80: .dw 80000,-80
+B80: .db 80,-80,7
+S80: .asciz "str80"
+    .dh 80
+L81: add $24,$25,$26
+    ori $27,-19,$28
+    beq $29,$30,L81
+    jmp L82
+    la X1
+    call L1053
+    sw $31,81,$0
+    bne $1,$2,L80
+W81: .dw 81000,-81
+B81: .db 81,-81,7
+L82: add $31,$0,$1
+    ori $2,-18,$3
+    beq $4,$5,L82
+    jmp L83
+    la X2
+    call L1066
+    sw $6,82,$7
+    bne $8,$9,L81
+W82: .dw 82000,-82
+B82: .db 82,-82,7
+L83: add $6,$7,$8
+    ori $9,-17,$10
+    beq $11,$12,L83
+    jmp L84
+    la X3
+    call L1079
+    sw $13,83,$14
+    bne $15,$16,L82
+W83: .dw 83000,-83
+B83: .db 83,-83,7
+L84: add $13,$14,$15
+    ori $16,-16,$17
+    beq $18,$19,L84
+    jmp L85
+    la X4
+    call L1092
+    sw $20,84,$21
+    bne $22,$23,L83
+W84: .dw 84000,-84
+B84: .db 84,-84,7
+L85: add $20,$21,$22
+    ori $23,-15,$24
+    beq $25,$26,L85
+    jmp L86
+    la X5
+    call L1105
+    sw $27,85,$28
+    bne $29,$30,L84
+W85: .dw 85000,-85
+B85: .db 85,-85,7
+L86: add $27,$28,$29
+    ori $30,-14,$31
+    beq $0,$1,L86
+    jmp L87
+    la X6
+    call L1118
+    sw $2,86,$3
+    bne $4,$5,L85
+W86: .dw 86000,-86
+B86: .db 86,-86,7
+L87: add $2,$3,$4
+    ori $5,-13,$6
+    beq $7,$8,L87
+    jmp L88
+    la X7
+    call L1131
+    sw $9,87,$10
+    bne $11,$12,L86
+W87: .dw 87000,-87
+B87: .db 87,-87,7
+L88: add $9,$10,$11
+    ori $12,-12,$13
+    beq $14,$15,L88
+    jmp L89
+    la X0
+    call L1144
+    sw $16,88,$17
+    bne $18,$19,L87
+W88: .dw 88000,-88
+B88: .db 88,-88,7
+L89: add $16,$17,$18
+    ori $19,-11,$20
+    beq $21,$22,L89
+    jmp L90
+    la X1
+    call L1157
+    sw $23,89,$24
+    bne $25,$26,L88
+W89: .dw 89000,-89
+B89: .db 89,-89,7
+L90: add $23,$24,$25
+    ori $26,-10,$27
+    beq $28,$29,L90
+    jmp L91
+    la X2
+    call L1170
+    sw $30,90,$31
+    bne $0,$1,L89
+W90: .dw 90000,-90
+B90: .db 90,-90,7
+S90: .asciz "str90"
+    .dh 90
+L91: add $30,$31,$0
+    ori $1,-9,$2
+    beq $3,$4,L91
+    jmp L92
+    la X3
+    call L1183
+    sw $5,91,$6
+    bne $7,$8,L90
+W91: .dw 91000,-91
+B91: .db 91,-91,7
+L92: add $5,$6,$7
+    ori $8,-8,$9
+    beq $10,$11,L92
+    jmp L93
+    la X4
+    call L1196
+    sw $12,92,$13
+    bne $14,$15,L91
+W92: .dw 92000,-92
+B92: .db 92,-92,7
+L93: add $12,$13,$14
+    ori $15,-7,$16
+    beq $17,$18,L93
+    jmp L94
+    la X5
+    call L1209
+    sw $19,93,$20
+    bne $21,$22,L92
+W93: .dw 93000,-93
+B93: .db 93,-93,7
+L94: add $19,$20,$21
+    ori $22,-6,$23
+    beq $24,$25,L94
+    jmp L95
+    la X6
+    call L1222
+    sw $26,94,$27
+    bne $28,$29,L93
+W94: .dw 94000,-94
+B94: .db 94,-94,7
+L95: add $26,$27,$28
+    ori $29,-5,$30
+    beq $31,$0,L95
+    jmp L96
+    la X7
+    call L1235
+    sw $1,95,$2
+    bne $3,$4,L94
+W95: .dw 95000,-95
+B95: .db 95,-95,7
+L96: add $1,$2,$3
+    ori $4,-4,$5
+    beq $6,$7,L96
+    jmp L97
+    la X0
+    call L1248
+    sw $8,96,$9
+    bne $10,$11,L95
+W96: .dw 96000,-96
+B96: .db 96,-96,7
+L97: add $8,$9,$10
+    ori $11,-3,$12
+    beq $13,$14,L97
+    jmp L98
+    la X1
+    call L1261
+    sw $15,97,$16
+    bne $17,$18,L96
+W97: .dw 97000,-97
+B97: .db 97,-97,7
+L98: add $15,$16,$17
+    ori $18,-2,$19
+    beq $20,$21,L98
+    jmp L99
+    la X2
+    call L1274
+    sw $22,98,$23
+    bne $24,$25,L97
+W98: .dw 98000,-98
+B98: .db 98,-98,7
+L99: add $22,$23,$24
+    ori $25,-1,$26
+    beq $27,$28,L99
+    jmp L100
+    la X3
+    call L1287
+    sw $29,99,$30
+    bne $31,$0,L98
+W99: .dw 99000,-99
+B99: .db 99,-99,7
+L100: add $29,$30,$31
+    ori $0,0,$1
+    beq $2,$3,L100
+    jmp L101
+    la X4
+    call L1300
+    sw $4,0,$5
+    bne $6,$7,L99
+W100: .dw 100000,-100
+B100: .db 100,0,7
+S100: .asciz "str100"
+    .dh 100
+.entry L100
+.entry W100
+L101: add $4,$5,$6
+    ori $7,1,$8
+    beq $9,$10,L101
+    jmp L102
+    la X5
+    call L1313
+    sw $11,1,$12
+    bne $13,$14,L100
+W101: .dw 101000,-101
+B101: .db 101,-1,7
+L102: add $11,$12,$13
+    ori $14,2,$15
+    beq $16,$17,L102
+    jmp L103
+    la X6
+    call L1326
+    sw $18,2,$19
+    bne $20,$21,L101
+W102: .dw 102000,-102
+B102: .db 102,-2,7
+L103: add $18,$19,$20
+    ori $21,3,$22
+    beq $23,$24,L103
+    jmp L104
+    la X7
+    call L1339
+    sw $25,3,$26
+    bne $27,$28,L102
+W103: .dw 103000,-103
+B103: .db 103,-3,7
+L104: add $25,$26,$27
+    ori $28,4,$29
+    beq $30,$31,L104
+    jmp L105
+    la X0
+    call L1352
+    sw $0,4,$1
+    bne $2,$3,L103
+W104: .dw 104000,-104
+B104: .db 104,-4,7
+L105: add $0,$1,$2
+    ori $3,5,$4
+    beq $5,$6,L105
+    jmp L106
+    la X1
+    call L1365
+    sw $7,5,$8
+    bne $9,$10,L104
+W105: .dw 105000,-105
+B105: .db 105,-5,7
+L106: add $7,$8,$9
+    ori $10,6,$11
+    beq $12,$13,L106
+    jmp L107
+    la X2
+    call L1378
+    sw $14,6,$15
+    bne $16,$17,L105
+W106: .dw 106000,-106
+B106: .db 106,-6,7
+L107: add $14,$15,$16
+    ori $17,7,$18
+    beq $19,$20,L107
+    jmp L108
+    la X3
+    call L1391
+    sw $21,7,$22
+    bne $23,$24,L106
+W107: .dw 107000,-107
+B107: .db 107,-7,7
+L108: add $21,$22,$23
+    ori $24,8,$25
+    beq $26,$27,L108
+    jmp L109
+    la X4
+    call L1404
+    sw $28,8,$29
+    bne $30,$31,L107
+W108: .dw 108000,-108
+B108: .db 108,-8,7
+L109: add $28,$29,$30
+    ori $31,9,$0
+    beq $1,$2,L109
+    jmp L110
+    la X5
+    call L1417
+    sw $3,9,$4
+    bne $5,$6,L108
+W109: .dw 109000,-109
+B109: .db 109,-9,7
+L110: add $3,$4,$5
+    ori $6,10,$7
+    beq $8,$9,L110
+    jmp L111
+    la X6
+    call L1430
+    sw $10,10,$11
+    bne $12,$13,L109
+W110: .dw 110000,-110
+B110: .db 110,-10,7
+S110: .asciz "str110"
+    .dh 110
+L111: add $10,$11,$12
+    ori $13,11,$14
+    beq $15,$16,L111
+    jmp L112
+    la X7
+    call L1443
+    sw $17,11,$18
+    bne $19,$20,L110
+W111: .dw 111000,-111
+B111: .db 111,-11,7
+L112: add $17,$18,$19
+    ori $20,12,$21
+    beq $22,$23,L112
+    jmp L113
+    la X0
+    call L1456
+    sw $24,12,$25
+    bne $26,$27,L111
+W112: .dw 112000,-112
+B112: .db 112,-12,7
+L113: add $24,$25,$26
+    ori $27,13,$28
+    beq $29,$30,L113
+    jmp L114
+    la X1
+    call L1469
+    sw $31,13,$0
+    bne $1,$2,L112
+W113: .dw 113000,-113
+B113: .db 113,-13,7
+L114: add $31,$0,$1
+    ori $2,14,$3
+    beq $4,$5,L114
+    jmp L115
+    la X2
+    call L1482
+    sw $6,14,$7
+    bne $8,$9,L113
+W114: .dw 114000,-114
+B114: .db 114,-14,7
+L115: add $6,$7,$8
+    ori $9,15,$10
+    beq $11,$12,L115
+    jmp L116
+    la X3
+    call L1495
+    sw $13,15,$14
+    bne $15,$16,L114
+W115: .dw 115000,-115
+B115: .db 115,-15,7
+L116: add $13,$14,$15
+    ori $16,16,$17
+    beq $18,$19,L116
+    jmp L117
+    la X4
+    call L1508
+    sw $20,16,$21
+    bne $22,$23,L115
+W116: .dw 116000,-116
+B116: .db 116,-16,7
+L117: add $20,$21,$22
+    ori $23,17,$24
+    beq $25,$26,L117
+    jmp L118
+    la X5
+    call L1521
+    sw $27,17,$28
+    bne $29,$30,L116
+W117: .dw 117000,-117
+B117: .db 117,-17,7
+L118: add $27,$28,$29
+    ori $30,18,$31
+    beq $0,$1,L118
+    jmp L119
+    la X6
+    call L1534
+    sw $2,18,$3
+    bne $4,$5,L117
+W118: .dw 118000,-118
+B118: .db 118,-18,7
+L119: add $2,$3,$4
+    ori $5,19,$6
+    beq $7,$8,L119
+    jmp L120
+    la X7
+    call L1547
+    sw $9,19,$10
+    bne $11,$12,L118
+W119: .dw 119000,-119
+B119: .db 119,-19,7
+L120: add $9,$10,$11
+    ori $12,20,$13
+    beq $14,$15,L120
+    jmp L121
+    la X0
+    call L1560
+    sw $16,20,$17
+    bne $18,$19,L119
+W120: .dw 120000,-120
+B120: .db 120,-20,7
+S120: .asciz "str120"
+    .dh 120
+L121: add $16,$17,$18
+    ori $19,21,$20
+    beq $21,$22,L121
+    jmp L122
+    la X1
+    call L1573
+    sw $23,21,$24
+    bne $25,$26,L120
+W121: .dw 121000,-121
+B121: .db 121,-21,7
+L122: add $23,$24,$25
+    ori $26,22,$27
+    beq $28,$29,L122
+    jmp L123
+    la X2
+    call L1586
+    sw $30,22,$31
+    bne $0,$1,L121
+W122: .dw 122000,-122
+B122: .db 122,-22,7
+L123: add $30,$31,$0
+    ori $1,23,$2
+    beq $3,$4,L123
+    jmp L124
+    la X3
+    call L1599
+    sw $5,23,$6
+    bne $7,$8,L122
+W123: .dw 123000,-123
+B123: .db 123,-23,7
+L124: add $5,$6,$7
+    ori $8,24,$9
+    beq $10,$11,L124
+    jmp L125
+    la X4
+    call L1612
+    sw $12,24,$13
+    bne $14,$15,L123
+W124: .dw 124000,-124
+B124: .db 124,-24,7
+L125: add $12,$13,$14
+    ori $15,25,$16
+    beq $17,$18,L125
+    jmp L126
+    la X5
+    call L1625
+    sw $19,25,$20
+    bne $21,$22,L124
+W125: .dw 125000,-125
+B125: .db 125,-25,7
+L126: add $19,$20,$21
+    ori $22,26,$23
+    beq $24,$25,L126
+    jmp L127
+    la X6
+    call L1638
+    sw $26,26,$27
+    bne $28,$29,L125
+W126: .dw 126000,-126
+B126: .db 126,-26,7
+L127: add $26,$27,$28
+    ori $29,27,$30
+    beq $31,$0,L127
+    jmp L128
+    la X7
+    call L1651
+    sw $1,27,$2
+    bne $3,$4,L126
+W127: .dw 127000,-127
+B127: .db 127,-27,7
+L128: add $1,$2,$3
+    ori $4,28,$5
+    beq $6,$7,L128
+    jmp L129
+    la X0
+    call L1664
+    sw $8,28,$9
+    bne $10,$11,L127
+W128: .dw 128000,-128
+B128: .db 0,-28,7
+L129: add $8,$9,$10
+    ori $11,29,$12
+    beq $13,$14,L129
+    jmp L130
+    la X1
+    call L1677
+    sw $15,29,$16
+    bne $17,$18,L128
+W129: .dw 129000,-129
+B129: .db 1,-29,7
+L130: add $15,$16,$17
+    ori $18,30,$19
+    beq $20,$21,L130
+    jmp L131
+    la X2
+    call L1690
+    sw $22,30,$23
+    bne $24,$25,L129
+W130: .dw 130000,-130
+B130: .db 2,-30,7
+S130: .asciz "str130"
+    .dh 130
+L131: add $22,$23,$24
+    ori $25,31,$26
+    beq $27,$28,L131
+    jmp L132
+    la X3
+    call L1703
+    sw $29,31,$30
+    bne $31,$0,L130
+W131: .dw 131000,-131
+B131: .db 3,-31,7
+L132: add $29,$30,$31
+    ori $0,32,$1
+    beq $2,$3,L132
+    jmp L133
+    la X4
+    call L1716
+    sw $4,32,$5
+    bne $6,$7,L131
+W132: .dw 132000,-132
+B132: .db 4,-32,7
+L133: add $4,$5,$6
+    ori $7,33,$8
+    beq $9,$10,L133
+    jmp L134
+    la X5
+    call L1729
+    sw $11,33,$12
+    bne $13,$14,L132
+W133: .dw 133000,-133
+B133: .db 5,-33,7
+L134: add $11,$12,$13
+    ori $14,34,$15
+    beq $16,$17,L134
+    jmp L135
+    la X6
+    call L1742
+    sw $18,34,$19
+    bne $20,$21,L133
+W134: .dw 134000,-134
+B134: .db 6,-34,7
+L135: add $18,$19,$20
+    ori $21,35,$22
+    beq $23,$24,L135
+    jmp L136
+    la X7
+    call L1755
+    sw $25,35,$26
+    bne $27,$28,L134
+W135: .dw 135000,-135
+B135: .db 7,-35,7
+L136: add $25,$26,$27
+    ori $28,36,$29
+    beq $30,$31,L136
+    jmp L137
+    la X0
+    call L1768
+    sw $0,36,$1
+    bne $2,$3,L135
+W136: .dw 136000,-136
+B136: .db 8,-36,7
+L137: add $0,$1,$2
+    ori $3,37,$4
+    beq $5,$6,L137
+    jmp L138
+    la X1
+    call L1781
+    sw $7,37,$8
+    bne $9,$10,L136
+W137: .dw 137000,-137
+B137: .db 9,-37,7
+L138: add $7,$8,$9
+    ori $10,38,$11
+    beq $12,$13,L138
+    jmp L139
+    la X2
+    call L1794
+    sw $14,38,$15
+    bne $16,$17,L137
+W138: .dw 138000,-138
+B138: .db 10,-38,7
+L139: add $14,$15,$16
+    ori $17,39,$18
+    beq $19,$20,L139
+    jmp L140
+    la X3
+    call L1807
+    sw $21,39,$22
+    bne $23,$24,L138
+W139: .dw 139000,-139
+B139: .db 11,-39,7
+L140: add $21,$22,$23
+    ori $24,40,$25
+    beq $26,$27,L140
+    jmp L141
+    la X4
+    call L1820
+    sw $28,40,$29
+    bne $30,$31,L139
+W140: .dw 140000,-140
+B140: .db 12,-40,7
+S140: .asciz "str140"
+    .dh 140
+L141: add $28,$29,$30
+    ori $31,41,$0
+    beq $1,$2,L141
+    jmp L142
+    la X5
+    call L1833
+    sw $3,41,$4
+    bne $5,$6,L140
+W141: .dw 141000,-141
+B141: .db 13,-41,7
+L142: add $3,$4,$5
+    ori $6,42,$7
+    beq $8,$9,L142
+    jmp L143
+    la X6
+    call L1846
+    sw $10,42,$11
+    bne $12,$13,L141
+W142: .dw 142000,-142
+B142: .db 14,-42,7
+L143: add $10,$11,$12
+    ori $13,43,$14
+    beq $15,$16,L143
+    jmp L144
+    la X7
+    call L1859
+    sw $17,43,$18
+    bne $19,$20,L142
+W143: .dw 143000,-143
+B143: .db 15,-43,7
+L144: add $17,$18,$19
+    ori $20,44,$21
+    beq $22,$23,L144
+    jmp L145
+    la X0
+    call L1872
+    sw $24,44,$25
+    bne $26,$27,L143
+W144: .dw 144000,-144
+B144: .db 16,-44,7
+L145: add $24,$25,$26
+    ori $27,45,$28
+    beq $29,$30,L145
+    jmp L146
+    la X1
+    call L1885
+    sw $31,45,$0
+    bne $1,$2,L144
+W145: .dw 145000,-145
+B145: .db 17,-45,7
+L146: add $31,$0,$1
+    ori $2,46,$3
+    beq $4,$5,L146
+    jmp L147
+    la X2
+    call L1898
+    sw $6,46,$7
+    bne $8,$9,L145
+W146: .dw 146000,-146
+B146: .db 18,-46,7
+L147: add $6,$7,$8
+    ori $9,47,$10
+    beq $11,$12,L147
+    jmp L148
+    la X3
+    call L1911
+    sw $13,47,$14
+    bne $15,$16,L146
+W147: .dw 147000,-147
+B147: .db 19,-47,7
+L148: add $13,$14,$15
+    ori $16,48,$17
+    beq $18,$19,L148
+    jmp L149
+    la X4
+    call L1924
+    sw $20,48,$21
+    bne $22,$23,L147
+W148: .dw 148000,-148
+B148: .db 20,-48,7
+L149: add $20,$21,$22
+    ori $23,49,$24
+    beq $25,$26,L149
+    jmp L150
+    la X5
+    call L1937
+    sw $27,49,$28
+    bne $29,$30,L148
+W149: .dw 149000,-149
+B149: .db 21,-49,7
+L150: add $27,$28,$29
+    ori $30,50,$31
+    beq $0,$1,L150
+    jmp L151
+    la X6
+    call L1950
+    sw $2,50,$3
+    bne $4,$5,L149
+W150: .dw 150000,-150
+B150: .db 22,-50,7
+S150: .asciz "str150"
+    .dh 150
+.entry L150
+.entry W150
+L151: add $2,$3,$4
+    ori $5,51,$6
+    beq $7,$8,L151
+    jmp L152
+    la X7
+    call L1963
+    sw $9,51,$10
+    bne $11,$12,L150
+W151: .dw 151000,-151
+B151: .db 23,-51,7
+L152: add $9,$10,$11
+    ori $12,52,$13
+    beq $14,$15,L152
+    jmp L153
+    la X0
+    call L1976
+    sw $16,52,$17
+    bne $18,$19,L151
+W152: .dw 152000,-152
+B152: .db 24,-52,7
+L153: add $16,$17,$18
+    ori $19,53,$20
+    beq $21,$22,L153
+    jmp L154
+    la X1
+    call L1989
+    sw $23,53,$24
+    bne $25,$26,L152
+W153: .dw 153000,-153
+B153: .db 25,-53,7
+L154: add $23,$24,$25
+    ori $26,54,$27
+    beq $28,$29,L154
+    jmp L155
+    la X2
+    call L2002
+    sw $30,54,$31
+    bne $0,$1,L153
+W154: .dw 154000,-154
+B154: .db 26,-54,7
+L155: add $30,$31,$0
+    ori $1,55,$2
+    beq $3,$4,L155
+    jmp L156
+    la X3
+    call L2015
+    sw $5,55,$6
+    bne $7,$8,L154
+W155: .dw 155000,-155
+B155: .db 27,-55,7
+L156: add $5,$6,$7
+    ori $8,56,$9
+    beq $10,$11,L156
+    jmp L157
+    la X4
+    call L2028
+    sw $12,56,$13
+    bne $14,$15,L155
+W156: .dw 156000,-156
+B156: .db 28,-56,7
+L157: add $12,$13,$14
+    ori $15,57,$16
+    beq $17,$18,L157
+    jmp L158
+    la X5
+    call L2041
+    sw $19,57,$20
+    bne $21,$22,L156
+W157: .dw 157000,-157
+B157: .db 29,-57,7
+L158: add $19,$20,$21
+    ori $22,58,$23
+    beq $24,$25,L158
+    jmp L159
+    la X6
+    call L2054
+    sw $26,58,$27
+    bne $28,$29,L157
+W158: .dw 158000,-158
+B158: .db 30,-58,7
+L159: add $26,$27,$28
+    ori $29,59,$30
+    beq $31,$0,L159
+    jmp L160
+    la X7
+    call L2067
+    sw $1,59,$2
+    bne $3,$4,L158
+W159: .dw 159000,-159
+B159: .db 31,-59,7
+L160: add $1,$2,$3
+    ori $4,60,$5
+    beq $6,$7,L160
+    jmp L161
+    la X0
+    call L2080
+    sw $8,60,$9
+    bne $10,$11,L159
+W160: .dw 160000,-160
+B160: .db 32,-60,7
+S160: .asciz "str160"
+    .dh 160
+L161: add $8,$9,$10
+    ori $11,61,$12
+    beq $13,$14,L161
+    jmp L162
+    la X1
+    call L2093
+    sw $15,61,$16
+    bne $17,$18,L160
+W161: .dw 161000,-161
+B161: .db 33,-61,7
+L162: add $15,$16,$17
+    ori $18,62,$19
+    beq $20,$21,L162
+    jmp L163
+    la X2
+    call L2106
+    sw $22,62,$23
+    bne $24,$25,L161
+W162: .dw 162000,-162
+B162: .db 34,-62,7
+L163: add $22,$23,$24
+    ori $25,63,$26
+    beq $27,$28,L163
+    jmp L164
+    la X3
+    call L2119
+    sw $29,63,$30
+    bne $31,$0,L162
+W163: .dw 163000,-163
+B163: .db 35,-63,7
+L164: add $29,$30,$31
+    ori $0,64,$1
+    beq $2,$3,L164
+    jmp L165
+    la X4
+    call L2132
+    sw $4,64,$5
+    bne $6,$7,L163
+W164: .dw 164000,-164
+B164: .db 36,-64,7
+L165: add $4,$5,$6
+    ori $7,65,$8
+    beq $9,$10,L165
+    jmp L166
+    la X5
+    call L2145
+    sw $11,65,$12
+    bne $13,$14,L164
+W165: .dw 165000,-165
+B165: .db 37,-65,7
+L166: add $11,$12,$13
+    ori $14,66,$15
+    beq $16,$17,L166
+    jmp L167
+    la X6
+    call L2158
+    sw $18,66,$19
+    bne $20,$21,L165
+W166: .dw 166000,-166
+B166: .db 38,-66,7
+L167: add $18,$19,$20
+    ori $21,67,$22
+    beq $23,$24,L167
+    jmp L168
+    la X7
+    call L2171
+    sw $25,67,$26
+    bne $27,$28,L166
+W167: .dw 167000,-167
+B167: .db 39,-67,7
+L168: add $25,$26,$27
+    ori $28,68,$29
+    beq $30,$31,L168
+    jmp L169
+    la X0
+    call L2184
+    sw $0,68,$1
+    bne $2,$3,L167
+W168: .dw 168000,-168
+B168: .db 40,-68,7
+L169: add $0,$1,$2
+    ori $3,69,$4
+    beq $5,$6,L169
+    jmp L170
+    la X1
+    call L2197
+    sw $7,69,$8
+    bne $9,$10,L168
+W169: .dw 169000,-169
+B169: .db 41,-69,7
+L170: add $7,$8,$9
+    ori $10,70,$11
+    beq $12,$13,L170
+    jmp L171
+    la X2
+    call L2210
+    sw $14,70,$15
+    bne $16,$17,L169
+W170: .dw 170000,-170
+B170: .db 42,-70,7
+S170: .asciz "str170"
+    .dh 170
+L171: add $14,$15,$16
+    ori $17,71,$18
+    beq $19,$20,L171
+    jmp L172
+    la X3
+    call L2223
+    sw $21,71,$22
+    bne $23,$24,L170
+W171: .dw 171000,-171
+B171: .db 43,-71,7
+L172: add $21,$22,$23
+    ori $24,72,$25
+    beq $26,$27,L172
+    jmp L173
+    la X4
+    call L2236
+    sw $28,72,$29
+    bne $30,$31,L171
+W172: .dw 172000,-172
+B172: .db 44,-72,7
+L173: add $28,$29,$30
+    ori $31,73,$0
+    beq $1,$2,L173
+    jmp L174
+    la X5
+    call L2249
+    sw $3,73,$4
+    bne $5,$6,L172
+W173: .dw 173000,-173
+B173: .db 45,-73,7
+L174: add $3,$4,$5
+    ori $6,74,$7
+    beq $8,$9,L174
+    jmp L175
+    la X6
+    call L2262
+    sw $10,74,$11
+    bne $12,$13,L173
+W174: .dw 174000,-174
+B174: .db 46,-74,7
+L175: add $10,$11,$12
+    ori $13,75,$14
+    beq $15,$16,L175
+    jmp L176
+    la X7
+    call L2275
+    sw $17,75,$18
+    bne $19,$20,L174
+W175: .dw 175000,-175
+B175: .db 47,-75,7
+L176: add $17,$18,$19
+    ori $20,76,$21
+    beq $22,$23,L176
+    jmp L177
+    la X0
+    call L2288
+    sw $24,76,$25
+    bne $26,$27,L175
+W176: .dw 176000,-176
+B176: .db 48,-76,7
+L177: add $24,$25,$26
+    ori $27,77,$28
+    beq $29,$30,L177
+    jmp L178
+    la X1
+    call L2301
+    sw $31,77,$0
+    bne $1,$2,L176
+W177: .dw 177000,-177
+B177: .db 49,-77,7
+L178: add $31,$0,$1
+    ori $2,78,$3
+    beq $4,$5,L178
+    jmp L179
+    la X2
+    call L2314
+    sw $6,78,$7
+    bne $8,$9,L177
+W178: .dw 178000,-178
+B178: .db 50,-78,7
+L179: add $6,$7,$8
+    ori $9,79,$10
+    beq $11,$12,L179
+    jmp L180
+    la X3
+    call L2327
+    sw $13,79,$14
+    bne $15,$16,L178
+W179: .dw 179000,-179
+B179: .db 51,-79,7
+L180: add $13,$14,$15
+    ori $16,80,$17
+    beq $18,$19,L180
+    jmp L181
+    la X4
+    call L2340
+    sw $20,80,$21
+    bne $22,$23,L179
+W180: .dw 180000,-180
+B180: .db 52,-80,7
+S180: .asciz "str180"
+    .dh 180
+L181: add $20,$21,$22
+    ori $23,81,$24
+    beq $25,$26,L181
+    jmp L182
+    la X5
+    call L2353
+    sw $27,81,$28
+    bne $29,$30,L180
+W181: .dw 181000,-181
+B181: .db 53,-81,7
+L182: add $27,$28,$29
+    ori $30,82,$31
+    beq $0,$1,L182
+    jmp L183
+    la X6
+    call L2366
+    sw $2,82,$3
+    bne $4,$5,L181
+W182: .dw 182000,-182
+B182: .db 54,-82,7
+L183: add $2,$3,$4
+    ori $5,83,$6
+    beq $7,$8,L183
+    jmp L184
+    la X7
+    call L2379
+    sw $9,83,$10
+    bne $11,$12,L182
+W183: .dw 183000,-183
+B183: .db 55,-83,7
+L184: add $9,$10,$11
+    ori $12,84,$13
+    beq $14,$15,L184
+    jmp L185
+    la X0
+    call L2392
+    sw $16,84,$17
+    bne $18,$19,L183
+W184: .dw 184000,-184
+B184: .db 56,-84,7
+L185: add $16,$17,$18
+    ori $19,85,$20
+    beq $21,$22,L185
+    jmp L186
+    la X1
+    call L2405
+    sw $23,85,$24
+    bne $25,$26,L184
+W185: .dw 185000,-185
+B185: .db 57,-85,7
+L186: add $23,$24,$25
+    ori $26,86,$27
+    beq $28,$29,L186
+    jmp L187
+    la X2
+    call L2418
+    sw $30,86,$31
+    bne $0,$1,L185
+W186: .dw 186000,-186
+B186: .db 58,-86,7
+L187: add $30,$31,$0
+    ori $1,87,$2
+    beq $3,$4,L187
+    jmp L188
+    la X3
+    call L2431
+    sw $5,87,$6
+    bne $7,$8,L186
+W187: .dw 187000,-187
+B187: .db 59,-87,7
+L188: add $5,$6,$7
+    ori $8,88,$9
+    beq $10,$11,L188
+    jmp L189
+    la X4
+    call L2444
+    sw $12,88,$13
+    bne $14,$15,L187
+W188: .dw 188000,-188
+B188: .db 60,-88,7
+L189: add $12,$13,$14
+    ori $15,89,$16
+    beq $17,$18,L189
+    jmp L190
+    la X5
+    call L2457
+    sw $19,89,$20
+    bne $21,$22,L188
+W189: .dw 189000,-189
+B189: .db 61,-89,7
+L190: add $19,$20,$21
+    ori $22,90,$23
+    beq $24,$25,L190
+    jmp L191
+    la X6
+    call L2470
+    sw $26,90,$27
+    bne $28,$29,L189
+W190: .dw 190000,-190
+B190: .db 62,-90,7
+S190: .asciz "str190"
+    .dh 190
+L191: add $26,$27,$28
+    ori $29,91,$30
+    beq $31,$0,L191
+    jmp L192
+    la X7
+    call L2483
+    sw $1,91,$2
+    bne $3,$4,L190
+W191: .dw 191000,-191
+B191: .db 63,-91,7
+L192: add $1,$2,$3
+    ori $4,92,$5
+    beq $6,$7,L192
+    jmp L193
+    la X0
+    call L2496
+    sw $8,92,$9
+    bne $10,$11,L191
+W192: .dw 192000,-192
+B192: .db 64,-92,7
+L193: add $8,$9,$10
+    ori $11,93,$12
+    beq $13,$14,L193
+    jmp L194
+    la X1
+    call L9
+    sw $15,93,$16
+    bne $17,$18,L192
+W193: .dw 193000,-193
+B193: .db 65,-93,7
+L194: add $15,$16,$17
+    ori $18,94,$19
+    beq $20,$21,L194
+    jmp L195
+    la X2
+    call L22
+    sw $22,94,$23
+    bne $24,$25,L193
+W194: .dw 194000,-194
+B194: .db 66,-94,7
+L195: add $22,$23,$24
+    ori $25,95,$26
+    beq $27,$28,L195
+    jmp L196
+    la X3
+    call L35
+    sw $29,95,$30
+    bne $31,$0,L194
+W195: .dw 195000,-195
+B195: .db 67,-95,7
+L196: add $29,$30,$31
+    ori $0,96,$1
+    beq $2,$3,L196
+    jmp L197
+    la X4
+    call L48
+    sw $4,96,$5
+    bne $6,$7,L195
+W196: .dw 196000,-196
+B196: .db 68,-96,7
+L197: add $4,$5,$6
+    ori $7,97,$8
+    beq $9,$10,L197
+    jmp L198
+    la X5
+    call L61
+    sw $11,97,$12
+    bne $13,$14,L196
+W197: .dw 197000,-197
+B197: .db 69,-97,7
+L198: add $11,$12,$13
+    ori $14,98,$15
+    beq $16,$17,L198
+    jmp L199
+    la X6
+    call L74
+    sw $18,98,$19
+    bne $20,$21,L197
+W198: .dw 198000,-198
+B198: .db 70,-98,7
+L199: add $18,$19,$20
+    ori $21,99,$22
+    beq $23,$24,L199
+    jmp L200
+    la X7
+    call L87
+    sw $25,99,$26
+    bne $27,$28,L198
+W199: .dw 199000,-199
+B199: .db 71,-99,7
+L200: add $25,$26,$27
+    ori $28,-100,$29
+    beq $30,$31,L200
+    jmp L201
+    la X0
+    call L100
+    sw $0,0,$1
+    bne $2,$3,L199
+W200: .dw 200000,-200
+B200: .db 72,0,7
+S200: .asciz "str200"
+    .dh 200
+.entry L200
+.entry W200
+L201: add $0,$1,$2
+    ori $3,-99,$4
+    beq $5,$6,L201
+    jmp L202
+    la X1
+    call L113
+    sw $7,1,$8
+    bne $9,$10,L200
+W201: .dw 201000,-201
+B201: .db 73,-1,7
+L202: add $7,$8,$9
+    ori $10,-98,$11
+    beq $12,$13,L202
+    jmp L203
+    la X2
+    call L126
+    sw $14,2,$15
+    bne $16,$17,L201
+W202: .dw 202000,-202
+B202: .db 74,-2,7
+L203: add $14,$15,$16
+    ori $17,-97,$18
+    beq $19,$20,L203
+    jmp L204
+    la X3
+    call L139
+    sw $21,3,$22
+    bne $23,$24,L202
+W203: .dw 203000,-203
+B203: .db 75,-3,7
+L204: add $21,$22,$23
+    ori $24,-96,$25
+    beq $26,$27,L204
+    jmp L205
+    la X4
+    call L152
+    sw $28,4,$29
+    bne $30,$31,L203
+W204: .dw 204000,-204
+B204: .db 76,-4,7
+L205: add $28,$29,$30
+    ori $31,-95,$0
+    beq $1,$2,L205
+    jmp L206
+    la X5
+    call L165
+    sw $3,5,$4
+    bne $5,$6,L204
+W205: .dw 205000,-205
+B205: .db 77,-5,7
+L206: add $3,$4,$5
+    ori $6,-94,$7
+    beq $8,$9,L206
+    jmp L207
+    la X6
+    call L178
+    sw $10,6,$11
+    bne $12,$13,L205
+W206: .dw 206000,-206
+B206: .db 78,-6,7
+L207: add $10,$11,$12
+    ori $13,-93,$14
+    beq $15,$16,L207
+    jmp L208
+    la X7
+    call L191
+    sw $17,7,$18
+    bne $19,$20,L206
+W207: .dw 207000,-207
+B207: .db 79,-7,7
+L208: add $17,$18,$19
+    ori $20,-92,$21
+    beq $22,$23,L208
+    jmp L209
+    la X0
+    call L204
+    sw $24,8,$25
+    bne $26,$27,L207
+W208: .dw 208000,-208
+B208: .db 80,-8,7
+L209: add $24,$25,$26
+    ori $27,-91,$28
+    beq $29,$30,L209
+    jmp L210
+    la X1
+    call L217
+    sw $31,9,$0
+    bne $1,$2,L208
+W209: .dw 209000,-209
+B209: .db 81,-9,7
+L210: add $31,$0,$1
+    ori $2,-90,$3
+    beq $4,$5,L210
+    jmp L211
+    la X2
+    call L230
+    sw $6,10,$7
+    bne $8,$9,L209
+W210: .dw 210000,-210
+B210: .db 82,-10,7
+S210: .asciz "str210"
+    .dh 210
+L211: add $6,$7,$8
+    ori $9,-89,$10
+    beq $11,$12,L211
+    jmp L212
+    la X3
+    call L243
+    sw $13,11,$14
+    bne $15,$16,L210
+W211: .dw 211000,-211
+B211: .db 83,-11,7
+L212: add $13,$14,$15
+    ori $16,-88,$17
+    beq $18,$19,L212
+    jmp L213
+    la X4
+    call L256
+    sw $20,12,$21
+    bne $22,$23,L211
+W212: .dw 212000,-212
+B212: .db 84,-12,7
+L213: add $20,$21,$22
+    ori $23,-87,$24
+    beq $25,$26,L213
+    jmp L214
+    la X5
+    call L269
+    sw $27,13,$28
+    bne $29,$30,L212
+W213: .dw 213000,-213
+B213: .db 85,-13,7
+L214: add $27,$28,$29
+    ori $30,-86,$31
+    beq $0,$1,L214
+    jmp L215
+    la X6
+    call L282
+    sw $2,14,$3
+    bne $4,$5,L213
+W214: .dw 214000,-214
+B214: .db 86,-14,7
+L215: add $2,$3,$4
+    ori $5,-85,$6
+    beq $7,$8,L215
+    jmp L216
+    la X7
+    call L295
+    sw $9,15,$10
+    bne $11,$12,L214
+W215: .dw 215000,-215
+B215: .db 87,-15,7
+L216: add $9,$10,$11
+    ori $12,-84,$13
+    beq $14,$15,L216
+    jmp L217
+    la X0
+    call L308
+    sw $16,16,$17
+    bne $18,$19,L215
+W216: .dw 216000,-216
+B216: .db 88,-16,7
+L217: add $16,$17,$18
+    ori $19,-83,$20
+    beq $21,$22,L217
+    jmp L218
+    la X1
+    call L321
+    sw $23,17,$24
+    bne $25,$26,L216
+W217: .dw 217000,-217
+B217: .db 89,-17,7
+L218: add $23,$24,$25
+    ori $26,-82,$27
+    beq $28,$29,L218
+    jmp L219
+    la X2
+    call L334
+    sw $30,18,$31
+    bne $0,$1,L217
+W218: .dw 218000,-218
+B218: .db 90,-18,7
+L219: add $30,$31,$0
+    ori $1,-81,$2
+    beq $3,$4,L219
+    jmp L220
+    la X3
+    call L347
+    sw $5,19,$6
+    bne $7,$8,L218
+W219: .dw 219000,-219
+B219: .db 91,-19,7
+L220: add $5,$6,$7
+    ori $8,-80,$9
+    beq $10,$11,L220
+    jmp L221
+    la X4
+    call L360
+    sw $12,20,$13
+    bne $14,$15,L219
+W220: .dw 220000,-220
+B220: .db 92,-20,7
+S220: .asciz "str220"
+    .dh 220
+L221: add $12,$13,$14
+    ori $15,-79,$16
+    beq $17,$18,L221
+    jmp L222
+    la X5
+    call L373
+    sw $19,21,$20
+    bne $21,$22,L220
+W221: .dw 221000,-221
+B221: .db 93,-21,7
+L222: add $19,$20,$21
+    ori $22,-78,$23
+    beq $24,$25,L222
+    jmp L223
+    la X6
+    call L386
+    sw $26,22,$27
+    bne $28,$29,L221
+W222: .dw 222000,-222
+B222: .db 94,-22,7
+L223: add $26,$27,$28
+    ori $29,-77,$30
+    beq $31,$0,L223
+    jmp L224
+    la X7
+    call L399
+    sw $1,23,$2
+    bne $3,$4,L222
+W223: .dw 223000,-223
+B223: .db 95,-23,7
+L224: add $1,$2,$3
+    ori $4,-76,$5
+    beq $6,$7,L224
+    jmp L225
+    la X0
+    call L412
+    sw $8,24,$9
+    bne $10,$11,L223
+W224: .dw 224000,-224
+B224: .db 96,-24,7
+L225: add $8,$9,$10
+    ori $11,-75,$12
+    beq $13,$14,L225
+    jmp L226
+    la X1
+    call L425
+    sw $15,25,$16
+    bne $17,$18,L224
+W225: .dw 225000,-225
+B225: .db 97,-25,7
+L226: add $15,$16,$17
+    ori $18,-74,$19
+    beq $20,$21,L226
+    jmp L227
+    la X2
+    call L438
+    sw $22,26,$23
+    bne $24,$25,L225
+W226: .dw 226000,-226
+B226: .db 98,-26,7
+L227: add $22,$23,$24
+    ori $25,-73,$26
+    beq $27,$28,L227
+    jmp L228
+    la X3
+    call L451
+    sw $29,27,$30
+    bne $31,$0,L226
+W227: .dw 227000,-227
+B227: .db 99,-27,7
+L228: add $29,$30,$31
+    ori $0,-72,$1
+    beq $2,$3,L228
+    jmp L229
+    la X4
+    call L464
+    sw $4,28,$5
+    bne $6,$7,L227
+W228: .dw 228000,-228
+B228: .db 100,-28,7
+L229: add $4,$5,$6
+    ori $7,-71,$8
+    beq $9,$10,L229
+    jmp L230
+    la X5
+    call L477
+    sw $11,29,$12
+    bne $13,$14,L228
+W229: .dw 229000,-229
+B229: .db 101,-29,7
+L230: add $11,$12,$13
+    ori $14,-70,$15
+    beq $16,$17,L230
+    jmp L231
+    la X6
+    call L490
+    sw $18,30,$19
+    bne $20,$21,L229
+W230: .dw 230000,-230
+B230: .db 102,-30,7
+S230: .asciz "str230"
+    .dh 230
+L231: add $18,$19,$20
+    ori $21,-69,$22
+    beq $23,$24,L231
+    jmp L232
+    la X7
+    call L503
+    sw $25,31,$26
+    bne $27,$28,L230
+W231: .dw 231000,-231
+B231: .db 103,-31,7
+L232: add $25,$26,$27
+    ori $28,-68,$29
+    beq $30,$31,L232
+    jmp L233
+    la X0
+    call L516
+    sw $0,32,$1
+    bne $2,$3,L231
+W232: .dw 232000,-232
+B232: .db 104,-32,7
+L233: add $0,$1,$2
+    ori $3,-67,$4
+    beq $5,$6,L233
+    jmp L234
+    la X1
+    call L529
+    sw $7,33,$8
+    bne $9,$10,L232
+W233: .dw 233000,-233
+B233: .db 105,-33,7
+L234: add $7,$8,$9
+    ori $10,-66,$11
+    beq $12,$13,L234
+    jmp L235
+    la X2
+    call L542
+    sw $14,34,$15
+    bne $16,$17,L233
+W234: .dw 234000,-234
+B234: .db 106,-34,7
+L235: add $14,$15,$16
+    ori $17,-65,$18
+    beq $19,$20,L235
+    jmp L236
+    la X3
+    call L555
+    sw $21,35,$22
+    bne $23,$24,L234
+W235: .dw 235000,-235
+B235: .db 107,-35,7
+L236: add $21,$22,$23
+    ori $24,-64,$25
+    beq $26,$27,L236
+    jmp L237
+    la X4
+    call L568
+    sw $28,36,$29
+    bne $30,$31,L235
+W236: .dw 236000,-236
+B236: .db 108,-36,7
+L237: add $28,$29,$30
+    ori $31,-63,$0
+    beq $1,$2,L237
+    jmp L238
+    la X5
+    call L581
+    sw $3,37,$4
+    bne $5,$6,L236
+W237: .dw 237000,-237
+B237: .db 109,-37,7
+L238: add $3,$4,$5
+    ori $6,-62,$7
+    beq $8,$9,L238
+    jmp L239
+    la X6
+    call L594
+    sw $10,38,$11
+    bne $12,$13,L237
+W238: .dw 238000,-238
+B238: .db 110,-38,7
+L239: add $10,$11,$12
+    ori $13,-61,$14
+    beq $15,$16,L239
+    jmp L240
+    la X7
+    call L607
+    sw $17,39,$18
+    bne $19,$20,L238
+W239: .dw 239000,-239
+B239: .db 111,-39,7
+L240: add $17,$18,$19
+    ori $20,-60,$21
+    beq $22,$23,L240
+    jmp L241
+    la X0
+    call L620
+    sw $24,40,$25
+    bne $26,$27,L239
+W240: .dw 240000,-240
+B240: .db 112,-40,7
+S240: .asciz "str240"
+    .dh 240
+L241: add $24,$25,$26
+    ori $27,-59,$28
+    beq $29,$30,L241
+    jmp L242
+    la X1
+    call L633
+    sw $31,41,$0
+    bne $1,$2,L240
+W241: .dw 241000,-241
+B241: .db 113,-41,7
+L242: add $31,$0,$1
+    ori $2,-58,$3
+    beq $4,$5,L242
+    jmp L243
+    la X2
+    call L646
+    sw $6,42,$7
+    bne $8,$9,L241
+W242: .dw 242000,-242
+B242: .db 114,-42,7
+L243: add $6,$7,$8
+    ori $9,-57,$10
+    beq $11,$12,L243
+    jmp L244
+    la X3
+    call L659
+    sw $13,43,$14
+    bne $15,$16,L242
+W243: .dw 243000,-243
+B243: .db 115,-43,7
+L244: add $13,$14,$15
+    ori $16,-56,$17
+    beq $18,$19,L244
+    jmp L245
+    la X4
+    call L672
+    sw $20,44,$21
+    bne $22,$23,L243
+W244: .dw 244000,-244
+B244: .db 116,-44,7
+L245: add $20,$21,$22
+    ori $23,-55,$24
+    beq $25,$26,L245
+    jmp L246
+    la X5
+    call L685
+    sw $27,45,$28
+    bne $29,$30,L244
+W245: .dw 245000,-245
+B245: .db 117,-45,7
+L246: add $27,$28,$29
+    ori $30,-54,$31
+    beq $0,$1,L246
+    jmp L247
+    la X6
+    call L698
+    sw $2,46,$3
+    bne $4,$5,L245
+W246: .dw 246000,-246
+B246: .db 118,-46,7
+L247: add $2,$3,$4
+    ori $5,-53,$6
+    beq $7,$8,L247
+    jmp L248
+    la X7
+    call L711
+    sw $9,47,$10
+    bne $11,$12,L246
+W247: .dw 247000,-247
+B247: .db 119,-47,7
+L248: add $9,$10,$11
+    ori $12,-52,$13
+    beq $14,$15,L248
+    jmp L249
+    la X0
+    call L724
+    sw $16,48,$17
+    bne $18,$19,L247
+W248: .dw 248000,-248
+B248: .db 120,-48,7
+L249: add $16,$17,$18
+    ori $19,-51,$20
+    beq $21,$22,L249
+    jmp L250
+    la X1
+    call L737
+    sw $23,49,$24
+    bne $25,$26,L248
+W249: .dw 249000,-249
+B249: .db 121,-49,7
+L250: add $23,$24,$25
+    ori $26,-50,$27
+    beq $28,$29,L250
+    jmp L251
+    la X2
+    call L750
+    sw $30,50,$31
+    bne $0,$1,L249
+W250: .dw 250000,-250
+B250: .db 122,-50,7
+S250: .asciz "str250"
+    .dh 250
+.entry L250
+.entry W250
+L251: add $30,$31,$0
+    ori $1,-49,$2
+    beq $3,$4,L251
+    jmp L252
+    la X3
+    call L763
+    sw $5,51,$6
+    bne $7,$8,L250
+W251: .dw 251000,-251
+B251: .db 123,-51,7
+L252: add $5,$6,$7
+    ori $8,-48,$9
+    beq $10,$11,L252
+    jmp L253
+    la X4
+    call L776
+    sw $12,52,$13
+    bne $14,$15,L251
+W252: .dw 252000,-252
+B252: .db 124,-52,7
+L253: add $12,$13,$14
+    ori $15,-47,$16
+    beq $17,$18,L253
+    jmp L254
+    la X5
+    call L789
+    sw $19,53,$20
+    bne $21,$22,L252
+W253: .dw 253000,-253
+B253: .db 125,-53,7
+L254: add $19,$20,$21
+    ori $22,-46,$23
+    beq $24,$25,L254
+    jmp L255
+    la X6
+    call L802
+    sw $26,54,$27
+    bne $28,$29,L253
+W254: .dw 254000,-254
+B254: .db 126,-54,7
+L255: add $26,$27,$28
+    ori $29,-45,$30
+    beq $31,$0,L255
+    jmp L256
+    la X7
+    call L815
+    sw $1,55,$2
+    bne $3,$4,L254
+W255: .dw 255000,-255
+B255: .db 127,-55,7
+L256: add $1,$2,$3
+    ori $4,-44,$5
+    beq $6,$7,L256
+    jmp L257
+    la X0
+    call L828
+    sw $8,56,$9
+    bne $10,$11,L255
+W256: .dw 256000,-256
+B256: .db 0,-56,7
+L257: add $8,$9,$10
+    ori $11,-43,$12
+    beq $13,$14,L257
+    jmp L258
+    la X1
+    call L841
+    sw $15,57,$16
+    bne $17,$18,L256
+W257: .dw 257000,-257
+B257: .db 1,-57,7
+L258: add $15,$16,$17
+    ori $18,-42,$19
+    beq $20,$21,L258
+    jmp L259
+    la X2
+    call L854
+    sw $22,58,$23
+    bne $24,$25,L257
+W258: .dw 258000,-258
+B258: .db 2,-58,7
+L259: add $22,$23,$24
+    ori $25,-41,$26
+    beq $27,$28,L259
+    jmp L260
+    la X3
+    call L867
+    sw $29,59,$30
+    bne $31,$0,L258
+W259: .dw 259000,-259
+B259: .db 3,-59,7
+L260: add $29,$30,$31
+    ori $0,-40,$1
+    beq $2,$3,L260
+    jmp L261
+    la X4
+    call L880
+    sw $4,60,$5
+    bne $6,$7,L259
+W260: .dw 260000,-260
+B260: .db 4,-60,7
+S260: .asciz "str260"
+    .dh 260
+L261: add $4,$5,$6
+    ori $7,-39,$8
+    beq $9,$10,L261
+    jmp L262
+    la X5
+    call L893
+    sw $11,61,$12
+    bne $13,$14,L260
+W261: .dw 261000,-261
+B261: .db 5,-61,7
+L262: add $11,$12,$13
+    ori $14,-38,$15
+    beq $16,$17,L262
+    jmp L263
+    la X6
+    call L906
+    sw $18,62,$19
+    bne $20,$21,L261
+W262: .dw 262000,-262
+B262: .db 6,-62,7
+L263: add $18,$19,$20
+    ori $21,-37,$22
+    beq $23,$24,L263
+    jmp L264
+    la X7
+    call L919
+    sw $25,63,$26
+    bne $27,$28,L262
+W263: .dw 263000,-263
+B263: .db 7,-63,7
+L264: add $25,$26,$27
+    ori $28,-36,$29
+    beq $30,$31,L264
+    jmp L265
+    la X0
+    call L932
+    sw $0,64,$1
+    bne $2,$3,L263
+W264: .dw 264000,-264
+B264: .db 8,-64,7
+L265: add $0,$1,$2
+    ori $3,-35,$4
+    beq $5,$6,L265
+    jmp L266
+    la X1
+    call L945
+    sw $7,65,$8
+    bne $9,$10,L264
+W265: .dw 265000,-265
+B265: .db 9,-65,7
+L266: add $7,$8,$9
+    ori $10,-34,$11
+    beq $12,$13,L266
+    jmp L267
+    la X2
+    call L958
+    sw $14,66,$15
+    bne $16,$17,L265
+W266: .dw 266000,-266
+B266: .db 10,-66,7
+L267: add $14,$15,$16
+    ori $17,-33,$18
+    beq $19,$20,L267
+    jmp L268
+    la X3
+    call L971
+    sw $21,67,$22
+    bne $23,$24,L266
+W267: .dw 267000,-267
+B267: .db 11,-67,7
+L268: add $21,$22,$23
+    ori $24,-32,$25
+    beq $26,$27,L268
+    jmp L269
+    la X4
+    call L984
+    sw $28,68,$29
+    bne $30,$31,L267
+W268: .dw 268000,-268
+B268: .db 12,-68,7
+L269: add $28,$29,$30
+    ori $31,-31,$0
+    beq $1,$2,L269
+    jmp L270
+    la X5
+    call L997
+    sw $3,69,$4
+    bne $5,$6,L268
+W269: .dw 269000,-269
+B269: .db 13,-69,7
+L270: add $3,$4,$5
+    ori $6,-30,$7
+    beq $8,$9,L270
+    jmp L271
+    la X6
+    call L1010
+    sw $10,70,$11
+    bne $12,$13,L269
+W270: .dw 270000,-270
+B270: .db 14,-70,7
+S270: .asciz "str270"
+    .dh 270
+L271: add $10,$11,$12
+    ori $13,-29,$14
+    beq $15,$16,L271
+    jmp L272
+    la X7
+    call L1023
+    sw $17,71,$18
+    bne $19,$20,L270
+W271: .dw 271000,-271
+B271: .db 15,-71,7
+L272: add $17,$18,$19
+    ori $20,-28,$21
+    beq $22,$23,L272
+    jmp L273
+    la X0
+    call L1036
+    sw $24,72,$25
+    bne $26,$27,L271
+W272: .dw 272000,-272
+B272: .db 16,-72,7
+L273: add $24,$25,$26
+    ori $27,-27,$28
+    beq $29,$30,L273
+    jmp L274
+    la X1
+    call L1049
+    sw $31,73,$0
+    bne $1,$2,L272
+W273: .dw 273000,-273
+B273: .db 17,-73,7
+L274: add $31,$0,$1
+    ori $2,-26,$3
+    beq $4,$5,L274
+    jmp L275
+    la X2
+    call L1062
+    sw $6,74,$7
+    bne $8,$9,L273
+W274: .dw 274000,-274
+B274: .db 18,-74,7
+L275: add $6,$7,$8
+    ori $9,-25,$10
+    beq $11,$12,L275
+    jmp L276
+    la X3
+    call L1075
+    sw $13,75,$14
+    bne $15,$16,L274
+W275: .dw 275000,-275
+B275: .db 19,-75,7
+L276: add $13,$14,$15
+    ori $16,-24,$17
+    beq $18,$19,L276
+    jmp L277
+    la X4
+    call L1088
+    sw $20,76,$21
+    bne $22,$23,L275
+W276: .dw 276000,-276
+B276: .db 20,-76,7
+L277: add $20,$21,$22
+    ori $23,-23,$24
+    beq $25,$26,L277
+    jmp L278
+    la X5
+    call L1101
+    sw $27,77,$28
+    bne $29,$30,L276
+W277: .dw 277000,-277
+B277: .db 21,-77,7
+L278: add $27,$28,$29
+    ori $30,-22,$31
+    beq $0,$1,L278
+    jmp L279
+    la X6
+    call L1114
+    sw $2,78,$3
+    bne $4,$5,L277
+W278: .dw 278000,-278
+B278: .db 22,-78,7
+L279: add $2,$3,$4
+    ori $5,-21,$6
+    beq $7,$8,L279
+    jmp L280
+    la X7
+    call L1127
+    sw $9,79,$10
+    bne $11,$12,L278
+W279: .dw 279000,-279
+B279: .db 23,-79,7
+L280: add $9,$10,$11
+    ori $12,-20,$13
+    beq $14,$15,L280
+    jmp L281
+    la X0
+    call L1140
+    sw $16,80,$17
+    bne $18,$19,L279
+W280: .dw 280000,-280
+B280: .db 24,-80,7
+S280: .asciz "str280"
+    .dh 280
+L281: add $16,$17,$18
+    ori $19,-19,$20
+    beq $21,$22,L281
+    jmp L282
+    la X1
+    call L1153
+    sw $23,81,$24
+    bne $25,$26,L280
+W281: .dw 281000,-281
+B281: .db 25,-81,7
+L282: add $23,$24,$25
+    ori $26,-18,$27
+    beq $28,$29,L282
+    jmp L283
+    la X2
+    call L1166
+    sw $30,82,$31
+    bne $0,$1,L281
+W282: .dw 282000,-282
+B282: .db 26,-82,7
+L283: add $30,$31,$0
+    ori $1,-17,$2
+    beq $3,$4,L283
+    jmp L284
+    la X3
+    call L1179
+    sw $5,83,$6
+    bne $7,$8,L282
+W283: .dw 283000,-283
+B283: .db 27,-83,7
+L284: add $5,$6,$7
+    ori $8,-16,$9
+    beq $10,$11,L284
+    jmp L285
+    la X4
+    call L1192
+    sw $12,84,$13
+    bne $14,$15,L283
+W284: .dw 284000,-284
+B284: .db 28,-84,7
+L285: add $12,$13,$14
+    ori $15,-15,$16
+    beq $17,$18,L285
+    jmp L286
+    la X5
+    call L1205
+    sw $19,85,$20
+    bne $21,$22,L284
+W285: .dw 285000,-285
+B285: .db 29,-85,7
+L286: add $19,$20,$21
+    ori $22,-14,$23
+    beq $24,$25,L286
+    jmp L287
+    la X6
+    call L1218
+    sw $26,86,$27
+    bne $28,$29,L285
+W286: .dw 286000,-286
+B286: .db 30,-86,7
+L287: add $26,$27,$28
+    ori $29,-13,$30
+    beq $31,$0,L287
+    jmp L288
+    la X7
+    call L1231
+    sw $1,87,$2
+    bne $3,$4,L286
+W287: .dw 287000,-287
+B287: .db 31,-87,7
+L288: add $1,$2,$3
+    ori $4,-12,$5
+    beq $6,$7,L288
+    jmp L289
+    la X0
+    call L1244
+    sw $8,88,$9
+    bne $10,$11,L287
+W288: .dw 288000,-288
+B288: .db 32,-88,7
+L289: add $8,$9,$10
+    ori $11,-11,$12
+    beq $13,$14,L289
+    jmp L290
+    la X1
+    call L1257
+    sw $15,89,$16
+    bne $17,$18,L288
+W289: .dw 289000,-289
+B289: .db 33,-89,7
+L290: add $15,$16,$17
+    ori $18,-10,$19
+    beq $20,$21,L290
+    jmp L291
+    la X2
+    call L1270
+    sw $22,90,$23
+    bne $24,$25,L289
+W290: .dw 290000,-290
+B290: .db 34,-90,7
+S290: .asciz "str290"
+    .dh 290
+L291: add $22,$23,$24
+    ori $25,-9,$26
+    beq $27,$28,L291
+    jmp L292
+    la X3
+    call L1283
+    sw $29,91,$30
+    bne $31,$0,L290
+W291: .dw 291000,-291
+B291: .db 35,-91,7
+L292: add $29,$30,$31
+    ori $0,-8,$1
+    beq $2,$3,L292
+    jmp L293
+    la X4
+    call L1296
+    sw $4,92,$5
+    bne $6,$7,L291
+W292: .dw 292000,-292
+B292: .db 36,-92,7
+L293: add $4,$5,$6
+    ori $7,-7,$8
+    beq $9,$10,L293
+    jmp L294
+    la X5
+    call L1309
+    sw $11,93,$12
+    bne $13,$14,L292
+W293: .dw 293000,-293
+B293: .db 37,-93,7
+L294: add $11,$12,$13
+    ori $14,-6,$15
+    beq $16,$17,L294
+    jmp L295
+    la X6
+    call L1322
+    sw $18,94,$19
+    bne $20,$21,L293
+W294: .dw 294000,-294
+B294: .db 38,-94,7
+L295: add $18,$19,$20
+    ori $21,-5,$22
+    beq $23,$24,L295
+    jmp L296
+    la X7
+    call L1335
+    sw $25,95,$26
+    bne $27,$28,L294
+W295: .dw 295000,-295
+B295: .db 39,-95,7
+L296: add $25,$26,$27
+    ori $28,-4,$29
+    beq $30,$31,L296
+    jmp L297
+    la X0
+    call L1348
+    sw $0,96,$1
+    bne $2,$3,L295
+W296: .dw 296000,-296
+B296: .db 40,-96,7
+L297: add $0,$1,$2
+    ori $3,-3,$4
+    beq $5,$6,L297
+    jmp L298
+    la X1
+    call L1361
+    sw $7,97,$8
+    bne $9,$10,L296
+W297: .dw 297000,-297
+B297: .db 41,-97,7
+L298: add $7,$8,$9
+    ori $10,-2,$11
+    beq $12,$13,L298
+    jmp L299
+    la X2
+    call L1374
+    sw $14,98,$15
+    bne $16,$17,L297
+W298: .dw 298000,-298
+B298: .db 42,-98,7
+L299: add $14,$15,$16
+    ori $17,-1,$18
+    beq $19,$20,L299
+    jmp L300
+    la X3
+    call L1387
+    sw $21,99,$22
+    bne $23,$24,L298
+W299: .dw 299000,-299
+B299: .db 43,-99,7
+L300: add $21,$22,$23
+    ori $24,0,$25
+    beq $26,$27,L300
+    jmp L301
+    la X4
+    call L1400
+    sw $28,0,$29
+    bne $30,$31,L299
+W300: .dw 300000,-300
+B300: .db 44,0,7
+S300: .asciz "str300"
+    .dh 300
+.entry L300
+.entry W300
+L301: add $28,$29,$30
+    ori $31,1,$0
+    beq $1,$2,L301
+    jmp L302
+    la X5
+    call L1413
+    sw $3,1,$4
+    bne $5,$6,L300
+W301: .dw 301000,-301
+B301: .db 45,-1,7
+L302: add $3,$4,$5
+    ori $6,2,$7
+    beq $8,$9,L302
+    jmp L303
+    la X6
+    call L1426
+    sw $10,2,$11
+    bne $12,$13,L301
+W302: .dw 302000,-302
+B302: .db 46,-2,7
+L303: add $10,$11,$12
+    ori $13,3,$14
+    beq $15,$16,L303
+    jmp L304
+    la X7
+    call L1439
+    sw $17,3,$18
+    bne $19,$20,L302
+W303: .dw 303000,-303
+B303: .db 47,-3,7
+L304: add $17,$18,$19
+    ori $20,4,$21
+    beq $22,$23,L304
+    jmp L305
+    la X0
+    call L1452
+    sw $24,4,$25
+    bne $26,$27,L303
+W304: .dw 304000,-304
+B304: .db 48,-4,7
+L305: add $24,$25,$26
+    ori $27,5,$28
+    beq $29,$30,L305
+    jmp L306
+    la X1
+    call L1465
+    sw $31,5,$0
+    bne $1,$2,L304
+W305: .dw 305000,-305
+B305: .db 49,-5,7
+L306: add $31,$0,$1
+    ori $2,6,$3
+    beq $4,$5,L306
+    jmp L307
+    la X2
+    call L1478
+    sw $6,6,$7
+    bne $8,$9,L305
+W306: .dw 306000,-306
+B306: .db 50,-6,7
+L307: add $6,$7,$8
+    ori $9,7,$10
+    beq $11,$12,L307
+    jmp L308
+    la X3
+    call L1491
+    sw $13,7,$14
+    bne $15,$16,L306
+W307: .dw 307000,-307
+B307: .db 51,-7,7
+L308: add $13,$14,$15
+    ori $16,8,$17
+    beq $18,$19,L308
+    jmp L309
+    la X4
+    call L1504
+    sw $20,8,$21
+    bne $22,$23,L307
+W308: .dw 308000,-308
+B308: .db 52,-8,7
+L309: add $20,$21,$22
+    ori $23,9,$24
+    beq $25,$26,L309
+    jmp L310
+    la X5
+    call L1517
+    sw $27,9,$28
+    bne $29,$30,L308
+W309: .dw 309000,-309
+B309: .db 53,-9,7
+L310: add $27,$28,$29
+    ori $30,10,$31
+    beq $0,$1,L310
+    jmp L311
+    la X6
+    call L1530
+    sw $2,10,$3
+    bne $4,$5,L309
+W310: .dw 310000,-310
+B310: .db 54,-10,7
+S310: .asciz "str310"
+    .dh 310
+L311: add $2,$3,$4
+    ori $5,11,$6
+    beq $7,$8,L311
+    jmp L312
+    la X7
+    call L1543
+    sw $9,11,$10
+    bne $11,$12,L310
+W311: .dw 311000,-311
+B311: .db 55,-11,7
+L312: add $9,$10,$11
+    ori $12,12,$13
+    beq $14,$15,L312
+    jmp L313
+    la X0
+    call L1556
+    sw $16,12,$17
+    bne $18,$19,L311
+W312: .dw 312000,-312
+B312: .db 56,-12,7
+L313: add $16,$17,$18
+    ori $19,13,$20
+    beq $21,$22,L313
+    jmp L314
+    la X1
+    call L1569
+    sw $23,13,$24
+    bne $25,$26,L312
+W313: .dw 313000,-313
+B313: .db 57,-13,7
+L314: add $23,$24,$25
+    ori $26,14,$27
+    beq $28,$29,L314
+    jmp L315
+    la X2
+    call L1582
+    sw $30,14,$31
+    bne $0,$1,L313
+W314: .dw 314000,-314
+B314: .db 58,-14,7
+L315: add $30,$31,$0
+    ori $1,15,$2
+    beq $3,$4,L315
+    jmp L316
+    la X3
+    call L1595
+    sw $5,15,$6
+    bne $7,$8,L314
+W315: .dw 315000,-315
+B315: .db 59,-15,7
+L316: add $5,$6,$7
+    ori $8,16,$9
+    beq $10,$11,L316
+    jmp L317
+    la X4
+    call L1608
+    sw $12,16,$13
+    bne $14,$15,L315
+W316: .dw 316000,-316
+B316: .db 60,-16,7
+L317: add $12,$13,$14
+    ori $15,17,$16
+    beq $17,$18,L317
+    jmp L318
+    la X5
+    call L1621
+    sw $19,17,$20
+    bne $21,$22,L316
+W317: .dw 317000,-317
+B317: .db 61,-17,7
+L318: add $19,$20,$21
+    ori $22,18,$23
+    beq $24,$25,L318
+    jmp L319
+    la X6
+    call L1634
+    sw $26,18,$27
+    bne $28,$29,L317
+W318: .dw 318000,-318
+B318: .db 62,-18,7
+L319: add $26,$27,$28
+    ori $29,19,$30
+    beq $31,$0,L319
+    jmp L320
+    la X7
+    call L1647
+    sw $1,19,$2
+    bne $3,$4,L318
+W319: .dw 319000,-319
+B319: .db 63,-19,7
+L320: add $1,$2,$3
+    ori $4,20,$5
+    beq $6,$7,L320
+    jmp L321
+    la X0
+    call L1660
+    sw $8,20,$9
+    bne $10,$11,L319
+W320: .dw 320000,-320
+B320: .db 64,-20,7
+S320: .asciz "str320"
+    .dh 320
+L321: add $8,$9,$10
+    ori $11,21,$12
+    beq $13,$14,L321
+    jmp L322
+    la X1
+    call L1673
+    sw $15,21,$16
+    bne $17,$18,L320
+W321: .dw 321000,-321
+B321: .db 65,-21,7
+L322: add $15,$16,$17
+    ori $18,22,$19
+    beq $20,$21,L322
+    jmp L323
+    la X2
+    call L1686
+    sw $22,22,$23
+    bne $24,$25,L321
+W322: .dw 322000,-322
+B322: .db 66,-22,7
+L323: add $22,$23,$24
+    ori $25,23,$26
+    beq $27,$28,L323
+    jmp L324
+    la X3
+    call L1699
+    sw $29,23,$30
+    bne $31,$0,L322
+W323: .dw 323000,-323
+B323: .db 67,-23,7
+L324: add $29,$30,$31
+    ori $0,24,$1
+    beq $2,$3,L324
+    jmp L325
+    la X4
+    call L1712
+    sw $4,24,$5
+    bne $6,$7,L323
+W324: .dw 324000,-324
+B324: .db 68,-24,7
+L325: add $4,$5,$6
+    ori $7,25,$8
+    beq $9,$10,L325
+    jmp L326
+    la X5
+    call L1725
+    sw $11,25,$12
+    bne $13,$14,L324
+W325: .dw 325000,-325
+B325: .db 69,-25,7
+L326: add $11,$12,$13
+    ori $14,26,$15
+    beq $16,$17,L326
+    jmp L327
+    la X6
+    call L1738
+    sw $18,26,$19
+    bne $20,$21,L325
+W326: .dw 326000,-326
+B326: .db 70,-26,7
+L327: add $18,$19,$20
+    ori $21,27,$22
+    beq $23,$24,L327
+    jmp L328
+    la X7
+    call L1751
+    sw $25,27,$26
+    bne $27,$28,L326
+W327: .dw 327000,-327
+B327: .db 71,-27,7
+L328: add $25,$26,$27
+    ori $28,28,$29
+    beq $30,$31,L328
+    jmp L329
+    la X0
+    call L1764
+    sw $0,28,$1
+    bne $2,$3,L327
+W328: .dw 328000,-328
+B328: .db 72,-28,7
+L329: add $0,$1,$2
+    ori $3,29,$4
+    beq $5,$6,L329
+    jmp L330
+    la X1
+    call L1777
+    sw $7,29,$8
+    bne $9,$10,L328
+W329: .dw 329000,-329
+B329: .db 73,-29,7
+L330: add $7,$8,$9
+    ori $10,30,$11
+    beq $12,$13,L330
+    jmp L331
+    la X2
+    call L1790
+    sw $14,30,$15
+    bne $16,$17,L329
+W330: .dw 330000,-330
+B330: .db 74,-30,7
+S330: .asciz "str330"
+    .dh 330
+L331: add $14,$15,$16
+    ori $17,31,$18
+    beq $19,$20,L331
+    jmp L332
+    la X3
+    call L1803
+    sw $21,31,$22
+    bne $23,$24,L330
+W331: .dw 331000,-331
+B331: .db 75,-31,7
+L332: add $21,$22,$23
+    ori $24,32,$25
+    beq $26,$27,L332
+    jmp L333
+    la X4
+    call L1816
+    sw $28,32,$29
+    bne $30,$31,L331
+W332: .dw 332000,-332
+B332: .db 76,-32,7
+L333: add $28,$29,$30
+    ori $31,33,$0
+    beq $1,$2,L333
+    jmp L334
+    la X5
+    call L1829
+    sw $3,33,$4
+    bne $5,$6,L332
+W333: .dw 333000,-333
+B333: .db 77,-33,7
+L334: add $3,$4,$5
+    ori $6,34,$7
+    beq $8,$9,L334
+    jmp L335
+    la X6
+    call L1842
+    sw $10,34,$11
+    bne $12,$13,L333
+W334: .dw 334000,-334
+B334: .db 78,-34,7
+L335: add $10,$11,$12
+    ori $13,35,$14
+    beq $15,$16,L335
+    jmp L336
+    la X7
+    call L1855
+    sw $17,35,$18
+    bne $19,$20,L334
+W335: .dw 335000,-335
+B335: .db 79,-35,7
+L336: add $17,$18,$19
+    ori $20,36,$21
+    beq $22,$23,L336
+    jmp L337
+    la X0
+    call L1868
+    sw $24,36,$25
+    bne $26,$27,L335
+W336: .dw 336000,-336
+B336: .db 80,-36,7
+L337: add $24,$25,$26
+    ori $27,37,$28
+    beq $29,$30,L337
+    jmp L338
+    la X1
+    call L1881
+    sw $31,37,$0
+    bne $1,$2,L336
+W337: .dw 337000,-337
+B337: .db 81,-37,7
+L338: add $31,$0,$1
+    ori $2,38,$3
+    beq $4,$5,L338
+    jmp L339
+    la X2
+    call L1894
+    sw $6,38,$7
+    bne $8,$9,L337
+W338: .dw 338000,-338
+B338: .db 82,-38,7
+L339: add $6,$7,$8
+    ori $9,39,$10
+    beq $11,$12,L339
+    jmp L340
+    la X3
+    call L1907
+    sw $13,39,$14
+    bne $15,$16,L338
+W339: .dw 339000,-339
+B339: .db 83,-39,7
+L340: add $13,$14,$15
+    ori $16,40,$17
+    beq $18,$19,L340
+    jmp L341
+    la X4
+    call L1920
+    sw $20,40,$21
+    bne $22,$23,L339
+W340: .dw 340000,-340
+B340: .db 84,-40,7
+S340: .asciz "str340"
+    .dh 340
+L341: add $20,$21,$22
+    ori $23,41,$24
+    beq $25,$26,L341
+    jmp L342
+    la X5
+    call L1933
+    sw $27,41,$28
+    bne $29,$30,L340
+W341: .dw 341000,-341
+B341: .db 85,-41,7
+L342: add $27,$28,$29
+    ori $30,42,$31
+    beq $0,$1,L342
+    jmp L343
+    la X6
+    call L1946
+    sw $2,42,$3
+    bne $4,$5,L341
+W342: .dw 342000,-342
+B342: .db 86,-42,7
+L343: add $2,$3,$4
+    ori $5,43,$6
+    beq $7,$8,L343
+    jmp L344
+    la X7
+    call L1959
+    sw $9,43,$10
+    bne $11,$12,L342
+W343: .dw 343000,-343
+B343: .db 87,-43,7
+L344: add $9,$10,$11
+    ori $12,44,$13
+    beq $14,$15,L344
+    jmp L345
+    la X0
+    call L1972
+    sw $16,44,$17
+    bne $18,$19,L343
+W344: .dw 344000,-344
+B344: .db 88,-44,7
+L345: add $16,$17,$18
+    ori $19,45,$20
+    beq $21,$22,L345
+    jmp L346
+    la X1
+    call L1985
+    sw $23,45,$24
+    bne $25,$26,L344
+W345: .dw 345000,-345
+B345: .db 89,-45,7
+L346: add $23,$24,$25
+    ori $26,46,$27
+    beq $28,$29,L346
+    jmp L347
+    la X2
+    call L1998
+    sw $30,46,$31
+    bne $0,$1,L345
+W346: .dw 346000,-346
+B346: .db 90,-46,7
+L347: add $30,$31,$0
+    ori $1,47,$2
+    beq $3,$4,L347
+    jmp L348
+    la X3
+    call L2011
+    sw $5,47,$6
+    bne $7,$8,L346
+W347: .dw 347000,-347
+B347: .db 91,-47,7
+L348: add $5,$6,$7
+    ori $8,48,$9
+    beq $10,$11,L348
+    jmp L349
+    la X4
+    call L2024
+    sw $12,48,$13
+    bne $14,$15,L347
+W348: .dw 348000,-348
+B348: .db 92,-48,7
+L349: add $12,$13,$14
+    ori $15,49,$16
+    beq $17,$18,L349
+    jmp L350
+    la X5
+    call L2037
+    sw $19,49,$20
+    bne $21,$22,L348
+W349: .dw 349000,-349
+B349: .db 93,-49,7
+L350: add $19,$20,$21
+    ori $22,50,$23
+    beq $24,$25,L350
+    jmp L351
+    la X6
+    call L2050
+    sw $26,50,$27
+    bne $28,$29,L349
+W350: .dw 350000,-350
+B350: .db 94,-50,7
+S350: .asciz "str350"
+    .dh 350
+.entry L350
+.entry W350
+L351: add $26,$27,$28
+    ori $29,51,$30
+    beq $31,$0,L351
+    jmp L352
+    la X7
+    call L2063
+    sw $1,51,$2
+    bne $3,$4,L350
+W351: .dw 351000,-351
+B351: .db 95,-51,7
+L352: add $1,$2,$3
+    ori $4,52,$5
+    beq $6,$7,L352
+    jmp L353
+    la X0
+    call L2076
+    sw $8,52,$9
+    bne $10,$11,L351
+W352: .dw 352000,-352
+B352: .db 96,-52,7
+L353: add $8,$9,$10
+    ori $11,53,$12
+    beq $13,$14,L353
+    jmp L354
+    la X1
+    call L2089
+    sw $15,53,$16
+    bne $17,$18,L352
+W353: .dw 353000,-353
+B353: .db 97,-53,7
+L354: add $15,$16,$17
+    ori $18,54,$19
+    beq $20,$21,L354
+    jmp L355
+    la X2
+    call L2102
+    sw $22,54,$23
+    bne $24,$25,L353
+W354: .dw 354000,-354
+B354: .db 98,-54,7
+L355: add $22,$23,$24
+    ori $25,55,$26
+    beq $27,$28,L355
+    jmp L356
+    la X3
+    call L2115
+    sw $29,55,$30
+    bne $31,$0,L354
+W355: .dw 355000,-355
+B355: .db 99,-55,7
+L356: add $29,$30,$31
+    ori $0,56,$1
+    beq $2,$3,L356
+    jmp L357
+    la X4
+    call L2128
+    sw $4,56,$5
+    bne $6,$7,L355
+W356: .dw 356000,-356
+B356: .db 100,-56,7
+L357: add $4,$5,$6
+    ori $7,57,$8
+    beq $9,$10,L357
+    jmp L358
+    la X5
+    call L2141
+    sw $11,57,$12
+    bne $13,$14,L356
+W357: .dw 357000,-357
+B357: .db 101,-57,7
+L358: add $11,$12,$13
+    ori $14,58,$15
+    beq $16,$17,L358
+    jmp L359
+    la X6
+    call L2154
+    sw $18,58,$19
+    bne $20,$21,L357
+W358: .dw 358000,-358
+B358: .db 102,-58,7
+L359: add $18,$19,$20
+    ori $21,59,$22
+    beq $23,$24,L359
+    jmp L360
+    la X7
+    call L2167
+    sw $25,59,$26
+    bne $27,$28,L358
+W359: .dw 359000,-359
+B359: .db 103,-59,7
+L360: add $25,$26,$27
+    ori $28,60,$29
+    beq $30,$31,L360
+    jmp L361
+    la X0
+    call L2180
+    sw $0,60,$1
+    bne $2,$3,L359
+W360: .dw 360000,-360
+B360: .db 104,-60,7
+S360: .asciz "str360"
+    .dh 360
+L361: add $0,$1,$2
+    ori $3,61,$4
+    beq $5,$6,L361
+    jmp L362
+    la X1
+    call L2193
+    sw $7,61,$8
+    bne $9,$10,L360
+W361: .dw 361000,-361
+B361: .db 105,-61,7
+L362: add $7,$8,$9
+    ori $10,62,$11
+    beq $12,$13,L362
+    jmp L363
+    la X2
+    call L2206
+    sw $14,62,$15
+    bne $16,$17,L361
+W362: .dw 362000,-362
+B362: .db 106,-62,7
+L363: add $14,$15,$16
+    ori $17,63,$18
+    beq $19,$20,L363
+    jmp L364
+    la X3
+    call L2219
+    sw $21,63,$22
+    bne $23,$24,L362
+W363: .dw 363000,-363
+B363: .db 107,-63,7
+L364: add $21,$22,$23
+    ori $24,64,$25
+    beq $26,$27,L364
+    jmp L365
+    la X4
+    call L2232
+    sw $28,64,$29
+    bne $30,$31,L363
+W364: .dw 364000,-364
+B364: .db 108,-64,7
+L365: add $28,$29,$30
+    ori $31,65,$0
+    beq $1,$2,L365
+    jmp L366
+    la X5
+    call L2245
+    sw $3,65,$4
+    bne $5,$6,L364
+W365: .dw 365000,-365
+B365: .db 109,-65,7
+L366: add $3,$4,$5
+    ori $6,66,$7
+    beq $8,$9,L366
+    jmp L367
+    la X6
+    call L2258
+    sw $10,66,$11
+    bne $12,$13,L365
+W366: .dw 366000,-366
+B366: .db 110,-66,7
+L367: add $10,$11,$12
+    ori $13,67,$14
+    beq $15,$16,L367
+    jmp L368
+    la X7
+    call L2271
+    sw $17,67,$18
+    bne $19,$20,L366
+W367: .dw 367000,-367
+B367: .db 111,-67,7
+L368: add $17,$18,$19
+    ori $20,68,$21
+    beq $22,$23,L368
+    jmp L369
+    la X0
+    call L2284
+    sw $24,68,$25
+    bne $26,$27,L367
+W368: .dw 368000,-368
+B368: .db 112,-68,7
+L369: add $24,$25,$26
+    ori $27,69,$28
+    beq $29,$30,L369
+    jmp L370
+    la X1
+    call L2297
+    sw $31,69,$0
+    bne $1,$2,L368
+W369: .dw 369000,-369
+B369: .db 113,-69,7
+L370: add $31,$0,$1
+    ori $2,70,$3
+    beq $4,$5,L370
+    jmp L371
+    la X2
+    call L2310
+    sw $6,70,$7
+    bne $8,$9,L369
+W370: .dw 370000,-370
+B370: .db 114,-70,7
+S370: .asciz "str370"
+    .dh 370
+L371: add $6,$7,$8
+    ori $9,71,$10
+    beq $11,$12,L371
+    jmp L372
+    la X3
+    call L2323
+    sw $13,71,$14
+    bne $15,$16,L370
+W371: .dw 371000,-371
+B371: .db 115,-71,7
+L372: add $13,$14,$15
+    ori $16,72,$17
+    beq $18,$19,L372
+    jmp L373
+    la X4
+    call L2336
+    sw $20,72,$21
+    bne $22,$23,L371
+W372: .dw 372000,-372
+B372: .db 116,-72,7
+L373: add $20,$21,$22
+    ori $23,73,$24
+    beq $25,$26,L373
+    jmp L374
+    la X5
+    call L2349
+    sw $27,73,$28
+    bne $29,$30,L372
+W373: .dw 373000,-373
+B373: .db 117,-73,7
+L374: add $27,$28,$29
+    ori $30,74,$31
+    beq $0,$1,L374
+    jmp L375
+    la X6
+    call L2362
+    sw $2,74,$3
+    bne $4,$5,L373
+W374: .dw 374000,-374
+B374: .db 118,-74,7
+L375: add $2,$3,$4
+    ori $5,75,$6
+    beq $7,$8,L375
+    jmp L376
+    la X7
+    call L2375
+    sw $9,75,$10
+    bne $11,$12,L374
+W375: .dw 375000,-375
+B375: .db 119,-75,7
+L376: add $9,$10,$11
+    ori $12,76,$13
+    beq $14,$15,L376
+    jmp L377
+    la X0
+    call L2388
+    sw $16,76,$17
+    bne $18,$19,L375
+W376: .dw 376000,-376
+B376: .db 120,-76,7
+L377: add $16,$17,$18
+    ori $19,77,$20
+    beq $21,$22,L377
+    jmp L378
+    la X1
+    call L2401
+    sw $23,77,$24
+    bne $25,$26,L376
+W377: .dw 377000,-377
+B377: .db 121,-77,7
+L378: add $23,$24,$25
+    ori $26,78,$27
+    beq $28,$29,L378
+    jmp L379
+    la X2
+    call L2414
+    sw $30,78,$31
+    bne $0,$1,L377
+W378: .dw 378000,-378
+B378: .db 122,-78,7
+L379: add $30,$31,$0
+    ori $1,79,$2
+    beq $3,$4,L379
+    jmp L380
+    la X3
+    call L2427
+    sw $5,79,$6
+    bne $7,$8,L378
+W379: .dw 379000,-379
+B379: .db 123,-79,7
+L380: add $5,$6,$7
+    ori $8,80,$9
+    beq $10,$11,L380
+    jmp L381
+    la X4
+    call L2440
+    sw $12,80,$13
+    bne $14,$15,L379
+W380: .dw 380000,-380
+B380: .db 124,-80,7
+S380: .asciz "str380"
+    .dh 380
+L381: add $12,$13,$14
+    ori $15,81,$16
+    beq $17,$18,L381
+    jmp L382
+    la X5
+    call L2453
+    sw $19,81,$20
+    bne $21,$22,L380
+W381: .dw 381000,-381
+B381: .db 125,-81,7
+L382: add $19,$20,$21
+    ori $22,82,$23
+    beq $24,$25,L382
+    jmp L383
+    la X6
+    call L2466
+    sw $26,82,$27
+    bne $28,$29,L381
+W382: .dw 382000,-382
+B382: .db 126,-82,7
+L383: add $26,$27,$28
+    ori $29,83,$30
+    beq $31,$0,L383
+    jmp L384
+    la X7
+    call L2479
+    sw $1,83,$2
+    bne $3,$4,L382
+W383: .dw 383000,-383
+B383: .db 127,-83,7
+L384: add $1,$2,$3
+    ori $4,84,$5
+    beq $6,$7,L384
+    jmp L385
+    la X0
+    call L2492
+    sw $8,84,$9
+    bne $10,$11,L383
+W384: .dw 384000,-384
+B384: .db 0,-84,7
+L385: add $8,$9,$10
+    ori $11,85,$12
+    beq $13,$14,L385
+    jmp L386
+    la X1
+    call L5
+    sw $15,85,$16
+    bne $17,$18,L384
+W385: .dw 385000,-385
+B385: .db 1,-85,7
+L386: add $15,$16,$17
+    ori $18,86,$19
+    beq $20,$21,L386
+    jmp L387
+    la X2
+    call L18
+    sw $22,86,$23
+    bne $24,$25,L385
+W386: .dw 386000,-386
+B386: .db 2,-86,7
+L387: add $22,$23,$24
+    ori $25,87,$26
+    beq $27,$28,L387
+    jmp L388
+    la X3
+    call L31
+    sw $29,87,$30
+    bne $31,$0,L386
+W387: .dw 387000,-387
+B387: .db 3,-87,7
+L388: add $29,$30,$31
+    ori $0,88,$1
+    beq $2,$3,L388
+    jmp L389
+    la X4
+    call L44
+    sw $4,88,$5
+    bne $6,$7,L387
+W388: .dw 388000,-388
+B388: .db 4,-88,7
+L389: add $4,$5,$6
+    ori $7,89,$8
+    beq $9,$10,L389
+    jmp L390
+    la X5
+    call L57
+    sw $11,89,$12
+    bne $13,$14,L388
+W389: .dw 389000,-389
+B389: .db 5,-89,7
+L390: add $11,$12,$13
+    ori $14,90,$15
+    beq $16,$17,L390
+    jmp L391
+    la X6
+    call L70
+    sw $18,90,$19
+    bne $20,$21,L389
+W390: .dw 390000,-390
+B390: .db 6,-90,7
+S390: .asciz "str390"
+    .dh 390
+L391: add $18,$19,$20
+    ori $21,91,$22
+    beq $23,$24,L391
+    jmp L392
+    la X7
+    call L83
+    sw $25,91,$26
+    bne $27,$28,L390
+W391: .dw 391000,-391
+B391: .db 7,-91,7
+L392: add $25,$26,$27
+    ori $28,92,$29
+    beq $30,$31,L392
+    jmp L393
+    la X0
+    call L96
+    sw $0,92,$1
+    bne $2,$3,L391
+W392: .dw 392000,-392
+B392: .db 8,-92,7
+L393: add $0,$1,$2
+    ori $3,93,$4
+    beq $5,$6,L393
+    jmp L394
+    la X1
+    call L109
+    sw $7,93,$8
+    bne $9,$10,L392
+W393: .dw 393000,-393
+B393: .db 9,-93,7
+L394: add $7,$8,$9
+    ori $10,94,$11
+    beq $12,$13,L394
+    jmp L395
+    la X2
+    call L122
+    sw $14,94,$15
+    bne $16,$17,L393
+W394: .dw 394000,-394
+B394: .db 10,-94,7
+L395: add $14,$15,$16
+    ori $17,95,$18
+    beq $19,$20,L395
+    jmp L396
+    la X3
+    call L135
+    sw $21,95,$22
+    bne $23,$24,L394
+W395: .dw 395000,-395
+B395: .db 11,-95,7
+L396: add $21,$22,$23
+    ori $24,96,$25
+    beq $26,$27,L396
+    jmp L397
+    la X4
+    call L148
+    sw $28,96,$29
+    bne $30,$31,L395
+W396: .dw 396000,-396
+B396: .db 12,-96,7
+L397: add $28,$29,$30
+    ori $31,97,$0
+    beq $1,$2,L397
+    jmp L398
+    la X5
+    call L161
+    sw $3,97,$4
+    bne $5,$6,L396
+W397: .dw 397000,-397
+B397: .db 13,-97,7
+L398: add $3,$4,$5
+    ori $6,98,$7
+    beq $8,$9,L398
+    jmp L399
+    la X6
+    call L174
+    sw $10,98,$11
+    bne $12,$13,L397
+W398: .dw 398000,-398
+B398: .db 14,-98,7
+L399: add $10,$11,$12
+    ori $13,99,$14
+    beq $15,$16,L399
+    jmp L400
+    la X7
+    call L187
+    sw $17,99,$18
+    bne $19,$20,L398
+W399: .dw 399000,-399
+B399: .db 15,-99,7
+L400: add $17,$18,$19
+    ori $20,-100,$21
+    beq $22,$23,L400
+    jmp L401
+    la X0
+    call L200
+    sw $24,0,$25
+    bne $26,$27,L399
+W400: .dw 400000,-400
+B400: .db 16,0,7
+S400: .asciz "str400"
+    .dh 400
+.entry L400
+.entry W400
+L401: add $24,$25,$26
+    ori $27,-99,$28
+    beq $29,$30,L401
+    jmp L402
+    la X1
+    call L213
+    sw $31,1,$0
+    bne $1,$2,L400
+W401: .dw 401000,-401
+B401: .db 17,-1,7
+L402: add $31,$0,$1
+    ori $2,-98,$3
+    beq $4,$5,L402
+    jmp L403
+    la X2
+    call L226
+    sw $6,2,$7
+    bne $8,$9,L401
+W402: .dw 402000,-402
+B402: .db 18,-2,7
+L403: add $6,$7,$8
+    ori $9,-97,$10
+    beq $11,$12,L403
+    jmp L404
+    la X3
+    call L239
+    sw $13,3,$14
+    bne $15,$16,L402
+W403: .dw 403000,-403
+B403: .db 19,-3,7
+L404: add $13,$14,$15
+    ori $16,-96,$17
+    beq $18,$19,L404
+    jmp L405
+    la X4
+    call L252
+    sw $20,4,$21
+    bne $22,$23,L403
+W404: .dw 404000,-404
+B404: .db 20,-4,7
+L405: add $20,$21,$22
+    ori $23,-95,$24
+    beq $25,$26,L405
+    jmp L406
+    la X5
+    call L265
+    sw $27,5,$28
+    bne $29,$30,L404
+W405: .dw 405000,-405
+B405: .db 21,-5,7
+L406: add $27,$28,$29
+    ori $30,-94,$31
+    beq $0,$1,L406
+    jmp L407
+    la X6
+    call L278
+    sw $2,6,$3
+    bne $4,$5,L405
+W406: .dw 406000,-406
+B406: .db 22,-6,7
+L407: add $2,$3,$4
+    ori $5,-93,$6
+    beq $7,$8,L407
+    jmp L408
+    la X7
+    call L291
+    sw $9,7,$10
+    bne $11,$12,L406
+W407: .dw 407000,-407
+B407: .db 23,-7,7
+L408: add $9,$10,$11
+    ori $12,-92,$13
+    beq $14,$15,L408
+    jmp L409
+    la X0
+    call L304
+    sw $16,8,$17
+    bne $18,$19,L407
+W408: .dw 408000,-408
+B408: .db 24,-8,7
+L409: add $16,$17,$18
+    ori $19,-91,$20
+    beq $21,$22,L409
+    jmp L410
+    la X1
+    call L317
+    sw $23,9,$24
+    bne $25,$26,L408
+W409: .dw 409000,-409
+B409: .db 25,-9,7
+L410: add $23,$24,$25
+    ori $26,-90,$27
+    beq $28,$29,L410
+    jmp L411
+    la X2
+    call L330
+    sw $30,10,$31
+    bne $0,$1,L409
+W410: .dw 410000,-410
+B410: .db 26,-10,7
+S410: .asciz "str410"
+    .dh 410
+L411: add $30,$31,$0
+    ori $1,-89,$2
+    beq $3,$4,L411
+    jmp L412
+    la X3
+    call L343
+    sw $5,11,$6
+    bne $7,$8,L410
+W411: .dw 411000,-411
+B411: .db 27,-11,7
+L412: add $5,$6,$7
+    ori $8,-88,$9
+    beq $10,$11,L412
+    jmp L413
+    la X4
+    call L356
+    sw $12,12,$13
+    bne $14,$15,L411
+W412: .dw 412000,-412
+B412: .db 28,-12,7
+L413: add $12,$13,$14
+    ori $15,-87,$16
+    beq $17,$18,L413
+    jmp L414
+    la X5
+    call L369
+    sw $19,13,$20
+    bne $21,$22,L412
+W413: .dw 413000,-413
+B413: .db 29,-13,7
+L414: add $19,$20,$21
+    ori $22,-86,$23
+    beq $24,$25,L414
+    jmp L415
+    la X6
+    call L382
+    sw $26,14,$27
+    bne $28,$29,L413
+W414: .dw 414000,-414
+B414: .db 30,-14,7
+L415: add $26,$27,$28
+    ori $29,-85,$30
+    beq $31,$0,L415
+    jmp L416
+    la X7
+    call L395
+    sw $1,15,$2
+    bne $3,$4,L414
+W415: .dw 415000,-415
+B415: .db 31,-15,7
+L416: add $1,$2,$3
+    ori $4,-84,$5
+    beq $6,$7,L416
+    jmp L417
+    la X0
+    call L408
+    sw $8,16,$9
+    bne $10,$11,L415
+W416: .dw 416000,-416
+B416: .db 32,-16,7
+L417: add $8,$9,$10
+    ori $11,-83,$12
+    beq $13,$14,L417
+    jmp L418
+    la X1
+    call L421
+    sw $15,17,$16
+    bne $17,$18,L416
+W417: .dw 417000,-417
+B417: .db 33,-17,7
+L418: add $15,$16,$17
+    ori $18,-82,$19
+    beq $20,$21,L418
+    jmp L419
+    la X2
+    call L434
+    sw $22,18,$23
+    bne $24,$25,L417
+W418: .dw 418000,-418
+B418: .db 34,-18,7
+L419: add $22,$23,$24
+    ori $25,-81,$26
+    beq $27,$28,L419
+    jmp L420
+    la X3
+    call L447
+    sw $29,19,$30
+    bne $31,$0,L418
+W419: .dw 419000,-419
+B419: .db 35,-19,7
+L420: add $29,$30,$31
+    ori $0,-80,$1
+    beq $2,$3,L420
+    jmp L421
+    la X4
+    call L460
+    sw $4,20,$5
+    bne $6,$7,L419
+W420: .dw 420000,-420
+B420: .db 36,-20,7
+S420: .asciz "str420"
+    .dh 420
+L421: add $4,$5,$6
+    ori $7,-79,$8
+    beq $9,$10,L421
+    jmp L422
+    la X5
+    call L473
+    sw $11,21,$12
+    bne $13,$14,L420
+W421: .dw 421000,-421
+B421: .db 37,-21,7
+L422: add $11,$12,$13
+    ori $14,-78,$15
+    beq $16,$17,L422
+    jmp L423
+    la X6
+    call L486
+    sw $18,22,$19
+    bne $20,$21,L421
+W422: .dw 422000,-422
+B422: .db 38,-22,7
+L423: add $18,$19,$20
+    ori $21,-77,$22
+    beq $23,$24,L423
+    jmp L424
+    la X7
+    call L499
+    sw $25,23,$26
+    bne $27,$28,L422
+W423: .dw 423000,-423
+B423: .db 39,-23,7
+L424: add $25,$26,$27
+    ori $28,-76,$29
+    beq $30,$31,L424
+    jmp L425
+    la X0
+    call L512
+    sw $0,24,$1
+    bne $2,$3,L423
+W424: .dw 424000,-424
+B424: .db 40,-24,7
+L425: add $0,$1,$2
+    ori $3,-75,$4
+    beq $5,$6,L425
+    jmp L426
+    la X1
+    call L525
+    sw $7,25,$8
+    bne $9,$10,L424
+W425: .dw 425000,-425
+B425: .db 41,-25,7
+L426: add $7,$8,$9
+    ori $10,-74,$11
+    beq $12,$13,L426
+    jmp L427
+    la X2
+    call L538
+    sw $14,26,$15
+    bne $16,$17,L425
+W426: .dw 426000,-426
+B426: .db 42,-26,7
+L427: add $14,$15,$16
+    ori $17,-73,$18
+    beq $19,$20,L427
+    jmp L428
+    la X3
+    call L551
+    sw $21,27,$22
+    bne $23,$24,L426
+W427: .dw 427000,-427
+B427: .db 43,-27,7
+L428: add $21,$22,$23
+    ori $24,-72,$25
+    beq $26,$27,L428
+    jmp L429
+    la X4
+    call L564
+    sw $28,28,$29
+    bne $30,$31,L427
+W428: .dw 428000,-428
+B428: .db 44,-28,7
+L429: add $28,$29,$30
+    ori $31,-71,$0
+    beq $1,$2,L429
+    jmp L430
+    la X5
+    call L577
+    sw $3,29,$4
+    bne $5,$6,L428
+W429: .dw 429000,-429
+B429: .db 45,-29,7
+L430: add $3,$4,$5
+    ori $6,-70,$7
+    beq $8,$9,L430
+    jmp L431
+    la X6
+    call L590
+    sw $10,30,$11
+    bne $12,$13,L429
+W430: .dw 430000,-430
+B430: .db 46,-30,7
+S430: .asciz "str430"
+    .dh 430
+L431: add $10,$11,$12
+    ori $13,-69,$14
+    beq $15,$16,L431
+    jmp L432
+    la X7
+    call L603
+    sw $17,31,$18
+    bne $19,$20,L430
+W431: .dw 431000,-431
+B431: .db 47,-31,7
+L432: add $17,$18,$19
+    ori $20,-68,$21
+    beq $22,$23,L432
+    jmp L433
+    la X0
+    call L616
+    sw $24,32,$25
+    bne $26,$27,L431
+W432: .dw 432000,-432
+B432: .db 48,-32,7
+L433: add $24,$25,$26
+    ori $27,-67,$28
+    beq $29,$30,L433
+    jmp L434
+    la X1
+    call L629
+    sw $31,33,$0
+    bne $1,$2,L432
+W433: .dw 433000,-433
+B433: .db 49,-33,7
+L434: add $31,$0,$1
+    ori $2,-66,$3
+    beq $4,$5,L434
+    jmp L435
+    la X2
+    call L642
+    sw $6,34,$7
+    bne $8,$9,L433
+W434: .dw 434000,-434
+B434: .db 50,-34,7
+L435: add $6,$7,$8
+    ori $9,-65,$10
+    beq $11,$12,L435
+    jmp L436
+    la X3
+    call L655
+    sw $13,35,$14
+    bne $15,$16,L434
+W435: .dw 435000,-435
+B435: .db 51,-35,7
+L436: add $13,$14,$15
+    ori $16,-64,$17
+    beq $18,$19,L436
+    jmp L437
+    la X4
+    call L668
+    sw $20,36,$21
+    bne $22,$23,L435
+W436: .dw 436000,-436
+B436: .db 52,-36,7
+L437: add $20,$21,$22
+    ori $23,-63,$24
+    beq $25,$26,L437
+    jmp L438
+    la X5
+    call L681
+    sw $27,37,$28
+    bne $29,$30,L436
+W437: .dw 437000,-437
+B437: .db 53,-37,7
+L438: add $27,$28,$29
+    ori $30,-62,$31
+    beq $0,$1,L438
+    jmp L439
+    la X6
+    call L694
+    sw $2,38,$3
+    bne $4,$5,L437
+W438: .dw 438000,-438
+B438: .db 54,-38,7
+L439: add $2,$3,$4
+    ori $5,-61,$6
+    beq $7,$8,L439
+    jmp L440
+    la X7
+    call L707
+    sw $9,39,$10
+    bne $11,$12,L438
+W439: .dw 439000,-439
+B439: .db 55,-39,7
+L440: add $9,$10,$11
+    ori $12,-60,$13
+    beq $14,$15,L440
+    jmp L441
+    la X0
+    call L720
+    sw $16,40,$17
+    bne $18,$19,L439
+W440: .dw 440000,-440
+B440: .db 56,-40,7
+S440: .asciz "str440"
+    .dh 440
+L441: add $16,$17,$18
+    ori $19,-59,$20
+    beq $21,$22,L441
+    jmp L442
+    la X1
+    call L733
+    sw $23,41,$24
+    bne $25,$26,L440
+W441: .dw 441000,-441
+B441: .db 57,-41,7
+L442: add $23,$24,$25
+    ori $26,-58,$27
+    beq $28,$29,L442
+    jmp L443
+    la X2
+    call L746
+    sw $30,42,$31
+    bne $0,$1,L441
+W442: .dw 442000,-442
+B442: .db 58,-42,7
+L443: add $30,$31,$0
+    ori $1,-57,$2
+    beq $3,$4,L443
+    jmp L444
+    la X3
+    call L759
+    sw $5,43,$6
+    bne $7,$8,L442
+W443: .dw 443000,-443
+B443: .db 59,-43,7
+L444: add $5,$6,$7
+    ori $8,-56,$9
+    beq $10,$11,L444
+    jmp L445
+    la X4
+    call L772
+    sw $12,44,$13
+    bne $14,$15,L443
+W444: .dw 444000,-444
+B444: .db 60,-44,7
+L445: add $12,$13,$14
+    ori $15,-55,$16
+    beq $17,$18,L445
+    jmp L446
+    la X5
+    call L785
+    sw $19,45,$20
+    bne $21,$22,L444
+W445: .dw 445000,-445
+B445: .db 61,-45,7
+L446: add $19,$20,$21
+    ori $22,-54,$23
+    beq $24,$25,L446
+    jmp L447
+    la X6
+    call L798
+    sw $26,46,$27
+    bne $28,$29,L445
+W446: .dw 446000,-446
+B446: .db 62,-46,7
+L447: add $26,$27,$28
+    ori $29,-53,$30
+    beq $31,$0,L447
+    jmp L448
+    la X7
+    call L811
+    sw $1,47,$2
+    bne $3,$4,L446
+W447: .dw 447000,-447
+B447: .db 63,-47,7
+L448: add $1,$2,$3
+    ori $4,-52,$5
+    beq $6,$7,L448
+    jmp L449
+    la X0
+    call L824
+    sw $8,48,$9
+    bne $10,$11,L447
+W448: .dw 448000,-448
+B448: .db 64,-48,7
+L449: add $8,$9,$10
+    ori $11,-51,$12
+    beq $13,$14,L449
+    jmp L450
+    la X1
+    call L837
+    sw $15,49,$16
+    bne $17,$18,L448
+W449: .dw 449000,-449
+B449: .db 65,-49,7
+L450: add $15,$16,$17
+    ori $18,-50,$19
+    beq $20,$21,L450
+    jmp L451
+    la X2
+    call L850
+    sw $22,50,$23
+    bne $24,$25,L449
+W450: .dw 450000,-450
+B450: .db 66,-50,7
+S450: .asciz "str450"
+    .dh 450
+.entry L450
+.entry W450
+L451: add $22,$23,$24
+    ori $25,-49,$26
+    beq $27,$28,L451
+    jmp L452
+    la X3
+    call L863
+    sw $29,51,$30
+    bne $31,$0,L450
+W451: .dw 451000,-451
+B451: .db 67,-51,7
+L452: add $29,$30,$31
+    ori $0,-48,$1
+    beq $2,$3,L452
+    jmp L453
+    la X4
+    call L876
+    sw $4,52,$5
+    bne $6,$7,L451
+W452: .dw 452000,-452
+B452: .db 68,-52,7
+L453: add $4,$5,$6
+    ori $7,-47,$8
+    beq $9,$10,L453
+    jmp L454
+    la X5
+    call L889
+    sw $11,53,$12
+    bne $13,$14,L452
+W453: .dw 453000,-453
+B453: .db 69,-53,7
+L454: add $11,$12,$13
+    ori $14,-46,$15
+    beq $16,$17,L454
+    jmp L455
+    la X6
+    call L902
+    sw $18,54,$19
+    bne $20,$21,L453
+W454: .dw 454000,-454
+B454: .db 70,-54,7
+L455: add $18,$19,$20
+    ori $21,-45,$22
+    beq $23,$24,L455
+    jmp L456
+    la X7
+    call L915
+    sw $25,55,$26
+    bne $27,$28,L454
+W455: .dw 455000,-455
+B455: .db 71,-55,7
+L456: add $25,$26,$27
+    ori $28,-44,$29
+    beq $30,$31,L456
+    jmp L457
+    la X0
+    call L928
+    sw $0,56,$1
+    bne $2,$3,L455
+W456: .dw 456000,-456
+B456: .db 72,-56,7
+L457: add $0,$1,$2
+    ori $3,-43,$4
+    beq $5,$6,L457
+    jmp L458
+    la X1
+    call L941
+    sw $7,57,$8
+    bne $9,$10,L456
+W457: .dw 457000,-457
+B457: .db 73,-57,7
+L458: add $7,$8,$9
+    ori $10,-42,$11
+    beq $12,$13,L458
+    jmp L459
+    la X2
+    call L954
+    sw $14,58,$15
+    bne $16,$17,L457
+W458: .dw 458000,-458
+B458: .db 74,-58,7
+L459: add $14,$15,$16
+    ori $17,-41,$18
+    beq $19,$20,L459
+    jmp L460
+    la X3
+    call L967
+    sw $21,59,$22
+    bne $23,$24,L458
+W459: .dw 459000,-459
+B459: .db 75,-59,7
+L460: add $21,$22,$23
+    ori $24,-40,$25
+    beq $26,$27,L460
+    jmp L461
+    la X4
+    call L980
+    sw $28,60,$29
+    bne $30,$31,L459
+W460: .dw 460000,-460
+B460: .db 76,-60,7
+S460: .asciz "str460"
+    .dh 460
+L461: add $28,$29,$30
+    ori $31,-39,$0
+    beq $1,$2,L461
+    jmp L462
+    la X5
+    call L993
+    sw $3,61,$4
+    bne $5,$6,L460
+W461: .dw 461000,-461
+B461: .db 77,-61,7
+L462: add $3,$4,$5
+    ori $6,-38,$7
+    beq $8,$9,L462
+    jmp L463
+    la X6
+    call L1006
+    sw $10,62,$11
+    bne $12,$13,L461
+W462: .dw 462000,-462
+B462: .db 78,-62,7
+L463: add $10,$11,$12
+    ori $13,-37,$14
+    beq $15,$16,L463
+    jmp L464
+    la X7
+    call L1019
+    sw $17,63,$18
+    bne $19,$20,L462
+W463: .dw 463000,-463
+B463: .db 79,-63,7
+L464: add $17,$18,$19
+    ori $20,-36,$21
+    beq $22,$23,L464
+    jmp L465
+    la X0
+    call L1032
+    sw $24,64,$25
+    bne $26,$27,L463
+W464: .dw 464000,-464
+B464: .db 80,-64,7
+L465: add $24,$25,$26
+    ori $27,-35,$28
+    beq $29,$30,L465
+    jmp L466
+    la X1
+    call L1045
+    sw $31,65,$0
+    bne $1,$2,L464
+W465: .dw 465000,-465
+B465: .db 81,-65,7
+L466: add $31,$0,$1
+    ori $2,-34,$3
+    beq $4,$5,L466
+    jmp L467
+    la X2
+    call L1058
+    sw $6,66,$7
+    bne $8,$9,L465
+W466: .dw 466000,-466
+B466: .db 82,-66,7
+L467: add $6,$7,$8
+    ori $9,-33,$10
+    beq $11,$12,L467
+    jmp L468
+    la X3
+    call L1071
+    sw $13,67,$14
+    bne $15,$16,L466
+W467: .dw 467000,-467
+B467: .db 83,-67,7
+L468: add $13,$14,$15
+    ori $16,-32,$17
+    beq $18,$19,L468
+    jmp L469
+    la X4
+    call L1084
+    sw $20,68,$21
+    bne $22,$23,L467
+W468: .dw 468000,-468
+B468: .db 84,-68,7
+L469: add $20,$21,$22
+    ori $23,-31,$24
+    beq $25,$26,L469
+    jmp L470
+    la X5
+    call L1097
+    sw $27,69,$28
+    bne $29,$30,L468
+W469: .dw 469000,-469
+B469: .db 85,-69,7
+L470: add $27,$28,$29
+    ori $30,-30,$31
+    beq $0,$1,L470
+    jmp L471
+    la X6
+    call L1110
+    sw $2,70,$3
+    bne $4,$5,L469
+W470: .dw 470000,-470
+B470: .db 86,-70,7
+S470: .asciz "str470"
+    .dh 470
+L471: add $2,$3,$4
+    ori $5,-29,$6
+    beq $7,$8,L471
+    jmp L472
+    la X7
+    call L1123
+    sw $9,71,$10
+    bne $11,$12,L470
+W471: .dw 471000,-471
+B471: .db 87,-71,7
+L472: add $9,$10,$11
+    ori $12,-28,$13
+    beq $14,$15,L472
+    jmp L473
+    la X0
+    call L1136
+    sw $16,72,$17
+    bne $18,$19,L471
+W472: .dw 472000,-472
+B472: .db 88,-72,7
+L473: add $16,$17,$18
+    ori $19,-27,$20
+    beq $21,$22,L473
+    jmp L474
+    la X1
+    call L1149
+    sw $23,73,$24
+    bne $25,$26,L472
+W473: .dw 473000,-473
+B473: .db 89,-73,7
+L474: add $23,$24,$25
+    ori $26,-26,$27
+    beq $28,$29,L474
+    jmp L475
+    la X2
+    call L1162
+    sw $30,74,$31
+    bne $0,$1,L473
+W474: .dw 474000,-474
+B474: .db 90,-74,7
+L475: add $30,$31,$0
+    ori $1,-25,$2
+    beq $3,$4,L475
+    jmp L476
+    la X3
+    call L1175
+    sw $5,75,$6
+    bne $7,$8,L474
+W475: .dw 475000,-475
+B475: .db 91,-75,7
+L476: add $5,$6,$7
+    ori $8,-24,$9
+    beq $10,$11,L476
+    jmp L477
+    la X4
+    call L1188
+    sw $12,76,$13
+    bne $14,$15,L475
+W476: .dw 476000,-476
+B476: .db 92,-76,7
+L477: add $12,$13,$14
+    ori $15,-23,$16
+    beq $17,$18,L477
+    jmp L478
+    la X5
+    call L1201
+    sw $19,77,$20
+    bne $21,$22,L476
+W477: .dw 477000,-477
+B477: .db 93,-77,7
+L478: add $19,$20,$21
+    ori $22,-22,$23
+    beq $24,$25,L478
+    jmp L479
+    la X6
+    call L1214
+    sw $26,78,$27
+    bne $28,$29,L477
+W478: .dw 478000,-478
+B478: .db 94,-78,7
+L479: add $26,$27,$28
+    ori $29,-21,$30
+    beq $31,$0,L479
+    jmp L480
+    la X7
+    call L1227
+    sw $1,79,$2
+    bne $3,$4,L478
+W479: .dw 479000,-479
+B479: .db 95,-79,7
+L480: add $1,$2,$3
+    ori $4,-20,$5
+    beq $6,$7,L480
+    jmp L481
+    la X0
+    call L1240
+    sw $8,80,$9
+    bne $10,$11,L479
+W480: .dw 480000,-480
+B480: .db 96,-80,7
+S480: .asciz "str480"
+    .dh 480
+L481: add $8,$9,$10
+    ori $11,-19,$12
+    beq $13,$14,L481
+    jmp L482
+    la X1
+    call L1253
+    sw $15,81,$16
+    bne $17,$18,L480
+W481: .dw 481000,-481
+B481: .db 97,-81,7
+L482: add $15,$16,$17
+    ori $18,-18,$19
+    beq $20,$21,L482
+    jmp L483
+    la X2
+    call L1266
+    sw $22,82,$23
+    bne $24,$25,L481
+W482: .dw 482000,-482
+B482: .db 98,-82,7
+L483: add $22,$23,$24
+    ori $25,-17,$26
+    beq $27,$28,L483
+    jmp L484
+    la X3
+    call L1279
+    sw $29,83,$30
+    bne $31,$0,L482
+W483: .dw 483000,-483
+B483: .db 99,-83,7
+L484: add $29,$30,$31
+    ori $0,-16,$1
+    beq $2,$3,L484
+    jmp L485
+    la X4
+    call L1292
+    sw $4,84,$5
+    bne $6,$7,L483
+W484: .dw 484000,-484
+B484: .db 100,-84,7
+L485: add $4,$5,$6
+    ori $7,-15,$8
+    beq $9,$10,L485
+    jmp L486
+    la X5
+    call L1305
+    sw $11,85,$12
+    bne $13,$14,L484
+W485: .dw 485000,-485
+B485: .db 101,-85,7
+L486: add $11,$12,$13
+    ori $14,-14,$15
+    beq $16,$17,L486
+    jmp L487
+    la X6
+    call L1318
+    sw $18,86,$19
+    bne $20,$21,L485
+W486: .dw 486000,-486
+B486: .db 102,-86,7
+L487: add $18,$19,$20
+    ori $21,-13,$22
+    beq $23,$24,L487
+    jmp L488
+    la X7
+    call L1331
+    sw $25,87,$26
+    bne $27,$28,L486
+W487: .dw 487000,-487
+B487: .db 103,-87,7
+L488: add $25,$26,$27
+    ori $28,-12,$29
+    beq $30,$31,L488
+    jmp L489
+    la X0
+    call L1344
+    sw $0,88,$1
+    bne $2,$3,L487
+W488: .dw 488000,-488
+B488: .db 104,-88,7
+L489: add $0,$1,$2
+    ori $3,-11,$4
+    beq $5,$6,L489
+    jmp L490
+    la X1
+    call L1357
+    sw $7,89,$8
+    bne $9,$10,L488
+W489: .dw 489000,-489
+B489: .db 105,-89,7
+L490: add $7,$8,$9
+    ori $10,-10,$11
+    beq $12,$13,L490
+    jmp L491
+    la X2
+    call L1370
+    sw $14,90,$15
+    bne $16,$17,L489
+W490: .dw 490000,-490
+B490: .db 106,-90,7
+S490: .asciz "str490"
+    .dh 490
+L491: add $14,$15,$16
+    ori $17,-9,$18
+    beq $19,$20,L491
+    jmp L492
+    la X3
+    call L1383
+    sw $21,91,$22
+    bne $23,$24,L490
+W491: .dw 491000,-491
+B491: .db 107,-91,7
+L492: add $21,$22,$23
+    ori $24,-8,$25
+    beq $26,$27,L492
+    jmp L493
+    la X4
+    call L1396
+    sw $28,92,$29
+    bne $30,$31,L491
+W492: .dw 492000,-492
+B492: .db 108,-92,7
+L493: add $28,$29,$30
+    ori $31,-7,$0
+    beq $1,$2,L493
+    jmp L494
+    la X5
+    call L1409
+    sw $3,93,$4
+    bne $5,$6,L492
+W493: .dw 493000,-493
+B493: .db 109,-93,7
+L494: add $3,$4,$5
+    ori $6,-6,$7
+    beq $8,$9,L494
+    jmp L495
+    la X6
+    call L1422
+    sw $10,94,$11
+    bne $12,$13,L493
+W494: .dw 494000,-494
+B494: .db 110,-94,7
+L495: add $10,$11,$12
+    ori $13,-5,$14
+    beq $15,$16,L495
+    jmp L496
+    la X7
+    call L1435
+    sw $17,95,$18
+    bne $19,$20,L494
+W495: .dw 495000,-495
+B495: .db 111,-95,7
+L496: add $17,$18,$19
+    ori $20,-4,$21
+    beq $22,$23,L496
+    jmp L497
+    la X0
+    call L1448
+    sw $24,96,$25
+    bne $26,$27,L495
+W496: .dw 496000,-496
+B496: .db 112,-96,7
+L497: add $24,$25,$26
+    ori $27,-3,$28
+    beq $29,$30,L497
+    jmp L498
+    la X1
+    call L1461
+    sw $31,97,$0
+    bne $1,$2,L496
+W497: .dw 497000,-497
+B497: .db 113,-97,7
+L498: add $31,$0,$1
+    ori $2,-2,$3
+    beq $4,$5,L498
+    jmp L499
+    la X2
+    call L1474
+    sw $6,98,$7
+    bne $8,$9,L497
+W498: .dw 498000,-498
+B498: .db 114,-98,7
+L499: add $6,$7,$8
+    ori $9,-1,$10
+    beq $11,$12,L499
+    jmp L500
+    la X3
+    call L1487
+    sw $13,99,$14
+    bne $15,$16,L498
+W499: .dw 499000,-499
+B499: .db 115,-99,7
+L500: add $13,$14,$15
+    ori $16,0,$17
+    beq $18,$19,L500
+    jmp L501
+    la X4
+    call L1500
+    sw $20,0,$21
+    bne $22,$23,L499
+W500: .dw 500000,-500
+B500: .db 116,0,7
+S500: .asciz "str500"
+    .dh 500
+.entry L500
+.entry W500
+L501: add $20,$21,$22
+    ori $23,1,$24
+    beq $25,$26,L501
+    jmp L502
+    la X5
+    call L1513
+    sw $27,1,$28
+    bne $29,$30,L500
+W501: .dw 501000,-501
+B501: .db 117,-1,7
+L502: add $27,$28,$29
+    ori $30,2,$31
+    beq $0,$1,L502
+    jmp L503
+    la X6
+    call L1526
+    sw $2,2,$3
+    bne $4,$5,L501
+W502: .dw 502000,-502
+B502: .db 118,-2,7
+L503: add $2,$3,$4
+    ori $5,3,$6
+    beq $7,$8,L503
+    jmp L504
+    la X7
+    call L1539
+    sw $9,3,$10
+    bne $11,$12,L502
+W503: .dw 503000,-503
+B503: .db 119,-3,7
+L504: add $9,$10,$11
+    ori $12,4,$13
+    beq $14,$15,L504
+    jmp L505
+    la X0
+    call L1552
+    sw $16,4,$17
+    bne $18,$19,L503
+W504: .dw 504000,-504
+B504: .db 120,-4,7
+L505: add $16,$17,$18
+    ori $19,5,$20
+    beq $21,$22,L505
+    jmp L506
+    la X1
+    call L1565
+    sw $23,5,$24
+    bne $25,$26,L504
+W505: .dw 505000,-505
+B505: .db 121,-5,7
+L506: add $23,$24,$25
+    ori $26,6,$27
+    beq $28,$29,L506
+    jmp L507
+    la X2
+    call L1578
+    sw $30,6,$31
+    bne $0,$1,L505
+W506: .dw 506000,-506
+B506: .db 122,-6,7
+L507: add $30,$31,$0
+    ori $1,7,$2
+    beq $3,$4,L507
+    jmp L508
+    la X3
+    call L1591
+    sw $5,7,$6
+    bne $7,$8,L506
+W507: .dw 507000,-507
+B507: .db 123,-7,7
+L508: add $5,$6,$7
+    ori $8,8,$9
+    beq $10,$11,L508
+    jmp L509
+    la X4
+    call L1604
+    sw $12,8,$13
+    bne $14,$15,L507
+W508: .dw 508000,-508
+B508: .db 124,-8,7
+L509: add $12,$13,$14
+    ori $15,9,$16
+    beq $17,$18,L509
+    jmp L510
+    la X5
+    call L1617
+    sw $19,9,$20
+    bne $21,$22,L508
+W509: .dw 509000,-509
+B509: .db 125,-9,7
+L510: add $19,$20,$21
+    ori $22,10,$23
+    beq $24,$25,L510
+    jmp L511
+    la X6
+    call L1630
+    sw $26,10,$27
+    bne $28,$29,L509
+W510: .dw 510000,-510
+B510: .db 126,-10,7
+S510: .asciz "str510"
+    .dh 510
+L511: add $26,$27,$28
+    ori $29,11,$30
+    beq $31,$0,L511
+    jmp L512
+    la X7
+    call L1643
+    sw $1,11,$2
+    bne $3,$4,L510
+W511: .dw 511000,-511
+B511: .db 127,-11,7
+L512: add $1,$2,$3
+    ori $4,12,$5
+    beq $6,$7,L512
+    jmp L513
+    la X0
+    call L1656
+    sw $8,12,$9
+    bne $10,$11,L511
+W512: .dw 512000,-512
+B512: .db 0,-12,7
+L513: add $8,$9,$10
+    ori $11,13,$12
+    beq $13,$14,L513
+    jmp L514
+    la X1
+    call L1669
+    sw $15,13,$16
+    bne $17,$18,L512
+W513: .dw 513000,-513
+B513: .db 1,-13,7
+L514: add $15,$16,$17
+    ori $18,14,$19
+    beq $20,$21,L514
+    jmp L515
+    la X2
+    call L1682
+    sw $22,14,$23
+    bne $24,$25,L513
+W514: .dw 514000,-514
+B514: .db 2,-14,7
+L515: add $22,$23,$24
+    ori $25,15,$26
+    beq $27,$28,L515
+    jmp L516
+    la X3
+    call L1695
+    sw $29,15,$30
+    bne $31,$0,L514
+W515: .dw 515000,-515
+B515: .db 3,-15,7
+L516: add $29,$30,$31
+    ori $0,16,$1
+    beq $2,$3,L516
+    jmp L517
+    la X4
+    call L1708
+    sw $4,16,$5
+    bne $6,$7,L515
+W516: .dw 516000,-516
+B516: .db 4,-16,7
+L517: add $4,$5,$6
+    ori $7,17,$8
+    beq $9,$10,L517
+    jmp L518
+    la X5
+    call L1721
+    sw $11,17,$12
+    bne $13,$14,L516
+W517: .dw 517000,-517
+B517: .db 5,-17,7
+L518: add $11,$12,$13
+    ori $14,18,$15
+    beq $16,$17,L518
+    jmp L519
+    la X6
+    call L1734
+    sw $18,18,$19
+    bne $20,$21,L517
+W518: .dw 518000,-518
+B518: .db 6,-18,7
+L519: add $18,$19,$20
+    ori $21,19,$22
+    beq $23,$24,L519
+    jmp L520
+    la X7
+    call L1747
+    sw $25,19,$26
+    bne $27,$28,L518
+W519: .dw 519000,-519
+B519: .db 7,-19,7
+L520: add $25,$26,$27
+    ori $28,20,$29
+    beq $30,$31,L520
+    jmp L521
+    la X0
+    call L1760
+    sw $0,20,$1
+    bne $2,$3,L519
+W520: .dw 520000,-520
+B520: .db 8,-20,7
+S520: .asciz "str520"
+    .dh 520
+L521: add $0,$1,$2
+    ori $3,21,$4
+    beq $5,$6,L521
+    jmp L522
+    la X1
+    call L1773
+    sw $7,21,$8
+    bne $9,$10,L520
+W521: .dw 521000,-521
+B521: .db 9,-21,7
+L522: add $7,$8,$9
+    ori $10,22,$11
+    beq $12,$13,L522
+    jmp L523
+    la X2
+    call L1786
+    sw $14,22,$15
+    bne $16,$17,L521
+W522: .dw 522000,-522
+B522: .db 10,-22,7
+L523: add $14,$15,$16
+    ori $17,23,$18
+    beq $19,$20,L523
+    jmp L524
+    la X3
+    call L1799
+    sw $21,23,$22
+    bne $23,$24,L522
+W523: .dw 523000,-523
+B523: .db 11,-23,7
+L524: add $21,$22,$23
+    ori $24,24,$25
+    beq $26,$27,L524
+    jmp L525
+    la X4
+    call L1812
+    sw $28,24,$29
+    bne $30,$31,L523
+W524: .dw 524000,-524
+B524: .db 12,-24,7
+L525: add $28,$29,$30
+    ori $31,25,$0
+    beq $1,$2,L525
+    jmp L526
+    la X5
+    call L1825
+    sw $3,25,$4
+    bne $5,$6,L524
+W525: .dw 525000,-525
+B525: .db 13,-25,7
+L526: add $3,$4,$5
+    ori $6,26,$7
+    beq $8,$9,L526
+    jmp L527
+    la X6
+    call L1838
+    sw $10,26,$11
+    bne $12,$13,L525
+W526: .dw 526000,-526
+B526: .db 14,-26,7
+L527: add $10,$11,$12
+    ori $13,27,$14
+    beq $15,$16,L527
+    jmp L528
+    la X7
+    call L1851
+    sw $17,27,$18
+    bne $19,$20,L526
+W527: .dw 527000,-527
+B527: .db 15,-27,7
+L528: add $17,$18,$19
+    ori $20,28,$21
+    beq $22,$23,L528
+    jmp L529
+    la X0
+    call L1864
+    sw $24,28,$25
+    bne $26,$27,L527
+W528: .dw 528000,-528
+B528: .db 16,-28,7
+L529: add $24,$25,$26
+    ori $27,29,$28
+    beq $29,$30,L529
+    jmp L530
+    la X1
+    call L1877
+    sw $31,29,$0
+    bne $1,$2,L528
+W529: .dw 529000,-529
+B529: .db 17,-29,7
+L530: add $31,$0,$1
+    ori $2,30,$3
+    beq $4,$5,L530
+    jmp L531
+    la X2
+    call L1890
+    sw $6,30,$7
+    bne $8,$9,L529
+W530: .dw 530000,-530
+B530: .db 18,-30,7
+S530: .asciz "str530"
+    .dh 530
+L531: add $6,$7,$8
+    ori $9,31,$10
+    beq $11,$12,L531
+    jmp L532
+    la X3
+    call L1903
+    sw $13,31,$14
+    bne $15,$16,L530
+W531: .dw 531000,-531
+B531: .db 19,-31,7
+L532: add $13,$14,$15
+    ori $16,32,$17
+    beq $18,$19,L532
+    jmp L533
+    la X4
+    call L1916
+    sw $20,32,$21
+    bne $22,$23,L531
+W532: .dw 532000,-532
+B532: .db 20,-32,7
+L533: add $20,$21,$22
+    ori $23,33,$24
+    beq $25,$26,L533
+    jmp L534
+    la X5
+    call L1929
+    sw $27,33,$28
+    bne $29,$30,L532
+W533: .dw 533000,-533
+B533: .db 21,-33,7
+L534: add $27,$28,$29
+    ori $30,34,$31
+    beq $0,$1,L534
+    jmp L535
+    la X6
+    call L1942
+    sw $2,34,$3
+    bne $4,$5,L533
+W534: .dw 534000,-534
+B534: .db 22,-34,7
+L535: add $2,$3,$4
+    ori $5,35,$6
+    beq $7,$8,L535
+    jmp L536
+    la X7
+    call L1955
+    sw $9,35,$10
+    bne $11,$12,L534
+W535: .dw 535000,-535
+B535: .db 23,-35,7
+L536: add $9,$10,$11
+    ori $12,36,$13
+    beq $14,$15,L536
+    jmp L537
+    la X0
+    call L1968
+    sw $16,36,$17
+    bne $18,$19,L535
+W536: .dw 536000,-536
+B536: .db 24,-36,7
+L537: add $16,$17,$18
+    ori $19,37,$20
+    beq $21,$22,L537
+    jmp L538
+    la X1
+    call L1981
+    sw $23,37,$24
+    bne $25,$26,L536
+W537: .dw 537000,-537
+B537: .db 25,-37,7
+L538: add $23,$24,$25
+    ori $26,38,$27
+    beq $28,$29,L538
+    jmp L539
+    la X2
+    call L1994
+    sw $30,38,$31
+    bne $0,$1,L537
+W538: .dw 538000,-538
+B538: .db 26,-38,7
+L539: add $30,$31,$0
+    ori $1,39,$2
+    beq $3,$4,L539
+    jmp L540
+    la X3
+    call L2007
+    sw $5,39,$6
+    bne $7,$8,L538
+W539: .dw 539000,-539
+B539: .db 27,-39,7
+L540: add $5,$6,$7
+    ori $8,40,$9
+    beq $10,$11,L540
+    jmp L541
+    la X4
+    call L2020
+    sw $12,40,$13
+    bne $14,$15,L539
+W540: .dw 540000,-540
+B540: .db 28,-40,7
+S540: .asciz "str540"
+    .dh 540
+L541: add $12,$13,$14
+    ori $15,41,$16
+    beq $17,$18,L541
+    jmp L542
+    la X5
+    call L2033
+    sw $19,41,$20
+    bne $21,$22,L540
+W541: .dw 541000,-541
+B541: .db 29,-41,7
+L542: add $19,$20,$21
+    ori $22,42,$23
+    beq $24,$25,L542
+    jmp L543
+    la X6
+    call L2046
+    sw $26,42,$27
+    bne $28,$29,L541
+W542: .dw 542000,-542
+B542: .db 30,-42,7
+L543: add $26,$27,$28
+    ori $29,43,$30
+    beq $31,$0,L543
+    jmp L544
+    la X7
+    call L2059
+    sw $1,43,$2
+    bne $3,$4,L542
+W543: .dw 543000,-543
+B543: .db 31,-43,7
+L544: add $1,$2,$3
+    ori $4,44,$5
+    beq $6,$7,L544
+    jmp L545
+    la X0
+    call L2072
+    sw $8,44,$9
+    bne $10,$11,L543
+W544: .dw 544000,-544
+B544: .db 32,-44,7
+L545: add $8,$9,$10
+    ori $11,45,$12
+    beq $13,$14,L545
+    jmp L546
+    la X1
+    call L2085
+    sw $15,45,$16
+    bne $17,$18,L544
+W545: .dw 545000,-545
+B545: .db 33,-45,7
+L546: add $15,$16,$17
+    ori $18,46,$19
+    beq $20,$21,L546
+    jmp L547
+    la X2
+    call L2098
+    sw $22,46,$23
+    bne $24,$25,L545
+W546: .dw 546000,-546
+B546: .db 34,-46,7
+L547: add $22,$23,$24
+    ori $25,47,$26
+    beq $27,$28,L547
+    jmp L548
+    la X3
+    call L2111
+    sw $29,47,$30
+    bne $31,$0,L546
+W547: .dw 547000,-547
+B547: .db 35,-47,7
+L548: add $29,$30,$31
+    ori $0,48,$1
+    beq $2,$3,L548
+    jmp L549
+    la X4
+    call L2124
+    sw $4,48,$5
+    bne $6,$7,L547
+W548: .dw 548000,-548
+B548: .db 36,-48,7
+L549: add $4,$5,$6
+    ori $7,49,$8
+    beq $9,$10,L549
+    jmp L550
+    la X5
+    call L2137
+    sw $11,49,$12
+    bne $13,$14,L548
+W549: .dw 549000,-549
+B549: .db 37,-49,7
+L550: add $11,$12,$13
+    ori $14,50,$15
+    beq $16,$17,L550
+    jmp L551
+    la X6
+    call L2150
+    sw $18,50,$19
+    bne $20,$21,L549
+W550: .dw 550000,-550
+B550: .db 38,-50,7
+S550: .asciz "str550"
+    .dh 550
+.entry L550
+.entry W550
+L551: add $18,$19,$20
+    ori $21,51,$22
+    beq $23,$24,L551
+    jmp L552
+    la X7
+    call L2163
+    sw $25,51,$26
+    bne $27,$28,L550
+W551: .dw 551000,-551
+B551: .db 39,-51,7
+L552: add $25,$26,$27
+    ori $28,52,$29
+    beq $30,$31,L552
+    jmp L553
+    la X0
+    call L2176
+    sw $0,52,$1
+    bne $2,$3,L551
+W552: .dw 552000,-552
+B552: .db 40,-52,7
+L553: add $0,$1,$2
+    ori $3,53,$4
+    beq $5,$6,L553
+    jmp L554
+    la X1
+    call L2189
+    sw $7,53,$8
+    bne $9,$10,L552
+W553: .dw 553000,-553
+B553: .db 41,-53,7
+L554: add $7,$8,$9
+    ori $10,54,$11
+    beq $12,$13,L554
+    jmp L555
+    la X2
+    call L2202
+    sw $14,54,$15
+    bne $16,$17,L553
+W554: .dw 554000,-554
+B554: .db 42,-54,7
+L555: add $14,$15,$16
+    ori $17,55,$18
+    beq $19,$20,L555
+    jmp L556
+    la X3
+    call L2215
+    sw $21,55,$22
+    bne $23,$24,L554
+W555: .dw 555000,-555
+B555: .db 43,-55,7
+L556: add $21,$22,$23
+    ori $24,56,$25
+    beq $26,$27,L556
+    jmp L557
+    la X4
+    call L2228
+    sw $28,56,$29
+    bne $30,$31,L555
+W556: .dw 556000,-556
+B556: .db 44,-56,7
+L557: add $28,$29,$30
+    ori $31,57,$0
+    beq $1,$2,L557
+    jmp L558
+    la X5
+    call L2241
+    sw $3,57,$4
+    bne $5,$6,L556
+W557: .dw 557000,-557
+B557: .db 45,-57,7
+L558: add $3,$4,$5
+    ori $6,58,$7
+    beq $8,$9,L558
+    jmp L559
+    la X6
+    call L2254
+    sw $10,58,$11
+    bne $12,$13,L557
+W558: .dw 558000,-558
+B558: .db 46,-58,7
+L559: add $10,$11,$12
+    ori $13,59,$14
+    beq $15,$16,L559
+    jmp L560
+    la X7
+    call L2267
+    sw $17,59,$18
+    bne $19,$20,L558
+W559: .dw 559000,-559
+B559: .db 47,-59,7
+L560: add $17,$18,$19
+    ori $20,60,$21
+    beq $22,$23,L560
+    jmp L561
+    la X0
+    call L2280
+    sw $24,60,$25
+    bne $26,$27,L559
+W560: .dw 560000,-560
+B560: .db 48,-60,7
+S560: .asciz "str560"
+    .dh 560
+L561: add $24,$25,$26
+    ori $27,61,$28
+    beq $29,$30,L561
+    jmp L562
+    la X1
+    call L2293
+    sw $31,61,$0
+    bne $1,$2,L560
+W561: .dw 561000,-561
+B561: .db 49,-61,7
+L562: add $31,$0,$1
+    ori $2,62,$3
+    beq $4,$5,L562
+    jmp L563
+    la X2
+    call L2306
+    sw $6,62,$7
+    bne $8,$9,L561
+W562: .dw 562000,-562
+B562: .db 50,-62,7
+L563: add $6,$7,$8
+    ori $9,63,$10
+    beq $11,$12,L563
+    jmp L564
+    la X3
+    call L2319
+    sw $13,63,$14
+    bne $15,$16,L562
+W563: .dw 563000,-563
+B563: .db 51,-63,7
+L564: add $13,$14,$15
+    ori $16,64,$17
+    beq $18,$19,L564
+    jmp L565
+    la X4
+    call L2332
+    sw $20,64,$21
+    bne $22,$23,L563
+W564: .dw 564000,-564
+B564: .db 52,-64,7
+L565: add $20,$21,$22
+    ori $23,65,$24
+    beq $25,$26,L565
+    jmp L566
+    la X5
+    call L2345
+    sw $27,65,$28
+    bne $29,$30,L564
+W565: .dw 565000,-565
+B565: .db 53,-65,7
+L566: add $27,$28,$29
+    ori $30,66,$31
+    beq $0,$1,L566
+    jmp L567
+    la X6
+    call L2358
+    sw $2,66,$3
+    bne $4,$5,L565
+W566: .dw 566000,-566
+B566: .db 54,-66,7
+L567: add $2,$3,$4
+    ori $5,67,$6
+    beq $7,$8,L567
+    jmp L568
+    la X7
+    call L2371
+    sw $9,67,$10
+    bne $11,$12,L566
+W567: .dw 567000,-567
+B567: .db 55,-67,7
+L568: add $9,$10,$11
+    ori $12,68,$13
+    beq $14,$15,L568
+    jmp L569
+    la X0
+    call L2384
+    sw $16,68,$17
+    bne $18,$19,L567
+W568: .dw 568000,-568
+B568: .db 56,-68,7
+L569: add $16,$17,$18
+    ori $19,69,$20
+    beq $21,$22,L569
+    jmp L570
+    la X1
+    call L2397
+    sw $23,69,$24
+    bne $25,$26,L568
+W569: .dw 569000,-569
+B569: .db 57,-69,7
+L570: add $23,$24,$25
+    ori $26,70,$27
+    beq $28,$29,L570
+    jmp L571
+    la X2
+    call L2410
+    sw $30,70,$31
+    bne $0,$1,L569
+W570: .dw 570000,-570
+B570: .db 58,-70,7
+S570: .asciz "str570"
+    .dh 570
+L571: add $30,$31,$0
+    ori $1,71,$2
+    beq $3,$4,L571
+    jmp L572
+    la X3
+    call L2423
+    sw $5,71,$6
+    bne $7,$8,L570
+W571: .dw 571000,-571
+B571: .db 59,-71,7
+L572: add $5,$6,$7
+    ori $8,72,$9
+    beq $10,$11,L572
+    jmp L573
+    la X4
+    call L2436
+    sw $12,72,$13
+    bne $14,$15,L571
+W572: .dw 572000,-572
+B572: .db 60,-72,7
+L573: add $12,$13,$14
+    ori $15,73,$16
+    beq $17,$18,L573
+    jmp L574
+    la X5
+    call L2449
+    sw $19,73,$20
+    bne $21,$22,L572
+W573: .dw 573000,-573
+B573: .db 61,-73,7
+L574: add $19,$20,$21
+    ori $22,74,$23
+    beq $24,$25,L574
+    jmp L575
+    la X6
+    call L2462
+    sw $26,74,$27
+    bne $28,$29,L573
+W574: .dw 574000,-574
+B574: .db 62,-74,7
+L575: add $26,$27,$28
+    ori $29,75,$30
+    beq $31,$0,L575
+    jmp L576
+    la X7
+    call L2475
+    sw $1,75,$2
+    bne $3,$4,L574
+W575: .dw 575000,-575
+B575: .db 63,-75,7
+L576: add $1,$2,$3
+    ori $4,76,$5
+    beq $6,$7,L576
+    jmp L577
+    la X0
+    call L2488
+    sw $8,76,$9
+    bne $10,$11,L575
+W576: .dw 576000,-576
+B576: .db 64,-76,7
+L577: add $8,$9,$10
+    ori $11,77,$12
+    beq $13,$14,L577
+    jmp L578
+    la X1
+    call L1
+    sw $15,77,$16
+    bne $17,$18,L576
+W577: .dw 577000,-577
+B577: .db 65,-77,7
+L578: add $15,$16,$17
+    ori $18,78,$19
+    beq $20,$21,L578
+    jmp L579
+    la X2
+    call L14
+    sw $22,78,$23
+    bne $24,$25,L577
+W578: .dw 578000,-578
+B578: .db 66,-78,7
+L579: add $22,$23,$24
+    ori $25,79,$26
+    beq $27,$28,L579
+    jmp L580
+    la X3
+    call L27
+    sw $29,79,$30
+    bne $31,$0,L578
+W579: .dw 579000,-579
+B579: .db 67,-79,7
+L580: add $29,$30,$31
+    ori $0,80,$1
+    beq $2,$3,L580
+    jmp L581
+    la X4
+    call L40
+    sw $4,80,$5
+    bne $6,$7,L579
+W580: .dw 580000,-580
+B580: .db 68,-80,7
+S580: .asciz "str580"
+    .dh 580
+L581: add $4,$5,$6
+    ori $7,81,$8
+    beq $9,$10,L581
+    jmp L582
+    la X5
+    call L53
+    sw $11,81,$12
+    bne $13,$14,L580
+W581: .dw 581000,-581
+B581: .db 69,-81,7
+L582: add $11,$12,$13
+    ori $14,82,$15
+    beq $16,$17,L582
+    jmp L583
+    la X6
+    call L66
+    sw $18,82,$19
+    bne $20,$21,L581
+W582: .dw 582000,-582
+B582: .db 70,-82,7
+L583: add $18,$19,$20
+    ori $21,83,$22
+    beq $23,$24,L583
+    jmp L584
+    la X7
+    call L79
+    sw $25,83,$26
+    bne $27,$28,L582
+W583: .dw 583000,-583
+B583: .db 71,-83,7
+L584: add $25,$26,$27
+    ori $28,84,$29
+    beq $30,$31,L584
+    jmp L585
+    la X0
+    call L92
+    sw $0,84,$1
+    bne $2,$3,L583
+W584: .dw 584000,-584
+B584: .db 72,-84,7
+L585: add $0,$1,$2
+    ori $3,85,$4
+    beq $5,$6,L585
+    jmp L586
+    la X1
+    call L105
+    sw $7,85,$8
+    bne $9,$10,L584
+W585: .dw 585000,-585
+B585: .db 73,-85,7
+L586: add $7,$8,$9
+    ori $10,86,$11
+    beq $12,$13,L586
+    jmp L587
+    la X2
+    call L118
+    sw $14,86,$15
+    bne $16,$17,L585
+W586: .dw 586000,-586
+B586: .db 74,-86,7
+L587: add $14,$15,$16
+    ori $17,87,$18
+    beq $19,$20,L587
+    jmp L588
+    la X3
+    call L131
+    sw $21,87,$22
+    bne $23,$24,L586
+W587: .dw 587000,-587
+B587: .db 75,-87,7
+L588: add $21,$22,$23
+    ori $24,88,$25
+    beq $26,$27,L588
+    jmp L589
+    la X4
+    call L144
+    sw $28,88,$29
+    bne $30,$31,L587
+W588: .dw 588000,-588
+B588: .db 76,-88,7
+L589: add $28,$29,$30
+    ori $31,89,$0
+    beq $1,$2,L589
+    jmp L590
+    la X5
+    call L157
+    sw $3,89,$4
+    bne $5,$6,L588
+W589: .dw 589000,-589
+B589: .db 77,-89,7
+L590: add $3,$4,$5
+    ori $6,90,$7
+    beq $8,$9,L590
+    jmp L591
+    la X6
+    call L170
+    sw $10,90,$11
+    bne $12,$13,L589
+W590: .dw 590000,-590
+B590: .db 78,-90,7
+S590: .asciz "str590"
+    .dh 590
+L591: add $10,$11,$12
+    ori $13,91,$14
+    beq $15,$16,L591
+    jmp L592
+    la X7
+    call L183
+    sw $17,91,$18
+    bne $19,$20,L590
+W591: .dw 591000,-591
+B591: .db 79,-91,7
+L592: add $17,$18,$19
+    ori $20,92,$21
+    beq $22,$23,L592
+    jmp L593
+    la X0
+    call L196
+    sw $24,92,$25
+    bne $26,$27,L591
+W592: .dw 592000,-592
+B592: .db 80,-92,7
+L593: add $24,$25,$26
+    ori $27,93,$28
+    beq $29,$30,L593
+    jmp L594
+    la X1
+    call L209
+    sw $31,93,$0
+    bne $1,$2,L592
+W593: .dw 593000,-593
+B593: .db 81,-93,7
+L594: add $31,$0,$1
+    ori $2,94,$3
+    beq $4,$5,L594
+    jmp L595
+    la X2
+    call L222
+    sw $6,94,$7
+    bne $8,$9,L593
+W594: .dw 594000,-594
+B594: .db 82,-94,7
+L595: add $6,$7,$8
+    ori $9,95,$10
+    beq $11,$12,L595
+    jmp L596
+    la X3
+    call L235
+    sw $13,95,$14
+    bne $15,$16,L594
+W595: .dw 595000,-595
+B595: .db 83,-95,7
+L596: add $13,$14,$15
+    ori $16,96,$17
+    beq $18,$19,L596
+    jmp L597
+    la X4
+    call L248
+    sw $20,96,$21
+    bne $22,$23,L595
+W596: .dw 596000,-596
+B596: .db 84,-96,7
+L597: add $20,$21,$22
+    ori $23,97,$24
+    beq $25,$26,L597
+    jmp L598
+    la X5
+    call L261
+    sw $27,97,$28
+    bne $29,$30,L596
+W597: .dw 597000,-597
+B597: .db 85,-97,7
+L598: add $27,$28,$29
+    ori $30,98,$31
+    beq $0,$1,L598
+    jmp L599
+    la X6
+    call L274
+    sw $2,98,$3
+    bne $4,$5,L597
+W598: .dw 598000,-598
+B598: .db 86,-98,7
+L599: add $2,$3,$4
+    ori $5,99,$6
+    beq $7,$8,L599
+    jmp L600
+    la X7
+    call L287
+    sw $9,99,$10
+    bne $11,$12,L598
+W599: .dw 599000,-599
+B599: .db 87,-99,7
+L600: add $9,$10,$11
+    ori $12,-100,$13
+    beq $14,$15,L600
+    jmp L601
+    la X0
+    call L300
+    sw $16,0,$17
+    bne $18,$19,L599
+W600: .dw 600000,-600
+B600: .db 88,0,7
+S600: .asciz "str600"
+    .dh 600
+.entry L600
+.entry W600
+L601: add $16,$17,$18
+    ori $19,-99,$20
+    beq $21,$22,L601
+    jmp L602
+    la X1
+    call L313
+    sw $23,1,$24
+    bne $25,$26,L600
+W601: .dw 601000,-601
+B601: .db 89,-1,7
+L602: add $23,$24,$25
+    ori $26,-98,$27
+    beq $28,$29,L602
+    jmp L603
+    la X2
+    call L326
+    sw $30,2,$31
+    bne $0,$1,L601
+W602: .dw 602000,-602
+B602: .db 90,-2,7
+L603: add $30,$31,$0
+    ori $1,-97,$2
+    beq $3,$4,L603
+    jmp L604
+    la X3
+    call L339
+    sw $5,3,$6
+    bne $7,$8,L602
+W603: .dw 603000,-603
+B603: .db 91,-3,7
+L604: add $5,$6,$7
+    ori $8,-96,$9
+    beq $10,$11,L604
+    jmp L605
+    la X4
+    call L352
+    sw $12,4,$13
+    bne $14,$15,L603
+W604: .dw 604000,-604
+B604: .db 92,-4,7
+L605: add $12,$13,$14
+    ori $15,-95,$16
+    beq $17,$18,L605
+    jmp L606
+    la X5
+    call L365
+    sw $19,5,$20
+    bne $21,$22,L604
+W605: .dw 605000,-605
+B605: .db 93,-5,7
+L606: add $19,$20,$21
+    ori $22,-94,$23
+    beq $24,$25,L606
+    jmp L607
+    la X6
+    call L378
+    sw $26,6,$27
+    bne $28,$29,L605
+W606: .dw 606000,-606
+B606: .db 94,-6,7
+L607: add $26,$27,$28
+    ori $29,-93,$30
+    beq $31,$0,L607
+    jmp L608
+    la X7
+    call L391
+    sw $1,7,$2
+    bne $3,$4,L606
+W607: .dw 607000,-607
+B607: .db 95,-7,7
+L608: add $1,$2,$3
+    ori $4,-92,$5
+    beq $6,$7,L608
+    jmp L609
+    la X0
+    call L404
+    sw $8,8,$9
+    bne $10,$11,L607
+W608: .dw 608000,-608
+B608: .db 96,-8,7
+L609: add $8,$9,$10
+    ori $11,-91,$12
+    beq $13,$14,L609
+    jmp L610
+    la X1
+    call L417
+    sw $15,9,$16
+    bne $17,$18,L608
+W609: .dw 609000,-609
+B609: .db 97,-9,7
+L610: add $15,$16,$17
+    ori $18,-90,$19
+    beq $20,$21,L610
+    jmp L611
+    la X2
+    call L430
+    sw $22,10,$23
+    bne $24,$25,L609
+W610: .dw 610000,-610
+B610: .db 98,-10,7
+S610: .asciz "str610"
+    .dh 610
+L611: add $22,$23,$24
+    ori $25,-89,$26
+    beq $27,$28,L611
+    jmp L612
+    la X3
+    call L443
+    sw $29,11,$30
+    bne $31,$0,L610
+W611: .dw 611000,-611
+B611: .db 99,-11,7
+L612: add $29,$30,$31
+    ori $0,-88,$1
+    beq $2,$3,L612
+    jmp L613
+    la X4
+    call L456
+    sw $4,12,$5
+    bne $6,$7,L611
+W612: .dw 612000,-612
+B612: .db 100,-12,7
+L613: add $4,$5,$6
+    ori $7,-87,$8
+    beq $9,$10,L613
+    jmp L614
+    la X5
+    call L469
+    sw $11,13,$12
+    bne $13,$14,L612
+W613: .dw 613000,-613
+B613: .db 101,-13,7
+L614: add $11,$12,$13
+    ori $14,-86,$15
+    beq $16,$17,L614
+    jmp L615
+    la X6
+    call L482
+    sw $18,14,$19
+    bne $20,$21,L613
+W614: .dw 614000,-614
+B614: .db 102,-14,7
+L615: add $18,$19,$20
+    ori $21,-85,$22
+    beq $23,$24,L615
+    jmp L616
+    la X7
+    call L495
+    sw $25,15,$26
+    bne $27,$28,L614
+W615: .dw 615000,-615
+B615: .db 103,-15,7
+L616: add $25,$26,$27
+    ori $28,-84,$29
+    beq $30,$31,L616
+    jmp L617
+    la X0
+    call L508
+    sw $0,16,$1
+    bne $2,$3,L615
+W616: .dw 616000,-616
+B616: .db 104,-16,7
+L617: add $0,$1,$2
+    ori $3,-83,$4
+    beq $5,$6,L617
+    jmp L618
+    la X1
+    call L521
+    sw $7,17,$8
+    bne $9,$10,L616
+W617: .dw 617000,-617
+B617: .db 105,-17,7
+L618: add $7,$8,$9
+    ori $10,-82,$11
+    beq $12,$13,L618
+    jmp L619
+    la X2
+    call L534
+    sw $14,18,$15
+    bne $16,$17,L617
+W618: .dw 618000,-618
+B618: .db 106,-18,7
+L619: add $14,$15,$16
+    ori $17,-81,$18
+    beq $19,$20,L619
+    jmp L620
+    la X3
+    call L547
+    sw $21,19,$22
+    bne $23,$24,L618
+W619: .dw 619000,-619
+B619: .db 107,-19,7
+L620: add $21,$22,$23
+    ori $24,-80,$25
+    beq $26,$27,L620
+    jmp L621
+    la X4
+    call L560
+    sw $28,20,$29
+    bne $30,$31,L619
+W620: .dw 620000,-620
+B620: .db 108,-20,7
+S620: .asciz "str620"
+    .dh 620
+L621: add $28,$29,$30
+    ori $31,-79,$0
+    beq $1,$2,L621
+    jmp L622
+    la X5
+    call L573
+    sw $3,21,$4
+    bne $5,$6,L620
+W621: .dw 621000,-621
+B621: .db 109,-21,7
+L622: add $3,$4,$5
+    ori $6,-78,$7
+    beq $8,$9,L622
+    jmp L623
+    la X6
+    call L586
+    sw $10,22,$11
+    bne $12,$13,L621
+W622: .dw 622000,-622
+B622: .db 110,-22,7
+L623: add $10,$11,$12
+    ori $13,-77,$14
+    beq $15,$16,L623
+    jmp L624
+    la X7
+    call L599
+    sw $17,23,$18
+    bne $19,$20,L622
+W623: .dw 623000,-623
+B623: .db 111,-23,7
+L624: add $17,$18,$19
+    ori $20,-76,$21
+    beq $22,$23,L624
+    jmp L625
+    la X0
+    call L612
+    sw $24,24,$25
+    bne $26,$27,L623
+W624: .dw 624000,-624
+B624: .db 112,-24,7
+L625: add $24,$25,$26
+    ori $27,-75,$28
+    beq $29,$30,L625
+    jmp L626
+    la X1
+    call L625
+    sw $31,25,$0
+    bne $1,$2,L624
+W625: .dw 625000,-625
+B625: .db 113,-25,7
+L626: add $31,$0,$1
+    ori $2,-74,$3
+    beq $4,$5,L626
+    jmp L627
+    la X2
+    call L638
+    sw $6,26,$7
+    bne $8,$9,L625
+W626: .dw 626000,-626
+B626: .db 114,-26,7
+L627: add $6,$7,$8
+    ori $9,-73,$10
+    beq $11,$12,L627
+    jmp L628
+    la X3
+    call L651
+    sw $13,27,$14
+    bne $15,$16,L626
+W627: .dw 627000,-627
+B627: .db 115,-27,7
+L628: add $13,$14,$15
+    ori $16,-72,$17
+    beq $18,$19,L628
+    jmp L629
+    la X4
+    call L664
+    sw $20,28,$21
+    bne $22,$23,L627
+W628: .dw 628000,-628
+B628: .db 116,-28,7
+L629: add $20,$21,$22
+    ori $23,-71,$24
+    beq $25,$26,L629
+    jmp L630
+    la X5
+    call L677
+    sw $27,29,$28
+    bne $29,$30,L628
+W629: .dw 629000,-629
+B629: .db 117,-29,7
+L630: add $27,$28,$29
+    ori $30,-70,$31
+    beq $0,$1,L630
+    jmp L631
+    la X6
+    call L690
+    sw $2,30,$3
+    bne $4,$5,L629
+W630: .dw 630000,-630
+B630: .db 118,-30,7
+S630: .asciz "str630"
+    .dh 630
+L631: add $2,$3,$4
+    ori $5,-69,$6
+    beq $7,$8,L631
+    jmp L632
+    la X7
+    call L703
+    sw $9,31,$10
+    bne $11,$12,L630
+W631: .dw 631000,-631
+B631: .db 119,-31,7
+L632: add $9,$10,$11
+    ori $12,-68,$13
+    beq $14,$15,L632
+    jmp L633
+    la X0
+    call L716
+    sw $16,32,$17
+    bne $18,$19,L631
+W632: .dw 632000,-632
+B632: .db 120,-32,7
+L633: add $16,$17,$18
+    ori $19,-67,$20
+    beq $21,$22,L633
+    jmp L634
+    la X1
+    call L729
+    sw $23,33,$24
+    bne $25,$26,L632
+W633: .dw 633000,-633
+B633: .db 121,-33,7
+L634: add $23,$24,$25
+    ori $26,-66,$27
+    beq $28,$29,L634
+    jmp L635
+    la X2
+    call L742
+    sw $30,34,$31
+    bne $0,$1,L633
+W634: .dw 634000,-634
+B634: .db 122,-34,7
+L635: add $30,$31,$0
+    ori $1,-65,$2
+    beq $3,$4,L635
+    jmp L636
+    la X3
+    call L755
+    sw $5,35,$6
+    bne $7,$8,L634
+W635: .dw 635000,-635
+B635: .db 123,-35,7
+L636: add $5,$6,$7
+    ori $8,-64,$9
+    beq $10,$11,L636
+    jmp L637
+    la X4
+    call L768
+    sw $12,36,$13
+    bne $14,$15,L635
+W636: .dw 636000,-636
+B636: .db 124,-36,7
+L637: add $12,$13,$14
+    ori $15,-63,$16
+    beq $17,$18,L637
+    jmp L638
+    la X5
+    call L781
+    sw $19,37,$20
+    bne $21,$22,L636
+W637: .dw 637000,-637
+B637: .db 125,-37,7
+L638: add $19,$20,$21
+    ori $22,-62,$23
+    beq $24,$25,L638
+    jmp L639
+    la X6
+    call L794
+    sw $26,38,$27
+    bne $28,$29,L637
+W638: .dw 638000,-638
+B638: .db 126,-38,7
+L639: add $26,$27,$28
+    ori $29,-61,$30
+    beq $31,$0,L639
+    jmp L640
+    la X7
+    call L807
+    sw $1,39,$2
+    bne $3,$4,L638
+W639: .dw 639000,-639
+B639: .db 127,-39,7
+L640: add $1,$2,$3
+    ori $4,-60,$5
+    beq $6,$7,L640
+    jmp L641
+    la X0
+    call L820
+    sw $8,40,$9
+    bne $10,$11,L639
+W640: .dw 640000,-640
+B640: .db 0,-40,7
+S640: .asciz "str640"
+    .dh 640
+L641: add $8,$9,$10
+    ori $11,-59,$12
+    beq $13,$14,L641
+    jmp L642
+    la X1
+    call L833
+    sw $15,41,$16
+    bne $17,$18,L640
+W641: .dw 641000,-641
+B641: .db 1,-41,7
+L642: add $15,$16,$17
+    ori $18,-58,$19
+    beq $20,$21,L642
+    jmp L643
+    la X2
+    call L846
+    sw $22,42,$23
+    bne $24,$25,L641
+W642: .dw 642000,-642
+B642: .db 2,-42,7
+L643: add $22,$23,$24
+    ori $25,-57,$26
+    beq $27,$28,L643
+    jmp L644
+    la X3
+    call L859
+    sw $29,43,$30
+    bne $31,$0,L642
+W643: .dw 643000,-643
+B643: .db 3,-43,7
+L644: add $29,$30,$31
+    ori $0,-56,$1
+    beq $2,$3,L644
+    jmp L645
+    la X4
+    call L872
+    sw $4,44,$5
+    bne $6,$7,L643
+W644: .dw 644000,-644
+B644: .db 4,-44,7
+L645: add $4,$5,$6
+    ori $7,-55,$8
+    beq $9,$10,L645
+    jmp L646
+    la X5
+    call L885
+    sw $11,45,$12
+    bne $13,$14,L644
+W645: .dw 645000,-645
+B645: .db 5,-45,7
+L646: add $11,$12,$13
+    ori $14,-54,$15
+    beq $16,$17,L646
+    jmp L647
+    la X6
+    call L898
+    sw $18,46,$19
+    bne $20,$21,L645
+W646: .dw 646000,-646
+B646: .db 6,-46,7
+L647: add $18,$19,$20
+    ori $21,-53,$22
+    beq $23,$24,L647
+    jmp L648
+    la X7
+    call L911
+    sw $25,47,$26
+    bne $27,$28,L646
+W647: .dw 647000,-647
+B647: .db 7,-47,7
+L648: add $25,$26,$27
+    ori $28,-52,$29
+    beq $30,$31,L648
+    jmp L649
+    la X0
+    call L924
+    sw $0,48,$1
+    bne $2,$3,L647
+W648: .dw 648000,-648
+B648: .db 8,-48,7
+L649: add $0,$1,$2
+    ori $3,-51,$4
+    beq $5,$6,L649
+    jmp L650
+    la X1
+    call L937
+    sw $7,49,$8
+    bne $9,$10,L648
+W649: .dw 649000,-649
+B649: .db 9,-49,7
+L650: add $7,$8,$9
+    ori $10,-50,$11
+    beq $12,$13,L650
+    jmp L651
+    la X2
+    call L950
+    sw $14,50,$15
+    bne $16,$17,L649
+W650: .dw 650000,-650
+B650: .db 10,-50,7
+S650: .asciz "str650"
+    .dh 650
+.entry L650
+.entry W650
+L651: add $14,$15,$16
+    ori $17,-49,$18
+    beq $19,$20,L651
+    jmp L652
+    la X3
+    call L963
+    sw $21,51,$22
+    bne $23,$24,L650
+W651: .dw 651000,-651
+B651: .db 11,-51,7
+L652: add $21,$22,$23
+    ori $24,-48,$25
+    beq $26,$27,L652
+    jmp L653
+    la X4
+    call L976
+    sw $28,52,$29
+    bne $30,$31,L651
+W652: .dw 652000,-652
+B652: .db 12,-52,7
+L653: add $28,$29,$30
+    ori $31,-47,$0
+    beq $1,$2,L653
+    jmp L654
+    la X5
+    call L989
+    sw $3,53,$4
+    bne $5,$6,L652
+W653: .dw 653000,-653
+B653: .db 13,-53,7
+L654: add $3,$4,$5
+    ori $6,-46,$7
+    beq $8,$9,L654
+    jmp L655
+    la X6
+    call L1002
+    sw $10,54,$11
+    bne $12,$13,L653
+W654: .dw 654000,-654
+B654: .db 14,-54,7
+L655: add $10,$11,$12
+    ori $13,-45,$14
+    beq $15,$16,L655
+    jmp L656
+    la X7
+    call L1015
+    sw $17,55,$18
+    bne $19,$20,L654
+W655: .dw 655000,-655
+B655: .db 15,-55,7
+L656: add $17,$18,$19
+    ori $20,-44,$21
+    beq $22,$23,L656
+    jmp L657
+    la X0
+    call L1028
+    sw $24,56,$25
+    bne $26,$27,L655
+W656: .dw 656000,-656
+B656: .db 16,-56,7
+L657: add $24,$25,$26
+    ori $27,-43,$28
+    beq $29,$30,L657
+    jmp L658
+    la X1
+    call L1041
+    sw $31,57,$0
+    bne $1,$2,L656
+W657: .dw 657000,-657
+B657: .db 17,-57,7
+L658: add $31,$0,$1
+    ori $2,-42,$3
+    beq $4,$5,L658
+    jmp L659
+    la X2
+    call L1054
+    sw $6,58,$7
+    bne $8,$9,L657
+W658: .dw 658000,-658
+B658: .db 18,-58,7
+L659: add $6,$7,$8
+    ori $9,-41,$10
+    beq $11,$12,L659
+    jmp L660
+    la X3
+    call L1067
+    sw $13,59,$14
+    bne $15,$16,L658
+W659: .dw 659000,-659
+B659: .db 19,-59,7
+L660: add $13,$14,$15
+    ori $16,-40,$17
+    beq $18,$19,L660
+    jmp L661
+    la X4
+    call L1080
+    sw $20,60,$21
+    bne $22,$23,L659
+W660: .dw 660000,-660
+B660: .db 20,-60,7
+S660: .asciz "str660"
+    .dh 660
+L661: add $20,$21,$22
+    ori $23,-39,$24
+    beq $25,$26,L661
+    jmp L662
+    la X5
+    call L1093
+    sw $27,61,$28
+    bne $29,$30,L660
+W661: .dw 661000,-661
+B661: .db 21,-61,7
+L662: add $27,$28,$29
+    ori $30,-38,$31
+    beq $0,$1,L662
+    jmp L663
+    la X6
+    call L1106
+    sw $2,62,$3
+    bne $4,$5,L661
+W662: .dw 662000,-662
+B662: .db 22,-62,7
+L663: add $2,$3,$4
+    ori $5,-37,$6
+    beq $7,$8,L663
+    jmp L664
+    la X7
+    call L1119
+    sw $9,63,$10
+    bne $11,$12,L662
+W663: .dw 663000,-663
+B663: .db 23,-63,7
+L664: add $9,$10,$11
+    ori $12,-36,$13
+    beq $14,$15,L664
+    jmp L665
+    la X0
+    call L1132
+    sw $16,64,$17
+    bne $18,$19,L663
+W664: .dw 664000,-664
+B664: .db 24,-64,7
+L665: add $16,$17,$18
+    ori $19,-35,$20
+    beq $21,$22,L665
+    jmp L666
+    la X1
+    call L1145
+    sw $23,65,$24
+    bne $25,$26,L664
+W665: .dw 665000,-665
+B665: .db 25,-65,7
+L666: add $23,$24,$25
+    ori $26,-34,$27
+    beq $28,$29,L666
+    jmp L667
+    la X2
+    call L1158
+    sw $30,66,$31
+    bne $0,$1,L665
+W666: .dw 666000,-666
+B666: .db 26,-66,7
+L667: add $30,$31,$0
+    ori $1,-33,$2
+    beq $3,$4,L667
+    jmp L668
+    la X3
+    call L1171
+    sw $5,67,$6
+    bne $7,$8,L666
+W667: .dw 667000,-667
+B667: .db 27,-67,7
+L668: add $5,$6,$7
+    ori $8,-32,$9
+    beq $10,$11,L668
+    jmp L669
+    la X4
+    call L1184
+    sw $12,68,$13
+    bne $14,$15,L667
+W668: .dw 668000,-668
+B668: .db 28,-68,7
+L669: add $12,$13,$14
+    ori $15,-31,$16
+    beq $17,$18,L669
+    jmp L670
+    la X5
+    call L1197
+    sw $19,69,$20
+    bne $21,$22,L668
+W669: .dw 669000,-669
+B669: .db 29,-69,7
+L670: add $19,$20,$21
+    ori $22,-30,$23
+    beq $24,$25,L670
+    jmp L671
+    la X6
+    call L1210
+    sw $26,70,$27
+    bne $28,$29,L669
+W670: .dw 670000,-670
+B670: .db 30,-70,7
+S670: .asciz "str670"
+    .dh 670
+L671: add $26,$27,$28
+    ori $29,-29,$30
+    beq $31,$0,L671
+    jmp L672
+    la X7
+    call L1223
+    sw $1,71,$2
+    bne $3,$4,L670
+W671: .dw 671000,-671
+B671: .db 31,-71,7
+L672: add $1,$2,$3
+    ori $4,-28,$5
+    beq $6,$7,L672
+    jmp L673
+    la X0
+    call L1236
+    sw $8,72,$9
+    bne $10,$11,L671
+W672: .dw 672000,-672
+B672: .db 32,-72,7
+L673: add $8,$9,$10
+    ori $11,-27,$12
+    beq $13,$14,L673
+    jmp L674
+    la X1
+    call L1249
+    sw $15,73,$16
+    bne $17,$18,L672
+W673: .dw 673000,-673
+B673: .db 33,-73,7
+L674: add $15,$16,$17
+    ori $18,-26,$19
+    beq $20,$21,L674
+    jmp L675
+    la X2
+    call L1262
+    sw $22,74,$23
+    bne $24,$25,L673
+W674: .dw 674000,-674
+B674: .db 34,-74,7
+L675: add $22,$23,$24
+    ori $25,-25,$26
+    beq $27,$28,L675
+    jmp L676
+    la X3
+    call L1275
+    sw $29,75,$30
+    bne $31,$0,L674
+W675: .dw 675000,-675
+B675: .db 35,-75,7
+L676: add $29,$30,$31
+    ori $0,-24,$1
+    beq $2,$3,L676
+    jmp L677
+    la X4
+    call L1288
+    sw $4,76,$5
+    bne $6,$7,L675
+W676: .dw 676000,-676
+B676: .db 36,-76,7
+L677: add $4,$5,$6
+    ori $7,-23,$8
+    beq $9,$10,L677
+    jmp L678
+    la X5
+    call L1301
+    sw $11,77,$12
+    bne $13,$14,L676
+W677: .dw 677000,-677
+B677: .db 37,-77,7
+L678: add $11,$12,$13
+    ori $14,-22,$15
+    beq $16,$17,L678
+    jmp L679
+    la X6
+    call L1314
+    sw $18,78,$19
+    bne $20,$21,L677
+W678: .dw 678000,-678
+B678: .db 38,-78,7
+L679: add $18,$19,$20
+    ori $21,-21,$22
+    beq $23,$24,L679
+    jmp L680
+    la X7
+    call L1327
+    sw $25,79,$26
+    bne $27,$28,L678
+W679: .dw 679000,-679
+B679: .db 39,-79,7
+L680: add $25,$26,$27
+    ori $28,-20,$29
+    beq $30,$31,L680
+    jmp L681
+    la X0
+    call L1340
+    sw $0,80,$1
+    bne $2,$3,L679
+W680: .dw 680000,-680
+B680: .db 40,-80,7
+S680: .asciz "str680"
+    .dh 680
+L681: add $0,$1,$2
+    ori $3,-19,$4
+    beq $5,$6,L681
+    jmp L682
+    la X1
+    call L1353
+    sw $7,81,$8
+    bne $9,$10,L680
+W681: .dw 681000,-681
+B681: .db 41,-81,7
+L682: add $7,$8,$9
+    ori $10,-18,$11
+    beq $12,$13,L682
+    jmp L683
+    la X2
+    call L1366
+    sw $14,82,$15
+    bne $16,$17,L681
+W682: .dw 682000,-682
+B682: .db 42,-82,7
+L683: add $14,$15,$16
+    ori $17,-17,$18
+    beq $19,$20,L683
+    jmp L684
+    la X3
+    call L1379
+    sw $21,83,$22
+    bne $23,$24,L682
+W683: .dw 683000,-683
+B683: .db 43,-83,7
+L684: add $21,$22,$23
+    ori $24,-16,$25
+    beq $26,$27,L684
+    jmp L685
+    la X4
+    call L1392
+    sw $28,84,$29
+    bne $30,$31,L683
+W684: .dw 684000,-684
+B684: .db 44,-84,7
+L685: add $28,$29,$30
+    ori $31,-15,$0
+    beq $1,$2,L685
+    jmp L686
+    la X5
+    call L1405
+    sw $3,85,$4
+    bne $5,$6,L684
+W685: .dw 685000,-685
+B685: .db 45,-85,7
+L686: add $3,$4,$5
+    ori $6,-14,$7
+    beq $8,$9,L686
+    jmp L687
+    la X6
+    call L1418
+    sw $10,86,$11
+    bne $12,$13,L685
+W686: .dw 686000,-686
+B686: .db 46,-86,7
+L687: add $10,$11,$12
+    ori $13,-13,$14
+    beq $15,$16,L687
+    jmp L688
+    la X7
+    call L1431
+    sw $17,87,$18
+    bne $19,$20,L686
+W687: .dw 687000,-687
+B687: .db 47,-87,7
+L688: add $17,$18,$19
+    ori $20,-12,$21
+    beq $22,$23,L688
+    jmp L689
+    la X0
+    call L1444
+    sw $24,88,$25
+    bne $26,$27,L687
+W688: .dw 688000,-688
+B688: .db 48,-88,7
+L689: add $24,$25,$26
+    ori $27,-11,$28
+    beq $29,$30,L689
+    jmp L690
+    la X1
+    call L1457
+    sw $31,89,$0
+    bne $1,$2,L688
+W689: .dw 689000,-689
+B689: .db 49,-89,7
+L690: add $31,$0,$1
+    ori $2,-10,$3
+    beq $4,$5,L690
+    jmp L691
+    la X2
+    call L1470
+    sw $6,90,$7
+    bne $8,$9,L689
+W690: .dw 690000,-690
+B690: .db 50,-90,7
+S690: .asciz "str690"
+    .dh 690
+L691: add $6,$7,$8
+    ori $9,-9,$10
+    beq $11,$12,L691
+    jmp L692
+    la X3
+    call L1483
+    sw $13,91,$14
+    bne $15,$16,L690
+W691: .dw 691000,-691
+B691: .db 51,-91,7
+L692: add $13,$14,$15
+    ori $16,-8,$17
+    beq $18,$19,L692
+    jmp L693
+    la X4
+    call L1496
+    sw $20,92,$21
+    bne $22,$23,L691
+W692: .dw 692000,-692
+B692: .db 52,-92,7
+L693: add $20,$21,$22
+    ori $23,-7,$24
+    beq $25,$26,L693
+    jmp L694
+    la X5
+    call L1509
+    sw $27,93,$28
+    bne $29,$30,L692
+W693: .dw 693000,-693
+B693: .db 53,-93,7
+L694: add $27,$28,$29
+    ori $30,-6,$31
+    beq $0,$1,L694
+    jmp L695
+    la X6
+    call L1522
+    sw $2,94,$3
+    bne $4,$5,L693
+W694: .dw 694000,-694
+B694: .db 54,-94,7
+L695: add $2,$3,$4
+    ori $5,-5,$6
+    beq $7,$8,L695
+    jmp L696
+    la X7
+    call L1535
+    sw $9,95,$10
+    bne $11,$12,L694
+W695: .dw 695000,-695
+B695: .db 55,-95,7
+L696: add $9,$10,$11
+    ori $12,-4,$13
+    beq $14,$15,L696
+    jmp L697
+    la X0
+    call L1548
+    sw $16,96,$17
+    bne $18,$19,L695
+W696: .dw 696000,-696
+B696: .db 56,-96,7
+L697: add $16,$17,$18
+    ori $19,-3,$20
+    beq $21,$22,L697
+    jmp L698
+    la X1
+    call L1561
+    sw $23,97,$24
+    bne $25,$26,L696
+W697: .dw 697000,-697
+B697: .db 57,-97,7
+L698: add $23,$24,$25
+    ori $26,-2,$27
+    beq $28,$29,L698
+    jmp L699
+    la X2
+    call L1574
+    sw $30,98,$31
+    bne $0,$1,L697
+W698: .dw 698000,-698
+B698: .db 58,-98,7
+L699: add $30,$31,$0
+    ori $1,-1,$2
+    beq $3,$4,L699
+    jmp L700
+    la X3
+    call L1587
+    sw $5,99,$6
+    bne $7,$8,L698
+W699: .dw 699000,-699
+B699: .db 59,-99,7
+L700: add $5,$6,$7
+    ori $8,0,$9
+    beq $10,$11,L700
+    jmp L701
+    la X4
+    call L1600
+    sw $12,0,$13
+    bne $14,$15,L699
+W700: .dw 700000,-700
+B700: .db 60,0,7
+S700: .asciz "str700"
+    .dh 700
+.entry L700
+.entry W700
+L701: add $12,$13,$14
+    ori $15,1,$16
+    beq $17,$18,L701
+    jmp L702
+    la X5
+    call L1613
+    sw $19,1,$20
+    bne $21,$22,L700
+W701: .dw 701000,-701
+B701: .db 61,-1,7
+L702: add $19,$20,$21
+    ori $22,2,$23
+    beq $24,$25,L702
+    jmp L703
+    la X6
+    call L1626
+    sw $26,2,$27
+    bne $28,$29,L701
+W702: .dw 702000,-702
+B702: .db 62,-2,7
+L703: add $26,$27,$28
+    ori $29,3,$30
+    beq $31,$0,L703
+    jmp L704
+    la X7
+    call L1639
+    sw $1,3,$2
+    bne $3,$4,L702
+W703: .dw 703000,-703
+B703: .db 63,-3,7
+L704: add $1,$2,$3
+    ori $4,4,$5
+    beq $6,$7,L704
+    jmp L705
+    la X0
+    call L1652
+    sw $8,4,$9
+    bne $10,$11,L703
+W704: .dw 704000,-704
+B704: .db 64,-4,7
+L705: add $8,$9,$10
+    ori $11,5,$12
+    beq $13,$14,L705
+    jmp L706
+    la X1
+    call L1665
+    sw $15,5,$16
+    bne $17,$18,L704
+W705: .dw 705000,-705
+B705: .db 65,-5,7
+L706: add $15,$16,$17
+    ori $18,6,$19
+    beq $20,$21,L706
+    jmp L707
+    la X2
+    call L1678
+    sw $22,6,$23
+    bne $24,$25,L705
+W706: .dw 706000,-706
+B706: .db 66,-6,7
+L707: add $22,$23,$24
+    ori $25,7,$26
+    beq $27,$28,L707
+    jmp L708
+    la X3
+    call L1691
+    sw $29,7,$30
+    bne $31,$0,L706
+W707: .dw 707000,-707
+B707: .db 67,-7,7
+L708: add $29,$30,$31
+    ori $0,8,$1
+    beq $2,$3,L708
+    jmp L709
+    la X4
+    call L1704
+    sw $4,8,$5
+    bne $6,$7,L707
+W708: .dw 708000,-708
+B708: .db 68,-8,7
+L709: add $4,$5,$6
+    ori $7,9,$8
+    beq $9,$10,L709
+    jmp L710
+    la X5
+    call L1717
+    sw $11,9,$12
+    bne $13,$14,L708
+W709: .dw 709000,-709
+B709: .db 69,-9,7
+L710: add $11,$12,$13
+    ori $14,10,$15
+    beq $16,$17,L710
+    jmp L711
+    la X6
+    call L1730
+    sw $18,10,$19
+    bne $20,$21,L709
+W710: .dw 710000,-710
+B710: .db 70,-10,7
+S710: .asciz "str710"
+    .dh 710
+L711: add $18,$19,$20
+    ori $21,11,$22
+    beq $23,$24,L711
+    jmp L712
+    la X7
+    call L1743
+    sw $25,11,$26
+    bne $27,$28,L710
+W711: .dw 711000,-711
+B711: .db 71,-11,7
+L712: add $25,$26,$27
+    ori $28,12,$29
+    beq $30,$31,L712
+    jmp L713
+    la X0
+    call L1756
+    sw $0,12,$1
+    bne $2,$3,L711
+W712: .dw 712000,-712
+B712: .db 72,-12,7
+L713: add $0,$1,$2
+    ori $3,13,$4
+    beq $5,$6,L713
+    jmp L714
+    la X1
+    call L1769
+    sw $7,13,$8
+    bne $9,$10,L712
+W713: .dw 713000,-713
+B713: .db 73,-13,7
+L714: add $7,$8,$9
+    ori $10,14,$11
+    beq $12,$13,L714
+    jmp L715
+    la X2
+    call L1782
+    sw $14,14,$15
+    bne $16,$17,L713
+W714: .dw 714000,-714
+B714: .db 74,-14,7
+L715: add $14,$15,$16
+    ori $17,15,$18
+    beq $19,$20,L715
+    jmp L716
+    la X3
+    call L1795
+    sw $21,15,$22
+    bne $23,$24,L714
+W715: .dw 715000,-715
+B715: .db 75,-15,7
+L716: add $21,$22,$23
+    ori $24,16,$25
+    beq $26,$27,L716
+    jmp L717
+    la X4
+    call L1808
+    sw $28,16,$29
+    bne $30,$31,L715
+W716: .dw 716000,-716
+B716: .db 76,-16,7
+L717: add $28,$29,$30
+    ori $31,17,$0
+    beq $1,$2,L717
+    jmp L718
+    la X5
+    call L1821
+    sw $3,17,$4
+    bne $5,$6,L716
+W717: .dw 717000,-717
+B717: .db 77,-17,7
+L718: add $3,$4,$5
+    ori $6,18,$7
+    beq $8,$9,L718
+    jmp L719
+    la X6
+    call L1834
+    sw $10,18,$11
+    bne $12,$13,L717
+W718: .dw 718000,-718
+B718: .db 78,-18,7
+L719: add $10,$11,$12
+    ori $13,19,$14
+    beq $15,$16,L719
+    jmp L720
+    la X7
+    call L1847
+    sw $17,19,$18
+    bne $19,$20,L718
+W719: .dw 719000,-719
+B719: .db 79,-19,7
+L720: add $17,$18,$19
+    ori $20,20,$21
+    beq $22,$23,L720
+    jmp L721
+    la X0
+    call L1860
+    sw $24,20,$25
+    bne $26,$27,L719
+W720: .dw 720000,-720
+B720: .db 80,-20,7
+S720: .asciz "str720"
+    .dh 720
+L721: add $24,$25,$26
+    ori $27,21,$28
+    beq $29,$30,L721
+    jmp L722
+    la X1
+    call L1873
+    sw $31,21,$0
+    bne $1,$2,L720
+W721: .dw 721000,-721
+B721: .db 81,-21,7
+L722: add $31,$0,$1
+    ori $2,22,$3
+    beq $4,$5,L722
+    jmp L723
+    la X2
+    call L1886
+    sw $6,22,$7
+    bne $8,$9,L721
+W722: .dw 722000,-722
+B722: .db 82,-22,7
+L723: add $6,$7,$8
+    ori $9,23,$10
+    beq $11,$12,L723
+    jmp L724
+    la X3
+    call L1899
+    sw $13,23,$14
+    bne $15,$16,L722
+W723: .dw 723000,-723
+B723: .db 83,-23,7
+L724: add $13,$14,$15
+    ori $16,24,$17
+    beq $18,$19,L724
+    jmp L725
+    la X4
+    call L1912
+    sw $20,24,$21
+    bne $22,$23,L723
+W724: .dw 724000,-724
+B724: .db 84,-24,7
+L725: add $20,$21,$22
+    ori $23,25,$24
+    beq $25,$26,L725
+    jmp L726
+    la X5
+    call L1925
+    sw $27,25,$28
+    bne $29,$30,L724
+W725: .dw 725000,-725
+B725: .db 85,-25,7
+L726: add $27,$28,$29
+    ori $30,26,$31
+    beq $0,$1,L726
+    jmp L727
+    la X6
+    call L1938
+    sw $2,26,$3
+    bne $4,$5,L725
+W726: .dw 726000,-726
+B726: .db 86,-26,7
+L727: add $2,$3,$4
+    ori $5,27,$6
+    beq $7,$8,L727
+    jmp L728
+    la X7
+    call L1951
+    sw $9,27,$10
+    bne $11,$12,L726
+W727: .dw 727000,-727
+B727: .db 87,-27,7
+L728: add $9,$10,$11
+    ori $12,28,$13
+    beq $14,$15,L728
+    jmp L729
+    la X0
+    call L1964
+    sw $16,28,$17
+    bne $18,$19,L727
+W728: .dw 728000,-728
+B728: .db 88,-28,7
+L729: add $16,$17,$18
+    ori $19,29,$20
+    beq $21,$22,L729
+    jmp L730
+    la X1
+    call L1977
+    sw $23,29,$24
+    bne $25,$26,L728
+W729: .dw 729000,-729
+B729: .db 89,-29,7
+L730: add $23,$24,$25
+    ori $26,30,$27
+    beq $28,$29,L730
+    jmp L731
+    la X2
+    call L1990
+    sw $30,30,$31
+    bne $0,$1,L729
+W730: .dw 730000,-730
+B730: .db 90,-30,7
+S730: .asciz "str730"
+    .dh 730
+L731: add $30,$31,$0
+    ori $1,31,$2
+    beq $3,$4,L731
+    jmp L732
+    la X3
+    call L2003
+    sw $5,31,$6
+    bne $7,$8,L730
+W731: .dw 731000,-731
+B731: .db 91,-31,7
+L732: add $5,$6,$7
+    ori $8,32,$9
+    beq $10,$11,L732
+    jmp L733
+    la X4
+    call L2016
+    sw $12,32,$13
+    bne $14,$15,L731
+W732: .dw 732000,-732
+B732: .db 92,-32,7
+L733: add $12,$13,$14
+    ori $15,33,$16
+    beq $17,$18,L733
+    jmp L734
+    la X5
+    call L2029
+    sw $19,33,$20
+    bne $21,$22,L732
+W733: .dw 733000,-733
+B733: .db 93,-33,7
+L734: add $19,$20,$21
+    ori $22,34,$23
+    beq $24,$25,L734
+    jmp L735
+    la X6
+    call L2042
+    sw $26,34,$27
+    bne $28,$29,L733
+W734: .dw 734000,-734
+B734: .db 94,-34,7
+L735: add $26,$27,$28
+    ori $29,35,$30
+    beq $31,$0,L735
+    jmp L736
+    la X7
+    call L2055
+    sw $1,35,$2
+    bne $3,$4,L734
+W735: .dw 735000,-735
+B735: .db 95,-35,7
+L736: add $1,$2,$3
+    ori $4,36,$5
+    beq $6,$7,L736
+    jmp L737
+    la X0
+    call L2068
+    sw $8,36,$9
+    bne $10,$11,L735
+W736: .dw 736000,-736
+B736: .db 96,-36,7
+L737: add $8,$9,$10
+    ori $11,37,$12
+    beq $13,$14,L737
+    jmp L738
+    la X1
+    call L2081
+    sw $15,37,$16
+    bne $17,$18,L736
+W737: .dw 737000,-737
+B737: .db 97,-37,7
+L738: add $15,$16,$17
+    ori $18,38,$19
+    beq $20,$21,L738
+    jmp L739
+    la X2
+    call L2094
+    sw $22,38,$23
+    bne $24,$25,L737
+W738: .dw 738000,-738
+B738: .db 98,-38,7
+L739: add $22,$23,$24
+    ori $25,39,$26
+    beq $27,$28,L739
+    jmp L740
+    la X3
+    call L2107
+    sw $29,39,$30
+    bne $31,$0,L738
+W739: .dw 739000,-739
+B739: .db 99,-39,7
+L740: add $29,$30,$31
+    ori $0,40,$1
+    beq $2,$3,L740
+    jmp L741
+    la X4
+    call L2120
+    sw $4,40,$5
+    bne $6,$7,L739
+W740: .dw 740000,-740
+B740: .db 100,-40,7
+S740: .asciz "str740"
+    .dh 740
+L741: add $4,$5,$6
+    ori $7,41,$8
+    beq $9,$10,L741
+    jmp L742
+    la X5
+    call L2133
+    sw $11,41,$12
+    bne $13,$14,L740
+W741: .dw 741000,-741
+B741: .db 101,-41,7
+L742: add $11,$12,$13
+    ori $14,42,$15
+    beq $16,$17,L742
+    jmp L743
+    la X6
+    call L2146
+    sw $18,42,$19
+    bne $20,$21,L741
+W742: .dw 742000,-742
+B742: .db 102,-42,7
+L743: add $18,$19,$20
+    ori $21,43,$22
+    beq $23,$24,L743
+    jmp L744
+    la X7
+    call L2159
+    sw $25,43,$26
+    bne $27,$28,L742
+W743: .dw 743000,-743
+B743: .db 103,-43,7
+L744: add $25,$26,$27
+    ori $28,44,$29
+    beq $30,$31,L744
+    jmp L745
+    la X0
+    call L2172
+    sw $0,44,$1
+    bne $2,$3,L743
+W744: .dw 744000,-744
+B744: .db 104,-44,7
+L745: add $0,$1,$2
+    ori $3,45,$4
+    beq $5,$6,L745
+    jmp L746
+    la X1
+    call L2185
+    sw $7,45,$8
+    bne $9,$10,L744
+W745: .dw 745000,-745
+B745: .db 105,-45,7
+L746: add $7,$8,$9
+    ori $10,46,$11
+    beq $12,$13,L746
+    jmp L747
+    la X2
+    call L2198
+    sw $14,46,$15
+    bne $16,$17,L745
+W746: .dw 746000,-746
+B746: .db 106,-46,7
+L747: add $14,$15,$16
+    ori $17,47,$18
+    beq $19,$20,L747
+    jmp L748
+    la X3
+    call L2211
+    sw $21,47,$22
+    bne $23,$24,L746
+W747: .dw 747000,-747
+B747: .db 107,-47,7
+L748: add $21,$22,$23
+    ori $24,48,$25
+    beq $26,$27,L748
+    jmp L749
+    la X4
+    call L2224
+    sw $28,48,$29
+    bne $30,$31,L747
+W748: .dw 748000,-748
+B748: .db 108,-48,7
+L749: add $28,$29,$30
+    ori $31,49,$0
+    beq $1,$2,L749
+    jmp L750
+    la X5
+    call L2237
+    sw $3,49,$4
+    bne $5,$6,L748
+W749: .dw 749000,-749
+B749: .db 109,-49,7
+L750: add $3,$4,$5
+    ori $6,50,$7
+    beq $8,$9,L750
+    jmp L751
+    la X6
+    call L2250
+    sw $10,50,$11
+    bne $12,$13,L749
+W750: .dw 750000,-750
+B750: .db 110,-50,7
+S750: .asciz "str750"
+    .dh 750
+.entry L750
+.entry W750
+L751: add $10,$11,$12
+    ori $13,51,$14
+    beq $15,$16,L751
+    jmp L752
+    la X7
+    call L2263
+    sw $17,51,$18
+    bne $19,$20,L750
+W751: .dw 751000,-751
+B751: .db 111,-51,7
+L752: add $17,$18,$19
+    ori $20,52,$21
+    beq $22,$23,L752
+    jmp L753
+    la X0
+    call L2276
+    sw $24,52,$25
+    bne $26,$27,L751
+W752: .dw 752000,-752
+B752: .db 112,-52,7
+L753: add $24,$25,$26
+    ori $27,53,$28
+    beq $29,$30,L753
+    jmp L754
+    la X1
+    call L2289
+    sw $31,53,$0
+    bne $1,$2,L752
+W753: .dw 753000,-753
+B753: .db 113,-53,7
+L754: add $31,$0,$1
+    ori $2,54,$3
+    beq $4,$5,L754
+    jmp L755
+    la X2
+    call L2302
+    sw $6,54,$7
+    bne $8,$9,L753
+W754: .dw 754000,-754
+B754: .db 114,-54,7
+L755: add $6,$7,$8
+    ori $9,55,$10
+    beq $11,$12,L755
+    jmp L756
+    la X3
+    call L2315
+    sw $13,55,$14
+    bne $15,$16,L754
+W755: .dw 755000,-755
+B755: .db 115,-55,7
+L756: add $13,$14,$15
+    ori $16,56,$17
+    beq $18,$19,L756
+    jmp L757
+    la X4
+    call L2328
+    sw $20,56,$21
+    bne $22,$23,L755
+W756: .dw 756000,-756
+B756: .db 116,-56,7
+L757: add $20,$21,$22
+    ori $23,57,$24
+    beq $25,$26,L757
+    jmp L758
+    la X5
+    call L2341
+    sw $27,57,$28
+    bne $29,$30,L756
+W757: .dw 757000,-757
+B757: .db 117,-57,7
+L758: add $27,$28,$29
+    ori $30,58,$31
+    beq $0,$1,L758
+    jmp L759
+    la X6
+    call L2354
+    sw $2,58,$3
+    bne $4,$5,L757
+W758: .dw 758000,-758
+B758: .db 118,-58,7
+L759: add $2,$3,$4
+    ori $5,59,$6
+    beq $7,$8,L759
+    jmp L760
+    la X7
+    call L2367
+    sw $9,59,$10
+    bne $11,$12,L758
+W759: .dw 759000,-759
+B759: .db 119,-59,7
+L760: add $9,$10,$11
+    ori $12,60,$13
+    beq $14,$15,L760
+    jmp L761
+    la X0
+    call L2380
+    sw $16,60,$17
+    bne $18,$19,L759
+W760: .dw 760000,-760
+B760: .db 120,-60,7
+S760: .asciz "str760"
+    .dh 760
+L761: add $16,$17,$18
+    ori $19,61,$20
+    beq $21,$22,L761
+    jmp L762
+    la X1
+    call L2393
+    sw $23,61,$24
+    bne $25,$26,L760
+W761: .dw 761000,-761
+B761: .db 121,-61,7
+L762: add $23,$24,$25
+    ori $26,62,$27
+    beq $28,$29,L762
+    jmp L763
+    la X2
+    call L2406
+    sw $30,62,$31
+    bne $0,$1,L761
+W762: .dw 762000,-762
+B762: .db 122,-62,7
+L763: add $30,$31,$0
+    ori $1,63,$2
+    beq $3,$4,L763
+    jmp L764
+    la X3
+    call L2419
+    sw $5,63,$6
+    bne $7,$8,L762
+W763: .dw 763000,-763
+B763: .db 123,-63,7
+L764: add $5,$6,$7
+    ori $8,64,$9
+    beq $10,$11,L764
+    jmp L765
+    la X4
+    call L2432
+    sw $12,64,$13
+    bne $14,$15,L763
+W764: .dw 764000,-764
+B764: .db 124,-64,7
+L765: add $12,$13,$14
+    ori $15,65,$16
+    beq $17,$18,L765
+    jmp L766
+    la X5
+    call L2445
+    sw $19,65,$20
+    bne $21,$22,L764
+W765: .dw 765000,-765
+B765: .db 125,-65,7
+L766: add $19,$20,$21
+    ori $22,66,$23
+    beq $24,$25,L766
+    jmp L767
+    la X6
+    call L2458
+    sw $26,66,$27
+    bne $28,$29,L765
+W766: .dw 766000,-766
+B766: .db 126,-66,7
+L767: add $26,$27,$28
+    ori $29,67,$30
+    beq $31,$0,L767
+    jmp L768
+    la X7
+    call L2471
+    sw $1,67,$2
+    bne $3,$4,L766
+W767: .dw 767000,-767
+B767: .db 127,-67,7
+L768: add $1,$2,$3
+    ori $4,68,$5
+    beq $6,$7,L768
+    jmp L769
+    la X0
+    call L2484
+    sw $8,68,$9
+    bne $10,$11,L767
+W768: .dw 768000,-768
+B768: .db 0,-68,7
+L769: add $8,$9,$10
+    ori $11,69,$12
+    beq $13,$14,L769
+    jmp L770
+    la X1
+    call L2497
+    sw $15,69,$16
+    bne $17,$18,L768
+W769: .dw 769000,-769
+B769: .db 1,-69,7
+L770: add $15,$16,$17
+    ori $18,70,$19
+    beq $20,$21,L770
+    jmp L771
+    la X2
+    call L10
+    sw $22,70,$23
+    bne $24,$25,L769
+W770: .dw 770000,-770
+B770: .db 2,-70,7
+S770: .asciz "str770"
+    .dh 770
+L771: add $22,$23,$24
+    ori $25,71,$26
+    beq $27,$28,L771
+    jmp L772
+    la X3
+    call L23
+    sw $29,71,$30
+    bne $31,$0,L770
+W771: .dw 771000,-771
+B771: .db 3,-71,7
+L772: add $29,$30,$31
+    ori $0,72,$1
+    beq $2,$3,L772
+    jmp L773
+    la X4
+    call L36
+    sw $4,72,$5
+    bne $6,$7,L771
+W772: .dw 772000,-772
+B772: .db 4,-72,7
+L773: add $4,$5,$6
+    ori $7,73,$8
+    beq $9,$10,L773
+    jmp L774
+    la X5
+    call L49
+    sw $11,73,$12
+    bne $13,$14,L772
+W773: .dw 773000,-773
+B773: .db 5,-73,7
+L774: add $11,$12,$13
+    ori $14,74,$15
+    beq $16,$17,L774
+    jmp L775
+    la X6
+    call L62
+    sw $18,74,$19
+    bne $20,$21,L773
+W774: .dw 774000,-774
+B774: .db 6,-74,7
+L775: add $18,$19,$20
+    ori $21,75,$22
+    beq $23,$24,L775
+    jmp L776
+    la X7
+    call L75
+    sw $25,75,$26
+    bne $27,$28,L774
+W775: .dw 775000,-775
+B775: .db 7,-75,7
+L776: add $25,$26,$27
+    ori $28,76,$29
+    beq $30,$31,L776
+    jmp L777
+    la X0
+    call L88
+    sw $0,76,$1
+    bne $2,$3,L775
+W776: .dw 776000,-776
+B776: .db 8,-76,7
+L777: add $0,$1,$2
+    ori $3,77,$4
+    beq $5,$6,L777
+    jmp L778
+    la X1
+    call L101
+    sw $7,77,$8
+    bne $9,$10,L776
+W777: .dw 777000,-777
+B777: .db 9,-77,7
+L778: add $7,$8,$9
+    ori $10,78,$11
+    beq $12,$13,L778
+    jmp L779
+    la X2
+    call L114
+    sw $14,78,$15
+    bne $16,$17,L777
+W778: .dw 778000,-778
+B778: .db 10,-78,7
+L779: add $14,$15,$16
+    ori $17,79,$18
+    beq $19,$20,L779
+    jmp L780
+    la X3
+    call L127
+    sw $21,79,$22
+    bne $23,$24,L778
+W779: .dw 779000,-779
+B779: .db 11,-79,7
+L780: add $21,$22,$23
+    ori $24,80,$25
+    beq $26,$27,L780
+    jmp L781
+    la X4
+    call L140
+    sw $28,80,$29
+    bne $30,$31,L779
+W780: .dw 780000,-780
+B780: .db 12,-80,7
+S780: .asciz "str780"
+    .dh 780
+L781: add $28,$29,$30
+    ori $31,81,$0
+    beq $1,$2,L781
+    jmp L782
+    la X5
+    call L153
+    sw $3,81,$4
+    bne $5,$6,L780
+W781: .dw 781000,-781
+B781: .db 13,-81,7
+L782: add $3,$4,$5
+    ori $6,82,$7
+    beq $8,$9,L782
+    jmp L783
+    la X6
+    call L166
+    sw $10,82,$11
+    bne $12,$13,L781
+W782: .dw 782000,-782
+B782: .db 14,-82,7
+L783: add $10,$11,$12
+    ori $13,83,$14
+    beq $15,$16,L783
+    jmp L784
+    la X7
+    call L179
+    sw $17,83,$18
+    bne $19,$20,L782
+W783: .dw 783000,-783
+B783: .db 15,-83,7
+L784: add $17,$18,$19
+    ori $20,84,$21
+    beq $22,$23,L784
+    jmp L785
+    la X0
+    call L192
+    sw $24,84,$25
+    bne $26,$27,L783
+W784: .dw 784000,-784
+B784: .db 16,-84,7
+L785: add $24,$25,$26
+    ori $27,85,$28
+    beq $29,$30,L785
+    jmp L786
+    la X1
+    call L205
+    sw $31,85,$0
+    bne $1,$2,L784
+W785: .dw 785000,-785
+B785: .db 17,-85,7
+L786: add $31,$0,$1
+    ori $2,86,$3
+    beq $4,$5,L786
+    jmp L787
+    la X2
+    call L218
+    sw $6,86,$7
+    bne $8,$9,L785
+W786: .dw 786000,-786
+B786: .db 18,-86,7
+L787: add $6,$7,$8
+    ori $9,87,$10
+    beq $11,$12,L787
+    jmp L788
+    la X3
+    call L231
+    sw $13,87,$14
+    bne $15,$16,L786
+W787: .dw 787000,-787
+B787: .db 19,-87,7
+L788: add $13,$14,$15
+    ori $16,88,$17
+    beq $18,$19,L788
+    jmp L789
+    la X4
+    call L244
+    sw $20,88,$21
+    bne $22,$23,L787
+W788: .dw 788000,-788
+B788: .db 20,-88,7
+L789: add $20,$21,$22
+    ori $23,89,$24
+    beq $25,$26,L789
+    jmp L790
+    la X5
+    call L257
+    sw $27,89,$28
+    bne $29,$30,L788
+W789: .dw 789000,-789
+B789: .db 21,-89,7
+L790: add $27,$28,$29
+    ori $30,90,$31
+    beq $0,$1,L790
+    jmp L791
+    la X6
+    call L270
+    sw $2,90,$3
+    bne $4,$5,L789
+W790: .dw 790000,-790
+B790: .db 22,-90,7
+S790: .asciz "str790"
+    .dh 790
+L791: add $2,$3,$4
+    ori $5,91,$6
+    beq $7,$8,L791
+    jmp L792
+    la X7
+    call L283
+    sw $9,91,$10
+    bne $11,$12,L790
+W791: .dw 791000,-791
+B791: .db 23,-91,7
+L792: add $9,$10,$11
+    ori $12,92,$13
+    beq $14,$15,L792
+    jmp L793
+    la X0
+    call L296
+    sw $16,92,$17
+    bne $18,$19,L791
+W792: .dw 792000,-792
+B792: .db 24,-92,7
+L793: add $16,$17,$18
+    ori $19,93,$20
+    beq $21,$22,L793
+    jmp L794
+    la X1
+    call L309
+    sw $23,93,$24
+    bne $25,$26,L792
+W793: .dw 793000,-793
+B793: .db 25,-93,7
+L794: add $23,$24,$25
+    ori $26,94,$27
+    beq $28,$29,L794
+    jmp L795
+    la X2
+    call L322
+    sw $30,94,$31
+    bne $0,$1,L793
+W794: .dw 794000,-794
+B794: .db 26,-94,7
+L795: add $30,$31,$0
+    ori $1,95,$2
+    beq $3,$4,L795
+    jmp L796
+    la X3
+    call L335
+    sw $5,95,$6
+    bne $7,$8,L794
+W795: .dw 795000,-795
+B795: .db 27,-95,7
+L796: add $5,$6,$7
+    ori $8,96,$9
+    beq $10,$11,L796
+    jmp L797
+    la X4
+    call L348
+    sw $12,96,$13
+    bne $14,$15,L795
+W796: .dw 796000,-796
+B796: .db 28,-96,7
+L797: add $12,$13,$14
+    ori $15,97,$16
+    beq $17,$18,L797
+    jmp L798
+    la X5
+    call L361
+    sw $19,97,$20
+    bne $21,$22,L796
+W797: .dw 797000,-797
+B797: .db 29,-97,7
+L798: add $19,$20,$21
+    ori $22,98,$23
+    beq $24,$25,L798
+    jmp L799
+    la X6
+    call L374
+    sw $26,98,$27
+    bne $28,$29,L797
+W798: .dw 798000,-798
+B798: .db 30,-98,7
+L799: add $26,$27,$28
+    ori $29,99,$30
+    beq $31,$0,L799
+    jmp L800
+    la X7
+    call L387
+    sw $1,99,$2
+    bne $3,$4,L798
+W799: .dw 799000,-799
+B799: .db 31,-99,7
+L800: add $1,$2,$3
+    ori $4,-100,$5
+    beq $6,$7,L800
+    jmp L801
+    la X0
+    call L400
+    sw $8,0,$9
+    bne $10,$11,L799
+W800: .dw 800000,-800
+B800: .db 32,0,7
+S800: .asciz "str800"
+    .dh 800
+.entry L800
+.entry W800
+L801: add $8,$9,$10
+    ori $11,-99,$12
+    beq $13,$14,L801
+    jmp L802
+    la X1
+    call L413
+    sw $15,1,$16
+    bne $17,$18,L800
+W801: .dw 801000,-801
+B801: .db 33,-1,7
+L802: add $15,$16,$17
+    ori $18,-98,$19
+    beq $20,$21,L802
+    jmp L803
+    la X2
+    call L426
+    sw $22,2,$23
+    bne $24,$25,L801
+W802: .dw 802000,-802
+B802: .db 34,-2,7
+L803: add $22,$23,$24
+    ori $25,-97,$26
+    beq $27,$28,L803
+    jmp L804
+    la X3
+    call L439
+    sw $29,3,$30
+    bne $31,$0,L802
+W803: .dw 803000,-803
+B803: .db 35,-3,7
+L804: add $29,$30,$31
+    ori $0,-96,$1
+    beq $2,$3,L804
+    jmp L805
+    la X4
+    call L452
+    sw $4,4,$5
+    bne $6,$7,L803
+W804: .dw 804000,-804
+B804: .db 36,-4,7
+L805: add $4,$5,$6
+    ori $7,-95,$8
+    beq $9,$10,L805
+    jmp L806
+    la X5
+    call L465
+    sw $11,5,$12
+    bne $13,$14,L804
+W805: .dw 805000,-805
+B805: .db 37,-5,7
+L806: add $11,$12,$13
+    ori $14,-94,$15
+    beq $16,$17,L806
+    jmp L807
+    la X6
+    call L478
+    sw $18,6,$19
+    bne $20,$21,L805
+W806: .dw 806000,-806
+B806: .db 38,-6,7
+L807: add $18,$19,$20
+    ori $21,-93,$22
+    beq $23,$24,L807
+    jmp L808
+    la X7
+    call L491
+    sw $25,7,$26
+    bne $27,$28,L806
+W807: .dw 807000,-807
+B807: .db 39,-7,7
+L808: add $25,$26,$27
+    ori $28,-92,$29
+    beq $30,$31,L808
+    jmp L809
+    la X0
+    call L504
+    sw $0,8,$1
+    bne $2,$3,L807
+W808: .dw 808000,-808
+B808: .db 40,-8,7
+L809: add $0,$1,$2
+    ori $3,-91,$4
+    beq $5,$6,L809
+    jmp L810
+    la X1
+    call L517
+    sw $7,9,$8
+    bne $9,$10,L808
+W809: .dw 809000,-809
+B809: .db 41,-9,7
+L810: add $7,$8,$9
+    ori $10,-90,$11
+    beq $12,$13,L810
+    jmp L811
+    la X2
+    call L530
+    sw $14,10,$15
+    bne $16,$17,L809
+W810: .dw 810000,-810
+B810: .db 42,-10,7
+S810: .asciz "str810"
+    .dh 810
+L811: add $14,$15,$16
+    ori $17,-89,$18
+    beq $19,$20,L811
+    jmp L812
+    la X3
+    call L543
+    sw $21,11,$22
+    bne $23,$24,L810
+W811: .dw 811000,-811
+B811: .db 43,-11,7
+L812: add $21,$22,$23
+    ori $24,-88,$25
+    beq $26,$27,L812
+    jmp L813
+    la X4
+    call L556
+    sw $28,12,$29
+    bne $30,$31,L811
+W812: .dw 812000,-812
+B812: .db 44,-12,7
+L813: add $28,$29,$30
+    ori $31,-87,$0
+    beq $1,$2,L813
+    jmp L814
+    la X5
+    call L569
+    sw $3,13,$4
+    bne $5,$6,L812
+W813: .dw 813000,-813
+B813: .db 45,-13,7
+L814: add $3,$4,$5
+    ori $6,-86,$7
+    beq $8,$9,L814
+    jmp L815
+    la X6
+    call L582
+    sw $10,14,$11
+    bne $12,$13,L813
+W814: .dw 814000,-814
+B814: .db 46,-14,7
+L815: add $10,$11,$12
+    ori $13,-85,$14
+    beq $15,$16,L815
+    jmp L816
+    la X7
+    call L595
+    sw $17,15,$18
+    bne $19,$20,L814
+W815: .dw 815000,-815
+B815: .db 47,-15,7
+L816: add $17,$18,$19
+    ori $20,-84,$21
+    beq $22,$23,L816
+    jmp L817
+    la X0
+    call L608
+    sw $24,16,$25
+    bne $26,$27,L815
+W816: .dw 816000,-816
+B816: .db 48,-16,7
+L817: add $24,$25,$26
+    ori $27,-83,$28
+    beq $29,$30,L817
+    jmp L818
+    la X1
+    call L621
+    sw $31,17,$0
+    bne $1,$2,L816
+W817: .dw 817000,-817
+B817: .db 49,-17,7
+L818: add $31,$0,$1
+    ori $2,-82,$3
+    beq $4,$5,L818
+    jmp L819
+    la X2
+    call L634
+    sw $6,18,$7
+    bne $8,$9,L817
+W818: .dw 818000,-818
+B818: .db 50,-18,7
+L819: add $6,$7,$8
+    ori $9,-81,$10
+    beq $11,$12,L819
+    jmp L820
+    la X3
+    call L647
+    sw $13,19,$14
+    bne $15,$16,L818
+W819: .dw 819000,-819
+B819: .db 51,-19,7
+L820: add $13,$14,$15
+    ori $16,-80,$17
+    beq $18,$19,L820
+    jmp L821
+    la X4
+    call L660
+    sw $20,20,$21
+    bne $22,$23,L819
+W820: .dw 820000,-820
+B820: .db 52,-20,7
+S820: .asciz "str820"
+    .dh 820
+L821: add $20,$21,$22
+    ori $23,-79,$24
+    beq $25,$26,L821
+    jmp L822
+    la X5
+    call L673
+    sw $27,21,$28
+    bne $29,$30,L820
+W821: .dw 821000,-821
+B821: .db 53,-21,7
+L822: add $27,$28,$29
+    ori $30,-78,$31
+    beq $0,$1,L822
+    jmp L823
+    la X6
+    call L686
+    sw $2,22,$3
+    bne $4,$5,L821
+W822: .dw 822000,-822
+B822: .db 54,-22,7
+L823: add $2,$3,$4
+    ori $5,-77,$6
+    beq $7,$8,L823
+    jmp L824
+    la X7
+    call L699
+    sw $9,23,$10
+    bne $11,$12,L822
+W823: .dw 823000,-823
+B823: .db 55,-23,7
+L824: add $9,$10,$11
+    ori $12,-76,$13
+    beq $14,$15,L824
+    jmp L825
+    la X0
+    call L712
+    sw $16,24,$17
+    bne $18,$19,L823
+W824: .dw 824000,-824
+B824: .db 56,-24,7
+L825: add $16,$17,$18
+    ori $19,-75,$20
+    beq $21,$22,L825
+    jmp L826
+    la X1
+    call L725
+    sw $23,25,$24
+    bne $25,$26,L824
+W825: .dw 825000,-825
+B825: .db 57,-25,7
+L826: add $23,$24,$25
+    ori $26,-74,$27
+    beq $28,$29,L826
+    jmp L827
+    la X2
+    call L738
+    sw $30,26,$31
+    bne $0,$1,L825
+W826: .dw 826000,-826
+B826: .db 58,-26,7
+L827: add $30,$31,$0
+    ori $1,-73,$2
+    beq $3,$4,L827
+    jmp L828
+    la X3
+    call L751
+    sw $5,27,$6
+    bne $7,$8,L826
+W827: .dw 827000,-827
+B827: .db 59,-27,7
+L828: add $5,$6,$7
+    ori $8,-72,$9
+    beq $10,$11,L828
+    jmp L829
+    la X4
+    call L764
+    sw $12,28,$13
+    bne $14,$15,L827
+W828: .dw 828000,-828
+B828: .db 60,-28,7
+L829: add $12,$13,$14
+    ori $15,-71,$16
+    beq $17,$18,L829
+    jmp L830
+    la X5
+    call L777
+    sw $19,29,$20
+    bne $21,$22,L828
+W829: .dw 829000,-829
+B829: .db 61,-29,7
+L830: add $19,$20,$21
+    ori $22,-70,$23
+    beq $24,$25,L830
+    jmp L831
+    la X6
+    call L790
+    sw $26,30,$27
+    bne $28,$29,L829
+W830: .dw 830000,-830
+B830: .db 62,-30,7
+S830: .asciz "str830"
+    .dh 830
+L831: add $26,$27,$28
+    ori $29,-69,$30
+    beq $31,$0,L831
+    jmp L832
+    la X7
+    call L803
+    sw $1,31,$2
+    bne $3,$4,L830
+W831: .dw 831000,-831
+B831: .db 63,-31,7
+L832: add $1,$2,$3
+    ori $4,-68,$5
+    beq $6,$7,L832
+    jmp L833
+    la X0
+    call L816
+    sw $8,32,$9
+    bne $10,$11,L831
+W832: .dw 832000,-832
+B832: .db 64,-32,7
+L833: add $8,$9,$10
+    ori $11,-67,$12
+    beq $13,$14,L833
+    jmp L834
+    la X1
+    call L829
+    sw $15,33,$16
+    bne $17,$18,L832
+W833: .dw 833000,-833
+B833: .db 65,-33,7
+L834: add $15,$16,$17
+    ori $18,-66,$19
+    beq $20,$21,L834
+    jmp L835
+    la X2
+    call L842
+    sw $22,34,$23
+    bne $24,$25,L833
+W834: .dw 834000,-834
+B834: .db 66,-34,7
+L835: add $22,$23,$24
+    ori $25,-65,$26
+    beq $27,$28,L835
+    jmp L836
+    la X3
+    call L855
+    sw $29,35,$30
+    bne $31,$0,L834
+W835: .dw 835000,-835
+B835: .db 67,-35,7
+L836: add $29,$30,$31
+    ori $0,-64,$1
+    beq $2,$3,L836
+    jmp L837
+    la X4
+    call L868
+    sw $4,36,$5
+    bne $6,$7,L835
+W836: .dw 836000,-836
+B836: .db 68,-36,7
+L837: add $4,$5,$6
+    ori $7,-63,$8
+    beq $9,$10,L837
+    jmp L838
+    la X5
+    call L881
+    sw $11,37,$12
+    bne $13,$14,L836
+W837: .dw 837000,-837
+B837: .db 69,-37,7
+L838: add $11,$12,$13
+    ori $14,-62,$15
+    beq $16,$17,L838
+    jmp L839
+    la X6
+    call L894
+    sw $18,38,$19
+    bne $20,$21,L837
+W838: .dw 838000,-838
+B838: .db 70,-38,7
+L839: add $18,$19,$20
+    ori $21,-61,$22
+    beq $23,$24,L839
+    jmp L840
+    la X7
+    call L907
+    sw $25,39,$26
+    bne $27,$28,L838
+W839: .dw 839000,-839
+B839: .db 71,-39,7
+L840: add $25,$26,$27
+    ori $28,-60,$29
+    beq $30,$31,L840
+    jmp L841
+    la X0
+    call L920
+    sw $0,40,$1
+    bne $2,$3,L839
+W840: .dw 840000,-840
+B840: .db 72,-40,7
+S840: .asciz "str840"
+    .dh 840
+L841: add $0,$1,$2
+    ori $3,-59,$4
+    beq $5,$6,L841
+    jmp L842
+    la X1
+    call L933
+    sw $7,41,$8
+    bne $9,$10,L840
+W841: .dw 841000,-841
+B841: .db 73,-41,7
+L842: add $7,$8,$9
+    ori $10,-58,$11
+    beq $12,$13,L842
+    jmp L843
+    la X2
+    call L946
+    sw $14,42,$15
+    bne $16,$17,L841
+W842: .dw 842000,-842
+B842: .db 74,-42,7
+L843: add $14,$15,$16
+    ori $17,-57,$18
+    beq $19,$20,L843
+    jmp L844
+    la X3
+    call L959
+    sw $21,43,$22
+    bne $23,$24,L842
+W843: .dw 843000,-843
+B843: .db 75,-43,7
+L844: add $21,$22,$23
+    ori $24,-56,$25
+    beq $26,$27,L844
+    jmp L845
+    la X4
+    call L972
+    sw $28,44,$29
+    bne $30,$31,L843
+W844: .dw 844000,-844
+B844: .db 76,-44,7
+L845: add $28,$29,$30
+    ori $31,-55,$0
+    beq $1,$2,L845
+    jmp L846
+    la X5
+    call L985
+    sw $3,45,$4
+    bne $5,$6,L844
+W845: .dw 845000,-845
+B845: .db 77,-45,7
+L846: add $3,$4,$5
+    ori $6,-54,$7
+    beq $8,$9,L846
+    jmp L847
+    la X6
+    call L998
+    sw $10,46,$11
+    bne $12,$13,L845
+W846: .dw 846000,-846
+B846: .db 78,-46,7
+L847: add $10,$11,$12
+    ori $13,-53,$14
+    beq $15,$16,L847
+    jmp L848
+    la X7
+    call L1011
+    sw $17,47,$18
+    bne $19,$20,L846
+W847: .dw 847000,-847
+B847: .db 79,-47,7
+L848: add $17,$18,$19
+    ori $20,-52,$21
+    beq $22,$23,L848
+    jmp L849
+    la X0
+    call L1024
+    sw $24,48,$25
+    bne $26,$27,L847
+W848: .dw 848000,-848
+B848: .db 80,-48,7
+L849: add $24,$25,$26
+    ori $27,-51,$28
+    beq $29,$30,L849
+    jmp L850
+    la X1
+    call L1037
+    sw $31,49,$0
+    bne $1,$2,L848
+W849: .dw 849000,-849
+B849: .db 81,-49,7
+L850: add $31,$0,$1
+    ori $2,-50,$3
+    beq $4,$5,L850
+    jmp L851
+    la X2
+    call L1050
+    sw $6,50,$7
+    bne $8,$9,L849
+W850: .dw 850000,-850
+B850: .db 82,-50,7
+S850: .asciz "str850"
+    .dh 850
+.entry L850
+.entry W850
+L851: add $6,$7,$8
+    ori $9,-49,$10
+    beq $11,$12,L851
+    jmp L852
+    la X3
+    call L1063
+    sw $13,51,$14
+    bne $15,$16,L850
+W851: .dw 851000,-851
+B851: .db 83,-51,7
+L852: add $13,$14,$15
+    ori $16,-48,$17
+    beq $18,$19,L852
+    jmp L853
+    la X4
+    call L1076
+    sw $20,52,$21
+    bne $22,$23,L851
+W852: .dw 852000,-852
+B852: .db 84,-52,7
+L853: add $20,$21,$22
+    ori $23,-47,$24
+    beq $25,$26,L853
+    jmp L854
+    la X5
+    call L1089
+    sw $27,53,$28
+    bne $29,$30,L852
+W853: .dw 853000,-853
+B853: .db 85,-53,7
+L854: add $27,$28,$29
+    ori $30,-46,$31
+    beq $0,$1,L854
+    jmp L855
+    la X6
+    call L1102
+    sw $2,54,$3
+    bne $4,$5,L853
+W854: .dw 854000,-854
+B854: .db 86,-54,7
+L855: add $2,$3,$4
+    ori $5,-45,$6
+    beq $7,$8,L855
+    jmp L856
+    la X7
+    call L1115
+    sw $9,55,$10
+    bne $11,$12,L854
+W855: .dw 855000,-855
+B855: .db 87,-55,7
+L856: add $9,$10,$11
+    ori $12,-44,$13
+    beq $14,$15,L856
+    jmp L857
+    la X0
+    call L1128
+    sw $16,56,$17
+    bne $18,$19,L855
+W856: .dw 856000,-856
+B856: .db 88,-56,7
+L857: add $16,$17,$18
+    ori $19,-43,$20
+    beq $21,$22,L857
+    jmp L858
+    la X1
+    call L1141
+    sw $23,57,$24
+    bne $25,$26,L856
+W857: .dw 857000,-857
+B857: .db 89,-57,7
+L858: add $23,$24,$25
+    ori $26,-42,$27
+    beq $28,$29,L858
+    jmp L859
+    la X2
+    call L1154
+    sw $30,58,$31
+    bne $0,$1,L857
+W858: .dw 858000,-858
+B858: .db 90,-58,7
+L859: add $30,$31,$0
+    ori $1,-41,$2
+    beq $3,$4,L859
+    jmp L860
+    la X3
+    call L1167
+    sw $5,59,$6
+    bne $7,$8,L858
+W859: .dw 859000,-859
+B859: .db 91,-59,7
+L860: add $5,$6,$7
+    ori $8,-40,$9
+    beq $10,$11,L860
+    jmp L861
+    la X4
+    call L1180
+    sw $12,60,$13
+    bne $14,$15,L859
+W860: .dw 860000,-860
+B860: .db 92,-60,7
+S860: .asciz "str860"
+    .dh 860
+L861: add $12,$13,$14
+    ori $15,-39,$16
+    beq $17,$18,L861
+    jmp L862
+    la X5
+    call L1193
+    sw $19,61,$20
+    bne $21,$22,L860
+W861: .dw 861000,-861
+B861: .db 93,-61,7
+L862: add $19,$20,$21
+    ori $22,-38,$23
+    beq $24,$25,L862
+    jmp L863
+    la X6
+    call L1206
+    sw $26,62,$27
+    bne $28,$29,L861
+W862: .dw 862000,-862
+B862: .db 94,-62,7
+L863: add $26,$27,$28
+    ori $29,-37,$30
+    beq $31,$0,L863
+    jmp L864
+    la X7
+    call L1219
+    sw $1,63,$2
+    bne $3,$4,L862
+W863: .dw 863000,-863
+B863: .db 95,-63,7
+L864: add $1,$2,$3
+    ori $4,-36,$5
+    beq $6,$7,L864
+    jmp L865
+    la X0
+    call L1232
+    sw $8,64,$9
+    bne $10,$11,L863
+W864: .dw 864000,-864
+B864: .db 96,-64,7
+L865: add $8,$9,$10
+    ori $11,-35,$12
+    beq $13,$14,L865
+    jmp L866
+    la X1
+    call L1245
+    sw $15,65,$16
+    bne $17,$18,L864
+W865: .dw 865000,-865
+B865: .db 97,-65,7
+L866: add $15,$16,$17
+    ori $18,-34,$19
+    beq $20,$21,L866
+    jmp L867
+    la X2
+    call L1258
+    sw $22,66,$23
+    bne $24,$25,L865
+W866: .dw 866000,-866
+B866: .db 98,-66,7
+L867: add $22,$23,$24
+    ori $25,-33,$26
+    beq $27,$28,L867
+    jmp L868
+    la X3
+    call L1271
+    sw $29,67,$30
+    bne $31,$0,L866
+W867: .dw 867000,-867
+B867: .db 99,-67,7
+L868: add $29,$30,$31
+    ori $0,-32,$1
+    beq $2,$3,L868
+    jmp L869
+    la X4
+    call L1284
+    sw $4,68,$5
+    bne $6,$7,L867
+W868: .dw 868000,-868
+B868: .db 100,-68,7
+L869: add $4,$5,$6
+    ori $7,-31,$8
+    beq $9,$10,L869
+    jmp L870
+    la X5
+    call L1297
+    sw $11,69,$12
+    bne $13,$14,L868
+W869: .dw 869000,-869
+B869: .db 101,-69,7
+L870: add $11,$12,$13
+    ori $14,-30,$15
+    beq $16,$17,L870
+    jmp L871
+    la X6
+    call L1310
+    sw $18,70,$19
+    bne $20,$21,L869
+W870: .dw 870000,-870
+B870: .db 102,-70,7
+S870: .asciz "str870"
+    .dh 870
+L871: add $18,$19,$20
+    ori $21,-29,$22
+    beq $23,$24,L871
+    jmp L872
+    la X7
+    call L1323
+    sw $25,71,$26
+    bne $27,$28,L870
+W871: .dw 871000,-871
+B871: .db 103,-71,7
+L872: add $25,$26,$27
+    ori $28,-28,$29
+    beq $30,$31,L872
+    jmp L873
+    la X0
+    call L1336
+    sw $0,72,$1
+    bne $2,$3,L871
+W872: .dw 872000,-872
+B872: .db 104,-72,7
+L873: add $0,$1,$2
+    ori $3,-27,$4
+    beq $5,$6,L873
+    jmp L874
+    la X1
+    call L1349
+    sw $7,73,$8
+    bne $9,$10,L872
+W873: .dw 873000,-873
+B873: .db 105,-73,7
+L874: add $7,$8,$9
+    ori $10,-26,$11
+    beq $12,$13,L874
+    jmp L875
+    la X2
+    call L1362
+    sw $14,74,$15
+    bne $16,$17,L873
+W874: .dw 874000,-874
+B874: .db 106,-74,7
+L875: add $14,$15,$16
+    ori $17,-25,$18
+    beq $19,$20,L875
+    jmp L876
+    la X3
+    call L1375
+    sw $21,75,$22
+    bne $23,$24,L874
+W875: .dw 875000,-875
+B875: .db 107,-75,7
+L876: add $21,$22,$23
+    ori $24,-24,$25
+    beq $26,$27,L876
+    jmp L877
+    la X4
+    call L1388
+    sw $28,76,$29
+    bne $30,$31,L875
+W876: .dw 876000,-876
+B876: .db 108,-76,7
+L877: add $28,$29,$30
+    ori $31,-23,$0
+    beq $1,$2,L877
+    jmp L878
+    la X5
+    call L1401
+    sw $3,77,$4
+    bne $5,$6,L876
+W877: .dw 877000,-877
+B877: .db 109,-77,7
+L878: add $3,$4,$5
+    ori $6,-22,$7
+    beq $8,$9,L878
+    jmp L879
+    la X6
+    call L1414
+    sw $10,78,$11
+    bne $12,$13,L877
+W878: .dw 878000,-878
+B878: .db 110,-78,7
+L879: add $10,$11,$12
+    ori $13,-21,$14
+    beq $15,$16,L879
+    jmp L880
+    la X7
+    call L1427
+    sw $17,79,$18
+    bne $19,$20,L878
+W879: .dw 879000,-879
+B879: .db 111,-79,7
+L880: add $17,$18,$19
+    ori $20,-20,$21
+    beq $22,$23,L880
+    jmp L881
+    la X0
+    call L1440
+    sw $24,80,$25
+    bne $26,$27,L879
+W880: .dw 880000,-880
+B880: .db 112,-80,7
+S880: .asciz "str880"
+    .dh 880
+L881: add $24,$25,$26
+    ori $27,-19,$28
+    beq $29,$30,L881
+    jmp L882
+    la X1
+    call L1453
+    sw $31,81,$0
+    bne $1,$2,L880
+W881: .dw 881000,-881
+B881: .db 113,-81,7
+L882: add $31,$0,$1
+    ori $2,-18,$3
+    beq $4,$5,L882
+    jmp L883
+    la X2
+    call L1466
+    sw $6,82,$7
+    bne $8,$9,L881
+W882: .dw 882000,-882
+B882: .db 114,-82,7
+L883: add $6,$7,$8
+    ori $9,-17,$10
+    beq $11,$12,L883
+    jmp L884
+    la X3
+    call L1479
+    sw $13,83,$14
+    bne $15,$16,L882
+W883: .dw 883000,-883
+B883: .db 115,-83,7
+L884: add $13,$14,$15
+    ori $16,-16,$17
+    beq $18,$19,L884
+    jmp L885
+    la X4
+    call L1492
+    sw $20,84,$21
+    bne $22,$23,L883
+W884: .dw 884000,-884
+B884: .db 116,-84,7
+L885: add $20,$21,$22
+    ori $23,-15,$24
+    beq $25,$26,L885
+    jmp L886
+    la X5
+    call L1505
+    sw $27,85,$28
+    bne $29,$30,L884
+W885: .dw 885000,-885
+B885: .db 117,-85,7
+L886: add $27,$28,$29
+    ori $30,-14,$31
+    beq $0,$1,L886
+    jmp L887
+    la X6
+    call L1518
+    sw $2,86,$3
+    bne $4,$5,L885
+W886: .dw 886000,-886
+B886: .db 118,-86,7
+L887: add $2,$3,$4
+    ori $5,-13,$6
+    beq $7,$8,L887
+    jmp L888
+    la X7
+    call L1531
+    sw $9,87,$10
+    bne $11,$12,L886
+W887: .dw 887000,-887
+B887: .db 119,-87,7
+L888: add $9,$10,$11
+    ori $12,-12,$13
+    beq $14,$15,L888
+    jmp L889
+    la X0
+    call L1544
+    sw $16,88,$17
+    bne $18,$19,L887
+W888: .dw 888000,-888
+B888: .db 120,-88,7
+L889: add $16,$17,$18
+    ori $19,-11,$20
+    beq $21,$22,L889
+    jmp L890
+    la X1
+    call L1557
+    sw $23,89,$24
+    bne $25,$26,L888
+W889: .dw 889000,-889
+B889: .db 121,-89,7
+L890: add $23,$24,$25
+    ori $26,-10,$27
+    beq $28,$29,L890
+    jmp L891
+    la X2
+    call L1570
+    sw $30,90,$31
+    bne $0,$1,L889
+W890: .dw 890000,-890
+B890: .db 122,-90,7
+S890: .asciz "str890"
+    .dh 890
+L891: add $30,$31,$0
+    ori $1,-9,$2
+    beq $3,$4,L891
+    jmp L892
+    la X3
+    call L1583
+    sw $5,91,$6
+    bne $7,$8,L890
+W891: .dw 891000,-891
+B891: .db 123,-91,7
+L892: add $5,$6,$7
+    ori $8,-8,$9
+    beq $10,$11,L892
+    jmp L893
+    la X4
+    call L1596
+    sw $12,92,$13
+    bne $14,$15,L891
+W892: .dw 892000,-892
+B892: .db 124,-92,7
+L893: add $12,$13,$14
+    ori $15,-7,$16
+    beq $17,$18,L893
+    jmp L894
+    la X5
+    call L1609
+    sw $19,93,$20
+    bne $21,$22,L892
+W893: .dw 893000,-893
+B893: .db 125,-93,7
+L894: add $19,$20,$21
+    ori $22,-6,$23
+    beq $24,$25,L894
+    jmp L895
+    la X6
+    call L1622
+    sw $26,94,$27
+    bne $28,$29,L893
+W894: .dw 894000,-894
+B894: .db 126,-94,7
+L895: add $26,$27,$28
+    ori $29,-5,$30
+    beq $31,$0,L895
+    jmp L896
+    la X7
+    call L1635
+    sw $1,95,$2
+    bne $3,$4,L894
+W895: .dw 895000,-895
+B895: .db 127,-95,7
+L896: add $1,$2,$3
+    ori $4,-4,$5
+    beq $6,$7,L896
+    jmp L897
+    la X0
+    call L1648
+    sw $8,96,$9
+    bne $10,$11,L895
+W896: .dw 896000,-896
+B896: .db 0,-96,7
+L897: add $8,$9,$10
+    ori $11,-3,$12
+    beq $13,$14,L897
+    jmp L898
+    la X1
+    call L1661
+    sw $15,97,$16
+    bne $17,$18,L896
+W897: .dw 897000,-897
+B897: .db 1,-97,7
+L898: add $15,$16,$17
+    ori $18,-2,$19
+    beq $20,$21,L898
+    jmp L899
+    la X2
+    call L1674
+    sw $22,98,$23
+    bne $24,$25,L897
+W898: .dw 898000,-898
+B898: .db 2,-98,7
+L899: add $22,$23,$24
+    ori $25,-1,$26
+    beq $27,$28,L899
+    jmp L900
+    la X3
+    call L1687
+    sw $29,99,$30
+    bne $31,$0,L898
+W899: .dw 899000,-899
+B899: .db 3,-99,7
+L900: add $29,$30,$31
+    ori $0,0,$1
+    beq $2,$3,L900
+    jmp L901
+    la X4
+    call L1700
+    sw $4,0,$5
+    bne $6,$7,L899
+W900: .dw 900000,-900
+B900: .db 4,0,7
+S900: .asciz "str900"
+    .dh 900
+.entry L900
+.entry W900
+L901: add $4,$5,$6
+    ori $7,1,$8
+    beq $9,$10,L901
+    jmp L902
+    la X5
+    call L1713
+    sw $11,1,$12
+    bne $13,$14,L900
+W901: .dw 901000,-901
+B901: .db 5,-1,7
+L902: add $11,$12,$13
+    ori $14,2,$15
+    beq $16,$17,L902
+    jmp L903
+    la X6
+    call L1726
+    sw $18,2,$19
+    bne $20,$21,L901
+W902: .dw 902000,-902
+B902: .db 6,-2,7
+L903: add $18,$19,$20
+    ori $21,3,$22
+    beq $23,$24,L903
+    jmp L904
+    la X7
+    call L1739
+    sw $25,3,$26
+    bne $27,$28,L902
+W903: .dw 903000,-903
+B903: .db 7,-3,7
+L904: add $25,$26,$27
+    ori $28,4,$29
+    beq $30,$31,L904
+    jmp L905
+    la X0
+    call L1752
+    sw $0,4,$1
+    bne $2,$3,L903
+W904: .dw 904000,-904
+B904: .db 8,-4,7
+L905: add $0,$1,$2
+    ori $3,5,$4
+    beq $5,$6,L905
+    jmp L906
+    la X1
+    call L1765
+    sw $7,5,$8
+    bne $9,$10,L904
+W905: .dw 905000,-905
+B905: .db 9,-5,7
+L906: add $7,$8,$9
+    ori $10,6,$11
+    beq $12,$13,L906
+    jmp L907
+    la X2
+    call L1778
+    sw $14,6,$15
+    bne $16,$17,L905
+W906: .dw 906000,-906
+B906: .db 10,-6,7
+L907: add $14,$15,$16
+    ori $17,7,$18
+    beq $19,$20,L907
+    jmp L908
+    la X3
+    call L1791
+    sw $21,7,$22
+    bne $23,$24,L906
+W907: .dw 907000,-907
+B907: .db 11,-7,7
+L908: add $21,$22,$23
+    ori $24,8,$25
+    beq $26,$27,L908
+    jmp L909
+    la X4
+    call L1804
+    sw $28,8,$29
+    bne $30,$31,L907
+W908: .dw 908000,-908
+B908: .db 12,-8,7
+L909: add $28,$29,$30
+    ori $31,9,$0
+    beq $1,$2,L909
+    jmp L910
+    la X5
+    call L1817
+    sw $3,9,$4
+    bne $5,$6,L908
+W909: .dw 909000,-909
+B909: .db 13,-9,7
+L910: add $3,$4,$5
+    ori $6,10,$7
+    beq $8,$9,L910
+    jmp L911
+    la X6
+    call L1830
+    sw $10,10,$11
+    bne $12,$13,L909
+W910: .dw 910000,-910
+B910: .db 14,-10,7
+S910: .asciz "str910"
+    .dh 910
+L911: add $10,$11,$12
+    ori $13,11,$14
+    beq $15,$16,L911
+    jmp L912
+    la X7
+    call L1843
+    sw $17,11,$18
+    bne $19,$20,L910
+W911: .dw 911000,-911
+B911: .db 15,-11,7
+L912: add $17,$18,$19
+    ori $20,12,$21
+    beq $22,$23,L912
+    jmp L913
+    la X0
+    call L1856
+    sw $24,12,$25
+    bne $26,$27,L911
+W912: .dw 912000,-912
+B912: .db 16,-12,7
+L913: add $24,$25,$26
+    ori $27,13,$28
+    beq $29,$30,L913
+    jmp L914
+    la X1
+    call L1869
+    sw $31,13,$0
+    bne $1,$2,L912
+W913: .dw 913000,-913
+B913: .db 17,-13,7
+L914: add $31,$0,$1
+    ori $2,14,$3
+    beq $4,$5,L914
+    jmp L915
+    la X2
+    call L1882
+    sw $6,14,$7
+    bne $8,$9,L913
+W914: .dw 914000,-914
+B914: .db 18,-14,7
+L915: add $6,$7,$8
+    ori $9,15,$10
+    beq $11,$12,L915
+    jmp L916
+    la X3
+    call L1895
+    sw $13,15,$14
+    bne $15,$16,L914
+W915: .dw 915000,-915
+B915: .db 19,-15,7
+L916: add $13,$14,$15
+    ori $16,16,$17
+    beq $18,$19,L916
+    jmp L917
+    la X4
+    call L1908
+    sw $20,16,$21
+    bne $22,$23,L915
+W916: .dw 916000,-916
+B916: .db 20,-16,7
+L917: add $20,$21,$22
+    ori $23,17,$24
+    beq $25,$26,L917
+    jmp L918
+    la X5
+    call L1921
+    sw $27,17,$28
+    bne $29,$30,L916
+W917: .dw 917000,-917
+B917: .db 21,-17,7
+L918: add $27,$28,$29
+    ori $30,18,$31
+    beq $0,$1,L918
+    jmp L919
+    la X6
+    call L1934
+    sw $2,18,$3
+    bne $4,$5,L917
+W918: .dw 918000,-918
+B918: .db 22,-18,7
+L919: add $2,$3,$4
+    ori $5,19,$6
+    beq $7,$8,L919
+    jmp L920
+    la X7
+    call L1947
+    sw $9,19,$10
+    bne $11,$12,L918
+W919: .dw 919000,-919
+B919: .db 23,-19,7
+L920: add $9,$10,$11
+    ori $12,20,$13
+    beq $14,$15,L920
+    jmp L921
+    la X0
+    call L1960
+    sw $16,20,$17
+    bne $18,$19,L919
+W920: .dw 920000,-920
+B920: .db 24,-20,7
+S920: .asciz "str920"
+    .dh 920
+L921: add $16,$17,$18
+    ori $19,21,$20
+    beq $21,$22,L921
+    jmp L922
+    la X1
+    call L1973
+    sw $23,21,$24
+    bne $25,$26,L920
+W921: .dw 921000,-921
+B921: .db 25,-21,7
+L922: add $23,$24,$25
+    ori $26,22,$27
+    beq $28,$29,L922
+    jmp L923
+    la X2
+    call L1986
+    sw $30,22,$31
+    bne $0,$1,L921
+W922: .dw 922000,-922
+B922: .db 26,-22,7
+L923: add $30,$31,$0
+    ori $1,23,$2
+    beq $3,$4,L923
+    jmp L924
+    la X3
+    call L1999
+    sw $5,23,$6
+    bne $7,$8,L922
+W923: .dw 923000,-923
+B923: .db 27,-23,7
+L924: add $5,$6,$7
+    ori $8,24,$9
+    beq $10,$11,L924
+    jmp L925
+    la X4
+    call L2012
+    sw $12,24,$13
+    bne $14,$15,L923
+W924: .dw 924000,-924
+B924: .db 28,-24,7
+L925: add $12,$13,$14
+    ori $15,25,$16
+    beq $17,$18,L925
+    jmp L926
+    la X5
+    call L2025
+    sw $19,25,$20
+    bne $21,$22,L924
+W925: .dw 925000,-925
+B925: .db 29,-25,7
+L926: add $19,$20,$21
+    ori $22,26,$23
+    beq $24,$25,L926
+    jmp L927
+    la X6
+    call L2038
+    sw $26,26,$27
+    bne $28,$29,L925
+W926: .dw 926000,-926
+B926: .db 30,-26,7
+L927: add $26,$27,$28
+    ori $29,27,$30
+    beq $31,$0,L927
+    jmp L928
+    la X7
+    call L2051
+    sw $1,27,$2
+    bne $3,$4,L926
+W927: .dw 927000,-927
+B927: .db 31,-27,7
+L928: add $1,$2,$3
+    ori $4,28,$5
+    beq $6,$7,L928
+    jmp L929
+    la X0
+    call L2064
+    sw $8,28,$9
+    bne $10,$11,L927
+W928: .dw 928000,-928
+B928: .db 32,-28,7
+L929: add $8,$9,$10
+    ori $11,29,$12
+    beq $13,$14,L929
+    jmp L930
+    la X1
+    call L2077
+    sw $15,29,$16
+    bne $17,$18,L928
+W929: .dw 929000,-929
+B929: .db 33,-29,7
+L930: add $15,$16,$17
+    ori $18,30,$19
+    beq $20,$21,L930
+    jmp L931
+    la X2
+    call L2090
+    sw $22,30,$23
+    bne $24,$25,L929
+W930: .dw 930000,-930
+B930: .db 34,-30,7
+S930: .asciz "str930"
+    .dh 930
+L931: add $22,$23,$24
+    ori $25,31,$26
+    beq $27,$28,L931
+    jmp L932
+    la X3
+    call L2103
+    sw $29,31,$30
+    bne $31,$0,L930
+W931: .dw 931000,-931
+B931: .db 35,-31,7
+L932: add $29,$30,$31
+    ori $0,32,$1
+    beq $2,$3,L932
+    jmp L933
+    la X4
+    call L2116
+    sw $4,32,$5
+    bne $6,$7,L931
+W932: .dw 932000,-932
+B932: .db 36,-32,7
+L933: add $4,$5,$6
+    ori $7,33,$8
+    beq $9,$10,L933
+    jmp L934
+    la X5
+    call L2129
+    sw $11,33,$12
+    bne $13,$14,L932
+W933: .dw 933000,-933
+B933: .db 37,-33,7
+L934: add $11,$12,$13
+    ori $14,34,$15
+    beq $16,$17,L934
+    jmp L935
+    la X6
+    call L2142
+    sw $18,34,$19
+    bne $20,$21,L933
+W934: .dw 934000,-934
+B934: .db 38,-34,7
+L935: add $18,$19,$20
+    ori $21,35,$22
+    beq $23,$24,L935
+    jmp L936
+    la X7
+    call L2155
+    sw $25,35,$26
+    bne $27,$28,L934
+W935: .dw 935000,-935
+B935: .db 39,-35,7
+L936: add $25,$26,$27
+    ori $28,36,$29
+    beq $30,$31,L936
+    jmp L937
+    la X0
+    call L2168
+    sw $0,36,$1
+    bne $2,$3,L935
+W936: .dw 936000,-936
+B936: .db 40,-36,7
+L937: add $0,$1,$2
+    ori $3,37,$4
+    beq $5,$6,L937
+    jmp L938
+    la X1
+    call L2181
+    sw $7,37,$8
+    bne $9,$10,L936
+W937: .dw 937000,-937
+B937: .db 41,-37,7
+L938: add $7,$8,$9
+    ori $10,38,$11
+    beq $12,$13,L938
+    jmp L939
+    la X2
+    call L2194
+    sw $14,38,$15
+    bne $16,$17,L937
+W938: .dw 938000,-938
+B938: .db 42,-38,7
+L939: add $14,$15,$16
+    ori $17,39,$18
+    beq $19,$20,L939
+    jmp L940
+    la X3
+    call L2207
+    sw $21,39,$22
+    bne $23,$24,L938
+W939: .dw 939000,-939
+B939: .db 43,-39,7
+L940: add $21,$22,$23
+    ori $24,40,$25
+    beq $26,$27,L940
+    jmp L941
+    la X4
+    call L2220
+    sw $28,40,$29
+    bne $30,$31,L939
+W940: .dw 940000,-940
+B940: .db 44,-40,7
+S940: .asciz "str940"
+    .dh 940
+L941: add $28,$29,$30
+    ori $31,41,$0
+    beq $1,$2,L941
+    jmp L942
+    la X5
+    call L2233
+    sw $3,41,$4
+    bne $5,$6,L940
+W941: .dw 941000,-941
+B941: .db 45,-41,7
+L942: add $3,$4,$5
+    ori $6,42,$7
+    beq $8,$9,L942
+    jmp L943
+    la X6
+    call L2246
+    sw $10,42,$11
+    bne $12,$13,L941
+W942: .dw 942000,-942
+B942: .db 46,-42,7
+L943: add $10,$11,$12
+    ori $13,43,$14
+    beq $15,$16,L943
+    jmp L944
+    la X7
+    call L2259
+    sw $17,43,$18
+    bne $19,$20,L942
+W943: .dw 943000,-943
+B943: .db 47,-43,7
+L944: add $17,$18,$19
+    ori $20,44,$21
+    beq $22,$23,L944
+    jmp L945
+    la X0
+    call L2272
+    sw $24,44,$25
+    bne $26,$27,L943
+W944: .dw 944000,-944
+B944: .db 48,-44,7
+L945: add $24,$25,$26
+    ori $27,45,$28
+    beq $29,$30,L945
+    jmp L946
+    la X1
+    call L2285
+    sw $31,45,$0
+    bne $1,$2,L944
+W945: .dw 945000,-945
+B945: .db 49,-45,7
+L946: add $31,$0,$1
+    ori $2,46,$3
+    beq $4,$5,L946
+    jmp L947
+    la X2
+    call L2298
+    sw $6,46,$7
+    bne $8,$9,L945
+W946: .dw 946000,-946
+B946: .db 50,-46,7
+L947: add $6,$7,$8
+    ori $9,47,$10
+    beq $11,$12,L947
+    jmp L948
+    la X3
+    call L2311
+    sw $13,47,$14
+    bne $15,$16,L946
+W947: .dw 947000,-947
+B947: .db 51,-47,7
+L948: add $13,$14,$15
+    ori $16,48,$17
+    beq $18,$19,L948
+    jmp L949
+    la X4
+    call L2324
+    sw $20,48,$21
+    bne $22,$23,L947
+W948: .dw 948000,-948
+B948: .db 52,-48,7
+L949: add $20,$21,$22
+    ori $23,49,$24
+    beq $25,$26,L949
+    jmp L950
+    la X5
+    call L2337
+    sw $27,49,$28
+    bne $29,$30,L948
+W949: .dw 949000,-949
+B949: .db 53,-49,7
+L950: add $27,$28,$29
+    ori $30,50,$31
+    beq $0,$1,L950
+    jmp L951
+    la X6
+    call L2350
+    sw $2,50,$3
+    bne $4,$5,L949
+W950: .dw 950000,-950
+B950: .db 54,-50,7
+S950: .asciz "str950"
+    .dh 950
+.entry L950
+.entry W950
+L951: add $2,$3,$4
+    ori $5,51,$6
+    beq $7,$8,L951
+    jmp L952
+    la X7
+    call L2363
+    sw $9,51,$10
+    bne $11,$12,L950
+W951: .dw 951000,-951
+B951: .db 55,-51,7
+L952: add $9,$10,$11
+    ori $12,52,$13
+    beq $14,$15,L952
+    jmp L953
+    la X0
+    call L2376
+    sw $16,52,$17
+    bne $18,$19,L951
+W952: .dw 952000,-952
+B952: .db 56,-52,7
+L953: add $16,$17,$18
+    ori $19,53,$20
+    beq $21,$22,L953
+    jmp L954
+    la X1
+    call L2389
+    sw $23,53,$24
+    bne $25,$26,L952
+W953: .dw 953000,-953
+B953: .db 57,-53,7
+L954: add $23,$24,$25
+    ori $26,54,$27
+    beq $28,$29,L954
+    jmp L955
+    la X2
+    call L2402
+    sw $30,54,$31
+    bne $0,$1,L953
+W954: .dw 954000,-954
+B954: .db 58,-54,7
+L955: add $30,$31,$0
+    ori $1,55,$2
+    beq $3,$4,L955
+    jmp L956
+    la X3
+    call L2415
+    sw $5,55,$6
+    bne $7,$8,L954
+W955: .dw 955000,-955
+B955: .db 59,-55,7
+L956: add $5,$6,$7
+    ori $8,56,$9
+    beq $10,$11,L956
+    jmp L957
+    la X4
+    call L2428
+    sw $12,56,$13
+    bne $14,$15,L955
+W956: .dw 956000,-956
+B956: .db 60,-56,7
+L957: add $12,$13,$14
+    ori $15,57,$16
+    beq $17,$18,L957
+    jmp L958
+    la X5
+    call L2441
+    sw $19,57,$20
+    bne $21,$22,L956
+W957: .dw 957000,-957
+B957: .db 61,-57,7
+L958: add $19,$20,$21
+    ori $22,58,$23
+    beq $24,$25,L958
+    jmp L959
+    la X6
+    call L2454
+    sw $26,58,$27
+    bne $28,$29,L957
+W958: .dw 958000,-958
+B958: .db 62,-58,7
+L959: add $26,$27,$28
+    ori $29,59,$30
+    beq $31,$0,L959
+    jmp L960
+    la X7
+    call L2467
+    sw $1,59,$2
+    bne $3,$4,L958
+W959: .dw 959000,-959
+B959: .db 63,-59,7
+L960: add $1,$2,$3
+    ori $4,60,$5
+    beq $6,$7,L960
+    jmp L961
+    la X0
+    call L2480
+    sw $8,60,$9
+    bne $10,$11,L959
+W960: .dw 960000,-960
+B960: .db 64,-60,7
+S960: .asciz "str960"
+    .dh 960
+L961: add $8,$9,$10
+    ori $11,61,$12
+    beq $13,$14,L961
+    jmp L962
+    la X1
+    call L2493
+    sw $15,61,$16
+    bne $17,$18,L960
+W961: .dw 961000,-961
+B961: .db 65,-61,7
+L962: add $15,$16,$17
+    ori $18,62,$19
+    beq $20,$21,L962
+    jmp L963
+    la X2
+    call L6
+    sw $22,62,$23
+    bne $24,$25,L961
+W962: .dw 962000,-962
+B962: .db 66,-62,7
+L963: add $22,$23,$24
+    ori $25,63,$26
+    beq $27,$28,L963
+    jmp L964
+    la X3
+    call L19
+    sw $29,63,$30
+    bne $31,$0,L962
+W963: .dw 963000,-963
+B963: .db 67,-63,7
+L964: add $29,$30,$31
+    ori $0,64,$1
+    beq $2,$3,L964
+    jmp L965
+    la X4
+    call L32
+    sw $4,64,$5
+    bne $6,$7,L963
+W964: .dw 964000,-964
+B964: .db 68,-64,7
+L965: add $4,$5,$6
+    ori $7,65,$8
+    beq $9,$10,L965
+    jmp L966
+    la X5
+    call L45
+    sw $11,65,$12
+    bne $13,$14,L964
+W965: .dw 965000,-965
+B965: .db 69,-65,7
+L966: add $11,$12,$13
+    ori $14,66,$15
+    beq $16,$17,L966
+    jmp L967
+    la X6
+    call L58
+    sw $18,66,$19
+    bne $20,$21,L965
+W966: .dw 966000,-966
+B966: .db 70,-66,7
+L967: add $18,$19,$20
+    ori $21,67,$22
+    beq $23,$24,L967
+    jmp L968
+    la X7
+    call L71
+    sw $25,67,$26
+    bne $27,$28,L966
+W967: .dw 967000,-967
+B967: .db 71,-67,7
+L968: add $25,$26,$27
+    ori $28,68,$29
+    beq $30,$31,L968
+    jmp L969
+    la X0
+    call L84
+    sw $0,68,$1
+    bne $2,$3,L967
+W968: .dw 968000,-968
+B968: .db 72,-68,7
+L969: add $0,$1,$2
+    ori $3,69,$4
+    beq $5,$6,L969
+    jmp L970
+    la X1
+    call L97
+    sw $7,69,$8
+    bne $9,$10,L968
+W969: .dw 969000,-969
+B969: .db 73,-69,7
+L970: add $7,$8,$9
+    ori $10,70,$11
+    beq $12,$13,L970
+    jmp L971
+    la X2
+    call L110
+    sw $14,70,$15
+    bne $16,$17,L969
+W970: .dw 970000,-970
+B970: .db 74,-70,7
+S970: .asciz "str970"
+    .dh 970
+L971: add $14,$15,$16
+    ori $17,71,$18
+    beq $19,$20,L971
+    jmp L972
+    la X3
+    call L123
+    sw $21,71,$22
+    bne $23,$24,L970
+W971: .dw 971000,-971
+B971: .db 75,-71,7
+L972: add $21,$22,$23
+    ori $24,72,$25
+    beq $26,$27,L972
+    jmp L973
+    la X4
+    call L136
+    sw $28,72,$29
+    bne $30,$31,L971
+W972: .dw 972000,-972
+B972: .db 76,-72,7
+L973: add $28,$29,$30
+    ori $31,73,$0
+    beq $1,$2,L973
+    jmp L974
+    la X5
+    call L149
+    sw $3,73,$4
+    bne $5,$6,L972
+W973: .dw 973000,-973
+B973: .db 77,-73,7
+L974: add $3,$4,$5
+    ori $6,74,$7
+    beq $8,$9,L974
+    jmp L975
+    la X6
+    call L162
+    sw $10,74,$11
+    bne $12,$13,L973
+W974: .dw 974000,-974
+B974: .db 78,-74,7
+L975: add $10,$11,$12
+    ori $13,75,$14
+    beq $15,$16,L975
+    jmp L976
+    la X7
+    call L175
+    sw $17,75,$18
+    bne $19,$20,L974
+W975: .dw 975000,-975
+B975: .db 79,-75,7
+L976: add $17,$18,$19
+    ori $20,76,$21
+    beq $22,$23,L976
+    jmp L977
+    la X0
+    call L188
+    sw $24,76,$25
+    bne $26,$27,L975
+W976: .dw 976000,-976
+B976: .db 80,-76,7
+L977: add $24,$25,$26
+    ori $27,77,$28
+    beq $29,$30,L977
+    jmp L978
+    la X1
+    call L201
+    sw $31,77,$0
+    bne $1,$2,L976
+W977: .dw 977000,-977
+B977: .db 81,-77,7
+L978: add $31,$0,$1
+    ori $2,78,$3
+    beq $4,$5,L978
+    jmp L979
+    la X2
+    call L214
+    sw $6,78,$7
+    bne $8,$9,L977
+W978: .dw 978000,-978
+B978: .db 82,-78,7
+L979: add $6,$7,$8
+    ori $9,79,$10
+    beq $11,$12,L979
+    jmp L980
+    la X3
+    call L227
+    sw $13,79,$14
+    bne $15,$16,L978
+W979: .dw 979000,-979
+B979: .db 83,-79,7
+L980: add $13,$14,$15
+    ori $16,80,$17
+    beq $18,$19,L980
+    jmp L981
+    la X4
+    call L240
+    sw $20,80,$21
+    bne $22,$23,L979
+W980: .dw 980000,-980
+B980: .db 84,-80,7
+S980: .asciz "str980"
+    .dh 980
+L981: add $20,$21,$22
+    ori $23,81,$24
+    beq $25,$26,L981
+    jmp L982
+    la X5
+    call L253
+    sw $27,81,$28
+    bne $29,$30,L980
+W981: .dw 981000,-981
+B981: .db 85,-81,7
+L982: add $27,$28,$29
+    ori $30,82,$31
+    beq $0,$1,L982
+    jmp L983
+    la X6
+    call L266
+    sw $2,82,$3
+    bne $4,$5,L981
+W982: .dw 982000,-982
+B982: .db 86,-82,7
+L983: add $2,$3,$4
+    ori $5,83,$6
+    beq $7,$8,L983
+    jmp L984
+    la X7
+    call L279
+    sw $9,83,$10
+    bne $11,$12,L982
+W983: .dw 983000,-983
+B983: .db 87,-83,7
+L984: add $9,$10,$11
+    ori $12,84,$13
+    beq $14,$15,L984
+    jmp L985
+    la X0
+    call L292
+    sw $16,84,$17
+    bne $18,$19,L983
+W984: .dw 984000,-984
+B984: .db 88,-84,7
+L985: add $16,$17,$18
+    ori $19,85,$20
+    beq $21,$22,L985
+    jmp L986
+    la X1
+    call L305
+    sw $23,85,$24
+    bne $25,$26,L984
+W985: .dw 985000,-985
+B985: .db 89,-85,7
+L986: add $23,$24,$25
+    ori $26,86,$27
+    beq $28,$29,L986
+    jmp L987
+    la X2
+    call L318
+    sw $30,86,$31
+    bne $0,$1,L985
+W986: .dw 986000,-986
+B986: .db 90,-86,7
+L987: add $30,$31,$0
+    ori $1,87,$2
+    beq $3,$4,L987
+    jmp L988
+    la X3
+    call L331
+    sw $5,87,$6
+    bne $7,$8,L986
+W987: .dw 987000,-987
+B987: .db 91,-87,7
+L988: add $5,$6,$7
+    ori $8,88,$9
+    beq $10,$11,L988
+    jmp L989
+    la X4
+    call L344
+    sw $12,88,$13
+    bne $14,$15,L987
+W988: .dw 988000,-988
+B988: .db 92,-88,7
+L989: add $12,$13,$14
+    ori $15,89,$16
+    beq $17,$18,L989
+    jmp L990
+    la X5
+    call L357
+    sw $19,89,$20
+    bne $21,$22,L988
+W989: .dw 989000,-989
+B989: .db 93,-89,7
+L990: add $19,$20,$21
+    ori $22,90,$23
+    beq $24,$25,L990
+    jmp L991
+    la X6
+    call L370
+    sw $26,90,$27
+    bne $28,$29,L989
+W990: .dw 990000,-990
+B990: .db 94,-90,7
+S990: .asciz "str990"
+    .dh 990
+L991: add $26,$27,$28
+    ori $29,91,$30
+    beq $31,$0,L991
+    jmp L992
+    la X7
+    call L383
+    sw $1,91,$2
+    bne $3,$4,L990
+W991: .dw 991000,-991
+B991: .db 95,-91,7
+L992: add $1,$2,$3
+    ori $4,92,$5
+    beq $6,$7,L992
+    jmp L993
+    la X0
+    call L396
+    sw $8,92,$9
+    bne $10,$11,L991
+W992: .dw 992000,-992
+B992: .db 96,-92,7
+L993: add $8,$9,$10
+    ori $11,93,$12
+    beq $13,$14,L993
+    jmp L994
+    la X1
+    call L409
+    sw $15,93,$16
+    bne $17,$18,L992
+W993: .dw 993000,-993
+B993: .db 97,-93,7
+L994: add $15,$16,$17
+    ori $18,94,$19
+    beq $20,$21,L994
+    jmp L995
+    la X2
+    call L422
+    sw $22,94,$23
+    bne $24,$25,L993
+W994: .dw 994000,-994
+B994: .db 98,-94,7
+L995: add $22,$23,$24
+    ori $25,95,$26
+    beq $27,$28,L995
+    jmp L996
+    la X3
+    call L435
+    sw $29,95,$30
+    bne $31,$0,L994
+W995: .dw 995000,-995
+B995: .db 99,-95,7
+L996: add $29,$30,$31
+    ori $0,96,$1
+    beq $2,$3,L996
+    jmp L997
+    la X4
+    call L448
+    sw $4,96,$5
+    bne $6,$7,L995
+W996: .dw 996000,-996
+B996: .db 100,-96,7
+L997: add $4,$5,$6
+    ori $7,97,$8
+    beq $9,$10,L997
+    jmp L998
+    la X5
+    call L461
+    sw $11,97,$12
+    bne $13,$14,L996
+W997: .dw 997000,-997
+B997: .db 101,-97,7
+L998: add $11,$12,$13
+    ori $14,98,$15
+    beq $16,$17,L998
+    jmp L999
+    la X6
+    call L474
+    sw $18,98,$19
+    bne $20,$21,L997
+W998: .dw 998000,-998
+B998: .db 102,-98,7
+L999: add $18,$19,$20
+    ori $21,99,$22
+    beq $23,$24,L999
+    jmp L1000
+    la X7
+    call L487
+    sw $25,99,$26
+    bne $27,$28,L998
+W999: .dw 999000,-999
+B999: .db 103,-99,7
+L1000: add $25,$26,$27
+    ori $28,-100,$29
+    beq $30,$31,L1000
+    jmp L1001
+    la X0
+    call L500
+    sw $0,0,$1
+    bne $2,$3,L999
+W1000: .dw 1000000,-1000
+B1000: .db 104,0,7
+S1000: .asciz "str1000"
+    .dh 1000
+.entry L1000
+.entry W1000
+L1001: add $0,$1,$2
+    ori $3,-99,$4
+    beq $5,$6,L1001
+    jmp L1002
+    la X1
+    call L513
+    sw $7,1,$8
+    bne $9,$10,L1000
+W1001: .dw 1001000,-1001
+B1001: .db 105,-1,7
+L1002: add $7,$8,$9
+    ori $10,-98,$11
+    beq $12,$13,L1002
+    jmp L1003
+    la X2
+    call L526
+    sw $14,2,$15
+    bne $16,$17,L1001
+W1002: .dw 1002000,-1002
+B1002: .db 106,-2,7
+L1003: add $14,$15,$16
+    ori $17,-97,$18
+    beq $19,$20,L1003
+    jmp L1004
+    la X3
+    call L539
+    sw $21,3,$22
+    bne $23,$24,L1002
+W1003: .dw 1003000,-1003
+B1003: .db 107,-3,7
+L1004: add $21,$22,$23
+    ori $24,-96,$25
+    beq $26,$27,L1004
+    jmp L1005
+    la X4
+    call L552
+    sw $28,4,$29
+    bne $30,$31,L1003
+W1004: .dw 1004000,-1004
+B1004: .db 108,-4,7
+L1005: add $28,$29,$30
+    ori $31,-95,$0
+    beq $1,$2,L1005
+    jmp L1006
+    la X5
+    call L565
+    sw $3,5,$4
+    bne $5,$6,L1004
+W1005: .dw 1005000,-1005
+B1005: .db 109,-5,7
+L1006: add $3,$4,$5
+    ori $6,-94,$7
+    beq $8,$9,L1006
+    jmp L1007
+    la X6
+    call L578
+    sw $10,6,$11
+    bne $12,$13,L1005
+W1006: .dw 1006000,-1006
+B1006: .db 110,-6,7
+L1007: add $10,$11,$12
+    ori $13,-93,$14
+    beq $15,$16,L1007
+    jmp L1008
+    la X7
+    call L591
+    sw $17,7,$18
+    bne $19,$20,L1006
+W1007: .dw 1007000,-1007
+B1007: .db 111,-7,7
+L1008: add $17,$18,$19
+    ori $20,-92,$21
+    beq $22,$23,L1008
+    jmp L1009
+    la X0
+    call L604
+    sw $24,8,$25
+    bne $26,$27,L1007
+W1008: .dw 1008000,-1008
+B1008: .db 112,-8,7
+L1009: add $24,$25,$26
+    ori $27,-91,$28
+    beq $29,$30,L1009
+    jmp L1010
+    la X1
+    call L617
+    sw $31,9,$0
+    bne $1,$2,L1008
+W1009: .dw 1009000,-1009
+B1009: .db 113,-9,7
+L1010: add $31,$0,$1
+    ori $2,-90,$3
+    beq $4,$5,L1010
+    jmp L1011
+    la X2
+    call L630
+    sw $6,10,$7
+    bne $8,$9,L1009
+W1010: .dw 1010000,-1010
+B1010: .db 114,-10,7
+S1010: .asciz "str1010"
+    .dh 1010
+L1011: add $6,$7,$8
+    ori $9,-89,$10
+    beq $11,$12,L1011
+    jmp L1012
+    la X3
+    call L643
+    sw $13,11,$14
+    bne $15,$16,L1010
+W1011: .dw 1011000,-1011
+B1011: .db 115,-11,7
+L1012: add $13,$14,$15
+    ori $16,-88,$17
+    beq $18,$19,L1012
+    jmp L1013
+    la X4
+    call L656
+    sw $20,12,$21
+    bne $22,$23,L1011
+W1012: .dw 1012000,-1012
+B1012: .db 116,-12,7
+L1013: add $20,$21,$22
+    ori $23,-87,$24
+    beq $25,$26,L1013
+    jmp L1014
+    la X5
+    call L669
+    sw $27,13,$28
+    bne $29,$30,L1012
+W1013: .dw 1013000,-1013
+B1013: .db 117,-13,7
+L1014: add $27,$28,$29
+    ori $30,-86,$31
+    beq $0,$1,L1014
+    jmp L1015
+    la X6
+    call L682
+    sw $2,14,$3
+    bne $4,$5,L1013
+W1014: .dw 1014000,-1014
+B1014: .db 118,-14,7
+L1015: add $2,$3,$4
+    ori $5,-85,$6
+    beq $7,$8,L1015
+    jmp L1016
+    la X7
+    call L695
+    sw $9,15,$10
+    bne $11,$12,L1014
+W1015: .dw 1015000,-1015
+B1015: .db 119,-15,7
+L1016: add $9,$10,$11
+    ori $12,-84,$13
+    beq $14,$15,L1016
+    jmp L1017
+    la X0
+    call L708
+    sw $16,16,$17
+    bne $18,$19,L1015
+W1016: .dw 1016000,-1016
+B1016: .db 120,-16,7
+L1017: add $16,$17,$18
+    ori $19,-83,$20
+    beq $21,$22,L1017
+    jmp L1018
+    la X1
+    call L721
+    sw $23,17,$24
+    bne $25,$26,L1016
+W1017: .dw 1017000,-1017
+B1017: .db 121,-17,7
+L1018: add $23,$24,$25
+    ori $26,-82,$27
+    beq $28,$29,L1018
+    jmp L1019
+    la X2
+    call L734
+    sw $30,18,$31
+    bne $0,$1,L1017
+W1018: .dw 1018000,-1018
+B1018: .db 122,-18,7
+L1019: add $30,$31,$0
+    ori $1,-81,$2
+    beq $3,$4,L1019
+    jmp L1020
+    la X3
+    call L747
+    sw $5,19,$6
+    bne $7,$8,L1018
+W1019: .dw 1019000,-1019
+B1019: .db 123,-19,7
+L1020: add $5,$6,$7
+    ori $8,-80,$9
+    beq $10,$11,L1020
+    jmp L1021
+    la X4
+    call L760
+    sw $12,20,$13
+    bne $14,$15,L1019
+W1020: .dw 1020000,-1020
+B1020: .db 124,-20,7
+S1020: .asciz "str1020"
+    .dh 1020
+L1021: add $12,$13,$14
+    ori $15,-79,$16
+    beq $17,$18,L1021
+    jmp L1022
+    la X5
+    call L773
+    sw $19,21,$20
+    bne $21,$22,L1020
+W1021: .dw 1021000,-1021
+B1021: .db 125,-21,7
+L1022: add $19,$20,$21
+    ori $22,-78,$23
+    beq $24,$25,L1022
+    jmp L1023
+    la X6
+    call L786
+    sw $26,22,$27
+    bne $28,$29,L1021
+W1022: .dw 1022000,-1022
+B1022: .db 126,-22,7
+L1023: add $26,$27,$28
+    ori $29,-77,$30
+    beq $31,$0,L1023
+    jmp L1024
+    la X7
+    call L799
+    sw $1,23,$2
+    bne $3,$4,L1022
+W1023: .dw 1023000,-1023
+B1023: .db 127,-23,7
+L1024: add $1,$2,$3
+    ori $4,-76,$5
+    beq $6,$7,L1024
+    jmp L1025
+    la X0
+    call L812
+    sw $8,24,$9
+    bne $10,$11,L1023
+W1024: .dw 1024000,-1024
+B1024: .db 0,-24,7
+L1025: add $8,$9,$10
+    ori $11,-75,$12
+    beq $13,$14,L1025
+    jmp L1026
+    la X1
+    call L825
+    sw $15,25,$16
+    bne $17,$18,L1024
+W1025: .dw 1025000,-1025
+B1025: .db 1,-25,7
+L1026: add $15,$16,$17
+    ori $18,-74,$19
+    beq $20,$21,L1026
+    jmp L1027
+    la X2
+    call L838
+    sw $22,26,$23
+    bne $24,$25,L1025
+W1026: .dw 1026000,-1026
+B1026: .db 2,-26,7
+L1027: add $22,$23,$24
+    ori $25,-73,$26
+    beq $27,$28,L1027
+    jmp L1028
+    la X3
+    call L851
+    sw $29,27,$30
+    bne $31,$0,L1026
+W1027: .dw 1027000,-1027
+B1027: .db 3,-27,7
+L1028: add $29,$30,$31
+    ori $0,-72,$1
+    beq $2,$3,L1028
+    jmp L1029
+    la X4
+    call L864
+    sw $4,28,$5
+    bne $6,$7,L1027
+W1028: .dw 1028000,-1028
+B1028: .db 4,-28,7
+L1029: add $4,$5,$6
+    ori $7,-71,$8
+    beq $9,$10,L1029
+    jmp L1030
+    la X5
+    call L877
+    sw $11,29,$12
+    bne $13,$14,L1028
+W1029: .dw 1029000,-1029
+B1029: .db 5,-29,7
+L1030: add $11,$12,$13
+    ori $14,-70,$15
+    beq $16,$17,L1030
+    jmp L1031
+    la X6
+    call L890
+    sw $18,30,$19
+    bne $20,$21,L1029
+W1030: .dw 1030000,-1030
+B1030: .db 6,-30,7
+S1030: .asciz "str1030"
+    .dh 1030
+L1031: add $18,$19,$20
+    ori $21,-69,$22
+    beq $23,$24,L1031
+    jmp L1032
+    la X7
+    call L903
+    sw $25,31,$26
+    bne $27,$28,L1030
+W1031: .dw 1031000,-1031
+B1031: .db 7,-31,7
+L1032: add $25,$26,$27
+    ori $28,-68,$29
+    beq $30,$31,L1032
+    jmp L1033
+    la X0
+    call L916
+    sw $0,32,$1
+    bne $2,$3,L1031
+W1032: .dw 1032000,-1032
+B1032: .db 8,-32,7
+L1033: add $0,$1,$2
+    ori $3,-67,$4
+    beq $5,$6,L1033
+    jmp L1034
+    la X1
+    call L929
+    sw $7,33,$8
+    bne $9,$10,L1032
+W1033: .dw 1033000,-1033
+B1033: .db 9,-33,7
+L1034: add $7,$8,$9
+    ori $10,-66,$11
+    beq $12,$13,L1034
+    jmp L1035
+    la X2
+    call L942
+    sw $14,34,$15
+    bne $16,$17,L1033
+W1034: .dw 1034000,-1034
+B1034: .db 10,-34,7
+L1035: add $14,$15,$16
+    ori $17,-65,$18
+    beq $19,$20,L1035
+    jmp L1036
+    la X3
+    call L955
+    sw $21,35,$22
+    bne $23,$24,L1034
+W1035: .dw 1035000,-1035
+B1035: .db 11,-35,7
+L1036: add $21,$22,$23
+    ori $24,-64,$25
+    beq $26,$27,L1036
+    jmp L1037
+    la X4
+    call L968
+    sw $28,36,$29
+    bne $30,$31,L1035
+W1036: .dw 1036000,-1036
+B1036: .db 12,-36,7
+L1037: add $28,$29,$30
+    ori $31,-63,$0
+    beq $1,$2,L1037
+    jmp L1038
+    la X5
+    call L981
+    sw $3,37,$4
+    bne $5,$6,L1036
+W1037: .dw 1037000,-1037
+B1037: .db 13,-37,7
+L1038: add $3,$4,$5
+    ori $6,-62,$7
+    beq $8,$9,L1038
+    jmp L1039
+    la X6
+    call L994
+    sw $10,38,$11
+    bne $12,$13,L1037
+W1038: .dw 1038000,-1038
+B1038: .db 14,-38,7
+L1039: add $10,$11,$12
+    ori $13,-61,$14
+    beq $15,$16,L1039
+    jmp L1040
+    la X7
+    call L1007
+    sw $17,39,$18
+    bne $19,$20,L1038
+W1039: .dw 1039000,-1039
+B1039: .db 15,-39,7
+L1040: add $17,$18,$19
+    ori $20,-60,$21
+    beq $22,$23,L1040
+    jmp L1041
+    la X0
+    call L1020
+    sw $24,40,$25
+    bne $26,$27,L1039
+W1040: .dw 1040000,-1040
+B1040: .db 16,-40,7
+S1040: .asciz "str1040"
+    .dh 1040
+L1041: add $24,$25,$26
+    ori $27,-59,$28
+    beq $29,$30,L1041
+    jmp L1042
+    la X1
+    call L1033
+    sw $31,41,$0
+    bne $1,$2,L1040
+W1041: .dw 1041000,-1041
+B1041: .db 17,-41,7
+L1042: add $31,$0,$1
+    ori $2,-58,$3
+    beq $4,$5,L1042
+    jmp L1043
+    la X2
+    call L1046
+    sw $6,42,$7
+    bne $8,$9,L1041
+W1042: .dw 1042000,-1042
+B1042: .db 18,-42,7
+L1043: add $6,$7,$8
+    ori $9,-57,$10
+    beq $11,$12,L1043
+    jmp L1044
+    la X3
+    call L1059
+    sw $13,43,$14
+    bne $15,$16,L1042
+W1043: .dw 1043000,-1043
+B1043: .db 19,-43,7
+L1044: add $13,$14,$15
+    ori $16,-56,$17
+    beq $18,$19,L1044
+    jmp L1045
+    la X4
+    call L1072
+    sw $20,44,$21
+    bne $22,$23,L1043
+W1044: .dw 1044000,-1044
+B1044: .db 20,-44,7
+L1045: add $20,$21,$22
+    ori $23,-55,$24
+    beq $25,$26,L1045
+    jmp L1046
+    la X5
+    call L1085
+    sw $27,45,$28
+    bne $29,$30,L1044
+W1045: .dw 1045000,-1045
+B1045: .db 21,-45,7
+L1046: add $27,$28,$29
+    ori $30,-54,$31
+    beq $0,$1,L1046
+    jmp L1047
+    la X6
+    call L1098
+    sw $2,46,$3
+    bne $4,$5,L1045
+W1046: .dw 1046000,-1046
+B1046: .db 22,-46,7
+L1047: add $2,$3,$4
+    ori $5,-53,$6
+    beq $7,$8,L1047
+    jmp L1048
+    la X7
+    call L1111
+    sw $9,47,$10
+    bne $11,$12,L1046
+W1047: .dw 1047000,-1047
+B1047: .db 23,-47,7
+L1048: add $9,$10,$11
+    ori $12,-52,$13
+    beq $14,$15,L1048
+    jmp L1049
+    la X0
+    call L1124
+    sw $16,48,$17
+    bne $18,$19,L1047
+W1048: .dw 1048000,-1048
+B1048: .db 24,-48,7
+L1049: add $16,$17,$18
+    ori $19,-51,$20
+    beq $21,$22,L1049
+    jmp L1050
+    la X1
+    call L1137
+    sw $23,49,$24
+    bne $25,$26,L1048
+W1049: .dw 1049000,-1049
+B1049: .db 25,-49,7
+L1050: add $23,$24,$25
+    ori $26,-50,$27
+    beq $28,$29,L1050
+    jmp L1051
+    la X2
+    call L1150
+    sw $30,50,$31
+    bne $0,$1,L1049
+W1050: .dw 1050000,-1050
+B1050: .db 26,-50,7
+S1050: .asciz "str1050"
+    .dh 1050
+.entry L1050
+.entry W1050
+L1051: add $30,$31,$0
+    ori $1,-49,$2
+    beq $3,$4,L1051
+    jmp L1052
+    la X3
+    call L1163
+    sw $5,51,$6
+    bne $7,$8,L1050
+W1051: .dw 1051000,-1051
+B1051: .db 27,-51,7
+L1052: add $5,$6,$7
+    ori $8,-48,$9
+    beq $10,$11,L1052
+    jmp L1053
+    la X4
+    call L1176
+    sw $12,52,$13
+    bne $14,$15,L1051
+W1052: .dw 1052000,-1052
+B1052: .db 28,-52,7
+L1053: add $12,$13,$14
+    ori $15,-47,$16
+    beq $17,$18,L1053
+    jmp L1054
+    la X5
+    call L1189
+    sw $19,53,$20
+    bne $21,$22,L1052
+W1053: .dw 1053000,-1053
+B1053: .db 29,-53,7
+L1054: add $19,$20,$21
+    ori $22,-46,$23
+    beq $24,$25,L1054
+    jmp L1055
+    la X6
+    call L1202
+    sw $26,54,$27
+    bne $28,$29,L1053
+W1054: .dw 1054000,-1054
+B1054: .db 30,-54,7
+L1055: add $26,$27,$28
+    ori $29,-45,$30
+    beq $31,$0,L1055
+    jmp L1056
+    la X7
+    call L1215
+    sw $1,55,$2
+    bne $3,$4,L1054
+W1055: .dw 1055000,-1055
+B1055: .db 31,-55,7
+L1056: add $1,$2,$3
+    ori $4,-44,$5
+    beq $6,$7,L1056
+    jmp L1057
+    la X0
+    call L1228
+    sw $8,56,$9
+    bne $10,$11,L1055
+W1056: .dw 1056000,-1056
+B1056: .db 32,-56,7
+L1057: add $8,$9,$10
+    ori $11,-43,$12
+    beq $13,$14,L1057
+    jmp L1058
+    la X1
+    call L1241
+    sw $15,57,$16
+    bne $17,$18,L1056
+W1057: .dw 1057000,-1057
+B1057: .db 33,-57,7
+L1058: add $15,$16,$17
+    ori $18,-42,$19
+    beq $20,$21,L1058
+    jmp L1059
+    la X2
+    call L1254
+    sw $22,58,$23
+    bne $24,$25,L1057
+W1058: .dw 1058000,-1058
+B1058: .db 34,-58,7
+L1059: add $22,$23,$24
+    ori $25,-41,$26
+    beq $27,$28,L1059
+    jmp L1060
+    la X3
+    call L1267
+    sw $29,59,$30
+    bne $31,$0,L1058
+W1059: .dw 1059000,-1059
+B1059: .db 35,-59,7
+L1060: add $29,$30,$31
+    ori $0,-40,$1
+    beq $2,$3,L1060
+    jmp L1061
+    la X4
+    call L1280
+    sw $4,60,$5
+    bne $6,$7,L1059
+W1060: .dw 1060000,-1060
+B1060: .db 36,-60,7
+S1060: .asciz "str1060"
+    .dh 1060
+L1061: add $4,$5,$6
+    ori $7,-39,$8
+    beq $9,$10,L1061
+    jmp L1062
+    la X5
+    call L1293
+    sw $11,61,$12
+    bne $13,$14,L1060
+W1061: .dw 1061000,-1061
+B1061: .db 37,-61,7
+L1062: add $11,$12,$13
+    ori $14,-38,$15
+    beq $16,$17,L1062
+    jmp L1063
+    la X6
+    call L1306
+    sw $18,62,$19
+    bne $20,$21,L1061
+W1062: .dw 1062000,-1062
+B1062: .db 38,-62,7
+L1063: add $18,$19,$20
+    ori $21,-37,$22
+    beq $23,$24,L1063
+    jmp L1064
+    la X7
+    call L1319
+    sw $25,63,$26
+    bne $27,$28,L1062
+W1063: .dw 1063000,-1063
+B1063: .db 39,-63,7
+L1064: add $25,$26,$27
+    ori $28,-36,$29
+    beq $30,$31,L1064
+    jmp L1065
+    la X0
+    call L1332
+    sw $0,64,$1
+    bne $2,$3,L1063
+W1064: .dw 1064000,-1064
+B1064: .db 40,-64,7
+L1065: add $0,$1,$2
+    ori $3,-35,$4
+    beq $5,$6,L1065
+    jmp L1066
+    la X1
+    call L1345
+    sw $7,65,$8
+    bne $9,$10,L1064
+W1065: .dw 1065000,-1065
+B1065: .db 41,-65,7
+L1066: add $7,$8,$9
+    ori $10,-34,$11
+    beq $12,$13,L1066
+    jmp L1067
+    la X2
+    call L1358
+    sw $14,66,$15
+    bne $16,$17,L1065
+W1066: .dw 1066000,-1066
+B1066: .db 42,-66,7
+L1067: add $14,$15,$16
+    ori $17,-33,$18
+    beq $19,$20,L1067
+    jmp L1068
+    la X3
+    call L1371
+    sw $21,67,$22
+    bne $23,$24,L1066
+W1067: .dw 1067000,-1067
+B1067: .db 43,-67,7
+L1068: add $21,$22,$23
+    ori $24,-32,$25
+    beq $26,$27,L1068
+    jmp L1069
+    la X4
+    call L1384
+    sw $28,68,$29
+    bne $30,$31,L1067
+W1068: .dw 1068000,-1068
+B1068: .db 44,-68,7
+L1069: add $28,$29,$30
+    ori $31,-31,$0
+    beq $1,$2,L1069
+    jmp L1070
+    la X5
+    call L1397
+    sw $3,69,$4
+    bne $5,$6,L1068
+W1069: .dw 1069000,-1069
+B1069: .db 45,-69,7
+L1070: add $3,$4,$5
+    ori $6,-30,$7
+    beq $8,$9,L1070
+    jmp L1071
+    la X6
+    call L1410
+    sw $10,70,$11
+    bne $12,$13,L1069
+W1070: .dw 1070000,-1070
+B1070: .db 46,-70,7
+S1070: .asciz "str1070"
+    .dh 1070
+L1071: add $10,$11,$12
+    ori $13,-29,$14
+    beq $15,$16,L1071
+    jmp L1072
+    la X7
+    call L1423
+    sw $17,71,$18
+    bne $19,$20,L1070
+W1071: .dw 1071000,-1071
+B1071: .db 47,-71,7
+L1072: add $17,$18,$19
+    ori $20,-28,$21
+    beq $22,$23,L1072
+    jmp L1073
+    la X0
+    call L1436
+    sw $24,72,$25
+    bne $26,$27,L1071
+W1072: .dw 1072000,-1072
+B1072: .db 48,-72,7
+L1073: add $24,$25,$26
+    ori $27,-27,$28
+    beq $29,$30,L1073
+    jmp L1074
+    la X1
+    call L1449
+    sw $31,73,$0
+    bne $1,$2,L1072
+W1073: .dw 1073000,-1073
+B1073: .db 49,-73,7
+L1074: add $31,$0,$1
+    ori $2,-26,$3
+    beq $4,$5,L1074
+    jmp L1075
+    la X2
+    call L1462
+    sw $6,74,$7
+    bne $8,$9,L1073
+W1074: .dw 1074000,-1074
+B1074: .db 50,-74,7
+L1075: add $6,$7,$8
+    ori $9,-25,$10
+    beq $11,$12,L1075
+    jmp L1076
+    la X3
+    call L1475
+    sw $13,75,$14
+    bne $15,$16,L1074
+W1075: .dw 1075000,-1075
+B1075: .db 51,-75,7
+L1076: add $13,$14,$15
+    ori $16,-24,$17
+    beq $18,$19,L1076
+    jmp L1077
+    la X4
+    call L1488
+    sw $20,76,$21
+    bne $22,$23,L1075
+W1076: .dw 1076000,-1076
+B1076: .db 52,-76,7
+L1077: add $20,$21,$22
+    ori $23,-23,$24
+    beq $25,$26,L1077
+    jmp L1078
+    la X5
+    call L1501
+    sw $27,77,$28
+    bne $29,$30,L1076
+W1077: .dw 1077000,-1077
+B1077: .db 53,-77,7
+L1078: add $27,$28,$29
+    ori $30,-22,$31
+    beq $0,$1,L1078
+    jmp L1079
+    la X6
+    call L1514
+    sw $2,78,$3
+    bne $4,$5,L1077
+W1078: .dw 1078000,-1078
+B1078: .db 54,-78,7
+L1079: add $2,$3,$4
+    ori $5,-21,$6
+    beq $7,$8,L1079
+    jmp L1080
+    la X7
+    call L1527
+    sw $9,79,$10
+    bne $11,$12,L1078
+W1079: .dw 1079000,-1079
+B1079: .db 55,-79,7
+L1080: add $9,$10,$11
+    ori $12,-20,$13
+    beq $14,$15,L1080
+    jmp L1081
+    la X0
+    call L1540
+    sw $16,80,$17
+    bne $18,$19,L1079
+W1080: .dw 1080000,-1080
+B1080: .db 56,-80,7
+S1080: .asciz "str1080"
+    .dh 1080
+L1081: add $16,$17,$18
+    ori $19,-19,$20
+    beq $21,$22,L1081
+    jmp L1082
+    la X1
+    call L1553
+    sw $23,81,$24
+    bne $25,$26,L1080
+W1081: .dw 1081000,-1081
+B1081: .db 57,-81,7
+L1082: add $23,$24,$25
+    ori $26,-18,$27
+    beq $28,$29,L1082
+    jmp L1083
+    la X2
+    call L1566
+    sw $30,82,$31
+    bne $0,$1,L1081
+W1082: .dw 1082000,-1082
+B1082: .db 58,-82,7
+L1083: add $30,$31,$0
+    ori $1,-17,$2
+    beq $3,$4,L1083
+    jmp L1084
+    la X3
+    call L1579
+    sw $5,83,$6
+    bne $7,$8,L1082
+W1083: .dw 1083000,-1083
+B1083: .db 59,-83,7
+L1084: add $5,$6,$7
+    ori $8,-16,$9
+    beq $10,$11,L1084
+    jmp L1085
+    la X4
+    call L1592
+    sw $12,84,$13
+    bne $14,$15,L1083
+W1084: .dw 1084000,-1084
+B1084: .db 60,-84,7
+L1085: add $12,$13,$14
+    ori $15,-15,$16
+    beq $17,$18,L1085
+    jmp L1086
+    la X5
+    call L1605
+    sw $19,85,$20
+    bne $21,$22,L1084
+W1085: .dw 1085000,-1085
+B1085: .db 61,-85,7
+L1086: add $19,$20,$21
+    ori $22,-14,$23
+    beq $24,$25,L1086
+    jmp L1087
+    la X6
+    call L1618
+    sw $26,86,$27
+    bne $28,$29,L1085
+W1086: .dw 1086000,-1086
+B1086: .db 62,-86,7
+L1087: add $26,$27,$28
+    ori $29,-13,$30
+    beq $31,$0,L1087
+    jmp L1088
+    la X7
+    call L1631
+    sw $1,87,$2
+    bne $3,$4,L1086
+W1087: .dw 1087000,-1087
+B1087: .db 63,-87,7
+L1088: add $1,$2,$3
+    ori $4,-12,$5
+    beq $6,$7,L1088
+    jmp L1089
+    la X0
+    call L1644
+    sw $8,88,$9
+    bne $10,$11,L1087
+W1088: .dw 1088000,-1088
+B1088: .db 64,-88,7
+L1089: add $8,$9,$10
+    ori $11,-11,$12
+    beq $13,$14,L1089
+    jmp L1090
+    la X1
+    call L1657
+    sw $15,89,$16
+    bne $17,$18,L1088
+W1089: .dw 1089000,-1089
+B1089: .db 65,-89,7
+L1090: add $15,$16,$17
+    ori $18,-10,$19
+    beq $20,$21,L1090
+    jmp L1091
+    la X2
+    call L1670
+    sw $22,90,$23
+    bne $24,$25,L1089
+W1090: .dw 1090000,-1090
+B1090: .db 66,-90,7
+S1090: .asciz "str1090"
+    .dh 1090
+L1091: add $22,$23,$24
+    ori $25,-9,$26
+    beq $27,$28,L1091
+    jmp L1092
+    la X3
+    call L1683
+    sw $29,91,$30
+    bne $31,$0,L1090
+W1091: .dw 1091000,-1091
+B1091: .db 67,-91,7
+L1092: add $29,$30,$31
+    ori $0,-8,$1
+    beq $2,$3,L1092
+    jmp L1093
+    la X4
+    call L1696
+    sw $4,92,$5
+    bne $6,$7,L1091
+W1092: .dw 1092000,-1092
+B1092: .db 68,-92,7
+L1093: add $4,$5,$6
+    ori $7,-7,$8
+    beq $9,$10,L1093
+    jmp L1094
+    la X5
+    call L1709
+    sw $11,93,$12
+    bne $13,$14,L1092
+W1093: .dw 1093000,-1093
+B1093: .db 69,-93,7
+L1094: add $11,$12,$13
+    ori $14,-6,$15
+    beq $16,$17,L1094
+    jmp L1095
+    la X6
+    call L1722
+    sw $18,94,$19
+    bne $20,$21,L1093
+W1094: .dw 1094000,-1094
+B1094: .db 70,-94,7
+L1095: add $18,$19,$20
+    ori $21,-5,$22
+    beq $23,$24,L1095
+    jmp L1096
+    la X7
+    call L1735
+    sw $25,95,$26
+    bne $27,$28,L1094
+W1095: .dw 1095000,-1095
+B1095: .db 71,-95,7
+L1096: add $25,$26,$27
+    ori $28,-4,$29
+    beq $30,$31,L1096
+    jmp L1097
+    la X0
+    call L1748
+    sw $0,96,$1
+    bne $2,$3,L1095
+W1096: .dw 1096000,-1096
+B1096: .db 72,-96,7
+L1097: add $0,$1,$2
+    ori $3,-3,$4
+    beq $5,$6,L1097
+    jmp L1098
+    la X1
+    call L1761
+    sw $7,97,$8
+    bne $9,$10,L1096
+W1097: .dw 1097000,-1097
+B1097: .db 73,-97,7
+L1098: add $7,$8,$9
+    ori $10,-2,$11
+    beq $12,$13,L1098
+    jmp L1099
+    la X2
+    call L1774
+    sw $14,98,$15
+    bne $16,$17,L1097
+W1098: .dw 1098000,-1098
+B1098: .db 74,-98,7
+L1099: add $14,$15,$16
+    ori $17,-1,$18
+    beq $19,$20,L1099
+    jmp L1100
+    la X3
+    call L1787
+    sw $21,99,$22
+    bne $23,$24,L1098
+W1099: .dw 1099000,-1099
+B1099: .db 75,-99,7
+L1100: add $21,$22,$23
+    ori $24,0,$25
+    beq $26,$27,L1100
+    jmp L1101
+    la X4
+    call L1800
+    sw $28,0,$29
+    bne $30,$31,L1099
+W1100: .dw 1100000,-1100
+B1100: .db 76,0,7
+S1100: .asciz "str1100"
+    .dh 1100
+.entry L1100
+.entry W1100
+L1101: add $28,$29,$30
+    ori $31,1,$0
+    beq $1,$2,L1101
+    jmp L1102
+    la X5
+    call L1813
+    sw $3,1,$4
+    bne $5,$6,L1100
+W1101: .dw 1101000,-1101
+B1101: .db 77,-1,7
+L1102: add $3,$4,$5
+    ori $6,2,$7
+    beq $8,$9,L1102
+    jmp L1103
+    la X6
+    call L1826
+    sw $10,2,$11
+    bne $12,$13,L1101
+W1102: .dw 1102000,-1102
+B1102: .db 78,-2,7
+L1103: add $10,$11,$12
+    ori $13,3,$14
+    beq $15,$16,L1103
+    jmp L1104
+    la X7
+    call L1839
+    sw $17,3,$18
+    bne $19,$20,L1102
+W1103: .dw 1103000,-1103
+B1103: .db 79,-3,7
+L1104: add $17,$18,$19
+    ori $20,4,$21
+    beq $22,$23,L1104
+    jmp L1105
+    la X0
+    call L1852
+    sw $24,4,$25
+    bne $26,$27,L1103
+W1104: .dw 1104000,-1104
+B1104: .db 80,-4,7
+L1105: add $24,$25,$26
+    ori $27,5,$28
+    beq $29,$30,L1105
+    jmp L1106
+    la X1
+    call L1865
+    sw $31,5,$0
+    bne $1,$2,L1104
+W1105: .dw 1105000,-1105
+B1105: .db 81,-5,7
+L1106: add $31,$0,$1
+    ori $2,6,$3
+    beq $4,$5,L1106
+    jmp L1107
+    la X2
+    call L1878
+    sw $6,6,$7
+    bne $8,$9,L1105
+W1106: .dw 1106000,-1106
+B1106: .db 82,-6,7
+L1107: add $6,$7,$8
+    ori $9,7,$10
+    beq $11,$12,L1107
+    jmp L1108
+    la X3
+    call L1891
+    sw $13,7,$14
+    bne $15,$16,L1106
+W1107: .dw 1107000,-1107
+B1107: .db 83,-7,7
+L1108: add $13,$14,$15
+    ori $16,8,$17
+    beq $18,$19,L1108
+    jmp L1109
+    la X4
+    call L1904
+    sw $20,8,$21
+    bne $22,$23,L1107
+W1108: .dw 1108000,-1108
+B1108: .db 84,-8,7
+L1109: add $20,$21,$22
+    ori $23,9,$24
+    beq $25,$26,L1109
+    jmp L1110
+    la X5
+    call L1917
+    sw $27,9,$28
+    bne $29,$30,L1108
+W1109: .dw 1109000,-1109
+B1109: .db 85,-9,7
+L1110: add $27,$28,$29
+    ori $30,10,$31
+    beq $0,$1,L1110
+    jmp L1111
+    la X6
+    call L1930
+    sw $2,10,$3
+    bne $4,$5,L1109
+W1110: .dw 1110000,-1110
+B1110: .db 86,-10,7
+S1110: .asciz "str1110"
+    .dh 1110
+L1111: add $2,$3,$4
+    ori $5,11,$6
+    beq $7,$8,L1111
+    jmp L1112
+    la X7
+    call L1943
+    sw $9,11,$10
+    bne $11,$12,L1110
+W1111: .dw 1111000,-1111
+B1111: .db 87,-11,7
+L1112: add $9,$10,$11
+    ori $12,12,$13
+    beq $14,$15,L1112
+    jmp L1113
+    la X0
+    call L1956
+    sw $16,12,$17
+    bne $18,$19,L1111
+W1112: .dw 1112000,-1112
+B1112: .db 88,-12,7
+L1113: add $16,$17,$18
+    ori $19,13,$20
+    beq $21,$22,L1113
+    jmp L1114
+    la X1
+    call L1969
+    sw $23,13,$24
+    bne $25,$26,L1112
+W1113: .dw 1113000,-1113
+B1113: .db 89,-13,7
+L1114: add $23,$24,$25
+    ori $26,14,$27
+    beq $28,$29,L1114
+    jmp L1115
+    la X2
+    call L1982
+    sw $30,14,$31
+    bne $0,$1,L1113
+W1114: .dw 1114000,-1114
+B1114: .db 90,-14,7
+L1115: add $30,$31,$0
+    ori $1,15,$2
+    beq $3,$4,L1115
+    jmp L1116
+    la X3
+    call L1995
+    sw $5,15,$6
+    bne $7,$8,L1114
+W1115: .dw 1115000,-1115
+B1115: .db 91,-15,7
+L1116: add $5,$6,$7
+    ori $8,16,$9
+    beq $10,$11,L1116
+    jmp L1117
+    la X4
+    call L2008
+    sw $12,16,$13
+    bne $14,$15,L1115
+W1116: .dw 1116000,-1116
+B1116: .db 92,-16,7
+L1117: add $12,$13,$14
+    ori $15,17,$16
+    beq $17,$18,L1117
+    jmp L1118
+    la X5
+    call L2021
+    sw $19,17,$20
+    bne $21,$22,L1116
+W1117: .dw 1117000,-1117
+B1117: .db 93,-17,7
+L1118: add $19,$20,$21
+    ori $22,18,$23
+    beq $24,$25,L1118
+    jmp L1119
+    la X6
+    call L2034
+    sw $26,18,$27
+    bne $28,$29,L1117
+W1118: .dw 1118000,-1118
+B1118: .db 94,-18,7
+L1119: add $26,$27,$28
+    ori $29,19,$30
+    beq $31,$0,L1119
+    jmp L1120
+    la X7
+    call L2047
+    sw $1,19,$2
+    bne $3,$4,L1118
+W1119: .dw 1119000,-1119
+B1119: .db 95,-19,7
+L1120: add $1,$2,$3
+    ori $4,20,$5
+    beq $6,$7,L1120
+    jmp L1121
+    la X0
+    call L2060
+    sw $8,20,$9
+    bne $10,$11,L1119
+W1120: .dw 1120000,-1120
+B1120: .db 96,-20,7
+S1120: .asciz "str1120"
+    .dh 1120
+L1121: add $8,$9,$10
+    ori $11,21,$12
+    beq $13,$14,L1121
+    jmp L1122
+    la X1
+    call L2073
+    sw $15,21,$16
+    bne $17,$18,L1120
+W1121: .dw 1121000,-1121
+B1121: .db 97,-21,7
+L1122: add $15,$16,$17
+    ori $18,22,$19
+    beq $20,$21,L1122
+    jmp L1123
+    la X2
+    call L2086
+    sw $22,22,$23
+    bne $24,$25,L1121
+W1122: .dw 1122000,-1122
+B1122: .db 98,-22,7
+L1123: add $22,$23,$24
+    ori $25,23,$26
+    beq $27,$28,L1123
+    jmp L1124
+    la X3
+    call L2099
+    sw $29,23,$30
+    bne $31,$0,L1122
+W1123: .dw 1123000,-1123
+B1123: .db 99,-23,7
+L1124: add $29,$30,$31
+    ori $0,24,$1
+    beq $2,$3,L1124
+    jmp L1125
+    la X4
+    call L2112
+    sw $4,24,$5
+    bne $6,$7,L1123
+W1124: .dw 1124000,-1124
+B1124: .db 100,-24,7
+L1125: add $4,$5,$6
+    ori $7,25,$8
+    beq $9,$10,L1125
+    jmp L1126
+    la X5
+    call L2125
+    sw $11,25,$12
+    bne $13,$14,L1124
+W1125: .dw 1125000,-1125
+B1125: .db 101,-25,7
+L1126: add $11,$12,$13
+    ori $14,26,$15
+    beq $16,$17,L1126
+    jmp L1127
+    la X6
+    call L2138
+    sw $18,26,$19
+    bne $20,$21,L1125
+W1126: .dw 1126000,-1126
+B1126: .db 102,-26,7
+L1127: add $18,$19,$20
+    ori $21,27,$22
+    beq $23,$24,L1127
+    jmp L1128
+    la X7
+    call L2151
+    sw $25,27,$26
+    bne $27,$28,L1126
+W1127: .dw 1127000,-1127
+B1127: .db 103,-27,7
+L1128: add $25,$26,$27
+    ori $28,28,$29
+    beq $30,$31,L1128
+    jmp L1129
+    la X0
+    call L2164
+    sw $0,28,$1
+    bne $2,$3,L1127
+W1128: .dw 1128000,-1128
+B1128: .db 104,-28,7
+L1129: add $0,$1,$2
+    ori $3,29,$4
+    beq $5,$6,L1129
+    jmp L1130
+    la X1
+    call L2177
+    sw $7,29,$8
+    bne $9,$10,L1128
+W1129: .dw 1129000,-1129
+B1129: .db 105,-29,7
+L1130: add $7,$8,$9
+    ori $10,30,$11
+    beq $12,$13,L1130
+    jmp L1131
+    la X2
+    call L2190
+    sw $14,30,$15
+    bne $16,$17,L1129
+W1130: .dw 1130000,-1130
+B1130: .db 106,-30,7
+S1130: .asciz "str1130"
+    .dh 1130
+L1131: add $14,$15,$16
+    ori $17,31,$18
+    beq $19,$20,L1131
+    jmp L1132
+    la X3
+    call L2203
+    sw $21,31,$22
+    bne $23,$24,L1130
+W1131: .dw 1131000,-1131
+B1131: .db 107,-31,7
+L1132: add $21,$22,$23
+    ori $24,32,$25
+    beq $26,$27,L1132
+    jmp L1133
+    la X4
+    call L2216
+    sw $28,32,$29
+    bne $30,$31,L1131
+W1132: .dw 1132000,-1132
+B1132: .db 108,-32,7
+L1133: add $28,$29,$30
+    ori $31,33,$0
+    beq $1,$2,L1133
+    jmp L1134
+    la X5
+    call L2229
+    sw $3,33,$4
+    bne $5,$6,L1132
+W1133: .dw 1133000,-1133
+B1133: .db 109,-33,7
+L1134: add $3,$4,$5
+    ori $6,34,$7
+    beq $8,$9,L1134
+    jmp L1135
+    la X6
+    call L2242
+    sw $10,34,$11
+    bne $12,$13,L1133
+W1134: .dw 1134000,-1134
+B1134: .db 110,-34,7
+L1135: add $10,$11,$12
+    ori $13,35,$14
+    beq $15,$16,L1135
+    jmp L1136
+    la X7
+    call L2255
+    sw $17,35,$18
+    bne $19,$20,L1134
+W1135: .dw 1135000,-1135
+B1135: .db 111,-35,7
+L1136: add $17,$18,$19
+    ori $20,36,$21
+    beq $22,$23,L1136
+    jmp L1137
+    la X0
+    call L2268
+    sw $24,36,$25
+    bne $26,$27,L1135
+W1136: .dw 1136000,-1136
+B1136: .db 112,-36,7
+L1137: add $24,$25,$26
+    ori $27,37,$28
+    beq $29,$30,L1137
+    jmp L1138
+    la X1
+    call L2281
+    sw $31,37,$0
+    bne $1,$2,L1136
+W1137: .dw 1137000,-1137
+B1137: .db 113,-37,7
+L1138: add $31,$0,$1
+    ori $2,38,$3
+    beq $4,$5,L1138
+    jmp L1139
+    la X2
+    call L2294
+    sw $6,38,$7
+    bne $8,$9,L1137
+W1138: .dw 1138000,-1138
+B1138: .db 114,-38,7
+L1139: add $6,$7,$8
+    ori $9,39,$10
+    beq $11,$12,L1139
+    jmp L1140
+    la X3
+    call L2307
+    sw $13,39,$14
+    bne $15,$16,L1138
+W1139: .dw 1139000,-1139
+B1139: .db 115,-39,7
+L1140: add $13,$14,$15
+    ori $16,40,$17
+    beq $18,$19,L1140
+    jmp L1141
+    la X4
+    call L2320
+    sw $20,40,$21
+    bne $22,$23,L1139
+W1140: .dw 1140000,-1140
+B1140: .db 116,-40,7
+S1140: .asciz "str1140"
+    .dh 1140
+L1141: add $20,$21,$22
+    ori $23,41,$24
+    beq $25,$26,L1141
+    jmp L1142
+    la X5
+    call L2333
+    sw $27,41,$28
+    bne $29,$30,L1140
+W1141: .dw 1141000,-1141
+B1141: .db 117,-41,7
+L1142: add $27,$28,$29
+    ori $30,42,$31
+    beq $0,$1,L1142
+    jmp L1143
+    la X6
+    call L2346
+    sw $2,42,$3
+    bne $4,$5,L1141
+W1142: .dw 1142000,-1142
+B1142: .db 118,-42,7
+L1143: add $2,$3,$4
+    ori $5,43,$6
+    beq $7,$8,L1143
+    jmp L1144
+    la X7
+    call L2359
+    sw $9,43,$10
+    bne $11,$12,L1142
+W1143: .dw 1143000,-1143
+B1143: .db 119,-43,7
+L1144: add $9,$10,$11
+    ori $12,44,$13
+    beq $14,$15,L1144
+    jmp L1145
+    la X0
+    call L2372
+    sw $16,44,$17
+    bne $18,$19,L1143
+W1144: .dw 1144000,-1144
+B1144: .db 120,-44,7
+L1145: add $16,$17,$18
+    ori $19,45,$20
+    beq $21,$22,L1145
+    jmp L1146
+    la X1
+    call L2385
+    sw $23,45,$24
+    bne $25,$26,L1144
+W1145: .dw 1145000,-1145
+B1145: .db 121,-45,7
+L1146: add $23,$24,$25
+    ori $26,46,$27
+    beq $28,$29,L1146
+    jmp L1147
+    la X2
+    call L2398
+    sw $30,46,$31
+    bne $0,$1,L1145
+W1146: .dw 1146000,-1146
+B1146: .db 122,-46,7
+L1147: add $30,$31,$0
+    ori $1,47,$2
+    beq $3,$4,L1147
+    jmp L1148
+    la X3
+    call L2411
+    sw $5,47,$6
+    bne $7,$8,L1146
+W1147: .dw 1147000,-1147
+B1147: .db 123,-47,7
+L1148: add $5,$6,$7
+    ori $8,48,$9
+    beq $10,$11,L1148
+    jmp L1149
+    la X4
+    call L2424
+    sw $12,48,$13
+    bne $14,$15,L1147
+W1148: .dw 1148000,-1148
+B1148: .db 124,-48,7
+L1149: add $12,$13,$14
+    ori $15,49,$16
+    beq $17,$18,L1149
+    jmp L1150
+    la X5
+    call L2437
+    sw $19,49,$20
+    bne $21,$22,L1148
+W1149: .dw 1149000,-1149
+B1149: .db 125,-49,7
+L1150: add $19,$20,$21
+    ori $22,50,$23
+    beq $24,$25,L1150
+    jmp L1151
+    la X6
+    call L2450
+    sw $26,50,$27
+    bne $28,$29,L1149
+W1150: .dw 1150000,-1150
+B1150: .db 126,-50,7
+S1150: .asciz "str1150"
+    .dh 1150
+.entry L1150
+.entry W1150
+L1151: add $26,$27,$28
+    ori $29,51,$30
+    beq $31,$0,L1151
+    jmp L1152
+    la X7
+    call L2463
+    sw $1,51,$2
+    bne $3,$4,L1150
+W1151: .dw 1151000,-1151
+B1151: .db 127,-51,7
+L1152: add $1,$2,$3
+    ori $4,52,$5
+    beq $6,$7,L1152
+    jmp L1153
+    la X0
+    call L2476
+    sw $8,52,$9
+    bne $10,$11,L1151
+W1152: .dw 1152000,-1152
+B1152: .db 0,-52,7
+L1153: add $8,$9,$10
+    ori $11,53,$12
+    beq $13,$14,L1153
+    jmp L1154
+    la X1
+    call L2489
+    sw $15,53,$16
+    bne $17,$18,L1152
+W1153: .dw 1153000,-1153
+B1153: .db 1,-53,7
+L1154: add $15,$16,$17
+    ori $18,54,$19
+    beq $20,$21,L1154
+    jmp L1155
+    la X2
+    call L2
+    sw $22,54,$23
+    bne $24,$25,L1153
+W1154: .dw 1154000,-1154
+B1154: .db 2,-54,7
+L1155: add $22,$23,$24
+    ori $25,55,$26
+    beq $27,$28,L1155
+    jmp L1156
+    la X3
+    call L15
+    sw $29,55,$30
+    bne $31,$0,L1154
+W1155: .dw 1155000,-1155
+B1155: .db 3,-55,7
+L1156: add $29,$30,$31
+    ori $0,56,$1
+    beq $2,$3,L1156
+    jmp L1157
+    la X4
+    call L28
+    sw $4,56,$5
+    bne $6,$7,L1155
+W1156: .dw 1156000,-1156
+B1156: .db 4,-56,7
+L1157: add $4,$5,$6
+    ori $7,57,$8
+    beq $9,$10,L1157
+    jmp L1158
+    la X5
+    call L41
+    sw $11,57,$12
+    bne $13,$14,L1156
+W1157: .dw 1157000,-1157
+B1157: .db 5,-57,7
+L1158: add $11,$12,$13
+    ori $14,58,$15
+    beq $16,$17,L1158
+    jmp L1159
+    la X6
+    call L54
+    sw $18,58,$19
+    bne $20,$21,L1157
+W1158: .dw 1158000,-1158
+B1158: .db 6,-58,7
+L1159: add $18,$19,$20
+    ori $21,59,$22
+    beq $23,$24,L1159
+    jmp L1160
+    la X7
+    call L67
+    sw $25,59,$26
+    bne $27,$28,L1158
+W1159: .dw 1159000,-1159
+B1159: .db 7,-59,7
+L1160: add $25,$26,$27
+    ori $28,60,$29
+    beq $30,$31,L1160
+    jmp L1161
+    la X0
+    call L80
+    sw $0,60,$1
+    bne $2,$3,L1159
+W1160: .dw 1160000,-1160
+B1160: .db 8,-60,7
+S1160: .asciz "str1160"
+    .dh 1160
+L1161: add $0,$1,$2
+    ori $3,61,$4
+    beq $5,$6,L1161
+    jmp L1162
+    la X1
+    call L93
+    sw $7,61,$8
+    bne $9,$10,L1160
+W1161: .dw 1161000,-1161
+B1161: .db 9,-61,7
+L1162: add $7,$8,$9
+    ori $10,62,$11
+    beq $12,$13,L1162
+    jmp L1163
+    la X2
+    call L106
+    sw $14,62,$15
+    bne $16,$17,L1161
+W1162: .dw 1162000,-1162
+B1162: .db 10,-62,7
+L1163: add $14,$15,$16
+    ori $17,63,$18
+    beq $19,$20,L1163
+    jmp L1164
+    la X3
+    call L119
+    sw $21,63,$22
+    bne $23,$24,L1162
+W1163: .dw 1163000,-1163
+B1163: .db 11,-63,7
+L1164: add $21,$22,$23
+    ori $24,64,$25
+    beq $26,$27,L1164
+    jmp L1165
+    la X4
+    call L132
+    sw $28,64,$29
+    bne $30,$31,L1163
+W1164: .dw 1164000,-1164
+B1164: .db 12,-64,7
+L1165: add $28,$29,$30
+    ori $31,65,$0
+    beq $1,$2,L1165
+    jmp L1166
+    la X5
+    call L145
+    sw $3,65,$4
+    bne $5,$6,L1164
+W1165: .dw 1165000,-1165
+B1165: .db 13,-65,7
+L1166: add $3,$4,$5
+    ori $6,66,$7
+    beq $8,$9,L1166
+    jmp L1167
+    la X6
+    call L158
+    sw $10,66,$11
+    bne $12,$13,L1165
+W1166: .dw 1166000,-1166
+B1166: .db 14,-66,7
+L1167: add $10,$11,$12
+    ori $13,67,$14
+    beq $15,$16,L1167
+    jmp L1168
+    la X7
+    call L171
+    sw $17,67,$18
+    bne $19,$20,L1166
+W1167: .dw 1167000,-1167
+B1167: .db 15,-67,7
+L1168: add $17,$18,$19
+    ori $20,68,$21
+    beq $22,$23,L1168
+    jmp L1169
+    la X0
+    call L184
+    sw $24,68,$25
+    bne $26,$27,L1167
+W1168: .dw 1168000,-1168
+B1168: .db 16,-68,7
+L1169: add $24,$25,$26
+    ori $27,69,$28
+    beq $29,$30,L1169
+    jmp L1170
+    la X1
+    call L197
+    sw $31,69,$0
+    bne $1,$2,L1168
+W1169: .dw 1169000,-1169
+B1169: .db 17,-69,7
+L1170: add $31,$0,$1
+    ori $2,70,$3
+    beq $4,$5,L1170
+    jmp L1171
+    la X2
+    call L210
+    sw $6,70,$7
+    bne $8,$9,L1169
+W1170: .dw 1170000,-1170
+B1170: .db 18,-70,7
+S1170: .asciz "str1170"
+    .dh 1170
+L1171: add $6,$7,$8
+    ori $9,71,$10
+    beq $11,$12,L1171
+    jmp L1172
+    la X3
+    call L223
+    sw $13,71,$14
+    bne $15,$16,L1170
+W1171: .dw 1171000,-1171
+B1171: .db 19,-71,7
+L1172: add $13,$14,$15
+    ori $16,72,$17
+    beq $18,$19,L1172
+    jmp L1173
+    la X4
+    call L236
+    sw $20,72,$21
+    bne $22,$23,L1171
+W1172: .dw 1172000,-1172
+B1172: .db 20,-72,7
+L1173: add $20,$21,$22
+    ori $23,73,$24
+    beq $25,$26,L1173
+    jmp L1174
+    la X5
+    call L249
+    sw $27,73,$28
+    bne $29,$30,L1172
+W1173: .dw 1173000,-1173
+B1173: .db 21,-73,7
+L1174: add $27,$28,$29
+    ori $30,74,$31
+    beq $0,$1,L1174
+    jmp L1175
+    la X6
+    call L262
+    sw $2,74,$3
+    bne $4,$5,L1173
+W1174: .dw 1174000,-1174
+B1174: .db 22,-74,7
+L1175: add $2,$3,$4
+    ori $5,75,$6
+    beq $7,$8,L1175
+    jmp L1176
+    la X7
+    call L275
+    sw $9,75,$10
+    bne $11,$12,L1174
+W1175: .dw 1175000,-1175
+B1175: .db 23,-75,7
+L1176: add $9,$10,$11
+    ori $12,76,$13
+    beq $14,$15,L1176
+    jmp L1177
+    la X0
+    call L288
+    sw $16,76,$17
+    bne $18,$19,L1175
+W1176: .dw 1176000,-1176
+B1176: .db 24,-76,7
+L1177: add $16,$17,$18
+    ori $19,77,$20
+    beq $21,$22,L1177
+    jmp L1178
+    la X1
+    call L301
+    sw $23,77,$24
+    bne $25,$26,L1176
+W1177: .dw 1177000,-1177
+B1177: .db 25,-77,7
+L1178: add $23,$24,$25
+    ori $26,78,$27
+    beq $28,$29,L1178
+    jmp L1179
+    la X2
+    call L314
+    sw $30,78,$31
+    bne $0,$1,L1177
+W1178: .dw 1178000,-1178
+B1178: .db 26,-78,7
+L1179: add $30,$31,$0
+    ori $1,79,$2
+    beq $3,$4,L1179
+    jmp L1180
+    la X3
+    call L327
+    sw $5,79,$6
+    bne $7,$8,L1178
+W1179: .dw 1179000,-1179
+B1179: .db 27,-79,7
+L1180: add $5,$6,$7
+    ori $8,80,$9
+    beq $10,$11,L1180
+    jmp L1181
+    la X4
+    call L340
+    sw $12,80,$13
+    bne $14,$15,L1179
+W1180: .dw 1180000,-1180
+B1180: .db 28,-80,7
+S1180: .asciz "str1180"
+    .dh 1180
+L1181: add $12,$13,$14
+    ori $15,81,$16
+    beq $17,$18,L1181
+    jmp L1182
+    la X5
+    call L353
+    sw $19,81,$20
+    bne $21,$22,L1180
+W1181: .dw 1181000,-1181
+B1181: .db 29,-81,7
+L1182: add $19,$20,$21
+    ori $22,82,$23
+    beq $24,$25,L1182
+    jmp L1183
+    la X6
+    call L366
+    sw $26,82,$27
+    bne $28,$29,L1181
+W1182: .dw 1182000,-1182
+B1182: .db 30,-82,7
+L1183: add $26,$27,$28
+    ori $29,83,$30
+    beq $31,$0,L1183
+    jmp L1184
+    la X7
+    call L379
+    sw $1,83,$2
+    bne $3,$4,L1182
+W1183: .dw 1183000,-1183
+B1183: .db 31,-83,7
+L1184: add $1,$2,$3
+    ori $4,84,$5
+    beq $6,$7,L1184
+    jmp L1185
+    la X0
+    call L392
+    sw $8,84,$9
+    bne $10,$11,L1183
+W1184: .dw 1184000,-1184
+B1184: .db 32,-84,7
+L1185: add $8,$9,$10
+    ori $11,85,$12
+    beq $13,$14,L1185
+    jmp L1186
+    la X1
+    call L405
+    sw $15,85,$16
+    bne $17,$18,L1184
+W1185: .dw 1185000,-1185
+B1185: .db 33,-85,7
+L1186: add $15,$16,$17
+    ori $18,86,$19
+    beq $20,$21,L1186
+    jmp L1187
+    la X2
+    call L418
+    sw $22,86,$23
+    bne $24,$25,L1185
+W1186: .dw 1186000,-1186
+B1186: .db 34,-86,7
+L1187: add $22,$23,$24
+    ori $25,87,$26
+    beq $27,$28,L1187
+    jmp L1188
+    la X3
+    call L431
+    sw $29,87,$30
+    bne $31,$0,L1186
+W1187: .dw 1187000,-1187
+B1187: .db 35,-87,7
+L1188: add $29,$30,$31
+    ori $0,88,$1
+    beq $2,$3,L1188
+    jmp L1189
+    la X4
+    call L444
+    sw $4,88,$5
+    bne $6,$7,L1187
+W1188: .dw 1188000,-1188
+B1188: .db 36,-88,7
+L1189: add $4,$5,$6
+    ori $7,89,$8
+    beq $9,$10,L1189
+    jmp L1190
+    la X5
+    call L457
+    sw $11,89,$12
+    bne $13,$14,L1188
+W1189: .dw 1189000,-1189
+B1189: .db 37,-89,7
+L1190: add $11,$12,$13
+    ori $14,90,$15
+    beq $16,$17,L1190
+    jmp L1191
+    la X6
+    call L470
+    sw $18,90,$19
+    bne $20,$21,L1189
+W1190: .dw 1190000,-1190
+B1190: .db 38,-90,7
+S1190: .asciz "str1190"
+    .dh 1190
+L1191: add $18,$19,$20
+    ori $21,91,$22
+    beq $23,$24,L1191
+    jmp L1192
+    la X7
+    call L483
+    sw $25,91,$26
+    bne $27,$28,L1190
+W1191: .dw 1191000,-1191
+B1191: .db 39,-91,7
+L1192: add $25,$26,$27
+    ori $28,92,$29
+    beq $30,$31,L1192
+    jmp L1193
+    la X0
+    call L496
+    sw $0,92,$1
+    bne $2,$3,L1191
+W1192: .dw 1192000,-1192
+B1192: .db 40,-92,7
+L1193: add $0,$1,$2
+    ori $3,93,$4
+    beq $5,$6,L1193
+    jmp L1194
+    la X1
+    call L509
+    sw $7,93,$8
+    bne $9,$10,L1192
+W1193: .dw 1193000,-1193
+B1193: .db 41,-93,7
+L1194: add $7,$8,$9
+    ori $10,94,$11
+    beq $12,$13,L1194
+    jmp L1195
+    la X2
+    call L522
+    sw $14,94,$15
+    bne $16,$17,L1193
+W1194: .dw 1194000,-1194
+B1194: .db 42,-94,7
+L1195: add $14,$15,$16
+    ori $17,95,$18
+    beq $19,$20,L1195
+    jmp L1196
+    la X3
+    call L535
+    sw $21,95,$22
+    bne $23,$24,L1194
+W1195: .dw 1195000,-1195
+B1195: .db 43,-95,7
+L1196: add $21,$22,$23
+    ori $24,96,$25
+    beq $26,$27,L1196
+    jmp L1197
+    la X4
+    call L548
+    sw $28,96,$29
+    bne $30,$31,L1195
+W1196: .dw 1196000,-1196
+B1196: .db 44,-96,7
+L1197: add $28,$29,$30
+    ori $31,97,$0
+    beq $1,$2,L1197
+    jmp L1198
+    la X5
+    call L561
+    sw $3,97,$4
+    bne $5,$6,L1196
+W1197: .dw 1197000,-1197
+B1197: .db 45,-97,7
+L1198: add $3,$4,$5
+    ori $6,98,$7
+    beq $8,$9,L1198
+    jmp L1199
+    la X6
+    call L574
+    sw $10,98,$11
+    bne $12,$13,L1197
+W1198: .dw 1198000,-1198
+B1198: .db 46,-98,7
+L1199: add $10,$11,$12
+    ori $13,99,$14
+    beq $15,$16,L1199
+    jmp L1200
+    la X7
+    call L587
+    sw $17,99,$18
+    bne $19,$20,L1198
+W1199: .dw 1199000,-1199
+B1199: .db 47,-99,7
+L1200: add $17,$18,$19
+    ori $20,-100,$21
+    beq $22,$23,L1200
+    jmp L1201
+    la X0
+    call L600
+    sw $24,0,$25
+    bne $26,$27,L1199
+W1200: .dw 1200000,-1200
+B1200: .db 48,0,7
+S1200: .asciz "str1200"
+    .dh 1200
+.entry L1200
+.entry W1200
+L1201: add $24,$25,$26
+    ori $27,-99,$28
+    beq $29,$30,L1201
+    jmp L1202
+    la X1
+    call L613
+    sw $31,1,$0
+    bne $1,$2,L1200
+W1201: .dw 1201000,-1201
+B1201: .db 49,-1,7
+L1202: add $31,$0,$1
+    ori $2,-98,$3
+    beq $4,$5,L1202
+    jmp L1203
+    la X2
+    call L626
+    sw $6,2,$7
+    bne $8,$9,L1201
+W1202: .dw 1202000,-1202
+B1202: .db 50,-2,7
+L1203: add $6,$7,$8
+    ori $9,-97,$10
+    beq $11,$12,L1203
+    jmp L1204
+    la X3
+    call L639
+    sw $13,3,$14
+    bne $15,$16,L1202
+W1203: .dw 1203000,-1203
+B1203: .db 51,-3,7
+L1204: add $13,$14,$15
+    ori $16,-96,$17
+    beq $18,$19,L1204
+    jmp L1205
+    la X4
+    call L652
+    sw $20,4,$21
+    bne $22,$23,L1203
+W1204: .dw 1204000,-1204
+B1204: .db 52,-4,7
+L1205: add $20,$21,$22
+    ori $23,-95,$24
+    beq $25,$26,L1205
+    jmp L1206
+    la X5
+    call L665
+    sw $27,5,$28
+    bne $29,$30,L1204
+W1205: .dw 1205000,-1205
+B1205: .db 53,-5,7
+L1206: add $27,$28,$29
+    ori $30,-94,$31
+    beq $0,$1,L1206
+    jmp L1207
+    la X6
+    call L678
+    sw $2,6,$3
+    bne $4,$5,L1205
+W1206: .dw 1206000,-1206
+B1206: .db 54,-6,7
+L1207: add $2,$3,$4
+    ori $5,-93,$6
+    beq $7,$8,L1207
+    jmp L1208
+    la X7
+    call L691
+    sw $9,7,$10
+    bne $11,$12,L1206
+W1207: .dw 1207000,-1207
+B1207: .db 55,-7,7
+L1208: add $9,$10,$11
+    ori $12,-92,$13
+    beq $14,$15,L1208
+    jmp L1209
+    la X0
+    call L704
+    sw $16,8,$17
+    bne $18,$19,L1207
+W1208: .dw 1208000,-1208
+B1208: .db 56,-8,7
+L1209: add $16,$17,$18
+    ori $19,-91,$20
+    beq $21,$22,L1209
+    jmp L1210
+    la X1
+    call L717
+    sw $23,9,$24
+    bne $25,$26,L1208
+W1209: .dw 1209000,-1209
+B1209: .db 57,-9,7
+L1210: add $23,$24,$25
+    ori $26,-90,$27
+    beq $28,$29,L1210
+    jmp L1211
+    la X2
+    call L730
+    sw $30,10,$31
+    bne $0,$1,L1209
+W1210: .dw 1210000,-1210
+B1210: .db 58,-10,7
+S1210: .asciz "str1210"
+    .dh 1210
+L1211: add $30,$31,$0
+    ori $1,-89,$2
+    beq $3,$4,L1211
+    jmp L1212
+    la X3
+    call L743
+    sw $5,11,$6
+    bne $7,$8,L1210
+W1211: .dw 1211000,-1211
+B1211: .db 59,-11,7
+L1212: add $5,$6,$7
+    ori $8,-88,$9
+    beq $10,$11,L1212
+    jmp L1213
+    la X4
+    call L756
+    sw $12,12,$13
+    bne $14,$15,L1211
+W1212: .dw 1212000,-1212
+B1212: .db 60,-12,7
+L1213: add $12,$13,$14
+    ori $15,-87,$16
+    beq $17,$18,L1213
+    jmp L1214
+    la X5
+    call L769
+    sw $19,13,$20
+    bne $21,$22,L1212
+W1213: .dw 1213000,-1213
+B1213: .db 61,-13,7
+L1214: add $19,$20,$21
+    ori $22,-86,$23
+    beq $24,$25,L1214
+    jmp L1215
+    la X6
+    call L782
+    sw $26,14,$27
+    bne $28,$29,L1213
+W1214: .dw 1214000,-1214
+B1214: .db 62,-14,7
+L1215: add $26,$27,$28
+    ori $29,-85,$30
+    beq $31,$0,L1215
+    jmp L1216
+    la X7
+    call L795
+    sw $1,15,$2
+    bne $3,$4,L1214
+W1215: .dw 1215000,-1215
+B1215: .db 63,-15,7
+L1216: add $1,$2,$3
+    ori $4,-84,$5
+    beq $6,$7,L1216
+    jmp L1217
+    la X0
+    call L808
+    sw $8,16,$9
+    bne $10,$11,L1215
+W1216: .dw 1216000,-1216
+B1216: .db 64,-16,7
+L1217: add $8,$9,$10
+    ori $11,-83,$12
+    beq $13,$14,L1217
+    jmp L1218
+    la X1
+    call L821
+    sw $15,17,$16
+    bne $17,$18,L1216
+W1217: .dw 1217000,-1217
+B1217: .db 65,-17,7
+L1218: add $15,$16,$17
+    ori $18,-82,$19
+    beq $20,$21,L1218
+    jmp L1219
+    la X2
+    call L834
+    sw $22,18,$23
+    bne $24,$25,L1217
+W1218: .dw 1218000,-1218
+B1218: .db 66,-18,7
+L1219: add $22,$23,$24
+    ori $25,-81,$26
+    beq $27,$28,L1219
+    jmp L1220
+    la X3
+    call L847
+    sw $29,19,$30
+    bne $31,$0,L1218
+W1219: .dw 1219000,-1219
+B1219: .db 67,-19,7
+L1220: add $29,$30,$31
+    ori $0,-80,$1
+    beq $2,$3,L1220
+    jmp L1221
+    la X4
+    call L860
+    sw $4,20,$5
+    bne $6,$7,L1219
+W1220: .dw 1220000,-1220
+B1220: .db 68,-20,7
+S1220: .asciz "str1220"
+    .dh 1220
+L1221: add $4,$5,$6
+    ori $7,-79,$8
+    beq $9,$10,L1221
+    jmp L1222
+    la X5
+    call L873
+    sw $11,21,$12
+    bne $13,$14,L1220
+W1221: .dw 1221000,-1221
+B1221: .db 69,-21,7
+L1222: add $11,$12,$13
+    ori $14,-78,$15
+    beq $16,$17,L1222
+    jmp L1223
+    la X6
+    call L886
+    sw $18,22,$19
+    bne $20,$21,L1221
+W1222: .dw 1222000,-1222
+B1222: .db 70,-22,7
+L1223: add $18,$19,$20
+    ori $21,-77,$22
+    beq $23,$24,L1223
+    jmp L1224
+    la X7
+    call L899
+    sw $25,23,$26
+    bne $27,$28,L1222
+W1223: .dw 1223000,-1223
+B1223: .db 71,-23,7
+L1224: add $25,$26,$27
+    ori $28,-76,$29
+    beq $30,$31,L1224
+    jmp L1225
+    la X0
+    call L912
+    sw $0,24,$1
+    bne $2,$3,L1223
+W1224: .dw 1224000,-1224
+B1224: .db 72,-24,7
+L1225: add $0,$1,$2
+    ori $3,-75,$4
+    beq $5,$6,L1225
+    jmp L1226
+    la X1
+    call L925
+    sw $7,25,$8
+    bne $9,$10,L1224
+W1225: .dw 1225000,-1225
+B1225: .db 73,-25,7
+L1226: add $7,$8,$9
+    ori $10,-74,$11
+    beq $12,$13,L1226
+    jmp L1227
+    la X2
+    call L938
+    sw $14,26,$15
+    bne $16,$17,L1225
+W1226: .dw 1226000,-1226
+B1226: .db 74,-26,7
+L1227: add $14,$15,$16
+    ori $17,-73,$18
+    beq $19,$20,L1227
+    jmp L1228
+    la X3
+    call L951
+    sw $21,27,$22
+    bne $23,$24,L1226
+W1227: .dw 1227000,-1227
+B1227: .db 75,-27,7
+L1228: add $21,$22,$23
+    ori $24,-72,$25
+    beq $26,$27,L1228
+    jmp L1229
+    la X4
+    call L964
+    sw $28,28,$29
+    bne $30,$31,L1227
+W1228: .dw 1228000,-1228
+B1228: .db 76,-28,7
+L1229: add $28,$29,$30
+    ori $31,-71,$0
+    beq $1,$2,L1229
+    jmp L1230
+    la X5
+    call L977
+    sw $3,29,$4
+    bne $5,$6,L1228
+W1229: .dw 1229000,-1229
+B1229: .db 77,-29,7
+L1230: add $3,$4,$5
+    ori $6,-70,$7
+    beq $8,$9,L1230
+    jmp L1231
+    la X6
+    call L990
+    sw $10,30,$11
+    bne $12,$13,L1229
+W1230: .dw 1230000,-1230
+B1230: .db 78,-30,7
+S1230: .asciz "str1230"
+    .dh 1230
+L1231: add $10,$11,$12
+    ori $13,-69,$14
+    beq $15,$16,L1231
+    jmp L1232
+    la X7
+    call L1003
+    sw $17,31,$18
+    bne $19,$20,L1230
+W1231: .dw 1231000,-1231
+B1231: .db 79,-31,7
+L1232: add $17,$18,$19
+    ori $20,-68,$21
+    beq $22,$23,L1232
+    jmp L1233
+    la X0
+    call L1016
+    sw $24,32,$25
+    bne $26,$27,L1231
+W1232: .dw 1232000,-1232
+B1232: .db 80,-32,7
+L1233: add $24,$25,$26
+    ori $27,-67,$28
+    beq $29,$30,L1233
+    jmp L1234
+    la X1
+    call L1029
+    sw $31,33,$0
+    bne $1,$2,L1232
+W1233: .dw 1233000,-1233
+B1233: .db 81,-33,7
+L1234: add $31,$0,$1
+    ori $2,-66,$3
+    beq $4,$5,L1234
+    jmp L1235
+    la X2
+    call L1042
+    sw $6,34,$7
+    bne $8,$9,L1233
+W1234: .dw 1234000,-1234
+B1234: .db 82,-34,7
+L1235: add $6,$7,$8
+    ori $9,-65,$10
+    beq $11,$12,L1235
+    jmp L1236
+    la X3
+    call L1055
+    sw $13,35,$14
+    bne $15,$16,L1234
+W1235: .dw 1235000,-1235
+B1235: .db 83,-35,7
+L1236: add $13,$14,$15
+    ori $16,-64,$17
+    beq $18,$19,L1236
+    jmp L1237
+    la X4
+    call L1068
+    sw $20,36,$21
+    bne $22,$23,L1235
+W1236: .dw 1236000,-1236
+B1236: .db 84,-36,7
+L1237: add $20,$21,$22
+    ori $23,-63,$24
+    beq $25,$26,L1237
+    jmp L1238
+    la X5
+    call L1081
+    sw $27,37,$28
+    bne $29,$30,L1236
+W1237: .dw 1237000,-1237
+B1237: .db 85,-37,7
+L1238: add $27,$28,$29
+    ori $30,-62,$31
+    beq $0,$1,L1238
+    jmp L1239
+    la X6
+    call L1094
+    sw $2,38,$3
+    bne $4,$5,L1237
+W1238: .dw 1238000,-1238
+B1238: .db 86,-38,7
+L1239: add $2,$3,$4
+    ori $5,-61,$6
+    beq $7,$8,L1239
+    jmp L1240
+    la X7
+    call L1107
+    sw $9,39,$10
+    bne $11,$12,L1238
+W1239: .dw 1239000,-1239
+B1239: .db 87,-39,7
+L1240: add $9,$10,$11
+    ori $12,-60,$13
+    beq $14,$15,L1240
+    jmp L1241
+    la X0
+    call L1120
+    sw $16,40,$17
+    bne $18,$19,L1239
+W1240: .dw 1240000,-1240
+B1240: .db 88,-40,7
+S1240: .asciz "str1240"
+    .dh 1240
+L1241: add $16,$17,$18
+    ori $19,-59,$20
+    beq $21,$22,L1241
+    jmp L1242
+    la X1
+    call L1133
+    sw $23,41,$24
+    bne $25,$26,L1240
+W1241: .dw 1241000,-1241
+B1241: .db 89,-41,7
+L1242: add $23,$24,$25
+    ori $26,-58,$27
+    beq $28,$29,L1242
+    jmp L1243
+    la X2
+    call L1146
+    sw $30,42,$31
+    bne $0,$1,L1241
+W1242: .dw 1242000,-1242
+B1242: .db 90,-42,7
+L1243: add $30,$31,$0
+    ori $1,-57,$2
+    beq $3,$4,L1243
+    jmp L1244
+    la X3
+    call L1159
+    sw $5,43,$6
+    bne $7,$8,L1242
+W1243: .dw 1243000,-1243
+B1243: .db 91,-43,7
+L1244: add $5,$6,$7
+    ori $8,-56,$9
+    beq $10,$11,L1244
+    jmp L1245
+    la X4
+    call L1172
+    sw $12,44,$13
+    bne $14,$15,L1243
+W1244: .dw 1244000,-1244
+B1244: .db 92,-44,7
+L1245: add $12,$13,$14
+    ori $15,-55,$16
+    beq $17,$18,L1245
+    jmp L1246
+    la X5
+    call L1185
+    sw $19,45,$20
+    bne $21,$22,L1244
+W1245: .dw 1245000,-1245
+B1245: .db 93,-45,7
+L1246: add $19,$20,$21
+    ori $22,-54,$23
+    beq $24,$25,L1246
+    jmp L1247
+    la X6
+    call L1198
+    sw $26,46,$27
+    bne $28,$29,L1245
+W1246: .dw 1246000,-1246
+B1246: .db 94,-46,7
+L1247: add $26,$27,$28
+    ori $29,-53,$30
+    beq $31,$0,L1247
+    jmp L1248
+    la X7
+    call L1211
+    sw $1,47,$2
+    bne $3,$4,L1246
+W1247: .dw 1247000,-1247
+B1247: .db 95,-47,7
+L1248: add $1,$2,$3
+    ori $4,-52,$5
+    beq $6,$7,L1248
+    jmp L1249
+    la X0
+    call L1224
+    sw $8,48,$9
+    bne $10,$11,L1247
+W1248: .dw 1248000,-1248
+B1248: .db 96,-48,7
+L1249: add $8,$9,$10
+    ori $11,-51,$12
+    beq $13,$14,L1249
+    jmp L1250
+    la X1
+    call L1237
+    sw $15,49,$16
+    bne $17,$18,L1248
+W1249: .dw 1249000,-1249
+B1249: .db 97,-49,7
+L1250: add $15,$16,$17
+    ori $18,-50,$19
+    beq $20,$21,L1250
+    jmp L1251
+    la X2
+    call L1250
+    sw $22,50,$23
+    bne $24,$25,L1249
+W1250: .dw 1250000,-1250
+B1250: .db 98,-50,7
+S1250: .asciz "str1250"
+    .dh 1250
+.entry L1250
+.entry W1250
+L1251: add $22,$23,$24
+    ori $25,-49,$26
+    beq $27,$28,L1251
+    jmp L1252
+    la X3
+    call L1263
+    sw $29,51,$30
+    bne $31,$0,L1250
+W1251: .dw 1251000,-1251
+B1251: .db 99,-51,7
+L1252: add $29,$30,$31
+    ori $0,-48,$1
+    beq $2,$3,L1252
+    jmp L1253
+    la X4
+    call L1276
+    sw $4,52,$5
+    bne $6,$7,L1251
+W1252: .dw 1252000,-1252
+B1252: .db 100,-52,7
+L1253: add $4,$5,$6
+    ori $7,-47,$8
+    beq $9,$10,L1253
+    jmp L1254
+    la X5
+    call L1289
+    sw $11,53,$12
+    bne $13,$14,L1252
+W1253: .dw 1253000,-1253
+B1253: .db 101,-53,7
+L1254: add $11,$12,$13
+    ori $14,-46,$15
+    beq $16,$17,L1254
+    jmp L1255
+    la X6
+    call L1302
+    sw $18,54,$19
+    bne $20,$21,L1253
+W1254: .dw 1254000,-1254
+B1254: .db 102,-54,7
+L1255: add $18,$19,$20
+    ori $21,-45,$22
+    beq $23,$24,L1255
+    jmp L1256
+    la X7
+    call L1315
+    sw $25,55,$26
+    bne $27,$28,L1254
+W1255: .dw 1255000,-1255
+B1255: .db 103,-55,7
+L1256: add $25,$26,$27
+    ori $28,-44,$29
+    beq $30,$31,L1256
+    jmp L1257
+    la X0
+    call L1328
+    sw $0,56,$1
+    bne $2,$3,L1255
+W1256: .dw 1256000,-1256
+B1256: .db 104,-56,7
+L1257: add $0,$1,$2
+    ori $3,-43,$4
+    beq $5,$6,L1257
+    jmp L1258
+    la X1
+    call L1341
+    sw $7,57,$8
+    bne $9,$10,L1256
+W1257: .dw 1257000,-1257
+B1257: .db 105,-57,7
+L1258: add $7,$8,$9
+    ori $10,-42,$11
+    beq $12,$13,L1258
+    jmp L1259
+    la X2
+    call L1354
+    sw $14,58,$15
+    bne $16,$17,L1257
+W1258: .dw 1258000,-1258
+B1258: .db 106,-58,7
+L1259: add $14,$15,$16
+    ori $17,-41,$18
+    beq $19,$20,L1259
+    jmp L1260
+    la X3
+    call L1367
+    sw $21,59,$22
+    bne $23,$24,L1258
+W1259: .dw 1259000,-1259
+B1259: .db 107,-59,7
+L1260: add $21,$22,$23
+    ori $24,-40,$25
+    beq $26,$27,L1260
+    jmp L1261
+    la X4
+    call L1380
+    sw $28,60,$29
+    bne $30,$31,L1259
+W1260: .dw 1260000,-1260
+B1260: .db 108,-60,7
+S1260: .asciz "str1260"
+    .dh 1260
+L1261: add $28,$29,$30
+    ori $31,-39,$0
+    beq $1,$2,L1261
+    jmp L1262
+    la X5
+    call L1393
+    sw $3,61,$4
+    bne $5,$6,L1260
+W1261: .dw 1261000,-1261
+B1261: .db 109,-61,7
+L1262: add $3,$4,$5
+    ori $6,-38,$7
+    beq $8,$9,L1262
+    jmp L1263
+    la X6
+    call L1406
+    sw $10,62,$11
+    bne $12,$13,L1261
+W1262: .dw 1262000,-1262
+B1262: .db 110,-62,7
+L1263: add $10,$11,$12
+    ori $13,-37,$14
+    beq $15,$16,L1263
+    jmp L1264
+    la X7
+    call L1419
+    sw $17,63,$18
+    bne $19,$20,L1262
+W1263: .dw 1263000,-1263
+B1263: .db 111,-63,7
+L1264: add $17,$18,$19
+    ori $20,-36,$21
+    beq $22,$23,L1264
+    jmp L1265
+    la X0
+    call L1432
+    sw $24,64,$25
+    bne $26,$27,L1263
+W1264: .dw 1264000,-1264
+B1264: .db 112,-64,7
+L1265: add $24,$25,$26
+    ori $27,-35,$28
+    beq $29,$30,L1265
+    jmp L1266
+    la X1
+    call L1445
+    sw $31,65,$0
+    bne $1,$2,L1264
+W1265: .dw 1265000,-1265
+B1265: .db 113,-65,7
+L1266: add $31,$0,$1
+    ori $2,-34,$3
+    beq $4,$5,L1266
+    jmp L1267
+    la X2
+    call L1458
+    sw $6,66,$7
+    bne $8,$9,L1265
+W1266: .dw 1266000,-1266
+B1266: .db 114,-66,7
+L1267: add $6,$7,$8
+    ori $9,-33,$10
+    beq $11,$12,L1267
+    jmp L1268
+    la X3
+    call L1471
+    sw $13,67,$14
+    bne $15,$16,L1266
+W1267: .dw 1267000,-1267
+B1267: .db 115,-67,7
+L1268: add $13,$14,$15
+    ori $16,-32,$17
+    beq $18,$19,L1268
+    jmp L1269
+    la X4
+    call L1484
+    sw $20,68,$21
+    bne $22,$23,L1267
+W1268: .dw 1268000,-1268
+B1268: .db 116,-68,7
+L1269: add $20,$21,$22
+    ori $23,-31,$24
+    beq $25,$26,L1269
+    jmp L1270
+    la X5
+    call L1497
+    sw $27,69,$28
+    bne $29,$30,L1268
+W1269: .dw 1269000,-1269
+B1269: .db 117,-69,7
+L1270: add $27,$28,$29
+    ori $30,-30,$31
+    beq $0,$1,L1270
+    jmp L1271
+    la X6
+    call L1510
+    sw $2,70,$3
+    bne $4,$5,L1269
+W1270: .dw 1270000,-1270
+B1270: .db 118,-70,7
+S1270: .asciz "str1270"
+    .dh 1270
+L1271: add $2,$3,$4
+    ori $5,-29,$6
+    beq $7,$8,L1271
+    jmp L1272
+    la X7
+    call L1523
+    sw $9,71,$10
+    bne $11,$12,L1270
+W1271: .dw 1271000,-1271
+B1271: .db 119,-71,7
+L1272: add $9,$10,$11
+    ori $12,-28,$13
+    beq $14,$15,L1272
+    jmp L1273
+    la X0
+    call L1536
+    sw $16,72,$17
+    bne $18,$19,L1271
+W1272: .dw 1272000,-1272
+B1272: .db 120,-72,7
+L1273: add $16,$17,$18
+    ori $19,-27,$20
+    beq $21,$22,L1273
+    jmp L1274
+    la X1
+    call L1549
+    sw $23,73,$24
+    bne $25,$26,L1272
+W1273: .dw 1273000,-1273
+B1273: .db 121,-73,7
+L1274: add $23,$24,$25
+    ori $26,-26,$27
+    beq $28,$29,L1274
+    jmp L1275
+    la X2
+    call L1562
+    sw $30,74,$31
+    bne $0,$1,L1273
+W1274: .dw 1274000,-1274
+B1274: .db 122,-74,7
+L1275: add $30,$31,$0
+    ori $1,-25,$2
+    beq $3,$4,L1275
+    jmp L1276
+    la X3
+    call L1575
+    sw $5,75,$6
+    bne $7,$8,L1274
+W1275: .dw 1275000,-1275
+B1275: .db 123,-75,7
+L1276: add $5,$6,$7
+    ori $8,-24,$9
+    beq $10,$11,L1276
+    jmp L1277
+    la X4
+    call L1588
+    sw $12,76,$13
+    bne $14,$15,L1275
+W1276: .dw 1276000,-1276
+B1276: .db 124,-76,7
+L1277: add $12,$13,$14
+    ori $15,-23,$16
+    beq $17,$18,L1277
+    jmp L1278
+    la X5
+    call L1601
+    sw $19,77,$20
+    bne $21,$22,L1276
+W1277: .dw 1277000,-1277
+B1277: .db 125,-77,7
+L1278: add $19,$20,$21
+    ori $22,-22,$23
+    beq $24,$25,L1278
+    jmp L1279
+    la X6
+    call L1614
+    sw $26,78,$27
+    bne $28,$29,L1277
+W1278: .dw 1278000,-1278
+B1278: .db 126,-78,7
+L1279: add $26,$27,$28
+    ori $29,-21,$30
+    beq $31,$0,L1279
+    jmp L1280
+    la X7
+    call L1627
+    sw $1,79,$2
+    bne $3,$4,L1278
+W1279: .dw 1279000,-1279
+B1279: .db 127,-79,7
+L1280: add $1,$2,$3
+    ori $4,-20,$5
+    beq $6,$7,L1280
+    jmp L1281
+    la X0
+    call L1640
+    sw $8,80,$9
+    bne $10,$11,L1279
+W1280: .dw 1280000,-1280
+B1280: .db 0,-80,7
+S1280: .asciz "str1280"
+    .dh 1280
+L1281: add $8,$9,$10
+    ori $11,-19,$12
+    beq $13,$14,L1281
+    jmp L1282
+    la X1
+    call L1653
+    sw $15,81,$16
+    bne $17,$18,L1280
+W1281: .dw 1281000,-1281
+B1281: .db 1,-81,7
+L1282: add $15,$16,$17
+    ori $18,-18,$19
+    beq $20,$21,L1282
+    jmp L1283
+    la X2
+    call L1666
+    sw $22,82,$23
+    bne $24,$25,L1281
+W1282: .dw 1282000,-1282
+B1282: .db 2,-82,7
+L1283: add $22,$23,$24
+    ori $25,-17,$26
+    beq $27,$28,L1283
+    jmp L1284
+    la X3
+    call L1679
+    sw $29,83,$30
+    bne $31,$0,L1282
+W1283: .dw 1283000,-1283
+B1283: .db 3,-83,7
+L1284: add $29,$30,$31
+    ori $0,-16,$1
+    beq $2,$3,L1284
+    jmp L1285
+    la X4
+    call L1692
+    sw $4,84,$5
+    bne $6,$7,L1283
+W1284: .dw 1284000,-1284
+B1284: .db 4,-84,7
+L1285: add $4,$5,$6
+    ori $7,-15,$8
+    beq $9,$10,L1285
+    jmp L1286
+    la X5
+    call L1705
+    sw $11,85,$12
+    bne $13,$14,L1284
+W1285: .dw 1285000,-1285
+B1285: .db 5,-85,7
+L1286: add $11,$12,$13
+    ori $14,-14,$15
+    beq $16,$17,L1286
+    jmp L1287
+    la X6
+    call L1718
+    sw $18,86,$19
+    bne $20,$21,L1285
+W1286: .dw 1286000,-1286
+B1286: .db 6,-86,7
+L1287: add $18,$19,$20
+    ori $21,-13,$22
+    beq $23,$24,L1287
+    jmp L1288
+    la X7
+    call L1731
+    sw $25,87,$26
+    bne $27,$28,L1286
+W1287: .dw 1287000,-1287
+B1287: .db 7,-87,7
+L1288: add $25,$26,$27
+    ori $28,-12,$29
+    beq $30,$31,L1288
+    jmp L1289
+    la X0
+    call L1744
+    sw $0,88,$1
+    bne $2,$3,L1287
+W1288: .dw 1288000,-1288
+B1288: .db 8,-88,7
+L1289: add $0,$1,$2
+    ori $3,-11,$4
+    beq $5,$6,L1289
+    jmp L1290
+    la X1
+    call L1757
+    sw $7,89,$8
+    bne $9,$10,L1288
+W1289: .dw 1289000,-1289
+B1289: .db 9,-89,7
+L1290: add $7,$8,$9
+    ori $10,-10,$11
+    beq $12,$13,L1290
+    jmp L1291
+    la X2
+    call L1770
+    sw $14,90,$15
+    bne $16,$17,L1289
+W1290: .dw 1290000,-1290
+B1290: .db 10,-90,7
+S1290: .asciz "str1290"
+    .dh 1290
+L1291: add $14,$15,$16
+    ori $17,-9,$18
+    beq $19,$20,L1291
+    jmp L1292
+    la X3
+    call L1783
+    sw $21,91,$22
+    bne $23,$24,L1290
+W1291: .dw 1291000,-1291
+B1291: .db 11,-91,7
+L1292: add $21,$22,$23
+    ori $24,-8,$25
+    beq $26,$27,L1292
+    jmp L1293
+    la X4
+    call L1796
+    sw $28,92,$29
+    bne $30,$31,L1291
+W1292: .dw 1292000,-1292
+B1292: .db 12,-92,7
+L1293: add $28,$29,$30
+    ori $31,-7,$0
+    beq $1,$2,L1293
+    jmp L1294
+    la X5
+    call L1809
+    sw $3,93,$4
+    bne $5,$6,L1292
+W1293: .dw 1293000,-1293
+B1293: .db 13,-93,7
+L1294: add $3,$4,$5
+    ori $6,-6,$7
+    beq $8,$9,L1294
+    jmp L1295
+    la X6
+    call L1822
+    sw $10,94,$11
+    bne $12,$13,L1293
+W1294: .dw 1294000,-1294
+B1294: .db 14,-94,7
+L1295: add $10,$11,$12
+    ori $13,-5,$14
+    beq $15,$16,L1295
+    jmp L1296
+    la X7
+    call L1835
+    sw $17,95,$18
+    bne $19,$20,L1294
+W1295: .dw 1295000,-1295
+B1295: .db 15,-95,7
+L1296: add $17,$18,$19
+    ori $20,-4,$21
+    beq $22,$23,L1296
+    jmp L1297
+    la X0
+    call L1848
+    sw $24,96,$25
+    bne $26,$27,L1295
+W1296: .dw 1296000,-1296
+B1296: .db 16,-96,7
+L1297: add $24,$25,$26
+    ori $27,-3,$28
+    beq $29,$30,L1297
+    jmp L1298
+    la X1
+    call L1861
+    sw $31,97,$0
+    bne $1,$2,L1296
+W1297: .dw 1297000,-1297
+B1297: .db 17,-97,7
+L1298: add $31,$0,$1
+    ori $2,-2,$3
+    beq $4,$5,L1298
+    jmp L1299
+    la X2
+    call L1874
+    sw $6,98,$7
+    bne $8,$9,L1297
+W1298: .dw 1298000,-1298
+B1298: .db 18,-98,7
+L1299: add $6,$7,$8
+    ori $9,-1,$10
+    beq $11,$12,L1299
+    jmp L1300
+    la X3
+    call L1887
+    sw $13,99,$14
+    bne $15,$16,L1298
+W1299: .dw 1299000,-1299
+B1299: .db 19,-99,7
+L1300: add $13,$14,$15
+    ori $16,0,$17
+    beq $18,$19,L1300
+    jmp L1301
+    la X4
+    call L1900
+    sw $20,0,$21
+    bne $22,$23,L1299
+W1300: .dw 1300000,-1300
+B1300: .db 20,0,7
+S1300: .asciz "str1300"
+    .dh 1300
+.entry L1300
+.entry W1300
+L1301: add $20,$21,$22
+    ori $23,1,$24
+    beq $25,$26,L1301
+    jmp L1302
+    la X5
+    call L1913
+    sw $27,1,$28
+    bne $29,$30,L1300
+W1301: .dw 1301000,-1301
+B1301: .db 21,-1,7
+L1302: add $27,$28,$29
+    ori $30,2,$31
+    beq $0,$1,L1302
+    jmp L1303
+    la X6
+    call L1926
+    sw $2,2,$3
+    bne $4,$5,L1301
+W1302: .dw 1302000,-1302
+B1302: .db 22,-2,7
+L1303: add $2,$3,$4
+    ori $5,3,$6
+    beq $7,$8,L1303
+    jmp L1304
+    la X7
+    call L1939
+    sw $9,3,$10
+    bne $11,$12,L1302
+W1303: .dw 1303000,-1303
+B1303: .db 23,-3,7
+L1304: add $9,$10,$11
+    ori $12,4,$13
+    beq $14,$15,L1304
+    jmp L1305
+    la X0
+    call L1952
+    sw $16,4,$17
+    bne $18,$19,L1303
+W1304: .dw 1304000,-1304
+B1304: .db 24,-4,7
+L1305: add $16,$17,$18
+    ori $19,5,$20
+    beq $21,$22,L1305
+    jmp L1306
+    la X1
+    call L1965
+    sw $23,5,$24
+    bne $25,$26,L1304
+W1305: .dw 1305000,-1305
+B1305: .db 25,-5,7
+L1306: add $23,$24,$25
+    ori $26,6,$27
+    beq $28,$29,L1306
+    jmp L1307
+    la X2
+    call L1978
+    sw $30,6,$31
+    bne $0,$1,L1305
+W1306: .dw 1306000,-1306
+B1306: .db 26,-6,7
+L1307: add $30,$31,$0
+    ori $1,7,$2
+    beq $3,$4,L1307
+    jmp L1308
+    la X3
+    call L1991
+    sw $5,7,$6
+    bne $7,$8,L1306
+W1307: .dw 1307000,-1307
+B1307: .db 27,-7,7
+L1308: add $5,$6,$7
+    ori $8,8,$9
+    beq $10,$11,L1308
+    jmp L1309
+    la X4
+    call L2004
+    sw $12,8,$13
+    bne $14,$15,L1307
+W1308: .dw 1308000,-1308
+B1308: .db 28,-8,7
+L1309: add $12,$13,$14
+    ori $15,9,$16
+    beq $17,$18,L1309
+    jmp L1310
+    la X5
+    call L2017
+    sw $19,9,$20
+    bne $21,$22,L1308
+W1309: .dw 1309000,-1309
+B1309: .db 29,-9,7
+L1310: add $19,$20,$21
+    ori $22,10,$23
+    beq $24,$25,L1310
+    jmp L1311
+    la X6
+    call L2030
+    sw $26,10,$27
+    bne $28,$29,L1309
+W1310: .dw 1310000,-1310
+B1310: .db 30,-10,7
+S1310: .asciz "str1310"
+    .dh 1310
+L1311: add $26,$27,$28
+    ori $29,11,$30
+    beq $31,$0,L1311
+    jmp L1312
+    la X7
+    call L2043
+    sw $1,11,$2
+    bne $3,$4,L1310
+W1311: .dw 1311000,-1311
+B1311: .db 31,-11,7
+L1312: add $1,$2,$3
+    ori $4,12,$5
+    beq $6,$7,L1312
+    jmp L1313
+    la X0
+    call L2056
+    sw $8,12,$9
+    bne $10,$11,L1311
+W1312: .dw 1312000,-1312
+B1312: .db 32,-12,7
+L1313: add $8,$9,$10
+    ori $11,13,$12
+    beq $13,$14,L1313
+    jmp L1314
+    la X1
+    call L2069
+    sw $15,13,$16
+    bne $17,$18,L1312
+W1313: .dw 1313000,-1313
+B1313: .db 33,-13,7
+L1314: add $15,$16,$17
+    ori $18,14,$19
+    beq $20,$21,L1314
+    jmp L1315
+    la X2
+    call L2082
+    sw $22,14,$23
+    bne $24,$25,L1313
+W1314: .dw 1314000,-1314
+B1314: .db 34,-14,7
+L1315: add $22,$23,$24
+    ori $25,15,$26
+    beq $27,$28,L1315
+    jmp L1316
+    la X3
+    call L2095
+    sw $29,15,$30
+    bne $31,$0,L1314
+W1315: .dw 1315000,-1315
+B1315: .db 35,-15,7
+L1316: add $29,$30,$31
+    ori $0,16,$1
+    beq $2,$3,L1316
+    jmp L1317
+    la X4
+    call L2108
+    sw $4,16,$5
+    bne $6,$7,L1315
+W1316: .dw 1316000,-1316
+B1316: .db 36,-16,7
+L1317: add $4,$5,$6
+    ori $7,17,$8
+    beq $9,$10,L1317
+    jmp L1318
+    la X5
+    call L2121
+    sw $11,17,$12
+    bne $13,$14,L1316
+W1317: .dw 1317000,-1317
+B1317: .db 37,-17,7
+L1318: add $11,$12,$13
+    ori $14,18,$15
+    beq $16,$17,L1318
+    jmp L1319
+    la X6
+    call L2134
+    sw $18,18,$19
+    bne $20,$21,L1317
+W1318: .dw 1318000,-1318
+B1318: .db 38,-18,7
+L1319: add $18,$19,$20
+    ori $21,19,$22
+    beq $23,$24,L1319
+    jmp L1320
+    la X7
+    call L2147
+    sw $25,19,$26
+    bne $27,$28,L1318
+W1319: .dw 1319000,-1319
+B1319: .db 39,-19,7
+L1320: add $25,$26,$27
+    ori $28,20,$29
+    beq $30,$31,L1320
+    jmp L1321
+    la X0
+    call L2160
+    sw $0,20,$1
+    bne $2,$3,L1319
+W1320: .dw 1320000,-1320
+B1320: .db 40,-20,7
+S1320: .asciz "str1320"
+    .dh 1320
+L1321: add $0,$1,$2
+    ori $3,21,$4
+    beq $5,$6,L1321
+    jmp L1322
+    la X1
+    call L2173
+    sw $7,21,$8
+    bne $9,$10,L1320
+W1321: .dw 1321000,-1321
+B1321: .db 41,-21,7
+L1322: add $7,$8,$9
+    ori $10,22,$11
+    beq $12,$13,L1322
+    jmp L1323
+    la X2
+    call L2186
+    sw $14,22,$15
+    bne $16,$17,L1321
+W1322: .dw 1322000,-1322
+B1322: .db 42,-22,7
+L1323: add $14,$15,$16
+    ori $17,23,$18
+    beq $19,$20,L1323
+    jmp L1324
+    la X3
+    call L2199
+    sw $21,23,$22
+    bne $23,$24,L1322
+W1323: .dw 1323000,-1323
+B1323: .db 43,-23,7
+L1324: add $21,$22,$23
+    ori $24,24,$25
+    beq $26,$27,L1324
+    jmp L1325
+    la X4
+    call L2212
+    sw $28,24,$29
+    bne $30,$31,L1323
+W1324: .dw 1324000,-1324
+B1324: .db 44,-24,7
+L1325: add $28,$29,$30
+    ori $31,25,$0
+    beq $1,$2,L1325
+    jmp L1326
+    la X5
+    call L2225
+    sw $3,25,$4
+    bne $5,$6,L1324
+W1325: .dw 1325000,-1325
+B1325: .db 45,-25,7
+L1326: add $3,$4,$5
+    ori $6,26,$7
+    beq $8,$9,L1326
+    jmp L1327
+    la X6
+    call L2238
+    sw $10,26,$11
+    bne $12,$13,L1325
+W1326: .dw 1326000,-1326
+B1326: .db 46,-26,7
+L1327: add $10,$11,$12
+    ori $13,27,$14
+    beq $15,$16,L1327
+    jmp L1328
+    la X7
+    call L2251
+    sw $17,27,$18
+    bne $19,$20,L1326
+W1327: .dw 1327000,-1327
+B1327: .db 47,-27,7
+L1328: add $17,$18,$19
+    ori $20,28,$21
+    beq $22,$23,L1328
+    jmp L1329
+    la X0
+    call L2264
+    sw $24,28,$25
+    bne $26,$27,L1327
+W1328: .dw 1328000,-1328
+B1328: .db 48,-28,7
+L1329: add $24,$25,$26
+    ori $27,29,$28
+    beq $29,$30,L1329
+    jmp L1330
+    la X1
+    call L2277
+    sw $31,29,$0
+    bne $1,$2,L1328
+W1329: .dw 1329000,-1329
+B1329: .db 49,-29,7
+L1330: add $31,$0,$1
+    ori $2,30,$3
+    beq $4,$5,L1330
+    jmp L1331
+    la X2
+    call L2290
+    sw $6,30,$7
+    bne $8,$9,L1329
+W1330: .dw 1330000,-1330
+B1330: .db 50,-30,7
+S1330: .asciz "str1330"
+    .dh 1330
+L1331: add $6,$7,$8
+    ori $9,31,$10
+    beq $11,$12,L1331
+    jmp L1332
+    la X3
+    call L2303
+    sw $13,31,$14
+    bne $15,$16,L1330
+W1331: .dw 1331000,-1331
+B1331: .db 51,-31,7
+L1332: add $13,$14,$15
+    ori $16,32,$17
+    beq $18,$19,L1332
+    jmp L1333
+    la X4
+    call L2316
+    sw $20,32,$21
+    bne $22,$23,L1331
+W1332: .dw 1332000,-1332
+B1332: .db 52,-32,7
+L1333: add $20,$21,$22
+    ori $23,33,$24
+    beq $25,$26,L1333
+    jmp L1334
+    la X5
+    call L2329
+    sw $27,33,$28
+    bne $29,$30,L1332
+W1333: .dw 1333000,-1333
+B1333: .db 53,-33,7
+L1334: add $27,$28,$29
+    ori $30,34,$31
+    beq $0,$1,L1334
+    jmp L1335
+    la X6
+    call L2342
+    sw $2,34,$3
+    bne $4,$5,L1333
+W1334: .dw 1334000,-1334
+B1334: .db 54,-34,7
+L1335: add $2,$3,$4
+    ori $5,35,$6
+    beq $7,$8,L1335
+    jmp L1336
+    la X7
+    call L2355
+    sw $9,35,$10
+    bne $11,$12,L1334
+W1335: .dw 1335000,-1335
+B1335: .db 55,-35,7
+L1336: add $9,$10,$11
+    ori $12,36,$13
+    beq $14,$15,L1336
+    jmp L1337
+    la X0
+    call L2368
+    sw $16,36,$17
+    bne $18,$19,L1335
+W1336: .dw 1336000,-1336
+B1336: .db 56,-36,7
+L1337: add $16,$17,$18
+    ori $19,37,$20
+    beq $21,$22,L1337
+    jmp L1338
+    la X1
+    call L2381
+    sw $23,37,$24
+    bne $25,$26,L1336
+W1337: .dw 1337000,-1337
+B1337: .db 57,-37,7
+L1338: add $23,$24,$25
+    ori $26,38,$27
+    beq $28,$29,L1338
+    jmp L1339
+    la X2
+    call L2394
+    sw $30,38,$31
+    bne $0,$1,L1337
+W1338: .dw 1338000,-1338
+B1338: .db 58,-38,7
+L1339: add $30,$31,$0
+    ori $1,39,$2
+    beq $3,$4,L1339
+    jmp L1340
+    la X3
+    call L2407
+    sw $5,39,$6
+    bne $7,$8,L1338
+W1339: .dw 1339000,-1339
+B1339: .db 59,-39,7
+L1340: add $5,$6,$7
+    ori $8,40,$9
+    beq $10,$11,L1340
+    jmp L1341
+    la X4
+    call L2420
+    sw $12,40,$13
+    bne $14,$15,L1339
+W1340: .dw 1340000,-1340
+B1340: .db 60,-40,7
+S1340: .asciz "str1340"
+    .dh 1340
+L1341: add $12,$13,$14
+    ori $15,41,$16
+    beq $17,$18,L1341
+    jmp L1342
+    la X5
+    call L2433
+    sw $19,41,$20
+    bne $21,$22,L1340
+W1341: .dw 1341000,-1341
+B1341: .db 61,-41,7
+L1342: add $19,$20,$21
+    ori $22,42,$23
+    beq $24,$25,L1342
+    jmp L1343
+    la X6
+    call L2446
+    sw $26,42,$27
+    bne $28,$29,L1341
+W1342: .dw 1342000,-1342
+B1342: .db 62,-42,7
+L1343: add $26,$27,$28
+    ori $29,43,$30
+    beq $31,$0,L1343
+    jmp L1344
+    la X7
+    call L2459
+    sw $1,43,$2
+    bne $3,$4,L1342
+W1343: .dw 1343000,-1343
+B1343: .db 63,-43,7
+L1344: add $1,$2,$3
+    ori $4,44,$5
+    beq $6,$7,L1344
+    jmp L1345
+    la X0
+    call L2472
+    sw $8,44,$9
+    bne $10,$11,L1343
+W1344: .dw 1344000,-1344
+B1344: .db 64,-44,7
+L1345: add $8,$9,$10
+    ori $11,45,$12
+    beq $13,$14,L1345
+    jmp L1346
+    la X1
+    call L2485
+    sw $15,45,$16
+    bne $17,$18,L1344
+W1345: .dw 1345000,-1345
+B1345: .db 65,-45,7
+L1346: add $15,$16,$17
+    ori $18,46,$19
+    beq $20,$21,L1346
+    jmp L1347
+    la X2
+    call L2498
+    sw $22,46,$23
+    bne $24,$25,L1345
+W1346: .dw 1346000,-1346
+B1346: .db 66,-46,7
+L1347: add $22,$23,$24
+    ori $25,47,$26
+    beq $27,$28,L1347
+    jmp L1348
+    la X3
+    call L11
+    sw $29,47,$30
+    bne $31,$0,L1346
+W1347: .dw 1347000,-1347
+B1347: .db 67,-47,7
+L1348: add $29,$30,$31
+    ori $0,48,$1
+    beq $2,$3,L1348
+    jmp L1349
+    la X4
+    call L24
+    sw $4,48,$5
+    bne $6,$7,L1347
+W1348: .dw 1348000,-1348
+B1348: .db 68,-48,7
+L1349: add $4,$5,$6
+    ori $7,49,$8
+    beq $9,$10,L1349
+    jmp L1350
+    la X5
+    call L37
+    sw $11,49,$12
+    bne $13,$14,L1348
+W1349: .dw 1349000,-1349
+B1349: .db 69,-49,7
+L1350: add $11,$12,$13
+    ori $14,50,$15
+    beq $16,$17,L1350
+    jmp L1351
+    la X6
+    call L50
+    sw $18,50,$19
+    bne $20,$21,L1349
+W1350: .dw 1350000,-1350
+B1350: .db 70,-50,7
+S1350: .asciz "str1350"
+    .dh 1350
+.entry L1350
+.entry W1350
+L1351: add $18,$19,$20
+    ori $21,51,$22
+    beq $23,$24,L1351
+    jmp L1352
+    la X7
+    call L63
+    sw $25,51,$26
+    bne $27,$28,L1350
+W1351: .dw 1351000,-1351
+B1351: .db 71,-51,7
+L1352: add $25,$26,$27
+    ori $28,52,$29
+    beq $30,$31,L1352
+    jmp L1353
+    la X0
+    call L76
+    sw $0,52,$1
+    bne $2,$3,L1351
+W1352: .dw 1352000,-1352
+B1352: .db 72,-52,7
+L1353: add $0,$1,$2
+    ori $3,53,$4
+    beq $5,$6,L1353
+    jmp L1354
+    la X1
+    call L89
+    sw $7,53,$8
+    bne $9,$10,L1352
+W1353: .dw 1353000,-1353
+B1353: .db 73,-53,7
+L1354: add $7,$8,$9
+    ori $10,54,$11
+    beq $12,$13,L1354
+    jmp L1355
+    la X2
+    call L102
+    sw $14,54,$15
+    bne $16,$17,L1353
+W1354: .dw 1354000,-1354
+B1354: .db 74,-54,7
+L1355: add $14,$15,$16
+    ori $17,55,$18
+    beq $19,$20,L1355
+    jmp L1356
+    la X3
+    call L115
+    sw $21,55,$22
+    bne $23,$24,L1354
+W1355: .dw 1355000,-1355
+B1355: .db 75,-55,7
+L1356: add $21,$22,$23
+    ori $24,56,$25
+    beq $26,$27,L1356
+    jmp L1357
+    la X4
+    call L128
+    sw $28,56,$29
+    bne $30,$31,L1355
+W1356: .dw 1356000,-1356
+B1356: .db 76,-56,7
+L1357: add $28,$29,$30
+    ori $31,57,$0
+    beq $1,$2,L1357
+    jmp L1358
+    la X5
+    call L141
+    sw $3,57,$4
+    bne $5,$6,L1356
+W1357: .dw 1357000,-1357
+B1357: .db 77,-57,7
+L1358: add $3,$4,$5
+    ori $6,58,$7
+    beq $8,$9,L1358
+    jmp L1359
+    la X6
+    call L154
+    sw $10,58,$11
+    bne $12,$13,L1357
+W1358: .dw 1358000,-1358
+B1358: .db 78,-58,7
+L1359: add $10,$11,$12
+    ori $13,59,$14
+    beq $15,$16,L1359
+    jmp L1360
+    la X7
+    call L167
+    sw $17,59,$18
+    bne $19,$20,L1358
+W1359: .dw 1359000,-1359
+B1359: .db 79,-59,7
+L1360: add $17,$18,$19
+    ori $20,60,$21
+    beq $22,$23,L1360
+    jmp L1361
+    la X0
+    call L180
+    sw $24,60,$25
+    bne $26,$27,L1359
+W1360: .dw 1360000,-1360
+B1360: .db 80,-60,7
+S1360: .asciz "str1360"
+    .dh 1360
+L1361: add $24,$25,$26
+    ori $27,61,$28
+    beq $29,$30,L1361
+    jmp L1362
+    la X1
+    call L193
+    sw $31,61,$0
+    bne $1,$2,L1360
+W1361: .dw 1361000,-1361
+B1361: .db 81,-61,7
+L1362: add $31,$0,$1
+    ori $2,62,$3
+    beq $4,$5,L1362
+    jmp L1363
+    la X2
+    call L206
+    sw $6,62,$7
+    bne $8,$9,L1361
+W1362: .dw 1362000,-1362
+B1362: .db 82,-62,7
+L1363: add $6,$7,$8
+    ori $9,63,$10
+    beq $11,$12,L1363
+    jmp L1364
+    la X3
+    call L219
+    sw $13,63,$14
+    bne $15,$16,L1362
+W1363: .dw 1363000,-1363
+B1363: .db 83,-63,7
+L1364: add $13,$14,$15
+    ori $16,64,$17
+    beq $18,$19,L1364
+    jmp L1365
+    la X4
+    call L232
+    sw $20,64,$21
+    bne $22,$23,L1363
+W1364: .dw 1364000,-1364
+B1364: .db 84,-64,7
+L1365: add $20,$21,$22
+    ori $23,65,$24
+    beq $25,$26,L1365
+    jmp L1366
+    la X5
+    call L245
+    sw $27,65,$28
+    bne $29,$30,L1364
+W1365: .dw 1365000,-1365
+B1365: .db 85,-65,7
+L1366: add $27,$28,$29
+    ori $30,66,$31
+    beq $0,$1,L1366
+    jmp L1367
+    la X6
+    call L258
+    sw $2,66,$3
+    bne $4,$5,L1365
+W1366: .dw 1366000,-1366
+B1366: .db 86,-66,7
+L1367: add $2,$3,$4
+    ori $5,67,$6
+    beq $7,$8,L1367
+    jmp L1368
+    la X7
+    call L271
+    sw $9,67,$10
+    bne $11,$12,L1366
+W1367: .dw 1367000,-1367
+B1367: .db 87,-67,7
+L1368: add $9,$10,$11
+    ori $12,68,$13
+    beq $14,$15,L1368
+    jmp L1369
+    la X0
+    call L284
+    sw $16,68,$17
+    bne $18,$19,L1367
+W1368: .dw 1368000,-1368
+B1368: .db 88,-68,7
+L1369: add $16,$17,$18
+    ori $19,69,$20
+    beq $21,$22,L1369
+    jmp L1370
+    la X1
+    call L297
+    sw $23,69,$24
+    bne $25,$26,L1368
+W1369: .dw 1369000,-1369
+B1369: .db 89,-69,7
+L1370: add $23,$24,$25
+    ori $26,70,$27
+    beq $28,$29,L1370
+    jmp L1371
+    la X2
+    call L310
+    sw $30,70,$31
+    bne $0,$1,L1369
+W1370: .dw 1370000,-1370
+B1370: .db 90,-70,7
+S1370: .asciz "str1370"
+    .dh 1370
+L1371: add $30,$31,$0
+    ori $1,71,$2
+    beq $3,$4,L1371
+    jmp L1372
+    la X3
+    call L323
+    sw $5,71,$6
+    bne $7,$8,L1370
+W1371: .dw 1371000,-1371
+B1371: .db 91,-71,7
+L1372: add $5,$6,$7
+    ori $8,72,$9
+    beq $10,$11,L1372
+    jmp L1373
+    la X4
+    call L336
+    sw $12,72,$13
+    bne $14,$15,L1371
+W1372: .dw 1372000,-1372
+B1372: .db 92,-72,7
+L1373: add $12,$13,$14
+    ori $15,73,$16
+    beq $17,$18,L1373
+    jmp L1374
+    la X5
+    call L349
+    sw $19,73,$20
+    bne $21,$22,L1372
+W1373: .dw 1373000,-1373
+B1373: .db 93,-73,7
+L1374: add $19,$20,$21
+    ori $22,74,$23
+    beq $24,$25,L1374
+    jmp L1375
+    la X6
+    call L362
+    sw $26,74,$27
+    bne $28,$29,L1373
+W1374: .dw 1374000,-1374
+B1374: .db 94,-74,7
+L1375: add $26,$27,$28
+    ori $29,75,$30
+    beq $31,$0,L1375
+    jmp L1376
+    la X7
+    call L375
+    sw $1,75,$2
+    bne $3,$4,L1374
+W1375: .dw 1375000,-1375
+B1375: .db 95,-75,7
+L1376: add $1,$2,$3
+    ori $4,76,$5
+    beq $6,$7,L1376
+    jmp L1377
+    la X0
+    call L388
+    sw $8,76,$9
+    bne $10,$11,L1375
+W1376: .dw 1376000,-1376
+B1376: .db 96,-76,7
+L1377: add $8,$9,$10
+    ori $11,77,$12
+    beq $13,$14,L1377
+    jmp L1378
+    la X1
+    call L401
+    sw $15,77,$16
+    bne $17,$18,L1376
+W1377: .dw 1377000,-1377
+B1377: .db 97,-77,7
+L1378: add $15,$16,$17
+    ori $18,78,$19
+    beq $20,$21,L1378
+    jmp L1379
+    la X2
+    call L414
+    sw $22,78,$23
+    bne $24,$25,L1377
+W1378: .dw 1378000,-1378
+B1378: .db 98,-78,7
+L1379: add $22,$23,$24
+    ori $25,79,$26
+    beq $27,$28,L1379
+    jmp L1380
+    la X3
+    call L427
+    sw $29,79,$30
+    bne $31,$0,L1378
+W1379: .dw 1379000,-1379
+B1379: .db 99,-79,7
+L1380: add $29,$30,$31
+    ori $0,80,$1
+    beq $2,$3,L1380
+    jmp L1381
+    la X4
+    call L440
+    sw $4,80,$5
+    bne $6,$7,L1379
+W1380: .dw 1380000,-1380
+B1380: .db 100,-80,7
+S1380: .asciz "str1380"
+    .dh 1380
+L1381: add $4,$5,$6
+    ori $7,81,$8
+    beq $9,$10,L1381
+    jmp L1382
+    la X5
+    call L453
+    sw $11,81,$12
+    bne $13,$14,L1380
+W1381: .dw 1381000,-1381
+B1381: .db 101,-81,7
+L1382: add $11,$12,$13
+    ori $14,82,$15
+    beq $16,$17,L1382
+    jmp L1383
+    la X6
+    call L466
+    sw $18,82,$19
+    bne $20,$21,L1381
+W1382: .dw 1382000,-1382
+B1382: .db 102,-82,7
+L1383: add $18,$19,$20
+    ori $21,83,$22
+    beq $23,$24,L1383
+    jmp L1384
+    la X7
+    call L479
+    sw $25,83,$26
+    bne $27,$28,L1382
+W1383: .dw 1383000,-1383
+B1383: .db 103,-83,7
+L1384: add $25,$26,$27
+    ori $28,84,$29
+    beq $30,$31,L1384
+    jmp L1385
+    la X0
+    call L492
+    sw $0,84,$1
+    bne $2,$3,L1383
+W1384: .dw 1384000,-1384
+B1384: .db 104,-84,7
+L1385: add $0,$1,$2
+    ori $3,85,$4
+    beq $5,$6,L1385
+    jmp L1386
+    la X1
+    call L505
+    sw $7,85,$8
+    bne $9,$10,L1384
+W1385: .dw 1385000,-1385
+B1385: .db 105,-85,7
+L1386: add $7,$8,$9
+    ori $10,86,$11
+    beq $12,$13,L1386
+    jmp L1387
+    la X2
+    call L518
+    sw $14,86,$15
+    bne $16,$17,L1385
+W1386: .dw 1386000,-1386
+B1386: .db 106,-86,7
+L1387: add $14,$15,$16
+    ori $17,87,$18
+    beq $19,$20,L1387
+    jmp L1388
+    la X3
+    call L531
+    sw $21,87,$22
+    bne $23,$24,L1386
+W1387: .dw 1387000,-1387
+B1387: .db 107,-87,7
+L1388: add $21,$22,$23
+    ori $24,88,$25
+    beq $26,$27,L1388
+    jmp L1389
+    la X4
+    call L544
+    sw $28,88,$29
+    bne $30,$31,L1387
+W1388: .dw 1388000,-1388
+B1388: .db 108,-88,7
+L1389: add $28,$29,$30
+    ori $31,89,$0
+    beq $1,$2,L1389
+    jmp L1390
+    la X5
+    call L557
+    sw $3,89,$4
+    bne $5,$6,L1388
+W1389: .dw 1389000,-1389
+B1389: .db 109,-89,7
+L1390: add $3,$4,$5
+    ori $6,90,$7
+    beq $8,$9,L1390
+    jmp L1391
+    la X6
+    call L570
+    sw $10,90,$11
+    bne $12,$13,L1389
+W1390: .dw 1390000,-1390
+B1390: .db 110,-90,7
+S1390: .asciz "str1390"
+    .dh 1390
+L1391: add $10,$11,$12
+    ori $13,91,$14
+    beq $15,$16,L1391
+    jmp L1392
+    la X7
+    call L583
+    sw $17,91,$18
+    bne $19,$20,L1390
+W1391: .dw 1391000,-1391
+B1391: .db 111,-91,7
+L1392: add $17,$18,$19
+    ori $20,92,$21
+    beq $22,$23,L1392
+    jmp L1393
+    la X0
+    call L596
+    sw $24,92,$25
+    bne $26,$27,L1391
+W1392: .dw 1392000,-1392
+B1392: .db 112,-92,7
+L1393: add $24,$25,$26
+    ori $27,93,$28
+    beq $29,$30,L1393
+    jmp L1394
+    la X1
+    call L609
+    sw $31,93,$0
+    bne $1,$2,L1392
+W1393: .dw 1393000,-1393
+B1393: .db 113,-93,7
+L1394: add $31,$0,$1
+    ori $2,94,$3
+    beq $4,$5,L1394
+    jmp L1395
+    la X2
+    call L622
+    sw $6,94,$7
+    bne $8,$9,L1393
+W1394: .dw 1394000,-1394
+B1394: .db 114,-94,7
+L1395: add $6,$7,$8
+    ori $9,95,$10
+    beq $11,$12,L1395
+    jmp L1396
+    la X3
+    call L635
+    sw $13,95,$14
+    bne $15,$16,L1394
+W1395: .dw 1395000,-1395
+B1395: .db 115,-95,7
+L1396: add $13,$14,$15
+    ori $16,96,$17
+    beq $18,$19,L1396
+    jmp L1397
+    la X4
+    call L648
+    sw $20,96,$21
+    bne $22,$23,L1395
+W1396: .dw 1396000,-1396
+B1396: .db 116,-96,7
+L1397: add $20,$21,$22
+    ori $23,97,$24
+    beq $25,$26,L1397
+    jmp L1398
+    la X5
+    call L661
+    sw $27,97,$28
+    bne $29,$30,L1396
+W1397: .dw 1397000,-1397
+B1397: .db 117,-97,7
+L1398: add $27,$28,$29
+    ori $30,98,$31
+    beq $0,$1,L1398
+    jmp L1399
+    la X6
+    call L674
+    sw $2,98,$3
+    bne $4,$5,L1397
+W1398: .dw 1398000,-1398
+B1398: .db 118,-98,7
+L1399: add $2,$3,$4
+    ori $5,99,$6
+    beq $7,$8,L1399
+    jmp L1400
+    la X7
+    call L687
+    sw $9,99,$10
+    bne $11,$12,L1398
+W1399: .dw 1399000,-1399
+B1399: .db 119,-99,7
+L1400: add $9,$10,$11
+    ori $12,-100,$13
+    beq $14,$15,L1400
+    jmp L1401
+    la X0
+    call L700
+    sw $16,0,$17
+    bne $18,$19,L1399
+W1400: .dw 1400000,-1400
+B1400: .db 120,0,7
+S1400: .asciz "str1400"
+    .dh 1400
+.entry L1400
+.entry W1400
+L1401: add $16,$17,$18
+    ori $19,-99,$20
+    beq $21,$22,L1401
+    jmp L1402
+    la X1
+    call L713
+    sw $23,1,$24
+    bne $25,$26,L1400
+W1401: .dw 1401000,-1401
+B1401: .db 121,-1,7
+L1402: add $23,$24,$25
+    ori $26,-98,$27
+    beq $28,$29,L1402
+    jmp L1403
+    la X2
+    call L726
+    sw $30,2,$31
+    bne $0,$1,L1401
+W1402: .dw 1402000,-1402
+B1402: .db 122,-2,7
+L1403: add $30,$31,$0
+    ori $1,-97,$2
+    beq $3,$4,L1403
+    jmp L1404
+    la X3
+    call L739
+    sw $5,3,$6
+    bne $7,$8,L1402
+W1403: .dw 1403000,-1403
+B1403: .db 123,-3,7
+L1404: add $5,$6,$7
+    ori $8,-96,$9
+    beq $10,$11,L1404
+    jmp L1405
+    la X4
+    call L752
+    sw $12,4,$13
+    bne $14,$15,L1403
+W1404: .dw 1404000,-1404
+B1404: .db 124,-4,7
+L1405: add $12,$13,$14
+    ori $15,-95,$16
+    beq $17,$18,L1405
+    jmp L1406
+    la X5
+    call L765
+    sw $19,5,$20
+    bne $21,$22,L1404
+W1405: .dw 1405000,-1405
+B1405: .db 125,-5,7
+L1406: add $19,$20,$21
+    ori $22,-94,$23
+    beq $24,$25,L1406
+    jmp L1407
+    la X6
+    call L778
+    sw $26,6,$27
+    bne $28,$29,L1405
+W1406: .dw 1406000,-1406
+B1406: .db 126,-6,7
+L1407: add $26,$27,$28
+    ori $29,-93,$30
+    beq $31,$0,L1407
+    jmp L1408
+    la X7
+    call L791
+    sw $1,7,$2
+    bne $3,$4,L1406
+W1407: .dw 1407000,-1407
+B1407: .db 127,-7,7
+L1408: add $1,$2,$3
+    ori $4,-92,$5
+    beq $6,$7,L1408
+    jmp L1409
+    la X0
+    call L804
+    sw $8,8,$9
+    bne $10,$11,L1407
+W1408: .dw 1408000,-1408
+B1408: .db 0,-8,7
+L1409: add $8,$9,$10
+    ori $11,-91,$12
+    beq $13,$14,L1409
+    jmp L1410
+    la X1
+    call L817
+    sw $15,9,$16
+    bne $17,$18,L1408
+W1409: .dw 1409000,-1409
+B1409: .db 1,-9,7
+L1410: add $15,$16,$17
+    ori $18,-90,$19
+    beq $20,$21,L1410
+    jmp L1411
+    la X2
+    call L830
+    sw $22,10,$23
+    bne $24,$25,L1409
+W1410: .dw 1410000,-1410
+B1410: .db 2,-10,7
+S1410: .asciz "str1410"
+    .dh 1410
+L1411: add $22,$23,$24
+    ori $25,-89,$26
+    beq $27,$28,L1411
+    jmp L1412
+    la X3
+    call L843
+    sw $29,11,$30
+    bne $31,$0,L1410
+W1411: .dw 1411000,-1411
+B1411: .db 3,-11,7
+L1412: add $29,$30,$31
+    ori $0,-88,$1
+    beq $2,$3,L1412
+    jmp L1413
+    la X4
+    call L856
+    sw $4,12,$5
+    bne $6,$7,L1411
+W1412: .dw 1412000,-1412
+B1412: .db 4,-12,7
+L1413: add $4,$5,$6
+    ori $7,-87,$8
+    beq $9,$10,L1413
+    jmp L1414
+    la X5
+    call L869
+    sw $11,13,$12
+    bne $13,$14,L1412
+W1413: .dw 1413000,-1413
+B1413: .db 5,-13,7
+L1414: add $11,$12,$13
+    ori $14,-86,$15
+    beq $16,$17,L1414
+    jmp L1415
+    la X6
+    call L882
+    sw $18,14,$19
+    bne $20,$21,L1413
+W1414: .dw 1414000,-1414
+B1414: .db 6,-14,7
+L1415: add $18,$19,$20
+    ori $21,-85,$22
+    beq $23,$24,L1415
+    jmp L1416
+    la X7
+    call L895
+    sw $25,15,$26
+    bne $27,$28,L1414
+W1415: .dw 1415000,-1415
+B1415: .db 7,-15,7
+L1416: add $25,$26,$27
+    ori $28,-84,$29
+    beq $30,$31,L1416
+    jmp L1417
+    la X0
+    call L908
+    sw $0,16,$1
+    bne $2,$3,L1415
+W1416: .dw 1416000,-1416
+B1416: .db 8,-16,7
+L1417: add $0,$1,$2
+    ori $3,-83,$4
+    beq $5,$6,L1417
+    jmp L1418
+    la X1
+    call L921
+    sw $7,17,$8
+    bne $9,$10,L1416
+W1417: .dw 1417000,-1417
+B1417: .db 9,-17,7
+L1418: add $7,$8,$9
+    ori $10,-82,$11
+    beq $12,$13,L1418
+    jmp L1419
+    la X2
+    call L934
+    sw $14,18,$15
+    bne $16,$17,L1417
+W1418: .dw 1418000,-1418
+B1418: .db 10,-18,7
+L1419: add $14,$15,$16
+    ori $17,-81,$18
+    beq $19,$20,L1419
+    jmp L1420
+    la X3
+    call L947
+    sw $21,19,$22
+    bne $23,$24,L1418
+W1419: .dw 1419000,-1419
+B1419: .db 11,-19,7
+L1420: add $21,$22,$23
+    ori $24,-80,$25
+    beq $26,$27,L1420
+    jmp L1421
+    la X4
+    call L960
+    sw $28,20,$29
+    bne $30,$31,L1419
+W1420: .dw 1420000,-1420
+B1420: .db 12,-20,7
+S1420: .asciz "str1420"
+    .dh 1420
+L1421: add $28,$29,$30
+    ori $31,-79,$0
+    beq $1,$2,L1421
+    jmp L1422
+    la X5
+    call L973
+    sw $3,21,$4
+    bne $5,$6,L1420
+W1421: .dw 1421000,-1421
+B1421: .db 13,-21,7
+L1422: add $3,$4,$5
+    ori $6,-78,$7
+    beq $8,$9,L1422
+    jmp L1423
+    la X6
+    call L986
+    sw $10,22,$11
+    bne $12,$13,L1421
+W1422: .dw 1422000,-1422
+B1422: .db 14,-22,7
+L1423: add $10,$11,$12
+    ori $13,-77,$14
+    beq $15,$16,L1423
+    jmp L1424
+    la X7
+    call L999
+    sw $17,23,$18
+    bne $19,$20,L1422
+W1423: .dw 1423000,-1423
+B1423: .db 15,-23,7
+L1424: add $17,$18,$19
+    ori $20,-76,$21
+    beq $22,$23,L1424
+    jmp L1425
+    la X0
+    call L1012
+    sw $24,24,$25
+    bne $26,$27,L1423
+W1424: .dw 1424000,-1424
+B1424: .db 16,-24,7
+L1425: add $24,$25,$26
+    ori $27,-75,$28
+    beq $29,$30,L1425
+    jmp L1426
+    la X1
+    call L1025
+    sw $31,25,$0
+    bne $1,$2,L1424
+W1425: .dw 1425000,-1425
+B1425: .db 17,-25,7
+L1426: add $31,$0,$1
+    ori $2,-74,$3
+    beq $4,$5,L1426
+    jmp L1427
+    la X2
+    call L1038
+    sw $6,26,$7
+    bne $8,$9,L1425
+W1426: .dw 1426000,-1426
+B1426: .db 18,-26,7
+L1427: add $6,$7,$8
+    ori $9,-73,$10
+    beq $11,$12,L1427
+    jmp L1428
+    la X3
+    call L1051
+    sw $13,27,$14
+    bne $15,$16,L1426
+W1427: .dw 1427000,-1427
+B1427: .db 19,-27,7
+L1428: add $13,$14,$15
+    ori $16,-72,$17
+    beq $18,$19,L1428
+    jmp L1429
+    la X4
+    call L1064
+    sw $20,28,$21
+    bne $22,$23,L1427
+W1428: .dw 1428000,-1428
+B1428: .db 20,-28,7
+L1429: add $20,$21,$22
+    ori $23,-71,$24
+    beq $25,$26,L1429
+    jmp L1430
+    la X5
+    call L1077
+    sw $27,29,$28
+    bne $29,$30,L1428
+W1429: .dw 1429000,-1429
+B1429: .db 21,-29,7
+L1430: add $27,$28,$29
+    ori $30,-70,$31
+    beq $0,$1,L1430
+    jmp L1431
+    la X6
+    call L1090
+    sw $2,30,$3
+    bne $4,$5,L1429
+W1430: .dw 1430000,-1430
+B1430: .db 22,-30,7
+S1430: .asciz "str1430"
+    .dh 1430
+L1431: add $2,$3,$4
+    ori $5,-69,$6
+    beq $7,$8,L1431
+    jmp L1432
+    la X7
+    call L1103
+    sw $9,31,$10
+    bne $11,$12,L1430
+W1431: .dw 1431000,-1431
+B1431: .db 23,-31,7
+L1432: add $9,$10,$11
+    ori $12,-68,$13
+    beq $14,$15,L1432
+    jmp L1433
+    la X0
+    call L1116
+    sw $16,32,$17
+    bne $18,$19,L1431
+W1432: .dw 1432000,-1432
+B1432: .db 24,-32,7
+L1433: add $16,$17,$18
+    ori $19,-67,$20
+    beq $21,$22,L1433
+    jmp L1434
+    la X1
+    call L1129
+    sw $23,33,$24
+    bne $25,$26,L1432
+W1433: .dw 1433000,-1433
+B1433: .db 25,-33,7
+L1434: add $23,$24,$25
+    ori $26,-66,$27
+    beq $28,$29,L1434
+    jmp L1435
+    la X2
+    call L1142
+    sw $30,34,$31
+    bne $0,$1,L1433
+W1434: .dw 1434000,-1434
+B1434: .db 26,-34,7
+L1435: add $30,$31,$0
+    ori $1,-65,$2
+    beq $3,$4,L1435
+    jmp L1436
+    la X3
+    call L1155
+    sw $5,35,$6
+    bne $7,$8,L1434
+W1435: .dw 1435000,-1435
+B1435: .db 27,-35,7
+L1436: add $5,$6,$7
+    ori $8,-64,$9
+    beq $10,$11,L1436
+    jmp L1437
+    la X4
+    call L1168
+    sw $12,36,$13
+    bne $14,$15,L1435
+W1436: .dw 1436000,-1436
+B1436: .db 28,-36,7
+L1437: add $12,$13,$14
+    ori $15,-63,$16
+    beq $17,$18,L1437
+    jmp L1438
+    la X5
+    call L1181
+    sw $19,37,$20
+    bne $21,$22,L1436
+W1437: .dw 1437000,-1437
+B1437: .db 29,-37,7
+L1438: add $19,$20,$21
+    ori $22,-62,$23
+    beq $24,$25,L1438
+    jmp L1439
+    la X6
+    call L1194
+    sw $26,38,$27
+    bne $28,$29,L1437
+W1438: .dw 1438000,-1438
+B1438: .db 30,-38,7
+L1439: add $26,$27,$28
+    ori $29,-61,$30
+    beq $31,$0,L1439
+    jmp L1440
+    la X7
+    call L1207
+    sw $1,39,$2
+    bne $3,$4,L1438
+W1439: .dw 1439000,-1439
+B1439: .db 31,-39,7
+L1440: add $1,$2,$3
+    ori $4,-60,$5
+    beq $6,$7,L1440
+    jmp L1441
+    la X0
+    call L1220
+    sw $8,40,$9
+    bne $10,$11,L1439
+W1440: .dw 1440000,-1440
+B1440: .db 32,-40,7
+S1440: .asciz "str1440"
+    .dh 1440
+L1441: add $8,$9,$10
+    ori $11,-59,$12
+    beq $13,$14,L1441
+    jmp L1442
+    la X1
+    call L1233
+    sw $15,41,$16
+    bne $17,$18,L1440
+W1441: .dw 1441000,-1441
+B1441: .db 33,-41,7
+L1442: add $15,$16,$17
+    ori $18,-58,$19
+    beq $20,$21,L1442
+    jmp L1443
+    la X2
+    call L1246
+    sw $22,42,$23
+    bne $24,$25,L1441
+W1442: .dw 1442000,-1442
+B1442: .db 34,-42,7
+L1443: add $22,$23,$24
+    ori $25,-57,$26
+    beq $27,$28,L1443
+    jmp L1444
+    la X3
+    call L1259
+    sw $29,43,$30
+    bne $31,$0,L1442
+W1443: .dw 1443000,-1443
+B1443: .db 35,-43,7
+L1444: add $29,$30,$31
+    ori $0,-56,$1
+    beq $2,$3,L1444
+    jmp L1445
+    la X4
+    call L1272
+    sw $4,44,$5
+    bne $6,$7,L1443
+W1444: .dw 1444000,-1444
+B1444: .db 36,-44,7
+L1445: add $4,$5,$6
+    ori $7,-55,$8
+    beq $9,$10,L1445
+    jmp L1446
+    la X5
+    call L1285
+    sw $11,45,$12
+    bne $13,$14,L1444
+W1445: .dw 1445000,-1445
+B1445: .db 37,-45,7
+L1446: add $11,$12,$13
+    ori $14,-54,$15
+    beq $16,$17,L1446
+    jmp L1447
+    la X6
+    call L1298
+    sw $18,46,$19
+    bne $20,$21,L1445
+W1446: .dw 1446000,-1446
+B1446: .db 38,-46,7
+L1447: add $18,$19,$20
+    ori $21,-53,$22
+    beq $23,$24,L1447
+    jmp L1448
+    la X7
+    call L1311
+    sw $25,47,$26
+    bne $27,$28,L1446
+W1447: .dw 1447000,-1447
+B1447: .db 39,-47,7
+L1448: add $25,$26,$27
+    ori $28,-52,$29
+    beq $30,$31,L1448
+    jmp L1449
+    la X0
+    call L1324
+    sw $0,48,$1
+    bne $2,$3,L1447
+W1448: .dw 1448000,-1448
+B1448: .db 40,-48,7
+L1449: add $0,$1,$2
+    ori $3,-51,$4
+    beq $5,$6,L1449
+    jmp L1450
+    la X1
+    call L1337
+    sw $7,49,$8
+    bne $9,$10,L1448
+W1449: .dw 1449000,-1449
+B1449: .db 41,-49,7
+L1450: add $7,$8,$9
+    ori $10,-50,$11
+    beq $12,$13,L1450
+    jmp L1451
+    la X2
+    call L1350
+    sw $14,50,$15
+    bne $16,$17,L1449
+W1450: .dw 1450000,-1450
+B1450: .db 42,-50,7
+S1450: .asciz "str1450"
+    .dh 1450
+.entry L1450
+.entry W1450
+L1451: add $14,$15,$16
+    ori $17,-49,$18
+    beq $19,$20,L1451
+    jmp L1452
+    la X3
+    call L1363
+    sw $21,51,$22
+    bne $23,$24,L1450
+W1451: .dw 1451000,-1451
+B1451: .db 43,-51,7
+L1452: add $21,$22,$23
+    ori $24,-48,$25
+    beq $26,$27,L1452
+    jmp L1453
+    la X4
+    call L1376
+    sw $28,52,$29
+    bne $30,$31,L1451
+W1452: .dw 1452000,-1452
+B1452: .db 44,-52,7
+L1453: add $28,$29,$30
+    ori $31,-47,$0
+    beq $1,$2,L1453
+    jmp L1454
+    la X5
+    call L1389
+    sw $3,53,$4
+    bne $5,$6,L1452
+W1453: .dw 1453000,-1453
+B1453: .db 45,-53,7
+L1454: add $3,$4,$5
+    ori $6,-46,$7
+    beq $8,$9,L1454
+    jmp L1455
+    la X6
+    call L1402
+    sw $10,54,$11
+    bne $12,$13,L1453
+W1454: .dw 1454000,-1454
+B1454: .db 46,-54,7
+L1455: add $10,$11,$12
+    ori $13,-45,$14
+    beq $15,$16,L1455
+    jmp L1456
+    la X7
+    call L1415
+    sw $17,55,$18
+    bne $19,$20,L1454
+W1455: .dw 1455000,-1455
+B1455: .db 47,-55,7
+L1456: add $17,$18,$19
+    ori $20,-44,$21
+    beq $22,$23,L1456
+    jmp L1457
+    la X0
+    call L1428
+    sw $24,56,$25
+    bne $26,$27,L1455
+W1456: .dw 1456000,-1456
+B1456: .db 48,-56,7
+L1457: add $24,$25,$26
+    ori $27,-43,$28
+    beq $29,$30,L1457
+    jmp L1458
+    la X1
+    call L1441
+    sw $31,57,$0
+    bne $1,$2,L1456
+W1457: .dw 1457000,-1457
+B1457: .db 49,-57,7
+L1458: add $31,$0,$1
+    ori $2,-42,$3
+    beq $4,$5,L1458
+    jmp L1459
+    la X2
+    call L1454
+    sw $6,58,$7
+    bne $8,$9,L1457
+W1458: .dw 1458000,-1458
+B1458: .db 50,-58,7
+L1459: add $6,$7,$8
+    ori $9,-41,$10
+    beq $11,$12,L1459
+    jmp L1460
+    la X3
+    call L1467
+    sw $13,59,$14
+    bne $15,$16,L1458
+W1459: .dw 1459000,-1459
+B1459: .db 51,-59,7
+L1460: add $13,$14,$15
+    ori $16,-40,$17
+    beq $18,$19,L1460
+    jmp L1461
+    la X4
+    call L1480
+    sw $20,60,$21
+    bne $22,$23,L1459
+W1460: .dw 1460000,-1460
+B1460: .db 52,-60,7
+S1460: .asciz "str1460"
+    .dh 1460
+L1461: add $20,$21,$22
+    ori $23,-39,$24
+    beq $25,$26,L1461
+    jmp L1462
+    la X5
+    call L1493
+    sw $27,61,$28
+    bne $29,$30,L1460
+W1461: .dw 1461000,-1461
+B1461: .db 53,-61,7
+L1462: add $27,$28,$29
+    ori $30,-38,$31
+    beq $0,$1,L1462
+    jmp L1463
+    la X6
+    call L1506
+    sw $2,62,$3
+    bne $4,$5,L1461
+W1462: .dw 1462000,-1462
+B1462: .db 54,-62,7
+L1463: add $2,$3,$4
+    ori $5,-37,$6
+    beq $7,$8,L1463
+    jmp L1464
+    la X7
+    call L1519
+    sw $9,63,$10
+    bne $11,$12,L1462
+W1463: .dw 1463000,-1463
+B1463: .db 55,-63,7
+L1464: add $9,$10,$11
+    ori $12,-36,$13
+    beq $14,$15,L1464
+    jmp L1465
+    la X0
+    call L1532
+    sw $16,64,$17
+    bne $18,$19,L1463
+W1464: .dw 1464000,-1464
+B1464: .db 56,-64,7
+L1465: add $16,$17,$18
+    ori $19,-35,$20
+    beq $21,$22,L1465
+    jmp L1466
+    la X1
+    call L1545
+    sw $23,65,$24
+    bne $25,$26,L1464
+W1465: .dw 1465000,-1465
+B1465: .db 57,-65,7
+L1466: add $23,$24,$25
+    ori $26,-34,$27
+    beq $28,$29,L1466
+    jmp L1467
+    la X2
+    call L1558
+    sw $30,66,$31
+    bne $0,$1,L1465
+W1466: .dw 1466000,-1466
+B1466: .db 58,-66,7
+L1467: add $30,$31,$0
+    ori $1,-33,$2
+    beq $3,$4,L1467
+    jmp L1468
+    la X3
+    call L1571
+    sw $5,67,$6
+    bne $7,$8,L1466
+W1467: .dw 1467000,-1467
+B1467: .db 59,-67,7
+L1468: add $5,$6,$7
+    ori $8,-32,$9
+    beq $10,$11,L1468
+    jmp L1469
+    la X4
+    call L1584
+    sw $12,68,$13
+    bne $14,$15,L1467
+W1468: .dw 1468000,-1468
+B1468: .db 60,-68,7
+L1469: add $12,$13,$14
+    ori $15,-31,$16
+    beq $17,$18,L1469
+    jmp L1470
+    la X5
+    call L1597
+    sw $19,69,$20
+    bne $21,$22,L1468
+W1469: .dw 1469000,-1469
+B1469: .db 61,-69,7
+L1470: add $19,$20,$21
+    ori $22,-30,$23
+    beq $24,$25,L1470
+    jmp L1471
+    la X6
+    call L1610
+    sw $26,70,$27
+    bne $28,$29,L1469
+W1470: .dw 1470000,-1470
+B1470: .db 62,-70,7
+S1470: .asciz "str1470"
+    .dh 1470
+L1471: add $26,$27,$28
+    ori $29,-29,$30
+    beq $31,$0,L1471
+    jmp L1472
+    la X7
+    call L1623
+    sw $1,71,$2
+    bne $3,$4,L1470
+W1471: .dw 1471000,-1471
+B1471: .db 63,-71,7
+L1472: add $1,$2,$3
+    ori $4,-28,$5
+    beq $6,$7,L1472
+    jmp L1473
+    la X0
+    call L1636
+    sw $8,72,$9
+    bne $10,$11,L1471
+W1472: .dw 1472000,-1472
+B1472: .db 64,-72,7
+L1473: add $8,$9,$10
+    ori $11,-27,$12
+    beq $13,$14,L1473
+    jmp L1474
+    la X1
+    call L1649
+    sw $15,73,$16
+    bne $17,$18,L1472
+W1473: .dw 1473000,-1473
+B1473: .db 65,-73,7
+L1474: add $15,$16,$17
+    ori $18,-26,$19
+    beq $20,$21,L1474
+    jmp L1475
+    la X2
+    call L1662
+    sw $22,74,$23
+    bne $24,$25,L1473
+W1474: .dw 1474000,-1474
+B1474: .db 66,-74,7
+L1475: add $22,$23,$24
+    ori $25,-25,$26
+    beq $27,$28,L1475
+    jmp L1476
+    la X3
+    call L1675
+    sw $29,75,$30
+    bne $31,$0,L1474
+W1475: .dw 1475000,-1475
+B1475: .db 67,-75,7
+L1476: add $29,$30,$31
+    ori $0,-24,$1
+    beq $2,$3,L1476
+    jmp L1477
+    la X4
+    call L1688
+    sw $4,76,$5
+    bne $6,$7,L1475
+W1476: .dw 1476000,-1476
+B1476: .db 68,-76,7
+L1477: add $4,$5,$6
+    ori $7,-23,$8
+    beq $9,$10,L1477
+    jmp L1478
+    la X5
+    call L1701
+    sw $11,77,$12
+    bne $13,$14,L1476
+W1477: .dw 1477000,-1477
+B1477: .db 69,-77,7
+L1478: add $11,$12,$13
+    ori $14,-22,$15
+    beq $16,$17,L1478
+    jmp L1479
+    la X6
+    call L1714
+    sw $18,78,$19
+    bne $20,$21,L1477
+W1478: .dw 1478000,-1478
+B1478: .db 70,-78,7
+L1479: add $18,$19,$20
+    ori $21,-21,$22
+    beq $23,$24,L1479
+    jmp L1480
+    la X7
+    call L1727
+    sw $25,79,$26
+    bne $27,$28,L1478
+W1479: .dw 1479000,-1479
+B1479: .db 71,-79,7
+L1480: add $25,$26,$27
+    ori $28,-20,$29
+    beq $30,$31,L1480
+    jmp L1481
+    la X0
+    call L1740
+    sw $0,80,$1
+    bne $2,$3,L1479
+W1480: .dw 1480000,-1480
+B1480: .db 72,-80,7
+S1480: .asciz "str1480"
+    .dh 1480
+L1481: add $0,$1,$2
+    ori $3,-19,$4
+    beq $5,$6,L1481
+    jmp L1482
+    la X1
+    call L1753
+    sw $7,81,$8
+    bne $9,$10,L1480
+W1481: .dw 1481000,-1481
+B1481: .db 73,-81,7
+L1482: add $7,$8,$9
+    ori $10,-18,$11
+    beq $12,$13,L1482
+    jmp L1483
+    la X2
+    call L1766
+    sw $14,82,$15
+    bne $16,$17,L1481
+W1482: .dw 1482000,-1482
+B1482: .db 74,-82,7
+L1483: add $14,$15,$16
+    ori $17,-17,$18
+    beq $19,$20,L1483
+    jmp L1484
+    la X3
+    call L1779
+    sw $21,83,$22
+    bne $23,$24,L1482
+W1483: .dw 1483000,-1483
+B1483: .db 75,-83,7
+L1484: add $21,$22,$23
+    ori $24,-16,$25
+    beq $26,$27,L1484
+    jmp L1485
+    la X4
+    call L1792
+    sw $28,84,$29
+    bne $30,$31,L1483
+W1484: .dw 1484000,-1484
+B1484: .db 76,-84,7
+L1485: add $28,$29,$30
+    ori $31,-15,$0
+    beq $1,$2,L1485
+    jmp L1486
+    la X5
+    call L1805
+    sw $3,85,$4
+    bne $5,$6,L1484
+W1485: .dw 1485000,-1485
+B1485: .db 77,-85,7
+L1486: add $3,$4,$5
+    ori $6,-14,$7
+    beq $8,$9,L1486
+    jmp L1487
+    la X6
+    call L1818
+    sw $10,86,$11
+    bne $12,$13,L1485
+W1486: .dw 1486000,-1486
+B1486: .db 78,-86,7
+L1487: add $10,$11,$12
+    ori $13,-13,$14
+    beq $15,$16,L1487
+    jmp L1488
+    la X7
+    call L1831
+    sw $17,87,$18
+    bne $19,$20,L1486
+W1487: .dw 1487000,-1487
+B1487: .db 79,-87,7
+L1488: add $17,$18,$19
+    ori $20,-12,$21
+    beq $22,$23,L1488
+    jmp L1489
+    la X0
+    call L1844
+    sw $24,88,$25
+    bne $26,$27,L1487
+W1488: .dw 1488000,-1488
+B1488: .db 80,-88,7
+L1489: add $24,$25,$26
+    ori $27,-11,$28
+    beq $29,$30,L1489
+    jmp L1490
+    la X1
+    call L1857
+    sw $31,89,$0
+    bne $1,$2,L1488
+W1489: .dw 1489000,-1489
+B1489: .db 81,-89,7
+L1490: add $31,$0,$1
+    ori $2,-10,$3
+    beq $4,$5,L1490
+    jmp L1491
+    la X2
+    call L1870
+    sw $6,90,$7
+    bne $8,$9,L1489
+W1490: .dw 1490000,-1490
+B1490: .db 82,-90,7
+S1490: .asciz "str1490"
+    .dh 1490
+L1491: add $6,$7,$8
+    ori $9,-9,$10
+    beq $11,$12,L1491
+    jmp L1492
+    la X3
+    call L1883
+    sw $13,91,$14
+    bne $15,$16,L1490
+W1491: .dw 1491000,-1491
+B1491: .db 83,-91,7
+L1492: add $13,$14,$15
+    ori $16,-8,$17
+    beq $18,$19,L1492
+    jmp L1493
+    la X4
+    call L1896
+    sw $20,92,$21
+    bne $22,$23,L1491
+W1492: .dw 1492000,-1492
+B1492: .db 84,-92,7
+L1493: add $20,$21,$22
+    ori $23,-7,$24
+    beq $25,$26,L1493
+    jmp L1494
+    la X5
+    call L1909
+    sw $27,93,$28
+    bne $29,$30,L1492
+W1493: .dw 1493000,-1493
+B1493: .db 85,-93,7
+L1494: add $27,$28,$29
+    ori $30,-6,$31
+    beq $0,$1,L1494
+    jmp L1495
+    la X6
+    call L1922
+    sw $2,94,$3
+    bne $4,$5,L1493
+W1494: .dw 1494000,-1494
+B1494: .db 86,-94,7
+L1495: add $2,$3,$4
+    ori $5,-5,$6
+    beq $7,$8,L1495
+    jmp L1496
+    la X7
+    call L1935
+    sw $9,95,$10
+    bne $11,$12,L1494
+W1495: .dw 1495000,-1495
+B1495: .db 87,-95,7
+L1496: add $9,$10,$11
+    ori $12,-4,$13
+    beq $14,$15,L1496
+    jmp L1497
+    la X0
+    call L1948
+    sw $16,96,$17
+    bne $18,$19,L1495
+W1496: .dw 1496000,-1496
+B1496: .db 88,-96,7
+L1497: add $16,$17,$18
+    ori $19,-3,$20
+    beq $21,$22,L1497
+    jmp L1498
+    la X1
+    call L1961
+    sw $23,97,$24
+    bne $25,$26,L1496
+W1497: .dw 1497000,-1497
+B1497: .db 89,-97,7
+L1498: add $23,$24,$25
+    ori $26,-2,$27
+    beq $28,$29,L1498
+    jmp L1499
+    la X2
+    call L1974
+    sw $30,98,$31
+    bne $0,$1,L1497
+W1498: .dw 1498000,-1498
+B1498: .db 90,-98,7
+L1499: add $30,$31,$0
+    ori $1,-1,$2
+    beq $3,$4,L1499
+    jmp L1500
+    la X3
+    call L1987
+    sw $5,99,$6
+    bne $7,$8,L1498
+W1499: .dw 1499000,-1499
+B1499: .db 91,-99,7
+L1500: add $5,$6,$7
+    ori $8,0,$9
+    beq $10,$11,L1500
+    jmp L1501
+    la X4
+    call L2000
+    sw $12,0,$13
+    bne $14,$15,L1499
+W1500: .dw 1500000,-1500
+B1500: .db 92,0,7
+S1500: .asciz "str1500"
+    .dh 1500
+.entry L1500
+.entry W1500
+L1501: add $12,$13,$14
+    ori $15,1,$16
+    beq $17,$18,L1501
+    jmp L1502
+    la X5
+    call L2013
+    sw $19,1,$20
+    bne $21,$22,L1500
+W1501: .dw 1501000,-1501
+B1501: .db 93,-1,7
+L1502: add $19,$20,$21
+    ori $22,2,$23
+    beq $24,$25,L1502
+    jmp L1503
+    la X6
+    call L2026
+    sw $26,2,$27
+    bne $28,$29,L1501
+W1502: .dw 1502000,-1502
+B1502: .db 94,-2,7
+L1503: add $26,$27,$28
+    ori $29,3,$30
+    beq $31,$0,L1503
+    jmp L1504
+    la X7
+    call L2039
+    sw $1,3,$2
+    bne $3,$4,L1502
+W1503: .dw 1503000,-1503
+B1503: .db 95,-3,7
+L1504: add $1,$2,$3
+    ori $4,4,$5
+    beq $6,$7,L1504
+    jmp L1505
+    la X0
+    call L2052
+    sw $8,4,$9
+    bne $10,$11,L1503
+W1504: .dw 1504000,-1504
+B1504: .db 96,-4,7
+L1505: add $8,$9,$10
+    ori $11,5,$12
+    beq $13,$14,L1505
+    jmp L1506
+    la X1
+    call L2065
+    sw $15,5,$16
+    bne $17,$18,L1504
+W1505: .dw 1505000,-1505
+B1505: .db 97,-5,7
+L1506: add $15,$16,$17
+    ori $18,6,$19
+    beq $20,$21,L1506
+    jmp L1507
+    la X2
+    call L2078
+    sw $22,6,$23
+    bne $24,$25,L1505
+W1506: .dw 1506000,-1506
+B1506: .db 98,-6,7
+L1507: add $22,$23,$24
+    ori $25,7,$26
+    beq $27,$28,L1507
+    jmp L1508
+    la X3
+    call L2091
+    sw $29,7,$30
+    bne $31,$0,L1506
+W1507: .dw 1507000,-1507
+B1507: .db 99,-7,7
+L1508: add $29,$30,$31
+    ori $0,8,$1
+    beq $2,$3,L1508
+    jmp L1509
+    la X4
+    call L2104
+    sw $4,8,$5
+    bne $6,$7,L1507
+W1508: .dw 1508000,-1508
+B1508: .db 100,-8,7
+L1509: add $4,$5,$6
+    ori $7,9,$8
+    beq $9,$10,L1509
+    jmp L1510
+    la X5
+    call L2117
+    sw $11,9,$12
+    bne $13,$14,L1508
+W1509: .dw 1509000,-1509
+B1509: .db 101,-9,7
+L1510: add $11,$12,$13
+    ori $14,10,$15
+    beq $16,$17,L1510
+    jmp L1511
+    la X6
+    call L2130
+    sw $18,10,$19
+    bne $20,$21,L1509
+W1510: .dw 1510000,-1510
+B1510: .db 102,-10,7
+S1510: .asciz "str1510"
+    .dh 1510
+L1511: add $18,$19,$20
+    ori $21,11,$22
+    beq $23,$24,L1511
+    jmp L1512
+    la X7
+    call L2143
+    sw $25,11,$26
+    bne $27,$28,L1510
+W1511: .dw 1511000,-1511
+B1511: .db 103,-11,7
+L1512: add $25,$26,$27
+    ori $28,12,$29
+    beq $30,$31,L1512
+    jmp L1513
+    la X0
+    call L2156
+    sw $0,12,$1
+    bne $2,$3,L1511
+W1512: .dw 1512000,-1512
+B1512: .db 104,-12,7
+L1513: add $0,$1,$2
+    ori $3,13,$4
+    beq $5,$6,L1513
+    jmp L1514
+    la X1
+    call L2169
+    sw $7,13,$8
+    bne $9,$10,L1512
+W1513: .dw 1513000,-1513
+B1513: .db 105,-13,7
+L1514: add $7,$8,$9
+    ori $10,14,$11
+    beq $12,$13,L1514
+    jmp L1515
+    la X2
+    call L2182
+    sw $14,14,$15
+    bne $16,$17,L1513
+W1514: .dw 1514000,-1514
+B1514: .db 106,-14,7
+L1515: add $14,$15,$16
+    ori $17,15,$18
+    beq $19,$20,L1515
+    jmp L1516
+    la X3
+    call L2195
+    sw $21,15,$22
+    bne $23,$24,L1514
+W1515: .dw 1515000,-1515
+B1515: .db 107,-15,7
+L1516: add $21,$22,$23
+    ori $24,16,$25
+    beq $26,$27,L1516
+    jmp L1517
+    la X4
+    call L2208
+    sw $28,16,$29
+    bne $30,$31,L1515
+W1516: .dw 1516000,-1516
+B1516: .db 108,-16,7
+L1517: add $28,$29,$30
+    ori $31,17,$0
+    beq $1,$2,L1517
+    jmp L1518
+    la X5
+    call L2221
+    sw $3,17,$4
+    bne $5,$6,L1516
+W1517: .dw 1517000,-1517
+B1517: .db 109,-17,7
+L1518: add $3,$4,$5
+    ori $6,18,$7
+    beq $8,$9,L1518
+    jmp L1519
+    la X6
+    call L2234
+    sw $10,18,$11
+    bne $12,$13,L1517
+W1518: .dw 1518000,-1518
+B1518: .db 110,-18,7
+L1519: add $10,$11,$12
+    ori $13,19,$14
+    beq $15,$16,L1519
+    jmp L1520
+    la X7
+    call L2247
+    sw $17,19,$18
+    bne $19,$20,L1518
+W1519: .dw 1519000,-1519
+B1519: .db 111,-19,7
+L1520: add $17,$18,$19
+    ori $20,20,$21
+    beq $22,$23,L1520
+    jmp L1521
+    la X0
+    call L2260
+    sw $24,20,$25
+    bne $26,$27,L1519
+W1520: .dw 1520000,-1520
+B1520: .db 112,-20,7
+S1520: .asciz "str1520"
+    .dh 1520
+L1521: add $24,$25,$26
+    ori $27,21,$28
+    beq $29,$30,L1521
+    jmp L1522
+    la X1
+    call L2273
+    sw $31,21,$0
+    bne $1,$2,L1520
+W1521: .dw 1521000,-1521
+B1521: .db 113,-21,7
+L1522: add $31,$0,$1
+    ori $2,22,$3
+    beq $4,$5,L1522
+    jmp L1523
+    la X2
+    call L2286
+    sw $6,22,$7
+    bne $8,$9,L1521
+W1522: .dw 1522000,-1522
+B1522: .db 114,-22,7
+L1523: add $6,$7,$8
+    ori $9,23,$10
+    beq $11,$12,L1523
+    jmp L1524
+    la X3
+    call L2299
+    sw $13,23,$14
+    bne $15,$16,L1522
+W1523: .dw 1523000,-1523
+B1523: .db 115,-23,7
+L1524: add $13,$14,$15
+    ori $16,24,$17
+    beq $18,$19,L1524
+    jmp L1525
+    la X4
+    call L2312
+    sw $20,24,$21
+    bne $22,$23,L1523
+W1524: .dw 1524000,-1524
+B1524: .db 116,-24,7
+L1525: add $20,$21,$22
+    ori $23,25,$24
+    beq $25,$26,L1525
+    jmp L1526
+    la X5
+    call L2325
+    sw $27,25,$28
+    bne $29,$30,L1524
+W1525: .dw 1525000,-1525
+B1525: .db 117,-25,7
+L1526: add $27,$28,$29
+    ori $30,26,$31
+    beq $0,$1,L1526
+    jmp L1527
+    la X6
+    call L2338
+    sw $2,26,$3
+    bne $4,$5,L1525
+W1526: .dw 1526000,-1526
+B1526: .db 118,-26,7
+L1527: add $2,$3,$4
+    ori $5,27,$6
+    beq $7,$8,L1527
+    jmp L1528
+    la X7
+    call L2351
+    sw $9,27,$10
+    bne $11,$12,L1526
+W1527: .dw 1527000,-1527
+B1527: .db 119,-27,7
+L1528: add $9,$10,$11
+    ori $12,28,$13
+    beq $14,$15,L1528
+    jmp L1529
+    la X0
+    call L2364
+    sw $16,28,$17
+    bne $18,$19,L1527
+W1528: .dw 1528000,-1528
+B1528: .db 120,-28,7
+L1529: add $16,$17,$18
+    ori $19,29,$20
+    beq $21,$22,L1529
+    jmp L1530
+    la X1
+    call L2377
+    sw $23,29,$24
+    bne $25,$26,L1528
+W1529: .dw 1529000,-1529
+B1529: .db 121,-29,7
+L1530: add $23,$24,$25
+    ori $26,30,$27
+    beq $28,$29,L1530
+    jmp L1531
+    la X2
+    call L2390
+    sw $30,30,$31
+    bne $0,$1,L1529
+W1530: .dw 1530000,-1530
+B1530: .db 122,-30,7
+S1530: .asciz "str1530"
+    .dh 1530
+L1531: add $30,$31,$0
+    ori $1,31,$2
+    beq $3,$4,L1531
+    jmp L1532
+    la X3
+    call L2403
+    sw $5,31,$6
+    bne $7,$8,L1530
+W1531: .dw 1531000,-1531
+B1531: .db 123,-31,7
+L1532: add $5,$6,$7
+    ori $8,32,$9
+    beq $10,$11,L1532
+    jmp L1533
+    la X4
+    call L2416
+    sw $12,32,$13
+    bne $14,$15,L1531
+W1532: .dw 1532000,-1532
+B1532: .db 124,-32,7
+L1533: add $12,$13,$14
+    ori $15,33,$16
+    beq $17,$18,L1533
+    jmp L1534
+    la X5
+    call L2429
+    sw $19,33,$20
+    bne $21,$22,L1532
+W1533: .dw 1533000,-1533
+B1533: .db 125,-33,7
+L1534: add $19,$20,$21
+    ori $22,34,$23
+    beq $24,$25,L1534
+    jmp L1535
+    la X6
+    call L2442
+    sw $26,34,$27
+    bne $28,$29,L1533
+W1534: .dw 1534000,-1534
+B1534: .db 126,-34,7
+L1535: add $26,$27,$28
+    ori $29,35,$30
+    beq $31,$0,L1535
+    jmp L1536
+    la X7
+    call L2455
+    sw $1,35,$2
+    bne $3,$4,L1534
+W1535: .dw 1535000,-1535
+B1535: .db 127,-35,7
+L1536: add $1,$2,$3
+    ori $4,36,$5
+    beq $6,$7,L1536
+    jmp L1537
+    la X0
+    call L2468
+    sw $8,36,$9
+    bne $10,$11,L1535
+W1536: .dw 1536000,-1536
+B1536: .db 0,-36,7
+L1537: add $8,$9,$10
+    ori $11,37,$12
+    beq $13,$14,L1537
+    jmp L1538
+    la X1
+    call L2481
+    sw $15,37,$16
+    bne $17,$18,L1536
+W1537: .dw 1537000,-1537
+B1537: .db 1,-37,7
+L1538: add $15,$16,$17
+    ori $18,38,$19
+    beq $20,$21,L1538
+    jmp L1539
+    la X2
+    call L2494
+    sw $22,38,$23
+    bne $24,$25,L1537
+W1538: .dw 1538000,-1538
+B1538: .db 2,-38,7
+L1539: add $22,$23,$24
+    ori $25,39,$26
+    beq $27,$28,L1539
+    jmp L1540
+    la X3
+    call L7
+    sw $29,39,$30
+    bne $31,$0,L1538
+W1539: .dw 1539000,-1539
+B1539: .db 3,-39,7
+L1540: add $29,$30,$31
+    ori $0,40,$1
+    beq $2,$3,L1540
+    jmp L1541
+    la X4
+    call L20
+    sw $4,40,$5
+    bne $6,$7,L1539
+W1540: .dw 1540000,-1540
+B1540: .db 4,-40,7
+S1540: .asciz "str1540"
+    .dh 1540
+L1541: add $4,$5,$6
+    ori $7,41,$8
+    beq $9,$10,L1541
+    jmp L1542
+    la X5
+    call L33
+    sw $11,41,$12
+    bne $13,$14,L1540
+W1541: .dw 1541000,-1541
+B1541: .db 5,-41,7
+L1542: add $11,$12,$13
+    ori $14,42,$15
+    beq $16,$17,L1542
+    jmp L1543
+    la X6
+    call L46
+    sw $18,42,$19
+    bne $20,$21,L1541
+W1542: .dw 1542000,-1542
+B1542: .db 6,-42,7
+L1543: add $18,$19,$20
+    ori $21,43,$22
+    beq $23,$24,L1543
+    jmp L1544
+    la X7
+    call L59
+    sw $25,43,$26
+    bne $27,$28,L1542
+W1543: .dw 1543000,-1543
+B1543: .db 7,-43,7
+L1544: add $25,$26,$27
+    ori $28,44,$29
+    beq $30,$31,L1544
+    jmp L1545
+    la X0
+    call L72
+    sw $0,44,$1
+    bne $2,$3,L1543
+W1544: .dw 1544000,-1544
+B1544: .db 8,-44,7
+L1545: add $0,$1,$2
+    ori $3,45,$4
+    beq $5,$6,L1545
+    jmp L1546
+    la X1
+    call L85
+    sw $7,45,$8
+    bne $9,$10,L1544
+W1545: .dw 1545000,-1545
+B1545: .db 9,-45,7
+L1546: add $7,$8,$9
+    ori $10,46,$11
+    beq $12,$13,L1546
+    jmp L1547
+    la X2
+    call L98
+    sw $14,46,$15
+    bne $16,$17,L1545
+W1546: .dw 1546000,-1546
+B1546: .db 10,-46,7
+L1547: add $14,$15,$16
+    ori $17,47,$18
+    beq $19,$20,L1547
+    jmp L1548
+    la X3
+    call L111
+    sw $21,47,$22
+    bne $23,$24,L1546
+W1547: .dw 1547000,-1547
+B1547: .db 11,-47,7
+L1548: add $21,$22,$23
+    ori $24,48,$25
+    beq $26,$27,L1548
+    jmp L1549
+    la X4
+    call L124
+    sw $28,48,$29
+    bne $30,$31,L1547
+W1548: .dw 1548000,-1548
+B1548: .db 12,-48,7
+L1549: add $28,$29,$30
+    ori $31,49,$0
+    beq $1,$2,L1549
+    jmp L1550
+    la X5
+    call L137
+    sw $3,49,$4
+    bne $5,$6,L1548
+W1549: .dw 1549000,-1549
+B1549: .db 13,-49,7
+L1550: add $3,$4,$5
+    ori $6,50,$7
+    beq $8,$9,L1550
+    jmp L1551
+    la X6
+    call L150
+    sw $10,50,$11
+    bne $12,$13,L1549
+W1550: .dw 1550000,-1550
+B1550: .db 14,-50,7
+S1550: .asciz "str1550"
+    .dh 1550
+.entry L1550
+.entry W1550
+L1551: add $10,$11,$12
+    ori $13,51,$14
+    beq $15,$16,L1551
+    jmp L1552
+    la X7
+    call L163
+    sw $17,51,$18
+    bne $19,$20,L1550
+W1551: .dw 1551000,-1551
+B1551: .db 15,-51,7
+L1552: add $17,$18,$19
+    ori $20,52,$21
+    beq $22,$23,L1552
+    jmp L1553
+    la X0
+    call L176
+    sw $24,52,$25
+    bne $26,$27,L1551
+W1552: .dw 1552000,-1552
+B1552: .db 16,-52,7
+L1553: add $24,$25,$26
+    ori $27,53,$28
+    beq $29,$30,L1553
+    jmp L1554
+    la X1
+    call L189
+    sw $31,53,$0
+    bne $1,$2,L1552
+W1553: .dw 1553000,-1553
+B1553: .db 17,-53,7
+L1554: add $31,$0,$1
+    ori $2,54,$3
+    beq $4,$5,L1554
+    jmp L1555
+    la X2
+    call L202
+    sw $6,54,$7
+    bne $8,$9,L1553
+W1554: .dw 1554000,-1554
+B1554: .db 18,-54,7
+L1555: add $6,$7,$8
+    ori $9,55,$10
+    beq $11,$12,L1555
+    jmp L1556
+    la X3
+    call L215
+    sw $13,55,$14
+    bne $15,$16,L1554
+W1555: .dw 1555000,-1555
+B1555: .db 19,-55,7
+L1556: add $13,$14,$15
+    ori $16,56,$17
+    beq $18,$19,L1556
+    jmp L1557
+    la X4
+    call L228
+    sw $20,56,$21
+    bne $22,$23,L1555
+W1556: .dw 1556000,-1556
+B1556: .db 20,-56,7
+L1557: add $20,$21,$22
+    ori $23,57,$24
+    beq $25,$26,L1557
+    jmp L1558
+    la X5
+    call L241
+    sw $27,57,$28
+    bne $29,$30,L1556
+W1557: .dw 1557000,-1557
+B1557: .db 21,-57,7
+L1558: add $27,$28,$29
+    ori $30,58,$31
+    beq $0,$1,L1558
+    jmp L1559
+    la X6
+    call L254
+    sw $2,58,$3
+    bne $4,$5,L1557
+W1558: .dw 1558000,-1558
+B1558: .db 22,-58,7
+L1559: add $2,$3,$4
+    ori $5,59,$6
+    beq $7,$8,L1559
+    jmp L1560
+    la X7
+    call L267
+    sw $9,59,$10
+    bne $11,$12,L1558
+W1559: .dw 1559000,-1559
+B1559: .db 23,-59,7
+L1560: add $9,$10,$11
+    ori $12,60,$13
+    beq $14,$15,L1560
+    jmp L1561
+    la X0
+    call L280
+    sw $16,60,$17
+    bne $18,$19,L1559
+W1560: .dw 1560000,-1560
+B1560: .db 24,-60,7
+S1560: .asciz "str1560"
+    .dh 1560
+L1561: add $16,$17,$18
+    ori $19,61,$20
+    beq $21,$22,L1561
+    jmp L1562
+    la X1
+    call L293
+    sw $23,61,$24
+    bne $25,$26,L1560
+W1561: .dw 1561000,-1561
+B1561: .db 25,-61,7
+L1562: add $23,$24,$25
+    ori $26,62,$27
+    beq $28,$29,L1562
+    jmp L1563
+    la X2
+    call L306
+    sw $30,62,$31
+    bne $0,$1,L1561
+W1562: .dw 1562000,-1562
+B1562: .db 26,-62,7
+L1563: add $30,$31,$0
+    ori $1,63,$2
+    beq $3,$4,L1563
+    jmp L1564
+    la X3
+    call L319
+    sw $5,63,$6
+    bne $7,$8,L1562
+W1563: .dw 1563000,-1563
+B1563: .db 27,-63,7
+L1564: add $5,$6,$7
+    ori $8,64,$9
+    beq $10,$11,L1564
+    jmp L1565
+    la X4
+    call L332
+    sw $12,64,$13
+    bne $14,$15,L1563
+W1564: .dw 1564000,-1564
+B1564: .db 28,-64,7
+L1565: add $12,$13,$14
+    ori $15,65,$16
+    beq $17,$18,L1565
+    jmp L1566
+    la X5
+    call L345
+    sw $19,65,$20
+    bne $21,$22,L1564
+W1565: .dw 1565000,-1565
+B1565: .db 29,-65,7
+L1566: add $19,$20,$21
+    ori $22,66,$23
+    beq $24,$25,L1566
+    jmp L1567
+    la X6
+    call L358
+    sw $26,66,$27
+    bne $28,$29,L1565
+W1566: .dw 1566000,-1566
+B1566: .db 30,-66,7
+L1567: add $26,$27,$28
+    ori $29,67,$30
+    beq $31,$0,L1567
+    jmp L1568
+    la X7
+    call L371
+    sw $1,67,$2
+    bne $3,$4,L1566
+W1567: .dw 1567000,-1567
+B1567: .db 31,-67,7
+L1568: add $1,$2,$3
+    ori $4,68,$5
+    beq $6,$7,L1568
+    jmp L1569
+    la X0
+    call L384
+    sw $8,68,$9
+    bne $10,$11,L1567
+W1568: .dw 1568000,-1568
+B1568: .db 32,-68,7
+L1569: add $8,$9,$10
+    ori $11,69,$12
+    beq $13,$14,L1569
+    jmp L1570
+    la X1
+    call L397
+    sw $15,69,$16
+    bne $17,$18,L1568
+W1569: .dw 1569000,-1569
+B1569: .db 33,-69,7
+L1570: add $15,$16,$17
+    ori $18,70,$19
+    beq $20,$21,L1570
+    jmp L1571
+    la X2
+    call L410
+    sw $22,70,$23
+    bne $24,$25,L1569
+W1570: .dw 1570000,-1570
+B1570: .db 34,-70,7
+S1570: .asciz "str1570"
+    .dh 1570
+L1571: add $22,$23,$24
+    ori $25,71,$26
+    beq $27,$28,L1571
+    jmp L1572
+    la X3
+    call L423
+    sw $29,71,$30
+    bne $31,$0,L1570
+W1571: .dw 1571000,-1571
+B1571: .db 35,-71,7
+L1572: add $29,$30,$31
+    ori $0,72,$1
+    beq $2,$3,L1572
+    jmp L1573
+    la X4
+    call L436
+    sw $4,72,$5
+    bne $6,$7,L1571
+W1572: .dw 1572000,-1572
+B1572: .db 36,-72,7
+L1573: add $4,$5,$6
+    ori $7,73,$8
+    beq $9,$10,L1573
+    jmp L1574
+    la X5
+    call L449
+    sw $11,73,$12
+    bne $13,$14,L1572
+W1573: .dw 1573000,-1573
+B1573: .db 37,-73,7
+L1574: add $11,$12,$13
+    ori $14,74,$15
+    beq $16,$17,L1574
+    jmp L1575
+    la X6
+    call L462
+    sw $18,74,$19
+    bne $20,$21,L1573
+W1574: .dw 1574000,-1574
+B1574: .db 38,-74,7
+L1575: add $18,$19,$20
+    ori $21,75,$22
+    beq $23,$24,L1575
+    jmp L1576
+    la X7
+    call L475
+    sw $25,75,$26
+    bne $27,$28,L1574
+W1575: .dw 1575000,-1575
+B1575: .db 39,-75,7
+L1576: add $25,$26,$27
+    ori $28,76,$29
+    beq $30,$31,L1576
+    jmp L1577
+    la X0
+    call L488
+    sw $0,76,$1
+    bne $2,$3,L1575
+W1576: .dw 1576000,-1576
+B1576: .db 40,-76,7
+L1577: add $0,$1,$2
+    ori $3,77,$4
+    beq $5,$6,L1577
+    jmp L1578
+    la X1
+    call L501
+    sw $7,77,$8
+    bne $9,$10,L1576
+W1577: .dw 1577000,-1577
+B1577: .db 41,-77,7
+L1578: add $7,$8,$9
+    ori $10,78,$11
+    beq $12,$13,L1578
+    jmp L1579
+    la X2
+    call L514
+    sw $14,78,$15
+    bne $16,$17,L1577
+W1578: .dw 1578000,-1578
+B1578: .db 42,-78,7
+L1579: add $14,$15,$16
+    ori $17,79,$18
+    beq $19,$20,L1579
+    jmp L1580
+    la X3
+    call L527
+    sw $21,79,$22
+    bne $23,$24,L1578
+W1579: .dw 1579000,-1579
+B1579: .db 43,-79,7
+L1580: add $21,$22,$23
+    ori $24,80,$25
+    beq $26,$27,L1580
+    jmp L1581
+    la X4
+    call L540
+    sw $28,80,$29
+    bne $30,$31,L1579
+W1580: .dw 1580000,-1580
+B1580: .db 44,-80,7
+S1580: .asciz "str1580"
+    .dh 1580
+L1581: add $28,$29,$30
+    ori $31,81,$0
+    beq $1,$2,L1581
+    jmp L1582
+    la X5
+    call L553
+    sw $3,81,$4
+    bne $5,$6,L1580
+W1581: .dw 1581000,-1581
+B1581: .db 45,-81,7
+L1582: add $3,$4,$5
+    ori $6,82,$7
+    beq $8,$9,L1582
+    jmp L1583
+    la X6
+    call L566
+    sw $10,82,$11
+    bne $12,$13,L1581
+W1582: .dw 1582000,-1582
+B1582: .db 46,-82,7
+L1583: add $10,$11,$12
+    ori $13,83,$14
+    beq $15,$16,L1583
+    jmp L1584
+    la X7
+    call L579
+    sw $17,83,$18
+    bne $19,$20,L1582
+W1583: .dw 1583000,-1583
+B1583: .db 47,-83,7
+L1584: add $17,$18,$19
+    ori $20,84,$21
+    beq $22,$23,L1584
+    jmp L1585
+    la X0
+    call L592
+    sw $24,84,$25
+    bne $26,$27,L1583
+W1584: .dw 1584000,-1584
+B1584: .db 48,-84,7
+L1585: add $24,$25,$26
+    ori $27,85,$28
+    beq $29,$30,L1585
+    jmp L1586
+    la X1
+    call L605
+    sw $31,85,$0
+    bne $1,$2,L1584
+W1585: .dw 1585000,-1585
+B1585: .db 49,-85,7
+L1586: add $31,$0,$1
+    ori $2,86,$3
+    beq $4,$5,L1586
+    jmp L1587
+    la X2
+    call L618
+    sw $6,86,$7
+    bne $8,$9,L1585
+W1586: .dw 1586000,-1586
+B1586: .db 50,-86,7
+L1587: add $6,$7,$8
+    ori $9,87,$10
+    beq $11,$12,L1587
+    jmp L1588
+    la X3
+    call L631
+    sw $13,87,$14
+    bne $15,$16,L1586
+W1587: .dw 1587000,-1587
+B1587: .db 51,-87,7
+L1588: add $13,$14,$15
+    ori $16,88,$17
+    beq $18,$19,L1588
+    jmp L1589
+    la X4
+    call L644
+    sw $20,88,$21
+    bne $22,$23,L1587
+W1588: .dw 1588000,-1588
+B1588: .db 52,-88,7
+L1589: add $20,$21,$22
+    ori $23,89,$24
+    beq $25,$26,L1589
+    jmp L1590
+    la X5
+    call L657
+    sw $27,89,$28
+    bne $29,$30,L1588
+W1589: .dw 1589000,-1589
+B1589: .db 53,-89,7
+L1590: add $27,$28,$29
+    ori $30,90,$31
+    beq $0,$1,L1590
+    jmp L1591
+    la X6
+    call L670
+    sw $2,90,$3
+    bne $4,$5,L1589
+W1590: .dw 1590000,-1590
+B1590: .db 54,-90,7
+S1590: .asciz "str1590"
+    .dh 1590
+L1591: add $2,$3,$4
+    ori $5,91,$6
+    beq $7,$8,L1591
+    jmp L1592
+    la X7
+    call L683
+    sw $9,91,$10
+    bne $11,$12,L1590
+W1591: .dw 1591000,-1591
+B1591: .db 55,-91,7
+L1592: add $9,$10,$11
+    ori $12,92,$13
+    beq $14,$15,L1592
+    jmp L1593
+    la X0
+    call L696
+    sw $16,92,$17
+    bne $18,$19,L1591
+W1592: .dw 1592000,-1592
+B1592: .db 56,-92,7
+L1593: add $16,$17,$18
+    ori $19,93,$20
+    beq $21,$22,L1593
+    jmp L1594
+    la X1
+    call L709
+    sw $23,93,$24
+    bne $25,$26,L1592
+W1593: .dw 1593000,-1593
+B1593: .db 57,-93,7
+L1594: add $23,$24,$25
+    ori $26,94,$27
+    beq $28,$29,L1594
+    jmp L1595
+    la X2
+    call L722
+    sw $30,94,$31
+    bne $0,$1,L1593
+W1594: .dw 1594000,-1594
+B1594: .db 58,-94,7
+L1595: add $30,$31,$0
+    ori $1,95,$2
+    beq $3,$4,L1595
+    jmp L1596
+    la X3
+    call L735
+    sw $5,95,$6
+    bne $7,$8,L1594
+W1595: .dw 1595000,-1595
+B1595: .db 59,-95,7
+L1596: add $5,$6,$7
+    ori $8,96,$9
+    beq $10,$11,L1596
+    jmp L1597
+    la X4
+    call L748
+    sw $12,96,$13
+    bne $14,$15,L1595
+W1596: .dw 1596000,-1596
+B1596: .db 60,-96,7
+L1597: add $12,$13,$14
+    ori $15,97,$16
+    beq $17,$18,L1597
+    jmp L1598
+    la X5
+    call L761
+    sw $19,97,$20
+    bne $21,$22,L1596
+W1597: .dw 1597000,-1597
+B1597: .db 61,-97,7
+L1598: add $19,$20,$21
+    ori $22,98,$23
+    beq $24,$25,L1598
+    jmp L1599
+    la X6
+    call L774
+    sw $26,98,$27
+    bne $28,$29,L1597
+W1598: .dw 1598000,-1598
+B1598: .db 62,-98,7
+L1599: add $26,$27,$28
+    ori $29,99,$30
+    beq $31,$0,L1599
+    jmp L1600
+    la X7
+    call L787
+    sw $1,99,$2
+    bne $3,$4,L1598
+W1599: .dw 1599000,-1599
+B1599: .db 63,-99,7
+L1600: add $1,$2,$3
+    ori $4,-100,$5
+    beq $6,$7,L1600
+    jmp L1601
+    la X0
+    call L800
+    sw $8,0,$9
+    bne $10,$11,L1599
+W1600: .dw 1600000,-1600
+B1600: .db 64,0,7
+S1600: .asciz "str1600"
+    .dh 1600
+.entry L1600
+.entry W1600
+L1601: add $8,$9,$10
+    ori $11,-99,$12
+    beq $13,$14,L1601
+    jmp L1602
+    la X1
+    call L813
+    sw $15,1,$16
+    bne $17,$18,L1600
+W1601: .dw 1601000,-1601
+B1601: .db 65,-1,7
+L1602: add $15,$16,$17
+    ori $18,-98,$19
+    beq $20,$21,L1602
+    jmp L1603
+    la X2
+    call L826
+    sw $22,2,$23
+    bne $24,$25,L1601
+W1602: .dw 1602000,-1602
+B1602: .db 66,-2,7
+L1603: add $22,$23,$24
+    ori $25,-97,$26
+    beq $27,$28,L1603
+    jmp L1604
+    la X3
+    call L839
+    sw $29,3,$30
+    bne $31,$0,L1602
+W1603: .dw 1603000,-1603
+B1603: .db 67,-3,7
+L1604: add $29,$30,$31
+    ori $0,-96,$1
+    beq $2,$3,L1604
+    jmp L1605
+    la X4
+    call L852
+    sw $4,4,$5
+    bne $6,$7,L1603
+W1604: .dw 1604000,-1604
+B1604: .db 68,-4,7
+L1605: add $4,$5,$6
+    ori $7,-95,$8
+    beq $9,$10,L1605
+    jmp L1606
+    la X5
+    call L865
+    sw $11,5,$12
+    bne $13,$14,L1604
+W1605: .dw 1605000,-1605
+B1605: .db 69,-5,7
+L1606: add $11,$12,$13
+    ori $14,-94,$15
+    beq $16,$17,L1606
+    jmp L1607
+    la X6
+    call L878
+    sw $18,6,$19
+    bne $20,$21,L1605
+W1606: .dw 1606000,-1606
+B1606: .db 70,-6,7
+L1607: add $18,$19,$20
+    ori $21,-93,$22
+    beq $23,$24,L1607
+    jmp L1608
+    la X7
+    call L891
+    sw $25,7,$26
+    bne $27,$28,L1606
+W1607: .dw 1607000,-1607
+B1607: .db 71,-7,7
+L1608: add $25,$26,$27
+    ori $28,-92,$29
+    beq $30,$31,L1608
+    jmp L1609
+    la X0
+    call L904
+    sw $0,8,$1
+    bne $2,$3,L1607
+W1608: .dw 1608000,-1608
+B1608: .db 72,-8,7
+L1609: add $0,$1,$2
+    ori $3,-91,$4
+    beq $5,$6,L1609
+    jmp L1610
+    la X1
+    call L917
+    sw $7,9,$8
+    bne $9,$10,L1608
+W1609: .dw 1609000,-1609
+B1609: .db 73,-9,7
+L1610: add $7,$8,$9
+    ori $10,-90,$11
+    beq $12,$13,L1610
+    jmp L1611
+    la X2
+    call L930
+    sw $14,10,$15
+    bne $16,$17,L1609
+W1610: .dw 1610000,-1610
+B1610: .db 74,-10,7
+S1610: .asciz "str1610"
+    .dh 1610
+L1611: add $14,$15,$16
+    ori $17,-89,$18
+    beq $19,$20,L1611
+    jmp L1612
+    la X3
+    call L943
+    sw $21,11,$22
+    bne $23,$24,L1610
+W1611: .dw 1611000,-1611
+B1611: .db 75,-11,7
+L1612: add $21,$22,$23
+    ori $24,-88,$25
+    beq $26,$27,L1612
+    jmp L1613
+    la X4
+    call L956
+    sw $28,12,$29
+    bne $30,$31,L1611
+W1612: .dw 1612000,-1612
+B1612: .db 76,-12,7
+L1613: add $28,$29,$30
+    ori $31,-87,$0
+    beq $1,$2,L1613
+    jmp L1614
+    la X5
+    call L969
+    sw $3,13,$4
+    bne $5,$6,L1612
+W1613: .dw 1613000,-1613
+B1613: .db 77,-13,7
+L1614: add $3,$4,$5
+    ori $6,-86,$7
+    beq $8,$9,L1614
+    jmp L1615
+    la X6
+    call L982
+    sw $10,14,$11
+    bne $12,$13,L1613
+W1614: .dw 1614000,-1614
+B1614: .db 78,-14,7
+L1615: add $10,$11,$12
+    ori $13,-85,$14
+    beq $15,$16,L1615
+    jmp L1616
+    la X7
+    call L995
+    sw $17,15,$18
+    bne $19,$20,L1614
+W1615: .dw 1615000,-1615
+B1615: .db 79,-15,7
+L1616: add $17,$18,$19
+    ori $20,-84,$21
+    beq $22,$23,L1616
+    jmp L1617
+    la X0
+    call L1008
+    sw $24,16,$25
+    bne $26,$27,L1615
+W1616: .dw 1616000,-1616
+B1616: .db 80,-16,7
+L1617: add $24,$25,$26
+    ori $27,-83,$28
+    beq $29,$30,L1617
+    jmp L1618
+    la X1
+    call L1021
+    sw $31,17,$0
+    bne $1,$2,L1616
+W1617: .dw 1617000,-1617
+B1617: .db 81,-17,7
+L1618: add $31,$0,$1
+    ori $2,-82,$3
+    beq $4,$5,L1618
+    jmp L1619
+    la X2
+    call L1034
+    sw $6,18,$7
+    bne $8,$9,L1617
+W1618: .dw 1618000,-1618
+B1618: .db 82,-18,7
+L1619: add $6,$7,$8
+    ori $9,-81,$10
+    beq $11,$12,L1619
+    jmp L1620
+    la X3
+    call L1047
+    sw $13,19,$14
+    bne $15,$16,L1618
+W1619: .dw 1619000,-1619
+B1619: .db 83,-19,7
+L1620: add $13,$14,$15
+    ori $16,-80,$17
+    beq $18,$19,L1620
+    jmp L1621
+    la X4
+    call L1060
+    sw $20,20,$21
+    bne $22,$23,L1619
+W1620: .dw 1620000,-1620
+B1620: .db 84,-20,7
+S1620: .asciz "str1620"
+    .dh 1620
+L1621: add $20,$21,$22
+    ori $23,-79,$24
+    beq $25,$26,L1621
+    jmp L1622
+    la X5
+    call L1073
+    sw $27,21,$28
+    bne $29,$30,L1620
+W1621: .dw 1621000,-1621
+B1621: .db 85,-21,7
+L1622: add $27,$28,$29
+    ori $30,-78,$31
+    beq $0,$1,L1622
+    jmp L1623
+    la X6
+    call L1086
+    sw $2,22,$3
+    bne $4,$5,L1621
+W1622: .dw 1622000,-1622
+B1622: .db 86,-22,7
+L1623: add $2,$3,$4
+    ori $5,-77,$6
+    beq $7,$8,L1623
+    jmp L1624
+    la X7
+    call L1099
+    sw $9,23,$10
+    bne $11,$12,L1622
+W1623: .dw 1623000,-1623
+B1623: .db 87,-23,7
+L1624: add $9,$10,$11
+    ori $12,-76,$13
+    beq $14,$15,L1624
+    jmp L1625
+    la X0
+    call L1112
+    sw $16,24,$17
+    bne $18,$19,L1623
+W1624: .dw 1624000,-1624
+B1624: .db 88,-24,7
+L1625: add $16,$17,$18
+    ori $19,-75,$20
+    beq $21,$22,L1625
+    jmp L1626
+    la X1
+    call L1125
+    sw $23,25,$24
+    bne $25,$26,L1624
+W1625: .dw 1625000,-1625
+B1625: .db 89,-25,7
+L1626: add $23,$24,$25
+    ori $26,-74,$27
+    beq $28,$29,L1626
+    jmp L1627
+    la X2
+    call L1138
+    sw $30,26,$31
+    bne $0,$1,L1625
+W1626: .dw 1626000,-1626
+B1626: .db 90,-26,7
+L1627: add $30,$31,$0
+    ori $1,-73,$2
+    beq $3,$4,L1627
+    jmp L1628
+    la X3
+    call L1151
+    sw $5,27,$6
+    bne $7,$8,L1626
+W1627: .dw 1627000,-1627
+B1627: .db 91,-27,7
+L1628: add $5,$6,$7
+    ori $8,-72,$9
+    beq $10,$11,L1628
+    jmp L1629
+    la X4
+    call L1164
+    sw $12,28,$13
+    bne $14,$15,L1627
+W1628: .dw 1628000,-1628
+B1628: .db 92,-28,7
+L1629: add $12,$13,$14
+    ori $15,-71,$16
+    beq $17,$18,L1629
+    jmp L1630
+    la X5
+    call L1177
+    sw $19,29,$20
+    bne $21,$22,L1628
+W1629: .dw 1629000,-1629
+B1629: .db 93,-29,7
+L1630: add $19,$20,$21
+    ori $22,-70,$23
+    beq $24,$25,L1630
+    jmp L1631
+    la X6
+    call L1190
+    sw $26,30,$27
+    bne $28,$29,L1629
+W1630: .dw 1630000,-1630
+B1630: .db 94,-30,7
+S1630: .asciz "str1630"
+    .dh 1630
+L1631: add $26,$27,$28
+    ori $29,-69,$30
+    beq $31,$0,L1631
+    jmp L1632
+    la X7
+    call L1203
+    sw $1,31,$2
+    bne $3,$4,L1630
+W1631: .dw 1631000,-1631
+B1631: .db 95,-31,7
+L1632: add $1,$2,$3
+    ori $4,-68,$5
+    beq $6,$7,L1632
+    jmp L1633
+    la X0
+    call L1216
+    sw $8,32,$9
+    bne $10,$11,L1631
+W1632: .dw 1632000,-1632
+B1632: .db 96,-32,7
+L1633: add $8,$9,$10
+    ori $11,-67,$12
+    beq $13,$14,L1633
+    jmp L1634
+    la X1
+    call L1229
+    sw $15,33,$16
+    bne $17,$18,L1632
+W1633: .dw 1633000,-1633
+B1633: .db 97,-33,7
+L1634: add $15,$16,$17
+    ori $18,-66,$19
+    beq $20,$21,L1634
+    jmp L1635
+    la X2
+    call L1242
+    sw $22,34,$23
+    bne $24,$25,L1633
+W1634: .dw 1634000,-1634
+B1634: .db 98,-34,7
+L1635: add $22,$23,$24
+    ori $25,-65,$26
+    beq $27,$28,L1635
+    jmp L1636
+    la X3
+    call L1255
+    sw $29,35,$30
+    bne $31,$0,L1634
+W1635: .dw 1635000,-1635
+B1635: .db 99,-35,7
+L1636: add $29,$30,$31
+    ori $0,-64,$1
+    beq $2,$3,L1636
+    jmp L1637
+    la X4
+    call L1268
+    sw $4,36,$5
+    bne $6,$7,L1635
+W1636: .dw 1636000,-1636
+B1636: .db 100,-36,7
+L1637: add $4,$5,$6
+    ori $7,-63,$8
+    beq $9,$10,L1637
+    jmp L1638
+    la X5
+    call L1281
+    sw $11,37,$12
+    bne $13,$14,L1636
+W1637: .dw 1637000,-1637
+B1637: .db 101,-37,7
+L1638: add $11,$12,$13
+    ori $14,-62,$15
+    beq $16,$17,L1638
+    jmp L1639
+    la X6
+    call L1294
+    sw $18,38,$19
+    bne $20,$21,L1637
+W1638: .dw 1638000,-1638
+B1638: .db 102,-38,7
+L1639: add $18,$19,$20
+    ori $21,-61,$22
+    beq $23,$24,L1639
+    jmp L1640
+    la X7
+    call L1307
+    sw $25,39,$26
+    bne $27,$28,L1638
+W1639: .dw 1639000,-1639
+B1639: .db 103,-39,7
+L1640: add $25,$26,$27
+    ori $28,-60,$29
+    beq $30,$31,L1640
+    jmp L1641
+    la X0
+    call L1320
+    sw $0,40,$1
+    bne $2,$3,L1639
+W1640: .dw 1640000,-1640
+B1640: .db 104,-40,7
+S1640: .asciz "str1640"
+    .dh 1640
+L1641: add $0,$1,$2
+    ori $3,-59,$4
+    beq $5,$6,L1641
+    jmp L1642
+    la X1
+    call L1333
+    sw $7,41,$8
+    bne $9,$10,L1640
+W1641: .dw 1641000,-1641
+B1641: .db 105,-41,7
+L1642: add $7,$8,$9
+    ori $10,-58,$11
+    beq $12,$13,L1642
+    jmp L1643
+    la X2
+    call L1346
+    sw $14,42,$15
+    bne $16,$17,L1641
+W1642: .dw 1642000,-1642
+B1642: .db 106,-42,7
+L1643: add $14,$15,$16
+    ori $17,-57,$18
+    beq $19,$20,L1643
+    jmp L1644
+    la X3
+    call L1359
+    sw $21,43,$22
+    bne $23,$24,L1642
+W1643: .dw 1643000,-1643
+B1643: .db 107,-43,7
+L1644: add $21,$22,$23
+    ori $24,-56,$25
+    beq $26,$27,L1644
+    jmp L1645
+    la X4
+    call L1372
+    sw $28,44,$29
+    bne $30,$31,L1643
+W1644: .dw 1644000,-1644
+B1644: .db 108,-44,7
+L1645: add $28,$29,$30
+    ori $31,-55,$0
+    beq $1,$2,L1645
+    jmp L1646
+    la X5
+    call L1385
+    sw $3,45,$4
+    bne $5,$6,L1644
+W1645: .dw 1645000,-1645
+B1645: .db 109,-45,7
+L1646: add $3,$4,$5
+    ori $6,-54,$7
+    beq $8,$9,L1646
+    jmp L1647
+    la X6
+    call L1398
+    sw $10,46,$11
+    bne $12,$13,L1645
+W1646: .dw 1646000,-1646
+B1646: .db 110,-46,7
+L1647: add $10,$11,$12
+    ori $13,-53,$14
+    beq $15,$16,L1647
+    jmp L1648
+    la X7
+    call L1411
+    sw $17,47,$18
+    bne $19,$20,L1646
+W1647: .dw 1647000,-1647
+B1647: .db 111,-47,7
+L1648: add $17,$18,$19
+    ori $20,-52,$21
+    beq $22,$23,L1648
+    jmp L1649
+    la X0
+    call L1424
+    sw $24,48,$25
+    bne $26,$27,L1647
+W1648: .dw 1648000,-1648
+B1648: .db 112,-48,7
+L1649: add $24,$25,$26
+    ori $27,-51,$28
+    beq $29,$30,L1649
+    jmp L1650
+    la X1
+    call L1437
+    sw $31,49,$0
+    bne $1,$2,L1648
+W1649: .dw 1649000,-1649
+B1649: .db 113,-49,7
+L1650: add $31,$0,$1
+    ori $2,-50,$3
+    beq $4,$5,L1650
+    jmp L1651
+    la X2
+    call L1450
+    sw $6,50,$7
+    bne $8,$9,L1649
+W1650: .dw 1650000,-1650
+B1650: .db 114,-50,7
+S1650: .asciz "str1650"
+    .dh 1650
+.entry L1650
+.entry W1650
+L1651: add $6,$7,$8
+    ori $9,-49,$10
+    beq $11,$12,L1651
+    jmp L1652
+    la X3
+    call L1463
+    sw $13,51,$14
+    bne $15,$16,L1650
+W1651: .dw 1651000,-1651
+B1651: .db 115,-51,7
+L1652: add $13,$14,$15
+    ori $16,-48,$17
+    beq $18,$19,L1652
+    jmp L1653
+    la X4
+    call L1476
+    sw $20,52,$21
+    bne $22,$23,L1651
+W1652: .dw 1652000,-1652
+B1652: .db 116,-52,7
+L1653: add $20,$21,$22
+    ori $23,-47,$24
+    beq $25,$26,L1653
+    jmp L1654
+    la X5
+    call L1489
+    sw $27,53,$28
+    bne $29,$30,L1652
+W1653: .dw 1653000,-1653
+B1653: .db 117,-53,7
+L1654: add $27,$28,$29
+    ori $30,-46,$31
+    beq $0,$1,L1654
+    jmp L1655
+    la X6
+    call L1502
+    sw $2,54,$3
+    bne $4,$5,L1653
+W1654: .dw 1654000,-1654
+B1654: .db 118,-54,7
+L1655: add $2,$3,$4
+    ori $5,-45,$6
+    beq $7,$8,L1655
+    jmp L1656
+    la X7
+    call L1515
+    sw $9,55,$10
+    bne $11,$12,L1654
+W1655: .dw 1655000,-1655
+B1655: .db 119,-55,7
+L1656: add $9,$10,$11
+    ori $12,-44,$13
+    beq $14,$15,L1656
+    jmp L1657
+    la X0
+    call L1528
+    sw $16,56,$17
+    bne $18,$19,L1655
+W1656: .dw 1656000,-1656
+B1656: .db 120,-56,7
+L1657: add $16,$17,$18
+    ori $19,-43,$20
+    beq $21,$22,L1657
+    jmp L1658
+    la X1
+    call L1541
+    sw $23,57,$24
+    bne $25,$26,L1656
+W1657: .dw 1657000,-1657
+B1657: .db 121,-57,7
+L1658: add $23,$24,$25
+    ori $26,-42,$27
+    beq $28,$29,L1658
+    jmp L1659
+    la X2
+    call L1554
+    sw $30,58,$31
+    bne $0,$1,L1657
+W1658: .dw 1658000,-1658
+B1658: .db 122,-58,7
+L1659: add $30,$31,$0
+    ori $1,-41,$2
+    beq $3,$4,L1659
+    jmp L1660
+    la X3
+    call L1567
+    sw $5,59,$6
+    bne $7,$8,L1658
+W1659: .dw 1659000,-1659
+B1659: .db 123,-59,7
+L1660: add $5,$6,$7
+    ori $8,-40,$9
+    beq $10,$11,L1660
+    jmp L1661
+    la X4
+    call L1580
+    sw $12,60,$13
+    bne $14,$15,L1659
+W1660: .dw 1660000,-1660
+B1660: .db 124,-60,7
+S1660: .asciz "str1660"
+    .dh 1660
+L1661: add $12,$13,$14
+    ori $15,-39,$16
+    beq $17,$18,L1661
+    jmp L1662
+    la X5
+    call L1593
+    sw $19,61,$20
+    bne $21,$22,L1660
+W1661: .dw 1661000,-1661
+B1661: .db 125,-61,7
+L1662: add $19,$20,$21
+    ori $22,-38,$23
+    beq $24,$25,L1662
+    jmp L1663
+    la X6
+    call L1606
+    sw $26,62,$27
+    bne $28,$29,L1661
+W1662: .dw 1662000,-1662
+B1662: .db 126,-62,7
+L1663: add $26,$27,$28
+    ori $29,-37,$30
+    beq $31,$0,L1663
+    jmp L1664
+    la X7
+    call L1619
+    sw $1,63,$2
+    bne $3,$4,L1662
+W1663: .dw 1663000,-1663
+B1663: .db 127,-63,7
+L1664: add $1,$2,$3
+    ori $4,-36,$5
+    beq $6,$7,L1664
+    jmp L1665
+    la X0
+    call L1632
+    sw $8,64,$9
+    bne $10,$11,L1663
+W1664: .dw 1664000,-1664
+B1664: .db 0,-64,7
+L1665: add $8,$9,$10
+    ori $11,-35,$12
+    beq $13,$14,L1665
+    jmp L1666
+    la X1
+    call L1645
+    sw $15,65,$16
+    bne $17,$18,L1664
+W1665: .dw 1665000,-1665
+B1665: .db 1,-65,7
+L1666: add $15,$16,$17
+    ori $18,-34,$19
+    beq $20,$21,L1666
+    jmp L1667
+    la X2
+    call L1658
+    sw $22,66,$23
+    bne $24,$25,L1665
+W1666: .dw 1666000,-1666
+B1666: .db 2,-66,7
+L1667: add $22,$23,$24
+    ori $25,-33,$26
+    beq $27,$28,L1667
+    jmp L1668
+    la X3
+    call L1671
+    sw $29,67,$30
+    bne $31,$0,L1666
+W1667: .dw 1667000,-1667
+B1667: .db 3,-67,7
+L1668: add $29,$30,$31
+    ori $0,-32,$1
+    beq $2,$3,L1668
+    jmp L1669
+    la X4
+    call L1684
+    sw $4,68,$5
+    bne $6,$7,L1667
+W1668: .dw 1668000,-1668
+B1668: .db 4,-68,7
+L1669: add $4,$5,$6
+    ori $7,-31,$8
+    beq $9,$10,L1669
+    jmp L1670
+    la X5
+    call L1697
+    sw $11,69,$12
+    bne $13,$14,L1668
+W1669: .dw 1669000,-1669
+B1669: .db 5,-69,7
+L1670: add $11,$12,$13
+    ori $14,-30,$15
+    beq $16,$17,L1670
+    jmp L1671
+    la X6
+    call L1710
+    sw $18,70,$19
+    bne $20,$21,L1669
+W1670: .dw 1670000,-1670
+B1670: .db 6,-70,7
+S1670: .asciz "str1670"
+    .dh 1670
+L1671: add $18,$19,$20
+    ori $21,-29,$22
+    beq $23,$24,L1671
+    jmp L1672
+    la X7
+    call L1723
+    sw $25,71,$26
+    bne $27,$28,L1670
+W1671: .dw 1671000,-1671
+B1671: .db 7,-71,7
+L1672: add $25,$26,$27
+    ori $28,-28,$29
+    beq $30,$31,L1672
+    jmp L1673
+    la X0
+    call L1736
+    sw $0,72,$1
+    bne $2,$3,L1671
+W1672: .dw 1672000,-1672
+B1672: .db 8,-72,7
+L1673: add $0,$1,$2
+    ori $3,-27,$4
+    beq $5,$6,L1673
+    jmp L1674
+    la X1
+    call L1749
+    sw $7,73,$8
+    bne $9,$10,L1672
+W1673: .dw 1673000,-1673
+B1673: .db 9,-73,7
+L1674: add $7,$8,$9
+    ori $10,-26,$11
+    beq $12,$13,L1674
+    jmp L1675
+    la X2
+    call L1762
+    sw $14,74,$15
+    bne $16,$17,L1673
+W1674: .dw 1674000,-1674
+B1674: .db 10,-74,7
+L1675: add $14,$15,$16
+    ori $17,-25,$18
+    beq $19,$20,L1675
+    jmp L1676
+    la X3
+    call L1775
+    sw $21,75,$22
+    bne $23,$24,L1674
+W1675: .dw 1675000,-1675
+B1675: .db 11,-75,7
+L1676: add $21,$22,$23
+    ori $24,-24,$25
+    beq $26,$27,L1676
+    jmp L1677
+    la X4
+    call L1788
+    sw $28,76,$29
+    bne $30,$31,L1675
+W1676: .dw 1676000,-1676
+B1676: .db 12,-76,7
+L1677: add $28,$29,$30
+    ori $31,-23,$0
+    beq $1,$2,L1677
+    jmp L1678
+    la X5
+    call L1801
+    sw $3,77,$4
+    bne $5,$6,L1676
+W1677: .dw 1677000,-1677
+B1677: .db 13,-77,7
+L1678: add $3,$4,$5
+    ori $6,-22,$7
+    beq $8,$9,L1678
+    jmp L1679
+    la X6
+    call L1814
+    sw $10,78,$11
+    bne $12,$13,L1677
+W1678: .dw 1678000,-1678
+B1678: .db 14,-78,7
+L1679: add $10,$11,$12
+    ori $13,-21,$14
+    beq $15,$16,L1679
+    jmp L1680
+    la X7
+    call L1827
+    sw $17,79,$18
+    bne $19,$20,L1678
+W1679: .dw 1679000,-1679
+B1679: .db 15,-79,7
+L1680: add $17,$18,$19
+    ori $20,-20,$21
+    beq $22,$23,L1680
+    jmp L1681
+    la X0
+    call L1840
+    sw $24,80,$25
+    bne $26,$27,L1679
+W1680: .dw 1680000,-1680
+B1680: .db 16,-80,7
+S1680: .asciz "str1680"
+    .dh 1680
+L1681: add $24,$25,$26
+    ori $27,-19,$28
+    beq $29,$30,L1681
+    jmp L1682
+    la X1
+    call L1853
+    sw $31,81,$0
+    bne $1,$2,L1680
+W1681: .dw 1681000,-1681
+B1681: .db 17,-81,7
+L1682: add $31,$0,$1
+    ori $2,-18,$3
+    beq $4,$5,L1682
+    jmp L1683
+    la X2
+    call L1866
+    sw $6,82,$7
+    bne $8,$9,L1681
+W1682: .dw 1682000,-1682
+B1682: .db 18,-82,7
+L1683: add $6,$7,$8
+    ori $9,-17,$10
+    beq $11,$12,L1683
+    jmp L1684
+    la X3
+    call L1879
+    sw $13,83,$14
+    bne $15,$16,L1682
+W1683: .dw 1683000,-1683
+B1683: .db 19,-83,7
+L1684: add $13,$14,$15
+    ori $16,-16,$17
+    beq $18,$19,L1684
+    jmp L1685
+    la X4
+    call L1892
+    sw $20,84,$21
+    bne $22,$23,L1683
+W1684: .dw 1684000,-1684
+B1684: .db 20,-84,7
+L1685: add $20,$21,$22
+    ori $23,-15,$24
+    beq $25,$26,L1685
+    jmp L1686
+    la X5
+    call L1905
+    sw $27,85,$28
+    bne $29,$30,L1684
+W1685: .dw 1685000,-1685
+B1685: .db 21,-85,7
+L1686: add $27,$28,$29
+    ori $30,-14,$31
+    beq $0,$1,L1686
+    jmp L1687
+    la X6
+    call L1918
+    sw $2,86,$3
+    bne $4,$5,L1685
+W1686: .dw 1686000,-1686
+B1686: .db 22,-86,7
+L1687: add $2,$3,$4
+    ori $5,-13,$6
+    beq $7,$8,L1687
+    jmp L1688
+    la X7
+    call L1931
+    sw $9,87,$10
+    bne $11,$12,L1686
+W1687: .dw 1687000,-1687
+B1687: .db 23,-87,7
+L1688: add $9,$10,$11
+    ori $12,-12,$13
+    beq $14,$15,L1688
+    jmp L1689
+    la X0
+    call L1944
+    sw $16,88,$17
+    bne $18,$19,L1687
+W1688: .dw 1688000,-1688
+B1688: .db 24,-88,7
+L1689: add $16,$17,$18
+    ori $19,-11,$20
+    beq $21,$22,L1689
+    jmp L1690
+    la X1
+    call L1957
+    sw $23,89,$24
+    bne $25,$26,L1688
+W1689: .dw 1689000,-1689
+B1689: .db 25,-89,7
+L1690: add $23,$24,$25
+    ori $26,-10,$27
+    beq $28,$29,L1690
+    jmp L1691
+    la X2
+    call L1970
+    sw $30,90,$31
+    bne $0,$1,L1689
+W1690: .dw 1690000,-1690
+B1690: .db 26,-90,7
+S1690: .asciz "str1690"
+    .dh 1690
+L1691: add $30,$31,$0
+    ori $1,-9,$2
+    beq $3,$4,L1691
+    jmp L1692
+    la X3
+    call L1983
+    sw $5,91,$6
+    bne $7,$8,L1690
+W1691: .dw 1691000,-1691
+B1691: .db 27,-91,7
+L1692: add $5,$6,$7
+    ori $8,-8,$9
+    beq $10,$11,L1692
+    jmp L1693
+    la X4
+    call L1996
+    sw $12,92,$13
+    bne $14,$15,L1691
+W1692: .dw 1692000,-1692
+B1692: .db 28,-92,7
+L1693: add $12,$13,$14
+    ori $15,-7,$16
+    beq $17,$18,L1693
+    jmp L1694
+    la X5
+    call L2009
+    sw $19,93,$20
+    bne $21,$22,L1692
+W1693: .dw 1693000,-1693
+B1693: .db 29,-93,7
+L1694: add $19,$20,$21
+    ori $22,-6,$23
+    beq $24,$25,L1694
+    jmp L1695
+    la X6
+    call L2022
+    sw $26,94,$27
+    bne $28,$29,L1693
+W1694: .dw 1694000,-1694
+B1694: .db 30,-94,7
+L1695: add $26,$27,$28
+    ori $29,-5,$30
+    beq $31,$0,L1695
+    jmp L1696
+    la X7
+    call L2035
+    sw $1,95,$2
+    bne $3,$4,L1694
+W1695: .dw 1695000,-1695
+B1695: .db 31,-95,7
+L1696: add $1,$2,$3
+    ori $4,-4,$5
+    beq $6,$7,L1696
+    jmp L1697
+    la X0
+    call L2048
+    sw $8,96,$9
+    bne $10,$11,L1695
+W1696: .dw 1696000,-1696
+B1696: .db 32,-96,7
+L1697: add $8,$9,$10
+    ori $11,-3,$12
+    beq $13,$14,L1697
+    jmp L1698
+    la X1
+    call L2061
+    sw $15,97,$16
+    bne $17,$18,L1696
+W1697: .dw 1697000,-1697
+B1697: .db 33,-97,7
+L1698: add $15,$16,$17
+    ori $18,-2,$19
+    beq $20,$21,L1698
+    jmp L1699
+    la X2
+    call L2074
+    sw $22,98,$23
+    bne $24,$25,L1697
+W1698: .dw 1698000,-1698
+B1698: .db 34,-98,7
+L1699: add $22,$23,$24
+    ori $25,-1,$26
+    beq $27,$28,L1699
+    jmp L1700
+    la X3
+    call L2087
+    sw $29,99,$30
+    bne $31,$0,L1698
+W1699: .dw 1699000,-1699
+B1699: .db 35,-99,7
+L1700: add $29,$30,$31
+    ori $0,0,$1
+    beq $2,$3,L1700
+    jmp L1701
+    la X4
+    call L2100
+    sw $4,0,$5
+    bne $6,$7,L1699
+W1700: .dw 1700000,-1700
+B1700: .db 36,0,7
+S1700: .asciz "str1700"
+    .dh 1700
+.entry L1700
+.entry W1700
+L1701: add $4,$5,$6
+    ori $7,1,$8
+    beq $9,$10,L1701
+    jmp L1702
+    la X5
+    call L2113
+    sw $11,1,$12
+    bne $13,$14,L1700
+W1701: .dw 1701000,-1701
+B1701: .db 37,-1,7
+L1702: add $11,$12,$13
+    ori $14,2,$15
+    beq $16,$17,L1702
+    jmp L1703
+    la X6
+    call L2126
+    sw $18,2,$19
+    bne $20,$21,L1701
+W1702: .dw 1702000,-1702
+B1702: .db 38,-2,7
+L1703: add $18,$19,$20
+    ori $21,3,$22
+    beq $23,$24,L1703
+    jmp L1704
+    la X7
+    call L2139
+    sw $25,3,$26
+    bne $27,$28,L1702
+W1703: .dw 1703000,-1703
+B1703: .db 39,-3,7
+L1704: add $25,$26,$27
+    ori $28,4,$29
+    beq $30,$31,L1704
+    jmp L1705
+    la X0
+    call L2152
+    sw $0,4,$1
+    bne $2,$3,L1703
+W1704: .dw 1704000,-1704
+B1704: .db 40,-4,7
+L1705: add $0,$1,$2
+    ori $3,5,$4
+    beq $5,$6,L1705
+    jmp L1706
+    la X1
+    call L2165
+    sw $7,5,$8
+    bne $9,$10,L1704
+W1705: .dw 1705000,-1705
+B1705: .db 41,-5,7
+L1706: add $7,$8,$9
+    ori $10,6,$11
+    beq $12,$13,L1706
+    jmp L1707
+    la X2
+    call L2178
+    sw $14,6,$15
+    bne $16,$17,L1705
+W1706: .dw 1706000,-1706
+B1706: .db 42,-6,7
+L1707: add $14,$15,$16
+    ori $17,7,$18
+    beq $19,$20,L1707
+    jmp L1708
+    la X3
+    call L2191
+    sw $21,7,$22
+    bne $23,$24,L1706
+W1707: .dw 1707000,-1707
+B1707: .db 43,-7,7
+L1708: add $21,$22,$23
+    ori $24,8,$25
+    beq $26,$27,L1708
+    jmp L1709
+    la X4
+    call L2204
+    sw $28,8,$29
+    bne $30,$31,L1707
+W1708: .dw 1708000,-1708
+B1708: .db 44,-8,7
+L1709: add $28,$29,$30
+    ori $31,9,$0
+    beq $1,$2,L1709
+    jmp L1710
+    la X5
+    call L2217
+    sw $3,9,$4
+    bne $5,$6,L1708
+W1709: .dw 1709000,-1709
+B1709: .db 45,-9,7
+L1710: add $3,$4,$5
+    ori $6,10,$7
+    beq $8,$9,L1710
+    jmp L1711
+    la X6
+    call L2230
+    sw $10,10,$11
+    bne $12,$13,L1709
+W1710: .dw 1710000,-1710
+B1710: .db 46,-10,7
+S1710: .asciz "str1710"
+    .dh 1710
+L1711: add $10,$11,$12
+    ori $13,11,$14
+    beq $15,$16,L1711
+    jmp L1712
+    la X7
+    call L2243
+    sw $17,11,$18
+    bne $19,$20,L1710
+W1711: .dw 1711000,-1711
+B1711: .db 47,-11,7
+L1712: add $17,$18,$19
+    ori $20,12,$21
+    beq $22,$23,L1712
+    jmp L1713
+    la X0
+    call L2256
+    sw $24,12,$25
+    bne $26,$27,L1711
+W1712: .dw 1712000,-1712
+B1712: .db 48,-12,7
+L1713: add $24,$25,$26
+    ori $27,13,$28
+    beq $29,$30,L1713
+    jmp L1714
+    la X1
+    call L2269
+    sw $31,13,$0
+    bne $1,$2,L1712
+W1713: .dw 1713000,-1713
+B1713: .db 49,-13,7
+L1714: add $31,$0,$1
+    ori $2,14,$3
+    beq $4,$5,L1714
+    jmp L1715
+    la X2
+    call L2282
+    sw $6,14,$7
+    bne $8,$9,L1713
+W1714: .dw 1714000,-1714
+B1714: .db 50,-14,7
+L1715: add $6,$7,$8
+    ori $9,15,$10
+    beq $11,$12,L1715
+    jmp L1716
+    la X3
+    call L2295
+    sw $13,15,$14
+    bne $15,$16,L1714
+W1715: .dw 1715000,-1715
+B1715: .db 51,-15,7
+L1716: add $13,$14,$15
+    ori $16,16,$17
+    beq $18,$19,L1716
+    jmp L1717
+    la X4
+    call L2308
+    sw $20,16,$21
+    bne $22,$23,L1715
+W1716: .dw 1716000,-1716
+B1716: .db 52,-16,7
+L1717: add $20,$21,$22
+    ori $23,17,$24
+    beq $25,$26,L1717
+    jmp L1718
+    la X5
+    call L2321
+    sw $27,17,$28
+    bne $29,$30,L1716
+W1717: .dw 1717000,-1717
+B1717: .db 53,-17,7
+L1718: add $27,$28,$29
+    ori $30,18,$31
+    beq $0,$1,L1718
+    jmp L1719
+    la X6
+    call L2334
+    sw $2,18,$3
+    bne $4,$5,L1717
+W1718: .dw 1718000,-1718
+B1718: .db 54,-18,7
+L1719: add $2,$3,$4
+    ori $5,19,$6
+    beq $7,$8,L1719
+    jmp L1720
+    la X7
+    call L2347
+    sw $9,19,$10
+    bne $11,$12,L1718
+W1719: .dw 1719000,-1719
+B1719: .db 55,-19,7
+L1720: add $9,$10,$11
+    ori $12,20,$13
+    beq $14,$15,L1720
+    jmp L1721
+    la X0
+    call L2360
+    sw $16,20,$17
+    bne $18,$19,L1719
+W1720: .dw 1720000,-1720
+B1720: .db 56,-20,7
+S1720: .asciz "str1720"
+    .dh 1720
+L1721: add $16,$17,$18
+    ori $19,21,$20
+    beq $21,$22,L1721
+    jmp L1722
+    la X1
+    call L2373
+    sw $23,21,$24
+    bne $25,$26,L1720
+W1721: .dw 1721000,-1721
+B1721: .db 57,-21,7
+L1722: add $23,$24,$25
+    ori $26,22,$27
+    beq $28,$29,L1722
+    jmp L1723
+    la X2
+    call L2386
+    sw $30,22,$31
+    bne $0,$1,L1721
+W1722: .dw 1722000,-1722
+B1722: .db 58,-22,7
+L1723: add $30,$31,$0
+    ori $1,23,$2
+    beq $3,$4,L1723
+    jmp L1724
+    la X3
+    call L2399
+    sw $5,23,$6
+    bne $7,$8,L1722
+W1723: .dw 1723000,-1723
+B1723: .db 59,-23,7
+L1724: add $5,$6,$7
+    ori $8,24,$9
+    beq $10,$11,L1724
+    jmp L1725
+    la X4
+    call L2412
+    sw $12,24,$13
+    bne $14,$15,L1723
+W1724: .dw 1724000,-1724
+B1724: .db 60,-24,7
+L1725: add $12,$13,$14
+    ori $15,25,$16
+    beq $17,$18,L1725
+    jmp L1726
+    la X5
+    call L2425
+    sw $19,25,$20
+    bne $21,$22,L1724
+W1725: .dw 1725000,-1725
+B1725: .db 61,-25,7
+L1726: add $19,$20,$21
+    ori $22,26,$23
+    beq $24,$25,L1726
+    jmp L1727
+    la X6
+    call L2438
+    sw $26,26,$27
+    bne $28,$29,L1725
+W1726: .dw 1726000,-1726
+B1726: .db 62,-26,7
+L1727: add $26,$27,$28
+    ori $29,27,$30
+    beq $31,$0,L1727
+    jmp L1728
+    la X7
+    call L2451
+    sw $1,27,$2
+    bne $3,$4,L1726
+W1727: .dw 1727000,-1727
+B1727: .db 63,-27,7
+L1728: add $1,$2,$3
+    ori $4,28,$5
+    beq $6,$7,L1728
+    jmp L1729
+    la X0
+    call L2464
+    sw $8,28,$9
+    bne $10,$11,L1727
+W1728: .dw 1728000,-1728
+B1728: .db 64,-28,7
+L1729: add $8,$9,$10
+    ori $11,29,$12
+    beq $13,$14,L1729
+    jmp L1730
+    la X1
+    call L2477
+    sw $15,29,$16
+    bne $17,$18,L1728
+W1729: .dw 1729000,-1729
+B1729: .db 65,-29,7
+L1730: add $15,$16,$17
+    ori $18,30,$19
+    beq $20,$21,L1730
+    jmp L1731
+    la X2
+    call L2490
+    sw $22,30,$23
+    bne $24,$25,L1729
+W1730: .dw 1730000,-1730
+B1730: .db 66,-30,7
+S1730: .asciz "str1730"
+    .dh 1730
+L1731: add $22,$23,$24
+    ori $25,31,$26
+    beq $27,$28,L1731
+    jmp L1732
+    la X3
+    call L3
+    sw $29,31,$30
+    bne $31,$0,L1730
+W1731: .dw 1731000,-1731
+B1731: .db 67,-31,7
+L1732: add $29,$30,$31
+    ori $0,32,$1
+    beq $2,$3,L1732
+    jmp L1733
+    la X4
+    call L16
+    sw $4,32,$5
+    bne $6,$7,L1731
+W1732: .dw 1732000,-1732
+B1732: .db 68,-32,7
+L1733: add $4,$5,$6
+    ori $7,33,$8
+    beq $9,$10,L1733
+    jmp L1734
+    la X5
+    call L29
+    sw $11,33,$12
+    bne $13,$14,L1732
+W1733: .dw 1733000,-1733
+B1733: .db 69,-33,7
+L1734: add $11,$12,$13
+    ori $14,34,$15
+    beq $16,$17,L1734
+    jmp L1735
+    la X6
+    call L42
+    sw $18,34,$19
+    bne $20,$21,L1733
+W1734: .dw 1734000,-1734
+B1734: .db 70,-34,7
+L1735: add $18,$19,$20
+    ori $21,35,$22
+    beq $23,$24,L1735
+    jmp L1736
+    la X7
+    call L55
+    sw $25,35,$26
+    bne $27,$28,L1734
+W1735: .dw 1735000,-1735
+B1735: .db 71,-35,7
+L1736: add $25,$26,$27
+    ori $28,36,$29
+    beq $30,$31,L1736
+    jmp L1737
+    la X0
+    call L68
+    sw $0,36,$1
+    bne $2,$3,L1735
+W1736: .dw 1736000,-1736
+B1736: .db 72,-36,7
+L1737: add $0,$1,$2
+    ori $3,37,$4
+    beq $5,$6,L1737
+    jmp L1738
+    la X1
+    call L81
+    sw $7,37,$8
+    bne $9,$10,L1736
+W1737: .dw 1737000,-1737
+B1737: .db 73,-37,7
+L1738: add $7,$8,$9
+    ori $10,38,$11
+    beq $12,$13,L1738
+    jmp L1739
+    la X2
+    call L94
+    sw $14,38,$15
+    bne $16,$17,L1737
+W1738: .dw 1738000,-1738
+B1738: .db 74,-38,7
+L1739: add $14,$15,$16
+    ori $17,39,$18
+    beq $19,$20,L1739
+    jmp L1740
+    la X3
+    call L107
+    sw $21,39,$22
+    bne $23,$24,L1738
+W1739: .dw 1739000,-1739
+B1739: .db 75,-39,7
+L1740: add $21,$22,$23
+    ori $24,40,$25
+    beq $26,$27,L1740
+    jmp L1741
+    la X4
+    call L120
+    sw $28,40,$29
+    bne $30,$31,L1739
+W1740: .dw 1740000,-1740
+B1740: .db 76,-40,7
+S1740: .asciz "str1740"
+    .dh 1740
+L1741: add $28,$29,$30
+    ori $31,41,$0
+    beq $1,$2,L1741
+    jmp L1742
+    la X5
+    call L133
+    sw $3,41,$4
+    bne $5,$6,L1740
+W1741: .dw 1741000,-1741
+B1741: .db 77,-41,7
+L1742: add $3,$4,$5
+    ori $6,42,$7
+    beq $8,$9,L1742
+    jmp L1743
+    la X6
+    call L146
+    sw $10,42,$11
+    bne $12,$13,L1741
+W1742: .dw 1742000,-1742
+B1742: .db 78,-42,7
+L1743: add $10,$11,$12
+    ori $13,43,$14
+    beq $15,$16,L1743
+    jmp L1744
+    la X7
+    call L159
+    sw $17,43,$18
+    bne $19,$20,L1742
+W1743: .dw 1743000,-1743
+B1743: .db 79,-43,7
+L1744: add $17,$18,$19
+    ori $20,44,$21
+    beq $22,$23,L1744
+    jmp L1745
+    la X0
+    call L172
+    sw $24,44,$25
+    bne $26,$27,L1743
+W1744: .dw 1744000,-1744
+B1744: .db 80,-44,7
+L1745: add $24,$25,$26
+    ori $27,45,$28
+    beq $29,$30,L1745
+    jmp L1746
+    la X1
+    call L185
+    sw $31,45,$0
+    bne $1,$2,L1744
+W1745: .dw 1745000,-1745
+B1745: .db 81,-45,7
+L1746: add $31,$0,$1
+    ori $2,46,$3
+    beq $4,$5,L1746
+    jmp L1747
+    la X2
+    call L198
+    sw $6,46,$7
+    bne $8,$9,L1745
+W1746: .dw 1746000,-1746
+B1746: .db 82,-46,7
+L1747: add $6,$7,$8
+    ori $9,47,$10
+    beq $11,$12,L1747
+    jmp L1748
+    la X3
+    call L211
+    sw $13,47,$14
+    bne $15,$16,L1746
+W1747: .dw 1747000,-1747
+B1747: .db 83,-47,7
+L1748: add $13,$14,$15
+    ori $16,48,$17
+    beq $18,$19,L1748
+    jmp L1749
+    la X4
+    call L224
+    sw $20,48,$21
+    bne $22,$23,L1747
+W1748: .dw 1748000,-1748
+B1748: .db 84,-48,7
+L1749: add $20,$21,$22
+    ori $23,49,$24
+    beq $25,$26,L1749
+    jmp L1750
+    la X5
+    call L237
+    sw $27,49,$28
+    bne $29,$30,L1748
+W1749: .dw 1749000,-1749
+B1749: .db 85,-49,7
+L1750: add $27,$28,$29
+    ori $30,50,$31
+    beq $0,$1,L1750
+    jmp L1751
+    la X6
+    call L250
+    sw $2,50,$3
+    bne $4,$5,L1749
+W1750: .dw 1750000,-1750
+B1750: .db 86,-50,7
+S1750: .asciz "str1750"
+    .dh 1750
+.entry L1750
+.entry W1750
+L1751: add $2,$3,$4
+    ori $5,51,$6
+    beq $7,$8,L1751
+    jmp L1752
+    la X7
+    call L263
+    sw $9,51,$10
+    bne $11,$12,L1750
+W1751: .dw 1751000,-1751
+B1751: .db 87,-51,7
+L1752: add $9,$10,$11
+    ori $12,52,$13
+    beq $14,$15,L1752
+    jmp L1753
+    la X0
+    call L276
+    sw $16,52,$17
+    bne $18,$19,L1751
+W1752: .dw 1752000,-1752
+B1752: .db 88,-52,7
+L1753: add $16,$17,$18
+    ori $19,53,$20
+    beq $21,$22,L1753
+    jmp L1754
+    la X1
+    call L289
+    sw $23,53,$24
+    bne $25,$26,L1752
+W1753: .dw 1753000,-1753
+B1753: .db 89,-53,7
+L1754: add $23,$24,$25
+    ori $26,54,$27
+    beq $28,$29,L1754
+    jmp L1755
+    la X2
+    call L302
+    sw $30,54,$31
+    bne $0,$1,L1753
+W1754: .dw 1754000,-1754
+B1754: .db 90,-54,7
+L1755: add $30,$31,$0
+    ori $1,55,$2
+    beq $3,$4,L1755
+    jmp L1756
+    la X3
+    call L315
+    sw $5,55,$6
+    bne $7,$8,L1754
+W1755: .dw 1755000,-1755
+B1755: .db 91,-55,7
+L1756: add $5,$6,$7
+    ori $8,56,$9
+    beq $10,$11,L1756
+    jmp L1757
+    la X4
+    call L328
+    sw $12,56,$13
+    bne $14,$15,L1755
+W1756: .dw 1756000,-1756
+B1756: .db 92,-56,7
+L1757: add $12,$13,$14
+    ori $15,57,$16
+    beq $17,$18,L1757
+    jmp L1758
+    la X5
+    call L341
+    sw $19,57,$20
+    bne $21,$22,L1756
+W1757: .dw 1757000,-1757
+B1757: .db 93,-57,7
+L1758: add $19,$20,$21
+    ori $22,58,$23
+    beq $24,$25,L1758
+    jmp L1759
+    la X6
+    call L354
+    sw $26,58,$27
+    bne $28,$29,L1757
+W1758: .dw 1758000,-1758
+B1758: .db 94,-58,7
+L1759: add $26,$27,$28
+    ori $29,59,$30
+    beq $31,$0,L1759
+    jmp L1760
+    la X7
+    call L367
+    sw $1,59,$2
+    bne $3,$4,L1758
+W1759: .dw 1759000,-1759
+B1759: .db 95,-59,7
+L1760: add $1,$2,$3
+    ori $4,60,$5
+    beq $6,$7,L1760
+    jmp L1761
+    la X0
+    call L380
+    sw $8,60,$9
+    bne $10,$11,L1759
+W1760: .dw 1760000,-1760
+B1760: .db 96,-60,7
+S1760: .asciz "str1760"
+    .dh 1760
+L1761: add $8,$9,$10
+    ori $11,61,$12
+    beq $13,$14,L1761
+    jmp L1762
+    la X1
+    call L393
+    sw $15,61,$16
+    bne $17,$18,L1760
+W1761: .dw 1761000,-1761
+B1761: .db 97,-61,7
+L1762: add $15,$16,$17
+    ori $18,62,$19
+    beq $20,$21,L1762
+    jmp L1763
+    la X2
+    call L406
+    sw $22,62,$23
+    bne $24,$25,L1761
+W1762: .dw 1762000,-1762
+B1762: .db 98,-62,7
+L1763: add $22,$23,$24
+    ori $25,63,$26
+    beq $27,$28,L1763
+    jmp L1764
+    la X3
+    call L419
+    sw $29,63,$30
+    bne $31,$0,L1762
+W1763: .dw 1763000,-1763
+B1763: .db 99,-63,7
+L1764: add $29,$30,$31
+    ori $0,64,$1
+    beq $2,$3,L1764
+    jmp L1765
+    la X4
+    call L432
+    sw $4,64,$5
+    bne $6,$7,L1763
+W1764: .dw 1764000,-1764
+B1764: .db 100,-64,7
+L1765: add $4,$5,$6
+    ori $7,65,$8
+    beq $9,$10,L1765
+    jmp L1766
+    la X5
+    call L445
+    sw $11,65,$12
+    bne $13,$14,L1764
+W1765: .dw 1765000,-1765
+B1765: .db 101,-65,7
+L1766: add $11,$12,$13
+    ori $14,66,$15
+    beq $16,$17,L1766
+    jmp L1767
+    la X6
+    call L458
+    sw $18,66,$19
+    bne $20,$21,L1765
+W1766: .dw 1766000,-1766
+B1766: .db 102,-66,7
+L1767: add $18,$19,$20
+    ori $21,67,$22
+    beq $23,$24,L1767
+    jmp L1768
+    la X7
+    call L471
+    sw $25,67,$26
+    bne $27,$28,L1766
+W1767: .dw 1767000,-1767
+B1767: .db 103,-67,7
+L1768: add $25,$26,$27
+    ori $28,68,$29
+    beq $30,$31,L1768
+    jmp L1769
+    la X0
+    call L484
+    sw $0,68,$1
+    bne $2,$3,L1767
+W1768: .dw 1768000,-1768
+B1768: .db 104,-68,7
+L1769: add $0,$1,$2
+    ori $3,69,$4
+    beq $5,$6,L1769
+    jmp L1770
+    la X1
+    call L497
+    sw $7,69,$8
+    bne $9,$10,L1768
+W1769: .dw 1769000,-1769
+B1769: .db 105,-69,7
+L1770: add $7,$8,$9
+    ori $10,70,$11
+    beq $12,$13,L1770
+    jmp L1771
+    la X2
+    call L510
+    sw $14,70,$15
+    bne $16,$17,L1769
+W1770: .dw 1770000,-1770
+B1770: .db 106,-70,7
+S1770: .asciz "str1770"
+    .dh 1770
+L1771: add $14,$15,$16
+    ori $17,71,$18
+    beq $19,$20,L1771
+    jmp L1772
+    la X3
+    call L523
+    sw $21,71,$22
+    bne $23,$24,L1770
+W1771: .dw 1771000,-1771
+B1771: .db 107,-71,7
+L1772: add $21,$22,$23
+    ori $24,72,$25
+    beq $26,$27,L1772
+    jmp L1773
+    la X4
+    call L536
+    sw $28,72,$29
+    bne $30,$31,L1771
+W1772: .dw 1772000,-1772
+B1772: .db 108,-72,7
+L1773: add $28,$29,$30
+    ori $31,73,$0
+    beq $1,$2,L1773
+    jmp L1774
+    la X5
+    call L549
+    sw $3,73,$4
+    bne $5,$6,L1772
+W1773: .dw 1773000,-1773
+B1773: .db 109,-73,7
+L1774: add $3,$4,$5
+    ori $6,74,$7
+    beq $8,$9,L1774
+    jmp L1775
+    la X6
+    call L562
+    sw $10,74,$11
+    bne $12,$13,L1773
+W1774: .dw 1774000,-1774
+B1774: .db 110,-74,7
+L1775: add $10,$11,$12
+    ori $13,75,$14
+    beq $15,$16,L1775
+    jmp L1776
+    la X7
+    call L575
+    sw $17,75,$18
+    bne $19,$20,L1774
+W1775: .dw 1775000,-1775
+B1775: .db 111,-75,7
+L1776: add $17,$18,$19
+    ori $20,76,$21
+    beq $22,$23,L1776
+    jmp L1777
+    la X0
+    call L588
+    sw $24,76,$25
+    bne $26,$27,L1775
+W1776: .dw 1776000,-1776
+B1776: .db 112,-76,7
+L1777: add $24,$25,$26
+    ori $27,77,$28
+    beq $29,$30,L1777
+    jmp L1778
+    la X1
+    call L601
+    sw $31,77,$0
+    bne $1,$2,L1776
+W1777: .dw 1777000,-1777
+B1777: .db 113,-77,7
+L1778: add $31,$0,$1
+    ori $2,78,$3
+    beq $4,$5,L1778
+    jmp L1779
+    la X2
+    call L614
+    sw $6,78,$7
+    bne $8,$9,L1777
+W1778: .dw 1778000,-1778
+B1778: .db 114,-78,7
+L1779: add $6,$7,$8
+    ori $9,79,$10
+    beq $11,$12,L1779
+    jmp L1780
+    la X3
+    call L627
+    sw $13,79,$14
+    bne $15,$16,L1778
+W1779: .dw 1779000,-1779
+B1779: .db 115,-79,7
+L1780: add $13,$14,$15
+    ori $16,80,$17
+    beq $18,$19,L1780
+    jmp L1781
+    la X4
+    call L640
+    sw $20,80,$21
+    bne $22,$23,L1779
+W1780: .dw 1780000,-1780
+B1780: .db 116,-80,7
+S1780: .asciz "str1780"
+    .dh 1780
+L1781: add $20,$21,$22
+    ori $23,81,$24
+    beq $25,$26,L1781
+    jmp L1782
+    la X5
+    call L653
+    sw $27,81,$28
+    bne $29,$30,L1780
+W1781: .dw 1781000,-1781
+B1781: .db 117,-81,7
+L1782: add $27,$28,$29
+    ori $30,82,$31
+    beq $0,$1,L1782
+    jmp L1783
+    la X6
+    call L666
+    sw $2,82,$3
+    bne $4,$5,L1781
+W1782: .dw 1782000,-1782
+B1782: .db 118,-82,7
+L1783: add $2,$3,$4
+    ori $5,83,$6
+    beq $7,$8,L1783
+    jmp L1784
+    la X7
+    call L679
+    sw $9,83,$10
+    bne $11,$12,L1782
+W1783: .dw 1783000,-1783
+B1783: .db 119,-83,7
+L1784: add $9,$10,$11
+    ori $12,84,$13
+    beq $14,$15,L1784
+    jmp L1785
+    la X0
+    call L692
+    sw $16,84,$17
+    bne $18,$19,L1783
+W1784: .dw 1784000,-1784
+B1784: .db 120,-84,7
+L1785: add $16,$17,$18
+    ori $19,85,$20
+    beq $21,$22,L1785
+    jmp L1786
+    la X1
+    call L705
+    sw $23,85,$24
+    bne $25,$26,L1784
+W1785: .dw 1785000,-1785
+B1785: .db 121,-85,7
+L1786: add $23,$24,$25
+    ori $26,86,$27
+    beq $28,$29,L1786
+    jmp L1787
+    la X2
+    call L718
+    sw $30,86,$31
+    bne $0,$1,L1785
+W1786: .dw 1786000,-1786
+B1786: .db 122,-86,7
+L1787: add $30,$31,$0
+    ori $1,87,$2
+    beq $3,$4,L1787
+    jmp L1788
+    la X3
+    call L731
+    sw $5,87,$6
+    bne $7,$8,L1786
+W1787: .dw 1787000,-1787
+B1787: .db 123,-87,7
+L1788: add $5,$6,$7
+    ori $8,88,$9
+    beq $10,$11,L1788
+    jmp L1789
+    la X4
+    call L744
+    sw $12,88,$13
+    bne $14,$15,L1787
+W1788: .dw 1788000,-1788
+B1788: .db 124,-88,7
+L1789: add $12,$13,$14
+    ori $15,89,$16
+    beq $17,$18,L1789
+    jmp L1790
+    la X5
+    call L757
+    sw $19,89,$20
+    bne $21,$22,L1788
+W1789: .dw 1789000,-1789
+B1789: .db 125,-89,7
+L1790: add $19,$20,$21
+    ori $22,90,$23
+    beq $24,$25,L1790
+    jmp L1791
+    la X6
+    call L770
+    sw $26,90,$27
+    bne $28,$29,L1789
+W1790: .dw 1790000,-1790
+B1790: .db 126,-90,7
+S1790: .asciz "str1790"
+    .dh 1790
+L1791: add $26,$27,$28
+    ori $29,91,$30
+    beq $31,$0,L1791
+    jmp L1792
+    la X7
+    call L783
+    sw $1,91,$2
+    bne $3,$4,L1790
+W1791: .dw 1791000,-1791
+B1791: .db 127,-91,7
+L1792: add $1,$2,$3
+    ori $4,92,$5
+    beq $6,$7,L1792
+    jmp L1793
+    la X0
+    call L796
+    sw $8,92,$9
+    bne $10,$11,L1791
+W1792: .dw 1792000,-1792
+B1792: .db 0,-92,7
+L1793: add $8,$9,$10
+    ori $11,93,$12
+    beq $13,$14,L1793
+    jmp L1794
+    la X1
+    call L809
+    sw $15,93,$16
+    bne $17,$18,L1792
+W1793: .dw 1793000,-1793
+B1793: .db 1,-93,7
+L1794: add $15,$16,$17
+    ori $18,94,$19
+    beq $20,$21,L1794
+    jmp L1795
+    la X2
+    call L822
+    sw $22,94,$23
+    bne $24,$25,L1793
+W1794: .dw 1794000,-1794
+B1794: .db 2,-94,7
+L1795: add $22,$23,$24
+    ori $25,95,$26
+    beq $27,$28,L1795
+    jmp L1796
+    la X3
+    call L835
+    sw $29,95,$30
+    bne $31,$0,L1794
+W1795: .dw 1795000,-1795
+B1795: .db 3,-95,7
+L1796: add $29,$30,$31
+    ori $0,96,$1
+    beq $2,$3,L1796
+    jmp L1797
+    la X4
+    call L848
+    sw $4,96,$5
+    bne $6,$7,L1795
+W1796: .dw 1796000,-1796
+B1796: .db 4,-96,7
+L1797: add $4,$5,$6
+    ori $7,97,$8
+    beq $9,$10,L1797
+    jmp L1798
+    la X5
+    call L861
+    sw $11,97,$12
+    bne $13,$14,L1796
+W1797: .dw 1797000,-1797
+B1797: .db 5,-97,7
+L1798: add $11,$12,$13
+    ori $14,98,$15
+    beq $16,$17,L1798
+    jmp L1799
+    la X6
+    call L874
+    sw $18,98,$19
+    bne $20,$21,L1797
+W1798: .dw 1798000,-1798
+B1798: .db 6,-98,7
+L1799: add $18,$19,$20
+    ori $21,99,$22
+    beq $23,$24,L1799
+    jmp L1800
+    la X7
+    call L887
+    sw $25,99,$26
+    bne $27,$28,L1798
+W1799: .dw 1799000,-1799
+B1799: .db 7,-99,7
+L1800: add $25,$26,$27
+    ori $28,-100,$29
+    beq $30,$31,L1800
+    jmp L1801
+    la X0
+    call L900
+    sw $0,0,$1
+    bne $2,$3,L1799
+W1800: .dw 1800000,-1800
+B1800: .db 8,0,7
+S1800: .asciz "str1800"
+    .dh 1800
+.entry L1800
+.entry W1800
+L1801: add $0,$1,$2
+    ori $3,-99,$4
+    beq $5,$6,L1801
+    jmp L1802
+    la X1
+    call L913
+    sw $7,1,$8
+    bne $9,$10,L1800
+W1801: .dw 1801000,-1801
+B1801: .db 9,-1,7
+L1802: add $7,$8,$9
+    ori $10,-98,$11
+    beq $12,$13,L1802
+    jmp L1803
+    la X2
+    call L926
+    sw $14,2,$15
+    bne $16,$17,L1801
+W1802: .dw 1802000,-1802
+B1802: .db 10,-2,7
+L1803: add $14,$15,$16
+    ori $17,-97,$18
+    beq $19,$20,L1803
+    jmp L1804
+    la X3
+    call L939
+    sw $21,3,$22
+    bne $23,$24,L1802
+W1803: .dw 1803000,-1803
+B1803: .db 11,-3,7
+L1804: add $21,$22,$23
+    ori $24,-96,$25
+    beq $26,$27,L1804
+    jmp L1805
+    la X4
+    call L952
+    sw $28,4,$29
+    bne $30,$31,L1803
+W1804: .dw 1804000,-1804
+B1804: .db 12,-4,7
+L1805: add $28,$29,$30
+    ori $31,-95,$0
+    beq $1,$2,L1805
+    jmp L1806
+    la X5
+    call L965
+    sw $3,5,$4
+    bne $5,$6,L1804
+W1805: .dw 1805000,-1805
+B1805: .db 13,-5,7
+L1806: add $3,$4,$5
+    ori $6,-94,$7
+    beq $8,$9,L1806
+    jmp L1807
+    la X6
+    call L978
+    sw $10,6,$11
+    bne $12,$13,L1805
+W1806: .dw 1806000,-1806
+B1806: .db 14,-6,7
+L1807: add $10,$11,$12
+    ori $13,-93,$14
+    beq $15,$16,L1807
+    jmp L1808
+    la X7
+    call L991
+    sw $17,7,$18
+    bne $19,$20,L1806
+W1807: .dw 1807000,-1807
+B1807: .db 15,-7,7
+L1808: add $17,$18,$19
+    ori $20,-92,$21
+    beq $22,$23,L1808
+    jmp L1809
+    la X0
+    call L1004
+    sw $24,8,$25
+    bne $26,$27,L1807
+W1808: .dw 1808000,-1808
+B1808: .db 16,-8,7
+L1809: add $24,$25,$26
+    ori $27,-91,$28
+    beq $29,$30,L1809
+    jmp L1810
+    la X1
+    call L1017
+    sw $31,9,$0
+    bne $1,$2,L1808
+W1809: .dw 1809000,-1809
+B1809: .db 17,-9,7
+L1810: add $31,$0,$1
+    ori $2,-90,$3
+    beq $4,$5,L1810
+    jmp L1811
+    la X2
+    call L1030
+    sw $6,10,$7
+    bne $8,$9,L1809
+W1810: .dw 1810000,-1810
+B1810: .db 18,-10,7
+S1810: .asciz "str1810"
+    .dh 1810
+L1811: add $6,$7,$8
+    ori $9,-89,$10
+    beq $11,$12,L1811
+    jmp L1812
+    la X3
+    call L1043
+    sw $13,11,$14
+    bne $15,$16,L1810
+W1811: .dw 1811000,-1811
+B1811: .db 19,-11,7
+L1812: add $13,$14,$15
+    ori $16,-88,$17
+    beq $18,$19,L1812
+    jmp L1813
+    la X4
+    call L1056
+    sw $20,12,$21
+    bne $22,$23,L1811
+W1812: .dw 1812000,-1812
+B1812: .db 20,-12,7
+L1813: add $20,$21,$22
+    ori $23,-87,$24
+    beq $25,$26,L1813
+    jmp L1814
+    la X5
+    call L1069
+    sw $27,13,$28
+    bne $29,$30,L1812
+W1813: .dw 1813000,-1813
+B1813: .db 21,-13,7
+L1814: add $27,$28,$29
+    ori $30,-86,$31
+    beq $0,$1,L1814
+    jmp L1815
+    la X6
+    call L1082
+    sw $2,14,$3
+    bne $4,$5,L1813
+W1814: .dw 1814000,-1814
+B1814: .db 22,-14,7
+L1815: add $2,$3,$4
+    ori $5,-85,$6
+    beq $7,$8,L1815
+    jmp L1816
+    la X7
+    call L1095
+    sw $9,15,$10
+    bne $11,$12,L1814
+W1815: .dw 1815000,-1815
+B1815: .db 23,-15,7
+L1816: add $9,$10,$11
+    ori $12,-84,$13
+    beq $14,$15,L1816
+    jmp L1817
+    la X0
+    call L1108
+    sw $16,16,$17
+    bne $18,$19,L1815
+W1816: .dw 1816000,-1816
+B1816: .db 24,-16,7
+L1817: add $16,$17,$18
+    ori $19,-83,$20
+    beq $21,$22,L1817
+    jmp L1818
+    la X1
+    call L1121
+    sw $23,17,$24
+    bne $25,$26,L1816
+W1817: .dw 1817000,-1817
+B1817: .db 25,-17,7
+L1818: add $23,$24,$25
+    ori $26,-82,$27
+    beq $28,$29,L1818
+    jmp L1819
+    la X2
+    call L1134
+    sw $30,18,$31
+    bne $0,$1,L1817
+W1818: .dw 1818000,-1818
+B1818: .db 26,-18,7
+L1819: add $30,$31,$0
+    ori $1,-81,$2
+    beq $3,$4,L1819
+    jmp L1820
+    la X3
+    call L1147
+    sw $5,19,$6
+    bne $7,$8,L1818
+W1819: .dw 1819000,-1819
+B1819: .db 27,-19,7
+L1820: add $5,$6,$7
+    ori $8,-80,$9
+    beq $10,$11,L1820
+    jmp L1821
+    la X4
+    call L1160
+    sw $12,20,$13
+    bne $14,$15,L1819
+W1820: .dw 1820000,-1820
+B1820: .db 28,-20,7
+S1820: .asciz "str1820"
+    .dh 1820
+L1821: add $12,$13,$14
+    ori $15,-79,$16
+    beq $17,$18,L1821
+    jmp L1822
+    la X5
+    call L1173
+    sw $19,21,$20
+    bne $21,$22,L1820
+W1821: .dw 1821000,-1821
+B1821: .db 29,-21,7
+L1822: add $19,$20,$21
+    ori $22,-78,$23
+    beq $24,$25,L1822
+    jmp L1823
+    la X6
+    call L1186
+    sw $26,22,$27
+    bne $28,$29,L1821
+W1822: .dw 1822000,-1822
+B1822: .db 30,-22,7
+L1823: add $26,$27,$28
+    ori $29,-77,$30
+    beq $31,$0,L1823
+    jmp L1824
+    la X7
+    call L1199
+    sw $1,23,$2
+    bne $3,$4,L1822
+W1823: .dw 1823000,-1823
+B1823: .db 31,-23,7
+L1824: add $1,$2,$3
+    ori $4,-76,$5
+    beq $6,$7,L1824
+    jmp L1825
+    la X0
+    call L1212
+    sw $8,24,$9
+    bne $10,$11,L1823
+W1824: .dw 1824000,-1824
+B1824: .db 32,-24,7
+L1825: add $8,$9,$10
+    ori $11,-75,$12
+    beq $13,$14,L1825
+    jmp L1826
+    la X1
+    call L1225
+    sw $15,25,$16
+    bne $17,$18,L1824
+W1825: .dw 1825000,-1825
+B1825: .db 33,-25,7
+L1826: add $15,$16,$17
+    ori $18,-74,$19
+    beq $20,$21,L1826
+    jmp L1827
+    la X2
+    call L1238
+    sw $22,26,$23
+    bne $24,$25,L1825
+W1826: .dw 1826000,-1826
+B1826: .db 34,-26,7
+L1827: add $22,$23,$24
+    ori $25,-73,$26
+    beq $27,$28,L1827
+    jmp L1828
+    la X3
+    call L1251
+    sw $29,27,$30
+    bne $31,$0,L1826
+W1827: .dw 1827000,-1827
+B1827: .db 35,-27,7
+L1828: add $29,$30,$31
+    ori $0,-72,$1
+    beq $2,$3,L1828
+    jmp L1829
+    la X4
+    call L1264
+    sw $4,28,$5
+    bne $6,$7,L1827
+W1828: .dw 1828000,-1828
+B1828: .db 36,-28,7
+L1829: add $4,$5,$6
+    ori $7,-71,$8
+    beq $9,$10,L1829
+    jmp L1830
+    la X5
+    call L1277
+    sw $11,29,$12
+    bne $13,$14,L1828
+W1829: .dw 1829000,-1829
+B1829: .db 37,-29,7
+L1830: add $11,$12,$13
+    ori $14,-70,$15
+    beq $16,$17,L1830
+    jmp L1831
+    la X6
+    call L1290
+    sw $18,30,$19
+    bne $20,$21,L1829
+W1830: .dw 1830000,-1830
+B1830: .db 38,-30,7
+S1830: .asciz "str1830"
+    .dh 1830
+L1831: add $18,$19,$20
+    ori $21,-69,$22
+    beq $23,$24,L1831
+    jmp L1832
+    la X7
+    call L1303
+    sw $25,31,$26
+    bne $27,$28,L1830
+W1831: .dw 1831000,-1831
+B1831: .db 39,-31,7
+L1832: add $25,$26,$27
+    ori $28,-68,$29
+    beq $30,$31,L1832
+    jmp L1833
+    la X0
+    call L1316
+    sw $0,32,$1
+    bne $2,$3,L1831
+W1832: .dw 1832000,-1832
+B1832: .db 40,-32,7
+L1833: add $0,$1,$2
+    ori $3,-67,$4
+    beq $5,$6,L1833
+    jmp L1834
+    la X1
+    call L1329
+    sw $7,33,$8
+    bne $9,$10,L1832
+W1833: .dw 1833000,-1833
+B1833: .db 41,-33,7
+L1834: add $7,$8,$9
+    ori $10,-66,$11
+    beq $12,$13,L1834
+    jmp L1835
+    la X2
+    call L1342
+    sw $14,34,$15
+    bne $16,$17,L1833
+W1834: .dw 1834000,-1834
+B1834: .db 42,-34,7
+L1835: add $14,$15,$16
+    ori $17,-65,$18
+    beq $19,$20,L1835
+    jmp L1836
+    la X3
+    call L1355
+    sw $21,35,$22
+    bne $23,$24,L1834
+W1835: .dw 1835000,-1835
+B1835: .db 43,-35,7
+L1836: add $21,$22,$23
+    ori $24,-64,$25
+    beq $26,$27,L1836
+    jmp L1837
+    la X4
+    call L1368
+    sw $28,36,$29
+    bne $30,$31,L1835
+W1836: .dw 1836000,-1836
+B1836: .db 44,-36,7
+L1837: add $28,$29,$30
+    ori $31,-63,$0
+    beq $1,$2,L1837
+    jmp L1838
+    la X5
+    call L1381
+    sw $3,37,$4
+    bne $5,$6,L1836
+W1837: .dw 1837000,-1837
+B1837: .db 45,-37,7
+L1838: add $3,$4,$5
+    ori $6,-62,$7
+    beq $8,$9,L1838
+    jmp L1839
+    la X6
+    call L1394
+    sw $10,38,$11
+    bne $12,$13,L1837
+W1838: .dw 1838000,-1838
+B1838: .db 46,-38,7
+L1839: add $10,$11,$12
+    ori $13,-61,$14
+    beq $15,$16,L1839
+    jmp L1840
+    la X7
+    call L1407
+    sw $17,39,$18
+    bne $19,$20,L1838
+W1839: .dw 1839000,-1839
+B1839: .db 47,-39,7
+L1840: add $17,$18,$19
+    ori $20,-60,$21
+    beq $22,$23,L1840
+    jmp L1841
+    la X0
+    call L1420
+    sw $24,40,$25
+    bne $26,$27,L1839
+W1840: .dw 1840000,-1840
+B1840: .db 48,-40,7
+S1840: .asciz "str1840"
+    .dh 1840
+L1841: add $24,$25,$26
+    ori $27,-59,$28
+    beq $29,$30,L1841
+    jmp L1842
+    la X1
+    call L1433
+    sw $31,41,$0
+    bne $1,$2,L1840
+W1841: .dw 1841000,-1841
+B1841: .db 49,-41,7
+L1842: add $31,$0,$1
+    ori $2,-58,$3
+    beq $4,$5,L1842
+    jmp L1843
+    la X2
+    call L1446
+    sw $6,42,$7
+    bne $8,$9,L1841
+W1842: .dw 1842000,-1842
+B1842: .db 50,-42,7
+L1843: add $6,$7,$8
+    ori $9,-57,$10
+    beq $11,$12,L1843
+    jmp L1844
+    la X3
+    call L1459
+    sw $13,43,$14
+    bne $15,$16,L1842
+W1843: .dw 1843000,-1843
+B1843: .db 51,-43,7
+L1844: add $13,$14,$15
+    ori $16,-56,$17
+    beq $18,$19,L1844
+    jmp L1845
+    la X4
+    call L1472
+    sw $20,44,$21
+    bne $22,$23,L1843
+W1844: .dw 1844000,-1844
+B1844: .db 52,-44,7
+L1845: add $20,$21,$22
+    ori $23,-55,$24
+    beq $25,$26,L1845
+    jmp L1846
+    la X5
+    call L1485
+    sw $27,45,$28
+    bne $29,$30,L1844
+W1845: .dw 1845000,-1845
+B1845: .db 53,-45,7
+L1846: add $27,$28,$29
+    ori $30,-54,$31
+    beq $0,$1,L1846
+    jmp L1847
+    la X6
+    call L1498
+    sw $2,46,$3
+    bne $4,$5,L1845
+W1846: .dw 1846000,-1846
+B1846: .db 54,-46,7
+L1847: add $2,$3,$4
+    ori $5,-53,$6
+    beq $7,$8,L1847
+    jmp L1848
+    la X7
+    call L1511
+    sw $9,47,$10
+    bne $11,$12,L1846
+W1847: .dw 1847000,-1847
+B1847: .db 55,-47,7
+L1848: add $9,$10,$11
+    ori $12,-52,$13
+    beq $14,$15,L1848
+    jmp L1849
+    la X0
+    call L1524
+    sw $16,48,$17
+    bne $18,$19,L1847
+W1848: .dw 1848000,-1848
+B1848: .db 56,-48,7
+L1849: add $16,$17,$18
+    ori $19,-51,$20
+    beq $21,$22,L1849
+    jmp L1850
+    la X1
+    call L1537
+    sw $23,49,$24
+    bne $25,$26,L1848
+W1849: .dw 1849000,-1849
+B1849: .db 57,-49,7
+L1850: add $23,$24,$25
+    ori $26,-50,$27
+    beq $28,$29,L1850
+    jmp L1851
+    la X2
+    call L1550
+    sw $30,50,$31
+    bne $0,$1,L1849
+W1850: .dw 1850000,-1850
+B1850: .db 58,-50,7
+S1850: .asciz "str1850"
+    .dh 1850
+.entry L1850
+.entry W1850
+L1851: add $30,$31,$0
+    ori $1,-49,$2
+    beq $3,$4,L1851
+    jmp L1852
+    la X3
+    call L1563
+    sw $5,51,$6
+    bne $7,$8,L1850
+W1851: .dw 1851000,-1851
+B1851: .db 59,-51,7
+L1852: add $5,$6,$7
+    ori $8,-48,$9
+    beq $10,$11,L1852
+    jmp L1853
+    la X4
+    call L1576
+    sw $12,52,$13
+    bne $14,$15,L1851
+W1852: .dw 1852000,-1852
+B1852: .db 60,-52,7
+L1853: add $12,$13,$14
+    ori $15,-47,$16
+    beq $17,$18,L1853
+    jmp L1854
+    la X5
+    call L1589
+    sw $19,53,$20
+    bne $21,$22,L1852
+W1853: .dw 1853000,-1853
+B1853: .db 61,-53,7
+L1854: add $19,$20,$21
+    ori $22,-46,$23
+    beq $24,$25,L1854
+    jmp L1855
+    la X6
+    call L1602
+    sw $26,54,$27
+    bne $28,$29,L1853
+W1854: .dw 1854000,-1854
+B1854: .db 62,-54,7
+L1855: add $26,$27,$28
+    ori $29,-45,$30
+    beq $31,$0,L1855
+    jmp L1856
+    la X7
+    call L1615
+    sw $1,55,$2
+    bne $3,$4,L1854
+W1855: .dw 1855000,-1855
+B1855: .db 63,-55,7
+L1856: add $1,$2,$3
+    ori $4,-44,$5
+    beq $6,$7,L1856
+    jmp L1857
+    la X0
+    call L1628
+    sw $8,56,$9
+    bne $10,$11,L1855
+W1856: .dw 1856000,-1856
+B1856: .db 64,-56,7
+L1857: add $8,$9,$10
+    ori $11,-43,$12
+    beq $13,$14,L1857
+    jmp L1858
+    la X1
+    call L1641
+    sw $15,57,$16
+    bne $17,$18,L1856
+W1857: .dw 1857000,-1857
+B1857: .db 65,-57,7
+L1858: add $15,$16,$17
+    ori $18,-42,$19
+    beq $20,$21,L1858
+    jmp L1859
+    la X2
+    call L1654
+    sw $22,58,$23
+    bne $24,$25,L1857
+W1858: .dw 1858000,-1858
+B1858: .db 66,-58,7
+L1859: add $22,$23,$24
+    ori $25,-41,$26
+    beq $27,$28,L1859
+    jmp L1860
+    la X3
+    call L1667
+    sw $29,59,$30
+    bne $31,$0,L1858
+W1859: .dw 1859000,-1859
+B1859: .db 67,-59,7
+L1860: add $29,$30,$31
+    ori $0,-40,$1
+    beq $2,$3,L1860
+    jmp L1861
+    la X4
+    call L1680
+    sw $4,60,$5
+    bne $6,$7,L1859
+W1860: .dw 1860000,-1860
+B1860: .db 68,-60,7
+S1860: .asciz "str1860"
+    .dh 1860
+L1861: add $4,$5,$6
+    ori $7,-39,$8
+    beq $9,$10,L1861
+    jmp L1862
+    la X5
+    call L1693
+    sw $11,61,$12
+    bne $13,$14,L1860
+W1861: .dw 1861000,-1861
+B1861: .db 69,-61,7
+L1862: add $11,$12,$13
+    ori $14,-38,$15
+    beq $16,$17,L1862
+    jmp L1863
+    la X6
+    call L1706
+    sw $18,62,$19
+    bne $20,$21,L1861
+W1862: .dw 1862000,-1862
+B1862: .db 70,-62,7
+L1863: add $18,$19,$20
+    ori $21,-37,$22
+    beq $23,$24,L1863
+    jmp L1864
+    la X7
+    call L1719
+    sw $25,63,$26
+    bne $27,$28,L1862
+W1863: .dw 1863000,-1863
+B1863: .db 71,-63,7
+L1864: add $25,$26,$27
+    ori $28,-36,$29
+    beq $30,$31,L1864
+    jmp L1865
+    la X0
+    call L1732
+    sw $0,64,$1
+    bne $2,$3,L1863
+W1864: .dw 1864000,-1864
+B1864: .db 72,-64,7
+L1865: add $0,$1,$2
+    ori $3,-35,$4
+    beq $5,$6,L1865
+    jmp L1866
+    la X1
+    call L1745
+    sw $7,65,$8
+    bne $9,$10,L1864
+W1865: .dw 1865000,-1865
+B1865: .db 73,-65,7
+L1866: add $7,$8,$9
+    ori $10,-34,$11
+    beq $12,$13,L1866
+    jmp L1867
+    la X2
+    call L1758
+    sw $14,66,$15
+    bne $16,$17,L1865
+W1866: .dw 1866000,-1866
+B1866: .db 74,-66,7
+L1867: add $14,$15,$16
+    ori $17,-33,$18
+    beq $19,$20,L1867
+    jmp L1868
+    la X3
+    call L1771
+    sw $21,67,$22
+    bne $23,$24,L1866
+W1867: .dw 1867000,-1867
+B1867: .db 75,-67,7
+L1868: add $21,$22,$23
+    ori $24,-32,$25
+    beq $26,$27,L1868
+    jmp L1869
+    la X4
+    call L1784
+    sw $28,68,$29
+    bne $30,$31,L1867
+W1868: .dw 1868000,-1868
+B1868: .db 76,-68,7
+L1869: add $28,$29,$30
+    ori $31,-31,$0
+    beq $1,$2,L1869
+    jmp L1870
+    la X5
+    call L1797
+    sw $3,69,$4
+    bne $5,$6,L1868
+W1869: .dw 1869000,-1869
+B1869: .db 77,-69,7
+L1870: add $3,$4,$5
+    ori $6,-30,$7
+    beq $8,$9,L1870
+    jmp L1871
+    la X6
+    call L1810
+    sw $10,70,$11
+    bne $12,$13,L1869
+W1870: .dw 1870000,-1870
+B1870: .db 78,-70,7
+S1870: .asciz "str1870"
+    .dh 1870
+L1871: add $10,$11,$12
+    ori $13,-29,$14
+    beq $15,$16,L1871
+    jmp L1872
+    la X7
+    call L1823
+    sw $17,71,$18
+    bne $19,$20,L1870
+W1871: .dw 1871000,-1871
+B1871: .db 79,-71,7
+L1872: add $17,$18,$19
+    ori $20,-28,$21
+    beq $22,$23,L1872
+    jmp L1873
+    la X0
+    call L1836
+    sw $24,72,$25
+    bne $26,$27,L1871
+W1872: .dw 1872000,-1872
+B1872: .db 80,-72,7
+L1873: add $24,$25,$26
+    ori $27,-27,$28
+    beq $29,$30,L1873
+    jmp L1874
+    la X1
+    call L1849
+    sw $31,73,$0
+    bne $1,$2,L1872
+W1873: .dw 1873000,-1873
+B1873: .db 81,-73,7
+L1874: add $31,$0,$1
+    ori $2,-26,$3
+    beq $4,$5,L1874
+    jmp L1875
+    la X2
+    call L1862
+    sw $6,74,$7
+    bne $8,$9,L1873
+W1874: .dw 1874000,-1874
+B1874: .db 82,-74,7
+L1875: add $6,$7,$8
+    ori $9,-25,$10
+    beq $11,$12,L1875
+    jmp L1876
+    la X3
+    call L1875
+    sw $13,75,$14
+    bne $15,$16,L1874
+W1875: .dw 1875000,-1875
+B1875: .db 83,-75,7
+L1876: add $13,$14,$15
+    ori $16,-24,$17
+    beq $18,$19,L1876
+    jmp L1877
+    la X4
+    call L1888
+    sw $20,76,$21
+    bne $22,$23,L1875
+W1876: .dw 1876000,-1876
+B1876: .db 84,-76,7
+L1877: add $20,$21,$22
+    ori $23,-23,$24
+    beq $25,$26,L1877
+    jmp L1878
+    la X5
+    call L1901
+    sw $27,77,$28
+    bne $29,$30,L1876
+W1877: .dw 1877000,-1877
+B1877: .db 85,-77,7
+L1878: add $27,$28,$29
+    ori $30,-22,$31
+    beq $0,$1,L1878
+    jmp L1879
+    la X6
+    call L1914
+    sw $2,78,$3
+    bne $4,$5,L1877
+W1878: .dw 1878000,-1878
+B1878: .db 86,-78,7
+L1879: add $2,$3,$4
+    ori $5,-21,$6
+    beq $7,$8,L1879
+    jmp L1880
+    la X7
+    call L1927
+    sw $9,79,$10
+    bne $11,$12,L1878
+W1879: .dw 1879000,-1879
+B1879: .db 87,-79,7
+L1880: add $9,$10,$11
+    ori $12,-20,$13
+    beq $14,$15,L1880
+    jmp L1881
+    la X0
+    call L1940
+    sw $16,80,$17
+    bne $18,$19,L1879
+W1880: .dw 1880000,-1880
+B1880: .db 88,-80,7
+S1880: .asciz "str1880"
+    .dh 1880
+L1881: add $16,$17,$18
+    ori $19,-19,$20
+    beq $21,$22,L1881
+    jmp L1882
+    la X1
+    call L1953
+    sw $23,81,$24
+    bne $25,$26,L1880
+W1881: .dw 1881000,-1881
+B1881: .db 89,-81,7
+L1882: add $23,$24,$25
+    ori $26,-18,$27
+    beq $28,$29,L1882
+    jmp L1883
+    la X2
+    call L1966
+    sw $30,82,$31
+    bne $0,$1,L1881
+W1882: .dw 1882000,-1882
+B1882: .db 90,-82,7
+L1883: add $30,$31,$0
+    ori $1,-17,$2
+    beq $3,$4,L1883
+    jmp L1884
+    la X3
+    call L1979
+    sw $5,83,$6
+    bne $7,$8,L1882
+W1883: .dw 1883000,-1883
+B1883: .db 91,-83,7
+L1884: add $5,$6,$7
+    ori $8,-16,$9
+    beq $10,$11,L1884
+    jmp L1885
+    la X4
+    call L1992
+    sw $12,84,$13
+    bne $14,$15,L1883
+W1884: .dw 1884000,-1884
+B1884: .db 92,-84,7
+L1885: add $12,$13,$14
+    ori $15,-15,$16
+    beq $17,$18,L1885
+    jmp L1886
+    la X5
+    call L2005
+    sw $19,85,$20
+    bne $21,$22,L1884
+W1885: .dw 1885000,-1885
+B1885: .db 93,-85,7
+L1886: add $19,$20,$21
+    ori $22,-14,$23
+    beq $24,$25,L1886
+    jmp L1887
+    la X6
+    call L2018
+    sw $26,86,$27
+    bne $28,$29,L1885
+W1886: .dw 1886000,-1886
+B1886: .db 94,-86,7
+L1887: add $26,$27,$28
+    ori $29,-13,$30
+    beq $31,$0,L1887
+    jmp L1888
+    la X7
+    call L2031
+    sw $1,87,$2
+    bne $3,$4,L1886
+W1887: .dw 1887000,-1887
+B1887: .db 95,-87,7
+L1888: add $1,$2,$3
+    ori $4,-12,$5
+    beq $6,$7,L1888
+    jmp L1889
+    la X0
+    call L2044
+    sw $8,88,$9
+    bne $10,$11,L1887
+W1888: .dw 1888000,-1888
+B1888: .db 96,-88,7
+L1889: add $8,$9,$10
+    ori $11,-11,$12
+    beq $13,$14,L1889
+    jmp L1890
+    la X1
+    call L2057
+    sw $15,89,$16
+    bne $17,$18,L1888
+W1889: .dw 1889000,-1889
+B1889: .db 97,-89,7
+L1890: add $15,$16,$17
+    ori $18,-10,$19
+    beq $20,$21,L1890
+    jmp L1891
+    la X2
+    call L2070
+    sw $22,90,$23
+    bne $24,$25,L1889
+W1890: .dw 1890000,-1890
+B1890: .db 98,-90,7
+S1890: .asciz "str1890"
+    .dh 1890
+L1891: add $22,$23,$24
+    ori $25,-9,$26
+    beq $27,$28,L1891
+    jmp L1892
+    la X3
+    call L2083
+    sw $29,91,$30
+    bne $31,$0,L1890
+W1891: .dw 1891000,-1891
+B1891: .db 99,-91,7
+L1892: add $29,$30,$31
+    ori $0,-8,$1
+    beq $2,$3,L1892
+    jmp L1893
+    la X4
+    call L2096
+    sw $4,92,$5
+    bne $6,$7,L1891
+W1892: .dw 1892000,-1892
+B1892: .db 100,-92,7
+L1893: add $4,$5,$6
+    ori $7,-7,$8
+    beq $9,$10,L1893
+    jmp L1894
+    la X5
+    call L2109
+    sw $11,93,$12
+    bne $13,$14,L1892
+W1893: .dw 1893000,-1893
+B1893: .db 101,-93,7
+L1894: add $11,$12,$13
+    ori $14,-6,$15
+    beq $16,$17,L1894
+    jmp L1895
+    la X6
+    call L2122
+    sw $18,94,$19
+    bne $20,$21,L1893
+W1894: .dw 1894000,-1894
+B1894: .db 102,-94,7
+L1895: add $18,$19,$20
+    ori $21,-5,$22
+    beq $23,$24,L1895
+    jmp L1896
+    la X7
+    call L2135
+    sw $25,95,$26
+    bne $27,$28,L1894
+W1895: .dw 1895000,-1895
+B1895: .db 103,-95,7
+L1896: add $25,$26,$27
+    ori $28,-4,$29
+    beq $30,$31,L1896
+    jmp L1897
+    la X0
+    call L2148
+    sw $0,96,$1
+    bne $2,$3,L1895
+W1896: .dw 1896000,-1896
+B1896: .db 104,-96,7
+L1897: add $0,$1,$2
+    ori $3,-3,$4
+    beq $5,$6,L1897
+    jmp L1898
+    la X1
+    call L2161
+    sw $7,97,$8
+    bne $9,$10,L1896
+W1897: .dw 1897000,-1897
+B1897: .db 105,-97,7
+L1898: add $7,$8,$9
+    ori $10,-2,$11
+    beq $12,$13,L1898
+    jmp L1899
+    la X2
+    call L2174
+    sw $14,98,$15
+    bne $16,$17,L1897
+W1898: .dw 1898000,-1898
+B1898: .db 106,-98,7
+L1899: add $14,$15,$16
+    ori $17,-1,$18
+    beq $19,$20,L1899
+    jmp L1900
+    la X3
+    call L2187
+    sw $21,99,$22
+    bne $23,$24,L1898
+W1899: .dw 1899000,-1899
+B1899: .db 107,-99,7
+L1900: add $21,$22,$23
+    ori $24,0,$25
+    beq $26,$27,L1900
+    jmp L1901
+    la X4
+    call L2200
+    sw $28,0,$29
+    bne $30,$31,L1899
+W1900: .dw 1900000,-1900
+B1900: .db 108,0,7
+S1900: .asciz "str1900"
+    .dh 1900
+.entry L1900
+.entry W1900
+L1901: add $28,$29,$30
+    ori $31,1,$0
+    beq $1,$2,L1901
+    jmp L1902
+    la X5
+    call L2213
+    sw $3,1,$4
+    bne $5,$6,L1900
+W1901: .dw 1901000,-1901
+B1901: .db 109,-1,7
+L1902: add $3,$4,$5
+    ori $6,2,$7
+    beq $8,$9,L1902
+    jmp L1903
+    la X6
+    call L2226
+    sw $10,2,$11
+    bne $12,$13,L1901
+W1902: .dw 1902000,-1902
+B1902: .db 110,-2,7
+L1903: add $10,$11,$12
+    ori $13,3,$14
+    beq $15,$16,L1903
+    jmp L1904
+    la X7
+    call L2239
+    sw $17,3,$18
+    bne $19,$20,L1902
+W1903: .dw 1903000,-1903
+B1903: .db 111,-3,7
+L1904: add $17,$18,$19
+    ori $20,4,$21
+    beq $22,$23,L1904
+    jmp L1905
+    la X0
+    call L2252
+    sw $24,4,$25
+    bne $26,$27,L1903
+W1904: .dw 1904000,-1904
+B1904: .db 112,-4,7
+L1905: add $24,$25,$26
+    ori $27,5,$28
+    beq $29,$30,L1905
+    jmp L1906
+    la X1
+    call L2265
+    sw $31,5,$0
+    bne $1,$2,L1904
+W1905: .dw 1905000,-1905
+B1905: .db 113,-5,7
+L1906: add $31,$0,$1
+    ori $2,6,$3
+    beq $4,$5,L1906
+    jmp L1907
+    la X2
+    call L2278
+    sw $6,6,$7
+    bne $8,$9,L1905
+W1906: .dw 1906000,-1906
+B1906: .db 114,-6,7
+L1907: add $6,$7,$8
+    ori $9,7,$10
+    beq $11,$12,L1907
+    jmp L1908
+    la X3
+    call L2291
+    sw $13,7,$14
+    bne $15,$16,L1906
+W1907: .dw 1907000,-1907
+B1907: .db 115,-7,7
+L1908: add $13,$14,$15
+    ori $16,8,$17
+    beq $18,$19,L1908
+    jmp L1909
+    la X4
+    call L2304
+    sw $20,8,$21
+    bne $22,$23,L1907
+W1908: .dw 1908000,-1908
+B1908: .db 116,-8,7
+L1909: add $20,$21,$22
+    ori $23,9,$24
+    beq $25,$26,L1909
+    jmp L1910
+    la X5
+    call L2317
+    sw $27,9,$28
+    bne $29,$30,L1908
+W1909: .dw 1909000,-1909
+B1909: .db 117,-9,7
+L1910: add $27,$28,$29
+    ori $30,10,$31
+    beq $0,$1,L1910
+    jmp L1911
+    la X6
+    call L2330
+    sw $2,10,$3
+    bne $4,$5,L1909
+W1910: .dw 1910000,-1910
+B1910: .db 118,-10,7
+S1910: .asciz "str1910"
+    .dh 1910
+L1911: add $2,$3,$4
+    ori $5,11,$6
+    beq $7,$8,L1911
+    jmp L1912
+    la X7
+    call L2343
+    sw $9,11,$10
+    bne $11,$12,L1910
+W1911: .dw 1911000,-1911
+B1911: .db 119,-11,7
+L1912: add $9,$10,$11
+    ori $12,12,$13
+    beq $14,$15,L1912
+    jmp L1913
+    la X0
+    call L2356
+    sw $16,12,$17
+    bne $18,$19,L1911
+W1912: .dw 1912000,-1912
+B1912: .db 120,-12,7
+L1913: add $16,$17,$18
+    ori $19,13,$20
+    beq $21,$22,L1913
+    jmp L1914
+    la X1
+    call L2369
+    sw $23,13,$24
+    bne $25,$26,L1912
+W1913: .dw 1913000,-1913
+B1913: .db 121,-13,7
+L1914: add $23,$24,$25
+    ori $26,14,$27
+    beq $28,$29,L1914
+    jmp L1915
+    la X2
+    call L2382
+    sw $30,14,$31
+    bne $0,$1,L1913
+W1914: .dw 1914000,-1914
+B1914: .db 122,-14,7
+L1915: add $30,$31,$0
+    ori $1,15,$2
+    beq $3,$4,L1915
+    jmp L1916
+    la X3
+    call L2395
+    sw $5,15,$6
+    bne $7,$8,L1914
+W1915: .dw 1915000,-1915
+B1915: .db 123,-15,7
+L1916: add $5,$6,$7
+    ori $8,16,$9
+    beq $10,$11,L1916
+    jmp L1917
+    la X4
+    call L2408
+    sw $12,16,$13
+    bne $14,$15,L1915
+W1916: .dw 1916000,-1916
+B1916: .db 124,-16,7
+L1917: add $12,$13,$14
+    ori $15,17,$16
+    beq $17,$18,L1917
+    jmp L1918
+    la X5
+    call L2421
+    sw $19,17,$20
+    bne $21,$22,L1916
+W1917: .dw 1917000,-1917
+B1917: .db 125,-17,7
+L1918: add $19,$20,$21
+    ori $22,18,$23
+    beq $24,$25,L1918
+    jmp L1919
+    la X6
+    call L2434
+    sw $26,18,$27
+    bne $28,$29,L1917
+W1918: .dw 1918000,-1918
+B1918: .db 126,-18,7
+L1919: add $26,$27,$28
+    ori $29,19,$30
+    beq $31,$0,L1919
+    jmp L1920
+    la X7
+    call L2447
+    sw $1,19,$2
+    bne $3,$4,L1918
+W1919: .dw 1919000,-1919
+B1919: .db 127,-19,7
+L1920: add $1,$2,$3
+    ori $4,20,$5
+    beq $6,$7,L1920
+    jmp L1921
+    la X0
+    call L2460
+    sw $8,20,$9
+    bne $10,$11,L1919
+W1920: .dw 1920000,-1920
+B1920: .db 0,-20,7
+S1920: .asciz "str1920"
+    .dh 1920
+L1921: add $8,$9,$10
+    ori $11,21,$12
+    beq $13,$14,L1921
+    jmp L1922
+    la X1
+    call L2473
+    sw $15,21,$16
+    bne $17,$18,L1920
+W1921: .dw 1921000,-1921
+B1921: .db 1,-21,7
+L1922: add $15,$16,$17
+    ori $18,22,$19
+    beq $20,$21,L1922
+    jmp L1923
+    la X2
+    call L2486
+    sw $22,22,$23
+    bne $24,$25,L1921
+W1922: .dw 1922000,-1922
+B1922: .db 2,-22,7
+L1923: add $22,$23,$24
+    ori $25,23,$26
+    beq $27,$28,L1923
+    jmp L1924
+    la X3
+    call L2499
+    sw $29,23,$30
+    bne $31,$0,L1922
+W1923: .dw 1923000,-1923
+B1923: .db 3,-23,7
+L1924: add $29,$30,$31
+    ori $0,24,$1
+    beq $2,$3,L1924
+    jmp L1925
+    la X4
+    call L12
+    sw $4,24,$5
+    bne $6,$7,L1923
+W1924: .dw 1924000,-1924
+B1924: .db 4,-24,7
+L1925: add $4,$5,$6
+    ori $7,25,$8
+    beq $9,$10,L1925
+    jmp L1926
+    la X5
+    call L25
+    sw $11,25,$12
+    bne $13,$14,L1924
+W1925: .dw 1925000,-1925
+B1925: .db 5,-25,7
+L1926: add $11,$12,$13
+    ori $14,26,$15
+    beq $16,$17,L1926
+    jmp L1927
+    la X6
+    call L38
+    sw $18,26,$19
+    bne $20,$21,L1925
+W1926: .dw 1926000,-1926
+B1926: .db 6,-26,7
+L1927: add $18,$19,$20
+    ori $21,27,$22
+    beq $23,$24,L1927
+    jmp L1928
+    la X7
+    call L51
+    sw $25,27,$26
+    bne $27,$28,L1926
+W1927: .dw 1927000,-1927
+B1927: .db 7,-27,7
+L1928: add $25,$26,$27
+    ori $28,28,$29
+    beq $30,$31,L1928
+    jmp L1929
+    la X0
+    call L64
+    sw $0,28,$1
+    bne $2,$3,L1927
+W1928: .dw 1928000,-1928
+B1928: .db 8,-28,7
+L1929: add $0,$1,$2
+    ori $3,29,$4
+    beq $5,$6,L1929
+    jmp L1930
+    la X1
+    call L77
+    sw $7,29,$8
+    bne $9,$10,L1928
+W1929: .dw 1929000,-1929
+B1929: .db 9,-29,7
+L1930: add $7,$8,$9
+    ori $10,30,$11
+    beq $12,$13,L1930
+    jmp L1931
+    la X2
+    call L90
+    sw $14,30,$15
+    bne $16,$17,L1929
+W1930: .dw 1930000,-1930
+B1930: .db 10,-30,7
+S1930: .asciz "str1930"
+    .dh 1930
+L1931: add $14,$15,$16
+    ori $17,31,$18
+    beq $19,$20,L1931
+    jmp L1932
+    la X3
+    call L103
+    sw $21,31,$22
+    bne $23,$24,L1930
+W1931: .dw 1931000,-1931
+B1931: .db 11,-31,7
+L1932: add $21,$22,$23
+    ori $24,32,$25
+    beq $26,$27,L1932
+    jmp L1933
+    la X4
+    call L116
+    sw $28,32,$29
+    bne $30,$31,L1931
+W1932: .dw 1932000,-1932
+B1932: .db 12,-32,7
+L1933: add $28,$29,$30
+    ori $31,33,$0
+    beq $1,$2,L1933
+    jmp L1934
+    la X5
+    call L129
+    sw $3,33,$4
+    bne $5,$6,L1932
+W1933: .dw 1933000,-1933
+B1933: .db 13,-33,7
+L1934: add $3,$4,$5
+    ori $6,34,$7
+    beq $8,$9,L1934
+    jmp L1935
+    la X6
+    call L142
+    sw $10,34,$11
+    bne $12,$13,L1933
+W1934: .dw 1934000,-1934
+B1934: .db 14,-34,7
+L1935: add $10,$11,$12
+    ori $13,35,$14
+    beq $15,$16,L1935
+    jmp L1936
+    la X7
+    call L155
+    sw $17,35,$18
+    bne $19,$20,L1934
+W1935: .dw 1935000,-1935
+B1935: .db 15,-35,7
+L1936: add $17,$18,$19
+    ori $20,36,$21
+    beq $22,$23,L1936
+    jmp L1937
+    la X0
+    call L168
+    sw $24,36,$25
+    bne $26,$27,L1935
+W1936: .dw 1936000,-1936
+B1936: .db 16,-36,7
+L1937: add $24,$25,$26
+    ori $27,37,$28
+    beq $29,$30,L1937
+    jmp L1938
+    la X1
+    call L181
+    sw $31,37,$0
+    bne $1,$2,L1936
+W1937: .dw 1937000,-1937
+B1937: .db 17,-37,7
+L1938: add $31,$0,$1
+    ori $2,38,$3
+    beq $4,$5,L1938
+    jmp L1939
+    la X2
+    call L194
+    sw $6,38,$7
+    bne $8,$9,L1937
+W1938: .dw 1938000,-1938
+B1938: .db 18,-38,7
+L1939: add $6,$7,$8
+    ori $9,39,$10
+    beq $11,$12,L1939
+    jmp L1940
+    la X3
+    call L207
+    sw $13,39,$14
+    bne $15,$16,L1938
+W1939: .dw 1939000,-1939
+B1939: .db 19,-39,7
+L1940: add $13,$14,$15
+    ori $16,40,$17
+    beq $18,$19,L1940
+    jmp L1941
+    la X4
+    call L220
+    sw $20,40,$21
+    bne $22,$23,L1939
+W1940: .dw 1940000,-1940
+B1940: .db 20,-40,7
+S1940: .asciz "str1940"
+    .dh 1940
+L1941: add $20,$21,$22
+    ori $23,41,$24
+    beq $25,$26,L1941
+    jmp L1942
+    la X5
+    call L233
+    sw $27,41,$28
+    bne $29,$30,L1940
+W1941: .dw 1941000,-1941
+B1941: .db 21,-41,7
+L1942: add $27,$28,$29
+    ori $30,42,$31
+    beq $0,$1,L1942
+    jmp L1943
+    la X6
+    call L246
+    sw $2,42,$3
+    bne $4,$5,L1941
+W1942: .dw 1942000,-1942
+B1942: .db 22,-42,7
+L1943: add $2,$3,$4
+    ori $5,43,$6
+    beq $7,$8,L1943
+    jmp L1944
+    la X7
+    call L259
+    sw $9,43,$10
+    bne $11,$12,L1942
+W1943: .dw 1943000,-1943
+B1943: .db 23,-43,7
+L1944: add $9,$10,$11
+    ori $12,44,$13
+    beq $14,$15,L1944
+    jmp L1945
+    la X0
+    call L272
+    sw $16,44,$17
+    bne $18,$19,L1943
+W1944: .dw 1944000,-1944
+B1944: .db 24,-44,7
+L1945: add $16,$17,$18
+    ori $19,45,$20
+    beq $21,$22,L1945
+    jmp L1946
+    la X1
+    call L285
+    sw $23,45,$24
+    bne $25,$26,L1944
+W1945: .dw 1945000,-1945
+B1945: .db 25,-45,7
+L1946: add $23,$24,$25
+    ori $26,46,$27
+    beq $28,$29,L1946
+    jmp L1947
+    la X2
+    call L298
+    sw $30,46,$31
+    bne $0,$1,L1945
+W1946: .dw 1946000,-1946
+B1946: .db 26,-46,7
+L1947: add $30,$31,$0
+    ori $1,47,$2
+    beq $3,$4,L1947
+    jmp L1948
+    la X3
+    call L311
+    sw $5,47,$6
+    bne $7,$8,L1946
+W1947: .dw 1947000,-1947
+B1947: .db 27,-47,7
+L1948: add $5,$6,$7
+    ori $8,48,$9
+    beq $10,$11,L1948
+    jmp L1949
+    la X4
+    call L324
+    sw $12,48,$13
+    bne $14,$15,L1947
+W1948: .dw 1948000,-1948
+B1948: .db 28,-48,7
+L1949: add $12,$13,$14
+    ori $15,49,$16
+    beq $17,$18,L1949
+    jmp L1950
+    la X5
+    call L337
+    sw $19,49,$20
+    bne $21,$22,L1948
+W1949: .dw 1949000,-1949
+B1949: .db 29,-49,7
+L1950: add $19,$20,$21
+    ori $22,50,$23
+    beq $24,$25,L1950
+    jmp L1951
+    la X6
+    call L350
+    sw $26,50,$27
+    bne $28,$29,L1949
+W1950: .dw 1950000,-1950
+B1950: .db 30,-50,7
+S1950: .asciz "str1950"
+    .dh 1950
+.entry L1950
+.entry W1950
+L1951: add $26,$27,$28
+    ori $29,51,$30
+    beq $31,$0,L1951
+    jmp L1952
+    la X7
+    call L363
+    sw $1,51,$2
+    bne $3,$4,L1950
+W1951: .dw 1951000,-1951
+B1951: .db 31,-51,7
+L1952: add $1,$2,$3
+    ori $4,52,$5
+    beq $6,$7,L1952
+    jmp L1953
+    la X0
+    call L376
+    sw $8,52,$9
+    bne $10,$11,L1951
+W1952: .dw 1952000,-1952
+B1952: .db 32,-52,7
+L1953: add $8,$9,$10
+    ori $11,53,$12
+    beq $13,$14,L1953
+    jmp L1954
+    la X1
+    call L389
+    sw $15,53,$16
+    bne $17,$18,L1952
+W1953: .dw 1953000,-1953
+B1953: .db 33,-53,7
+L1954: add $15,$16,$17
+    ori $18,54,$19
+    beq $20,$21,L1954
+    jmp L1955
+    la X2
+    call L402
+    sw $22,54,$23
+    bne $24,$25,L1953
+W1954: .dw 1954000,-1954
+B1954: .db 34,-54,7
+L1955: add $22,$23,$24
+    ori $25,55,$26
+    beq $27,$28,L1955
+    jmp L1956
+    la X3
+    call L415
+    sw $29,55,$30
+    bne $31,$0,L1954
+W1955: .dw 1955000,-1955
+B1955: .db 35,-55,7
+L1956: add $29,$30,$31
+    ori $0,56,$1
+    beq $2,$3,L1956
+    jmp L1957
+    la X4
+    call L428
+    sw $4,56,$5
+    bne $6,$7,L1955
+W1956: .dw 1956000,-1956
+B1956: .db 36,-56,7
+L1957: add $4,$5,$6
+    ori $7,57,$8
+    beq $9,$10,L1957
+    jmp L1958
+    la X5
+    call L441
+    sw $11,57,$12
+    bne $13,$14,L1956
+W1957: .dw 1957000,-1957
+B1957: .db 37,-57,7
+L1958: add $11,$12,$13
+    ori $14,58,$15
+    beq $16,$17,L1958
+    jmp L1959
+    la X6
+    call L454
+    sw $18,58,$19
+    bne $20,$21,L1957
+W1958: .dw 1958000,-1958
+B1958: .db 38,-58,7
+L1959: add $18,$19,$20
+    ori $21,59,$22
+    beq $23,$24,L1959
+    jmp L1960
+    la X7
+    call L467
+    sw $25,59,$26
+    bne $27,$28,L1958
+W1959: .dw 1959000,-1959
+B1959: .db 39,-59,7
+L1960: add $25,$26,$27
+    ori $28,60,$29
+    beq $30,$31,L1960
+    jmp L1961
+    la X0
+    call L480
+    sw $0,60,$1
+    bne $2,$3,L1959
+W1960: .dw 1960000,-1960
+B1960: .db 40,-60,7
+S1960: .asciz "str1960"
+    .dh 1960
+L1961: add $0,$1,$2
+    ori $3,61,$4
+    beq $5,$6,L1961
+    jmp L1962
+    la X1
+    call L493
+    sw $7,61,$8
+    bne $9,$10,L1960
+W1961: .dw 1961000,-1961
+B1961: .db 41,-61,7
+L1962: add $7,$8,$9
+    ori $10,62,$11
+    beq $12,$13,L1962
+    jmp L1963
+    la X2
+    call L506
+    sw $14,62,$15
+    bne $16,$17,L1961
+W1962: .dw 1962000,-1962
+B1962: .db 42,-62,7
+L1963: add $14,$15,$16
+    ori $17,63,$18
+    beq $19,$20,L1963
+    jmp L1964
+    la X3
+    call L519
+    sw $21,63,$22
+    bne $23,$24,L1962
+W1963: .dw 1963000,-1963
+B1963: .db 43,-63,7
+L1964: add $21,$22,$23
+    ori $24,64,$25
+    beq $26,$27,L1964
+    jmp L1965
+    la X4
+    call L532
+    sw $28,64,$29
+    bne $30,$31,L1963
+W1964: .dw 1964000,-1964
+B1964: .db 44,-64,7
+L1965: add $28,$29,$30
+    ori $31,65,$0
+    beq $1,$2,L1965
+    jmp L1966
+    la X5
+    call L545
+    sw $3,65,$4
+    bne $5,$6,L1964
+W1965: .dw 1965000,-1965
+B1965: .db 45,-65,7
+L1966: add $3,$4,$5
+    ori $6,66,$7
+    beq $8,$9,L1966
+    jmp L1967
+    la X6
+    call L558
+    sw $10,66,$11
+    bne $12,$13,L1965
+W1966: .dw 1966000,-1966
+B1966: .db 46,-66,7
+L1967: add $10,$11,$12
+    ori $13,67,$14
+    beq $15,$16,L1967
+    jmp L1968
+    la X7
+    call L571
+    sw $17,67,$18
+    bne $19,$20,L1966
+W1967: .dw 1967000,-1967
+B1967: .db 47,-67,7
+L1968: add $17,$18,$19
+    ori $20,68,$21
+    beq $22,$23,L1968
+    jmp L1969
+    la X0
+    call L584
+    sw $24,68,$25
+    bne $26,$27,L1967
+W1968: .dw 1968000,-1968
+B1968: .db 48,-68,7
+L1969: add $24,$25,$26
+    ori $27,69,$28
+    beq $29,$30,L1969
+    jmp L1970
+    la X1
+    call L597
+    sw $31,69,$0
+    bne $1,$2,L1968
+W1969: .dw 1969000,-1969
+B1969: .db 49,-69,7
+L1970: add $31,$0,$1
+    ori $2,70,$3
+    beq $4,$5,L1970
+    jmp L1971
+    la X2
+    call L610
+    sw $6,70,$7
+    bne $8,$9,L1969
+W1970: .dw 1970000,-1970
+B1970: .db 50,-70,7
+S1970: .asciz "str1970"
+    .dh 1970
+L1971: add $6,$7,$8
+    ori $9,71,$10
+    beq $11,$12,L1971
+    jmp L1972
+    la X3
+    call L623
+    sw $13,71,$14
+    bne $15,$16,L1970
+W1971: .dw 1971000,-1971
+B1971: .db 51,-71,7
+L1972: add $13,$14,$15
+    ori $16,72,$17
+    beq $18,$19,L1972
+    jmp L1973
+    la X4
+    call L636
+    sw $20,72,$21
+    bne $22,$23,L1971
+W1972: .dw 1972000,-1972
+B1972: .db 52,-72,7
+L1973: add $20,$21,$22
+    ori $23,73,$24
+    beq $25,$26,L1973
+    jmp L1974
+    la X5
+    call L649
+    sw $27,73,$28
+    bne $29,$30,L1972
+W1973: .dw 1973000,-1973
+B1973: .db 53,-73,7
+L1974: add $27,$28,$29
+    ori $30,74,$31
+    beq $0,$1,L1974
+    jmp L1975
+    la X6
+    call L662
+    sw $2,74,$3
+    bne $4,$5,L1973
+W1974: .dw 1974000,-1974
+B1974: .db 54,-74,7
+L1975: add $2,$3,$4
+    ori $5,75,$6
+    beq $7,$8,L1975
+    jmp L1976
+    la X7
+    call L675
+    sw $9,75,$10
+    bne $11,$12,L1974
+W1975: .dw 1975000,-1975
+B1975: .db 55,-75,7
+L1976: add $9,$10,$11
+    ori $12,76,$13
+    beq $14,$15,L1976
+    jmp L1977
+    la X0
+    call L688
+    sw $16,76,$17
+    bne $18,$19,L1975
+W1976: .dw 1976000,-1976
+B1976: .db 56,-76,7
+L1977: add $16,$17,$18
+    ori $19,77,$20
+    beq $21,$22,L1977
+    jmp L1978
+    la X1
+    call L701
+    sw $23,77,$24
+    bne $25,$26,L1976
+W1977: .dw 1977000,-1977
+B1977: .db 57,-77,7
+L1978: add $23,$24,$25
+    ori $26,78,$27
+    beq $28,$29,L1978
+    jmp L1979
+    la X2
+    call L714
+    sw $30,78,$31
+    bne $0,$1,L1977
+W1978: .dw 1978000,-1978
+B1978: .db 58,-78,7
+L1979: add $30,$31,$0
+    ori $1,79,$2
+    beq $3,$4,L1979
+    jmp L1980
+    la X3
+    call L727
+    sw $5,79,$6
+    bne $7,$8,L1978
+W1979: .dw 1979000,-1979
+B1979: .db 59,-79,7
+L1980: add $5,$6,$7
+    ori $8,80,$9
+    beq $10,$11,L1980
+    jmp L1981
+    la X4
+    call L740
+    sw $12,80,$13
+    bne $14,$15,L1979
+W1980: .dw 1980000,-1980
+B1980: .db 60,-80,7
+S1980: .asciz "str1980"
+    .dh 1980
+L1981: add $12,$13,$14
+    ori $15,81,$16
+    beq $17,$18,L1981
+    jmp L1982
+    la X5
+    call L753
+    sw $19,81,$20
+    bne $21,$22,L1980
+W1981: .dw 1981000,-1981
+B1981: .db 61,-81,7
+L1982: add $19,$20,$21
+    ori $22,82,$23
+    beq $24,$25,L1982
+    jmp L1983
+    la X6
+    call L766
+    sw $26,82,$27
+    bne $28,$29,L1981
+W1982: .dw 1982000,-1982
+B1982: .db 62,-82,7
+L1983: add $26,$27,$28
+    ori $29,83,$30
+    beq $31,$0,L1983
+    jmp L1984
+    la X7
+    call L779
+    sw $1,83,$2
+    bne $3,$4,L1982
+W1983: .dw 1983000,-1983
+B1983: .db 63,-83,7
+L1984: add $1,$2,$3
+    ori $4,84,$5
+    beq $6,$7,L1984
+    jmp L1985
+    la X0
+    call L792
+    sw $8,84,$9
+    bne $10,$11,L1983
+W1984: .dw 1984000,-1984
+B1984: .db 64,-84,7
+L1985: add $8,$9,$10
+    ori $11,85,$12
+    beq $13,$14,L1985
+    jmp L1986
+    la X1
+    call L805
+    sw $15,85,$16
+    bne $17,$18,L1984
+W1985: .dw 1985000,-1985
+B1985: .db 65,-85,7
+L1986: add $15,$16,$17
+    ori $18,86,$19
+    beq $20,$21,L1986
+    jmp L1987
+    la X2
+    call L818
+    sw $22,86,$23
+    bne $24,$25,L1985
+W1986: .dw 1986000,-1986
+B1986: .db 66,-86,7
+L1987: add $22,$23,$24
+    ori $25,87,$26
+    beq $27,$28,L1987
+    jmp L1988
+    la X3
+    call L831
+    sw $29,87,$30
+    bne $31,$0,L1986
+W1987: .dw 1987000,-1987
+B1987: .db 67,-87,7
+L1988: add $29,$30,$31
+    ori $0,88,$1
+    beq $2,$3,L1988
+    jmp L1989
+    la X4
+    call L844
+    sw $4,88,$5
+    bne $6,$7,L1987
+W1988: .dw 1988000,-1988
+B1988: .db 68,-88,7
+L1989: add $4,$5,$6
+    ori $7,89,$8
+    beq $9,$10,L1989
+    jmp L1990
+    la X5
+    call L857
+    sw $11,89,$12
+    bne $13,$14,L1988
+W1989: .dw 1989000,-1989
+B1989: .db 69,-89,7
+L1990: add $11,$12,$13
+    ori $14,90,$15
+    beq $16,$17,L1990
+    jmp L1991
+    la X6
+    call L870
+    sw $18,90,$19
+    bne $20,$21,L1989
+W1990: .dw 1990000,-1990
+B1990: .db 70,-90,7
+S1990: .asciz "str1990"
+    .dh 1990
+L1991: add $18,$19,$20
+    ori $21,91,$22
+    beq $23,$24,L1991
+    jmp L1992
+    la X7
+    call L883
+    sw $25,91,$26
+    bne $27,$28,L1990
+W1991: .dw 1991000,-1991
+B1991: .db 71,-91,7
+L1992: add $25,$26,$27
+    ori $28,92,$29
+    beq $30,$31,L1992
+    jmp L1993
+    la X0
+    call L896
+    sw $0,92,$1
+    bne $2,$3,L1991
+W1992: .dw 1992000,-1992
+B1992: .db 72,-92,7
+L1993: add $0,$1,$2
+    ori $3,93,$4
+    beq $5,$6,L1993
+    jmp L1994
+    la X1
+    call L909
+    sw $7,93,$8
+    bne $9,$10,L1992
+W1993: .dw 1993000,-1993
+B1993: .db 73,-93,7
+L1994: add $7,$8,$9
+    ori $10,94,$11
+    beq $12,$13,L1994
+    jmp L1995
+    la X2
+    call L922
+    sw $14,94,$15
+    bne $16,$17,L1993
+W1994: .dw 1994000,-1994
+B1994: .db 74,-94,7
+L1995: add $14,$15,$16
+    ori $17,95,$18
+    beq $19,$20,L1995
+    jmp L1996
+    la X3
+    call L935
+    sw $21,95,$22
+    bne $23,$24,L1994
+W1995: .dw 1995000,-1995
+B1995: .db 75,-95,7
+L1996: add $21,$22,$23
+    ori $24,96,$25
+    beq $26,$27,L1996
+    jmp L1997
+    la X4
+    call L948
+    sw $28,96,$29
+    bne $30,$31,L1995
+W1996: .dw 1996000,-1996
+B1996: .db 76,-96,7
+L1997: add $28,$29,$30
+    ori $31,97,$0
+    beq $1,$2,L1997
+    jmp L1998
+    la X5
+    call L961
+    sw $3,97,$4
+    bne $5,$6,L1996
+W1997: .dw 1997000,-1997
+B1997: .db 77,-97,7
+L1998: add $3,$4,$5
+    ori $6,98,$7
+    beq $8,$9,L1998
+    jmp L1999
+    la X6
+    call L974
+    sw $10,98,$11
+    bne $12,$13,L1997
+W1998: .dw 1998000,-1998
+B1998: .db 78,-98,7
+L1999: add $10,$11,$12
+    ori $13,99,$14
+    beq $15,$16,L1999
+    jmp L2000
+    la X7
+    call L987
+    sw $17,99,$18
+    bne $19,$20,L1998
+W1999: .dw 1999000,-1999
+B1999: .db 79,-99,7
+L2000: add $17,$18,$19
+    ori $20,-100,$21
+    beq $22,$23,L2000
+    jmp L2001
+    la X0
+    call L1000
+    sw $24,0,$25
+    bne $26,$27,L1999
+W2000: .dw 2000000,-2000
+B2000: .db 80,0,7
+S2000: .asciz "str2000"
+    .dh 2000
+.entry L2000
+.entry W2000
+L2001: add $24,$25,$26
+    ori $27,-99,$28
+    beq $29,$30,L2001
+    jmp L2002
+    la X1
+    call L1013
+    sw $31,1,$0
+    bne $1,$2,L2000
+W2001: .dw 2001000,-2001
+B2001: .db 81,-1,7
+L2002: add $31,$0,$1
+    ori $2,-98,$3
+    beq $4,$5,L2002
+    jmp L2003
+    la X2
+    call L1026
+    sw $6,2,$7
+    bne $8,$9,L2001
+W2002: .dw 2002000,-2002
+B2002: .db 82,-2,7
+L2003: add $6,$7,$8
+    ori $9,-97,$10
+    beq $11,$12,L2003
+    jmp L2004
+    la X3
+    call L1039
+    sw $13,3,$14
+    bne $15,$16,L2002
+W2003: .dw 2003000,-2003
+B2003: .db 83,-3,7
+L2004: add $13,$14,$15
+    ori $16,-96,$17
+    beq $18,$19,L2004
+    jmp L2005
+    la X4
+    call L1052
+    sw $20,4,$21
+    bne $22,$23,L2003
+W2004: .dw 2004000,-2004
+B2004: .db 84,-4,7
+L2005: add $20,$21,$22
+    ori $23,-95,$24
+    beq $25,$26,L2005
+    jmp L2006
+    la X5
+    call L1065
+    sw $27,5,$28
+    bne $29,$30,L2004
+W2005: .dw 2005000,-2005
+B2005: .db 85,-5,7
+L2006: add $27,$28,$29
+    ori $30,-94,$31
+    beq $0,$1,L2006
+    jmp L2007
+    la X6
+    call L1078
+    sw $2,6,$3
+    bne $4,$5,L2005
+W2006: .dw 2006000,-2006
+B2006: .db 86,-6,7
+L2007: add $2,$3,$4
+    ori $5,-93,$6
+    beq $7,$8,L2007
+    jmp L2008
+    la X7
+    call L1091
+    sw $9,7,$10
+    bne $11,$12,L2006
+W2007: .dw 2007000,-2007
+B2007: .db 87,-7,7
+L2008: add $9,$10,$11
+    ori $12,-92,$13
+    beq $14,$15,L2008
+    jmp L2009
+    la X0
+    call L1104
+    sw $16,8,$17
+    bne $18,$19,L2007
+W2008: .dw 2008000,-2008
+B2008: .db 88,-8,7
+L2009: add $16,$17,$18
+    ori $19,-91,$20
+    beq $21,$22,L2009
+    jmp L2010
+    la X1
+    call L1117
+    sw $23,9,$24
+    bne $25,$26,L2008
+W2009: .dw 2009000,-2009
+B2009: .db 89,-9,7
+L2010: add $23,$24,$25
+    ori $26,-90,$27
+    beq $28,$29,L2010
+    jmp L2011
+    la X2
+    call L1130
+    sw $30,10,$31
+    bne $0,$1,L2009
+W2010: .dw 2010000,-2010
+B2010: .db 90,-10,7
+S2010: .asciz "str2010"
+    .dh 2010
+L2011: add $30,$31,$0
+    ori $1,-89,$2
+    beq $3,$4,L2011
+    jmp L2012
+    la X3
+    call L1143
+    sw $5,11,$6
+    bne $7,$8,L2010
+W2011: .dw 2011000,-2011
+B2011: .db 91,-11,7
+L2012: add $5,$6,$7
+    ori $8,-88,$9
+    beq $10,$11,L2012
+    jmp L2013
+    la X4
+    call L1156
+    sw $12,12,$13
+    bne $14,$15,L2011
+W2012: .dw 2012000,-2012
+B2012: .db 92,-12,7
+L2013: add $12,$13,$14
+    ori $15,-87,$16
+    beq $17,$18,L2013
+    jmp L2014
+    la X5
+    call L1169
+    sw $19,13,$20
+    bne $21,$22,L2012
+W2013: .dw 2013000,-2013
+B2013: .db 93,-13,7
+L2014: add $19,$20,$21
+    ori $22,-86,$23
+    beq $24,$25,L2014
+    jmp L2015
+    la X6
+    call L1182
+    sw $26,14,$27
+    bne $28,$29,L2013
+W2014: .dw 2014000,-2014
+B2014: .db 94,-14,7
+L2015: add $26,$27,$28
+    ori $29,-85,$30
+    beq $31,$0,L2015
+    jmp L2016
+    la X7
+    call L1195
+    sw $1,15,$2
+    bne $3,$4,L2014
+W2015: .dw 2015000,-2015
+B2015: .db 95,-15,7
+L2016: add $1,$2,$3
+    ori $4,-84,$5
+    beq $6,$7,L2016
+    jmp L2017
+    la X0
+    call L1208
+    sw $8,16,$9
+    bne $10,$11,L2015
+W2016: .dw 2016000,-2016
+B2016: .db 96,-16,7
+L2017: add $8,$9,$10
+    ori $11,-83,$12
+    beq $13,$14,L2017
+    jmp L2018
+    la X1
+    call L1221
+    sw $15,17,$16
+    bne $17,$18,L2016
+W2017: .dw 2017000,-2017
+B2017: .db 97,-17,7
+L2018: add $15,$16,$17
+    ori $18,-82,$19
+    beq $20,$21,L2018
+    jmp L2019
+    la X2
+    call L1234
+    sw $22,18,$23
+    bne $24,$25,L2017
+W2018: .dw 2018000,-2018
+B2018: .db 98,-18,7
+L2019: add $22,$23,$24
+    ori $25,-81,$26
+    beq $27,$28,L2019
+    jmp L2020
+    la X3
+    call L1247
+    sw $29,19,$30
+    bne $31,$0,L2018
+W2019: .dw 2019000,-2019
+B2019: .db 99,-19,7
+L2020: add $29,$30,$31
+    ori $0,-80,$1
+    beq $2,$3,L2020
+    jmp L2021
+    la X4
+    call L1260
+    sw $4,20,$5
+    bne $6,$7,L2019
+W2020: .dw 2020000,-2020
+B2020: .db 100,-20,7
+S2020: .asciz "str2020"
+    .dh 2020
+L2021: add $4,$5,$6
+    ori $7,-79,$8
+    beq $9,$10,L2021
+    jmp L2022
+    la X5
+    call L1273
+    sw $11,21,$12
+    bne $13,$14,L2020
+W2021: .dw 2021000,-2021
+B2021: .db 101,-21,7
+L2022: add $11,$12,$13
+    ori $14,-78,$15
+    beq $16,$17,L2022
+    jmp L2023
+    la X6
+    call L1286
+    sw $18,22,$19
+    bne $20,$21,L2021
+W2022: .dw 2022000,-2022
+B2022: .db 102,-22,7
+L2023: add $18,$19,$20
+    ori $21,-77,$22
+    beq $23,$24,L2023
+    jmp L2024
+    la X7
+    call L1299
+    sw $25,23,$26
+    bne $27,$28,L2022
+W2023: .dw 2023000,-2023
+B2023: .db 103,-23,7
+L2024: add $25,$26,$27
+    ori $28,-76,$29
+    beq $30,$31,L2024
+    jmp L2025
+    la X0
+    call L1312
+    sw $0,24,$1
+    bne $2,$3,L2023
+W2024: .dw 2024000,-2024
+B2024: .db 104,-24,7
+L2025: add $0,$1,$2
+    ori $3,-75,$4
+    beq $5,$6,L2025
+    jmp L2026
+    la X1
+    call L1325
+    sw $7,25,$8
+    bne $9,$10,L2024
+W2025: .dw 2025000,-2025
+B2025: .db 105,-25,7
+L2026: add $7,$8,$9
+    ori $10,-74,$11
+    beq $12,$13,L2026
+    jmp L2027
+    la X2
+    call L1338
+    sw $14,26,$15
+    bne $16,$17,L2025
+W2026: .dw 2026000,-2026
+B2026: .db 106,-26,7
+L2027: add $14,$15,$16
+    ori $17,-73,$18
+    beq $19,$20,L2027
+    jmp L2028
+    la X3
+    call L1351
+    sw $21,27,$22
+    bne $23,$24,L2026
+W2027: .dw 2027000,-2027
+B2027: .db 107,-27,7
+L2028: add $21,$22,$23
+    ori $24,-72,$25
+    beq $26,$27,L2028
+    jmp L2029
+    la X4
+    call L1364
+    sw $28,28,$29
+    bne $30,$31,L2027
+W2028: .dw 2028000,-2028
+B2028: .db 108,-28,7
+L2029: add $28,$29,$30
+    ori $31,-71,$0
+    beq $1,$2,L2029
+    jmp L2030
+    la X5
+    call L1377
+    sw $3,29,$4
+    bne $5,$6,L2028
+W2029: .dw 2029000,-2029
+B2029: .db 109,-29,7
+L2030: add $3,$4,$5
+    ori $6,-70,$7
+    beq $8,$9,L2030
+    jmp L2031
+    la X6
+    call L1390
+    sw $10,30,$11
+    bne $12,$13,L2029
+W2030: .dw 2030000,-2030
+B2030: .db 110,-30,7
+S2030: .asciz "str2030"
+    .dh 2030
+L2031: add $10,$11,$12
+    ori $13,-69,$14
+    beq $15,$16,L2031
+    jmp L2032
+    la X7
+    call L1403
+    sw $17,31,$18
+    bne $19,$20,L2030
+W2031: .dw 2031000,-2031
+B2031: .db 111,-31,7
+L2032: add $17,$18,$19
+    ori $20,-68,$21
+    beq $22,$23,L2032
+    jmp L2033
+    la X0
+    call L1416
+    sw $24,32,$25
+    bne $26,$27,L2031
+W2032: .dw 2032000,-2032
+B2032: .db 112,-32,7
+L2033: add $24,$25,$26
+    ori $27,-67,$28
+    beq $29,$30,L2033
+    jmp L2034
+    la X1
+    call L1429
+    sw $31,33,$0
+    bne $1,$2,L2032
+W2033: .dw 2033000,-2033
+B2033: .db 113,-33,7
+L2034: add $31,$0,$1
+    ori $2,-66,$3
+    beq $4,$5,L2034
+    jmp L2035
+    la X2
+    call L1442
+    sw $6,34,$7
+    bne $8,$9,L2033
+W2034: .dw 2034000,-2034
+B2034: .db 114,-34,7
+L2035: add $6,$7,$8
+    ori $9,-65,$10
+    beq $11,$12,L2035
+    jmp L2036
+    la X3
+    call L1455
+    sw $13,35,$14
+    bne $15,$16,L2034
+W2035: .dw 2035000,-2035
+B2035: .db 115,-35,7
+L2036: add $13,$14,$15
+    ori $16,-64,$17
+    beq $18,$19,L2036
+    jmp L2037
+    la X4
+    call L1468
+    sw $20,36,$21
+    bne $22,$23,L2035
+W2036: .dw 2036000,-2036
+B2036: .db 116,-36,7
+L2037: add $20,$21,$22
+    ori $23,-63,$24
+    beq $25,$26,L2037
+    jmp L2038
+    la X5
+    call L1481
+    sw $27,37,$28
+    bne $29,$30,L2036
+W2037: .dw 2037000,-2037
+B2037: .db 117,-37,7
+L2038: add $27,$28,$29
+    ori $30,-62,$31
+    beq $0,$1,L2038
+    jmp L2039
+    la X6
+    call L1494
+    sw $2,38,$3
+    bne $4,$5,L2037
+W2038: .dw 2038000,-2038
+B2038: .db 118,-38,7
+L2039: add $2,$3,$4
+    ori $5,-61,$6
+    beq $7,$8,L2039
+    jmp L2040
+    la X7
+    call L1507
+    sw $9,39,$10
+    bne $11,$12,L2038
+W2039: .dw 2039000,-2039
+B2039: .db 119,-39,7
+L2040: add $9,$10,$11
+    ori $12,-60,$13
+    beq $14,$15,L2040
+    jmp L2041
+    la X0
+    call L1520
+    sw $16,40,$17
+    bne $18,$19,L2039
+W2040: .dw 2040000,-2040
+B2040: .db 120,-40,7
+S2040: .asciz "str2040"
+    .dh 2040
+L2041: add $16,$17,$18
+    ori $19,-59,$20
+    beq $21,$22,L2041
+    jmp L2042
+    la X1
+    call L1533
+    sw $23,41,$24
+    bne $25,$26,L2040
+W2041: .dw 2041000,-2041
+B2041: .db 121,-41,7
+L2042: add $23,$24,$25
+    ori $26,-58,$27
+    beq $28,$29,L2042
+    jmp L2043
+    la X2
+    call L1546
+    sw $30,42,$31
+    bne $0,$1,L2041
+W2042: .dw 2042000,-2042
+B2042: .db 122,-42,7
+L2043: add $30,$31,$0
+    ori $1,-57,$2
+    beq $3,$4,L2043
+    jmp L2044
+    la X3
+    call L1559
+    sw $5,43,$6
+    bne $7,$8,L2042
+W2043: .dw 2043000,-2043
+B2043: .db 123,-43,7
+L2044: add $5,$6,$7
+    ori $8,-56,$9
+    beq $10,$11,L2044
+    jmp L2045
+    la X4
+    call L1572
+    sw $12,44,$13
+    bne $14,$15,L2043
+W2044: .dw 2044000,-2044
+B2044: .db 124,-44,7
+L2045: add $12,$13,$14
+    ori $15,-55,$16
+    beq $17,$18,L2045
+    jmp L2046
+    la X5
+    call L1585
+    sw $19,45,$20
+    bne $21,$22,L2044
+W2045: .dw 2045000,-2045
+B2045: .db 125,-45,7
+L2046: add $19,$20,$21
+    ori $22,-54,$23
+    beq $24,$25,L2046
+    jmp L2047
+    la X6
+    call L1598
+    sw $26,46,$27
+    bne $28,$29,L2045
+W2046: .dw 2046000,-2046
+B2046: .db 126,-46,7
+L2047: add $26,$27,$28
+    ori $29,-53,$30
+    beq $31,$0,L2047
+    jmp L2048
+    la X7
+    call L1611
+    sw $1,47,$2
+    bne $3,$4,L2046
+W2047: .dw 2047000,-2047
+B2047: .db 127,-47,7
+L2048: add $1,$2,$3
+    ori $4,-52,$5
+    beq $6,$7,L2048
+    jmp L2049
+    la X0
+    call L1624
+    sw $8,48,$9
+    bne $10,$11,L2047
+W2048: .dw 2048000,-2048
+B2048: .db 0,-48,7
+L2049: add $8,$9,$10
+    ori $11,-51,$12
+    beq $13,$14,L2049
+    jmp L2050
+    la X1
+    call L1637
+    sw $15,49,$16
+    bne $17,$18,L2048
+W2049: .dw 2049000,-2049
+B2049: .db 1,-49,7
+L2050: add $15,$16,$17
+    ori $18,-50,$19
+    beq $20,$21,L2050
+    jmp L2051
+    la X2
+    call L1650
+    sw $22,50,$23
+    bne $24,$25,L2049
+W2050: .dw 2050000,-2050
+B2050: .db 2,-50,7
+S2050: .asciz "str2050"
+    .dh 2050
+.entry L2050
+.entry W2050
+L2051: add $22,$23,$24
+    ori $25,-49,$26
+    beq $27,$28,L2051
+    jmp L2052
+    la X3
+    call L1663
+    sw $29,51,$30
+    bne $31,$0,L2050
+W2051: .dw 2051000,-2051
+B2051: .db 3,-51,7
+L2052: add $29,$30,$31
+    ori $0,-48,$1
+    beq $2,$3,L2052
+    jmp L2053
+    la X4
+    call L1676
+    sw $4,52,$5
+    bne $6,$7,L2051
+W2052: .dw 2052000,-2052
+B2052: .db 4,-52,7
+L2053: add $4,$5,$6
+    ori $7,-47,$8
+    beq $9,$10,L2053
+    jmp L2054
+    la X5
+    call L1689
+    sw $11,53,$12
+    bne $13,$14,L2052
+W2053: .dw 2053000,-2053
+B2053: .db 5,-53,7
+L2054: add $11,$12,$13
+    ori $14,-46,$15
+    beq $16,$17,L2054
+    jmp L2055
+    la X6
+    call L1702
+    sw $18,54,$19
+    bne $20,$21,L2053
+W2054: .dw 2054000,-2054
+B2054: .db 6,-54,7
+L2055: add $18,$19,$20
+    ori $21,-45,$22
+    beq $23,$24,L2055
+    jmp L2056
+    la X7
+    call L1715
+    sw $25,55,$26
+    bne $27,$28,L2054
+W2055: .dw 2055000,-2055
+B2055: .db 7,-55,7
+L2056: add $25,$26,$27
+    ori $28,-44,$29
+    beq $30,$31,L2056
+    jmp L2057
+    la X0
+    call L1728
+    sw $0,56,$1
+    bne $2,$3,L2055
+W2056: .dw 2056000,-2056
+B2056: .db 8,-56,7
+L2057: add $0,$1,$2
+    ori $3,-43,$4
+    beq $5,$6,L2057
+    jmp L2058
+    la X1
+    call L1741
+    sw $7,57,$8
+    bne $9,$10,L2056
+W2057: .dw 2057000,-2057
+B2057: .db 9,-57,7
+L2058: add $7,$8,$9
+    ori $10,-42,$11
+    beq $12,$13,L2058
+    jmp L2059
+    la X2
+    call L1754
+    sw $14,58,$15
+    bne $16,$17,L2057
+W2058: .dw 2058000,-2058
+B2058: .db 10,-58,7
+L2059: add $14,$15,$16
+    ori $17,-41,$18
+    beq $19,$20,L2059
+    jmp L2060
+    la X3
+    call L1767
+    sw $21,59,$22
+    bne $23,$24,L2058
+W2059: .dw 2059000,-2059
+B2059: .db 11,-59,7
+L2060: add $21,$22,$23
+    ori $24,-40,$25
+    beq $26,$27,L2060
+    jmp L2061
+    la X4
+    call L1780
+    sw $28,60,$29
+    bne $30,$31,L2059
+W2060: .dw 2060000,-2060
+B2060: .db 12,-60,7
+S2060: .asciz "str2060"
+    .dh 2060
+L2061: add $28,$29,$30
+    ori $31,-39,$0
+    beq $1,$2,L2061
+    jmp L2062
+    la X5
+    call L1793
+    sw $3,61,$4
+    bne $5,$6,L2060
+W2061: .dw 2061000,-2061
+B2061: .db 13,-61,7
+L2062: add $3,$4,$5
+    ori $6,-38,$7
+    beq $8,$9,L2062
+    jmp L2063
+    la X6
+    call L1806
+    sw $10,62,$11
+    bne $12,$13,L2061
+W2062: .dw 2062000,-2062
+B2062: .db 14,-62,7
+L2063: add $10,$11,$12
+    ori $13,-37,$14
+    beq $15,$16,L2063
+    jmp L2064
+    la X7
+    call L1819
+    sw $17,63,$18
+    bne $19,$20,L2062
+W2063: .dw 2063000,-2063
+B2063: .db 15,-63,7
+L2064: add $17,$18,$19
+    ori $20,-36,$21
+    beq $22,$23,L2064
+    jmp L2065
+    la X0
+    call L1832
+    sw $24,64,$25
+    bne $26,$27,L2063
+W2064: .dw 2064000,-2064
+B2064: .db 16,-64,7
+L2065: add $24,$25,$26
+    ori $27,-35,$28
+    beq $29,$30,L2065
+    jmp L2066
+    la X1
+    call L1845
+    sw $31,65,$0
+    bne $1,$2,L2064
+W2065: .dw 2065000,-2065
+B2065: .db 17,-65,7
+L2066: add $31,$0,$1
+    ori $2,-34,$3
+    beq $4,$5,L2066
+    jmp L2067
+    la X2
+    call L1858
+    sw $6,66,$7
+    bne $8,$9,L2065
+W2066: .dw 2066000,-2066
+B2066: .db 18,-66,7
+L2067: add $6,$7,$8
+    ori $9,-33,$10
+    beq $11,$12,L2067
+    jmp L2068
+    la X3
+    call L1871
+    sw $13,67,$14
+    bne $15,$16,L2066
+W2067: .dw 2067000,-2067
+B2067: .db 19,-67,7
+L2068: add $13,$14,$15
+    ori $16,-32,$17
+    beq $18,$19,L2068
+    jmp L2069
+    la X4
+    call L1884
+    sw $20,68,$21
+    bne $22,$23,L2067
+W2068: .dw 2068000,-2068
+B2068: .db 20,-68,7
+L2069: add $20,$21,$22
+    ori $23,-31,$24
+    beq $25,$26,L2069
+    jmp L2070
+    la X5
+    call L1897
+    sw $27,69,$28
+    bne $29,$30,L2068
+W2069: .dw 2069000,-2069
+B2069: .db 21,-69,7
+L2070: add $27,$28,$29
+    ori $30,-30,$31
+    beq $0,$1,L2070
+    jmp L2071
+    la X6
+    call L1910
+    sw $2,70,$3
+    bne $4,$5,L2069
+W2070: .dw 2070000,-2070
+B2070: .db 22,-70,7
+S2070: .asciz "str2070"
+    .dh 2070
+L2071: add $2,$3,$4
+    ori $5,-29,$6
+    beq $7,$8,L2071
+    jmp L2072
+    la X7
+    call L1923
+    sw $9,71,$10
+    bne $11,$12,L2070
+W2071: .dw 2071000,-2071
+B2071: .db 23,-71,7
+L2072: add $9,$10,$11
+    ori $12,-28,$13
+    beq $14,$15,L2072
+    jmp L2073
+    la X0
+    call L1936
+    sw $16,72,$17
+    bne $18,$19,L2071
+W2072: .dw 2072000,-2072
+B2072: .db 24,-72,7
+L2073: add $16,$17,$18
+    ori $19,-27,$20
+    beq $21,$22,L2073
+    jmp L2074
+    la X1
+    call L1949
+    sw $23,73,$24
+    bne $25,$26,L2072
+W2073: .dw 2073000,-2073
+B2073: .db 25,-73,7
+L2074: add $23,$24,$25
+    ori $26,-26,$27
+    beq $28,$29,L2074
+    jmp L2075
+    la X2
+    call L1962
+    sw $30,74,$31
+    bne $0,$1,L2073
+W2074: .dw 2074000,-2074
+B2074: .db 26,-74,7
+L2075: add $30,$31,$0
+    ori $1,-25,$2
+    beq $3,$4,L2075
+    jmp L2076
+    la X3
+    call L1975
+    sw $5,75,$6
+    bne $7,$8,L2074
+W2075: .dw 2075000,-2075
+B2075: .db 27,-75,7
+L2076: add $5,$6,$7
+    ori $8,-24,$9
+    beq $10,$11,L2076
+    jmp L2077
+    la X4
+    call L1988
+    sw $12,76,$13
+    bne $14,$15,L2075
+W2076: .dw 2076000,-2076
+B2076: .db 28,-76,7
+L2077: add $12,$13,$14
+    ori $15,-23,$16
+    beq $17,$18,L2077
+    jmp L2078
+    la X5
+    call L2001
+    sw $19,77,$20
+    bne $21,$22,L2076
+W2077: .dw 2077000,-2077
+B2077: .db 29,-77,7
+L2078: add $19,$20,$21
+    ori $22,-22,$23
+    beq $24,$25,L2078
+    jmp L2079
+    la X6
+    call L2014
+    sw $26,78,$27
+    bne $28,$29,L2077
+W2078: .dw 2078000,-2078
+B2078: .db 30,-78,7
+L2079: add $26,$27,$28
+    ori $29,-21,$30
+    beq $31,$0,L2079
+    jmp L2080
+    la X7
+    call L2027
+    sw $1,79,$2
+    bne $3,$4,L2078
+W2079: .dw 2079000,-2079
+B2079: .db 31,-79,7
+L2080: add $1,$2,$3
+    ori $4,-20,$5
+    beq $6,$7,L2080
+    jmp L2081
+    la X0
+    call L2040
+    sw $8,80,$9
+    bne $10,$11,L2079
+W2080: .dw 2080000,-2080
+B2080: .db 32,-80,7
+S2080: .asciz "str2080"
+    .dh 2080
+L2081: add $8,$9,$10
+    ori $11,-19,$12
+    beq $13,$14,L2081
+    jmp L2082
+    la X1
+    call L2053
+    sw $15,81,$16
+    bne $17,$18,L2080
+W2081: .dw 2081000,-2081
+B2081: .db 33,-81,7
+L2082: add $15,$16,$17
+    ori $18,-18,$19
+    beq $20,$21,L2082
+    jmp L2083
+    la X2
+    call L2066
+    sw $22,82,$23
+    bne $24,$25,L2081
+W2082: .dw 2082000,-2082
+B2082: .db 34,-82,7
+L2083: add $22,$23,$24
+    ori $25,-17,$26
+    beq $27,$28,L2083
+    jmp L2084
+    la X3
+    call L2079
+    sw $29,83,$30
+    bne $31,$0,L2082
+W2083: .dw 2083000,-2083
+B2083: .db 35,-83,7
+L2084: add $29,$30,$31
+    ori $0,-16,$1
+    beq $2,$3,L2084
+    jmp L2085
+    la X4
+    call L2092
+    sw $4,84,$5
+    bne $6,$7,L2083
+W2084: .dw 2084000,-2084
+B2084: .db 36,-84,7
+L2085: add $4,$5,$6
+    ori $7,-15,$8
+    beq $9,$10,L2085
+    jmp L2086
+    la X5
+    call L2105
+    sw $11,85,$12
+    bne $13,$14,L2084
+W2085: .dw 2085000,-2085
+B2085: .db 37,-85,7
+L2086: add $11,$12,$13
+    ori $14,-14,$15
+    beq $16,$17,L2086
+    jmp L2087
+    la X6
+    call L2118
+    sw $18,86,$19
+    bne $20,$21,L2085
+W2086: .dw 2086000,-2086
+B2086: .db 38,-86,7
+L2087: add $18,$19,$20
+    ori $21,-13,$22
+    beq $23,$24,L2087
+    jmp L2088
+    la X7
+    call L2131
+    sw $25,87,$26
+    bne $27,$28,L2086
+W2087: .dw 2087000,-2087
+B2087: .db 39,-87,7
+L2088: add $25,$26,$27
+    ori $28,-12,$29
+    beq $30,$31,L2088
+    jmp L2089
+    la X0
+    call L2144
+    sw $0,88,$1
+    bne $2,$3,L2087
+W2088: .dw 2088000,-2088
+B2088: .db 40,-88,7
+L2089: add $0,$1,$2
+    ori $3,-11,$4
+    beq $5,$6,L2089
+    jmp L2090
+    la X1
+    call L2157
+    sw $7,89,$8
+    bne $9,$10,L2088
+W2089: .dw 2089000,-2089
+B2089: .db 41,-89,7
+L2090: add $7,$8,$9
+    ori $10,-10,$11
+    beq $12,$13,L2090
+    jmp L2091
+    la X2
+    call L2170
+    sw $14,90,$15
+    bne $16,$17,L2089
+W2090: .dw 2090000,-2090
+B2090: .db 42,-90,7
+S2090: .asciz "str2090"
+    .dh 2090
+L2091: add $14,$15,$16
+    ori $17,-9,$18
+    beq $19,$20,L2091
+    jmp L2092
+    la X3
+    call L2183
+    sw $21,91,$22
+    bne $23,$24,L2090
+W2091: .dw 2091000,-2091
+B2091: .db 43,-91,7
+L2092: add $21,$22,$23
+    ori $24,-8,$25
+    beq $26,$27,L2092
+    jmp L2093
+    la X4
+    call L2196
+    sw $28,92,$29
+    bne $30,$31,L2091
+W2092: .dw 2092000,-2092
+B2092: .db 44,-92,7
+L2093: add $28,$29,$30
+    ori $31,-7,$0
+    beq $1,$2,L2093
+    jmp L2094
+    la X5
+    call L2209
+    sw $3,93,$4
+    bne $5,$6,L2092
+W2093: .dw 2093000,-2093
+B2093: .db 45,-93,7
+L2094: add $3,$4,$5
+    ori $6,-6,$7
+    beq $8,$9,L2094
+    jmp L2095
+    la X6
+    call L2222
+    sw $10,94,$11
+    bne $12,$13,L2093
+W2094: .dw 2094000,-2094
+B2094: .db 46,-94,7
+L2095: add $10,$11,$12
+    ori $13,-5,$14
+    beq $15,$16,L2095
+    jmp L2096
+    la X7
+    call L2235
+    sw $17,95,$18
+    bne $19,$20,L2094
+W2095: .dw 2095000,-2095
+B2095: .db 47,-95,7
+L2096: add $17,$18,$19
+    ori $20,-4,$21
+    beq $22,$23,L2096
+    jmp L2097
+    la X0
+    call L2248
+    sw $24,96,$25
+    bne $26,$27,L2095
+W2096: .dw 2096000,-2096
+B2096: .db 48,-96,7
+L2097: add $24,$25,$26
+    ori $27,-3,$28
+    beq $29,$30,L2097
+    jmp L2098
+    la X1
+    call L2261
+    sw $31,97,$0
+    bne $1,$2,L2096
+W2097: .dw 2097000,-2097
+B2097: .db 49,-97,7
+L2098: add $31,$0,$1
+    ori $2,-2,$3
+    beq $4,$5,L2098
+    jmp L2099
+    la X2
+    call L2274
+    sw $6,98,$7
+    bne $8,$9,L2097
+W2098: .dw 2098000,-2098
+B2098: .db 50,-98,7
+L2099: add $6,$7,$8
+    ori $9,-1,$10
+    beq $11,$12,L2099
+    jmp L2100
+    la X3
+    call L2287
+    sw $13,99,$14
+    bne $15,$16,L2098
+W2099: .dw 2099000,-2099
+B2099: .db 51,-99,7
+L2100: add $13,$14,$15
+    ori $16,0,$17
+    beq $18,$19,L2100
+    jmp L2101
+    la X4
+    call L2300
+    sw $20,0,$21
+    bne $22,$23,L2099
+W2100: .dw 2100000,-2100
+B2100: .db 52,0,7
+S2100: .asciz "str2100"
+    .dh 2100
+.entry L2100
+.entry W2100
+L2101: add $20,$21,$22
+    ori $23,1,$24
+    beq $25,$26,L2101
+    jmp L2102
+    la X5
+    call L2313
+    sw $27,1,$28
+    bne $29,$30,L2100
+W2101: .dw 2101000,-2101
+B2101: .db 53,-1,7
+L2102: add $27,$28,$29
+    ori $30,2,$31
+    beq $0,$1,L2102
+    jmp L2103
+    la X6
+    call L2326
+    sw $2,2,$3
+    bne $4,$5,L2101
+W2102: .dw 2102000,-2102
+B2102: .db 54,-2,7
+L2103: add $2,$3,$4
+    ori $5,3,$6
+    beq $7,$8,L2103
+    jmp L2104
+    la X7
+    call L2339
+    sw $9,3,$10
+    bne $11,$12,L2102
+W2103: .dw 2103000,-2103
+B2103: .db 55,-3,7
+L2104: add $9,$10,$11
+    ori $12,4,$13
+    beq $14,$15,L2104
+    jmp L2105
+    la X0
+    call L2352
+    sw $16,4,$17
+    bne $18,$19,L2103
+W2104: .dw 2104000,-2104
+B2104: .db 56,-4,7
+L2105: add $16,$17,$18
+    ori $19,5,$20
+    beq $21,$22,L2105
+    jmp L2106
+    la X1
+    call L2365
+    sw $23,5,$24
+    bne $25,$26,L2104
+W2105: .dw 2105000,-2105
+B2105: .db 57,-5,7
+L2106: add $23,$24,$25
+    ori $26,6,$27
+    beq $28,$29,L2106
+    jmp L2107
+    la X2
+    call L2378
+    sw $30,6,$31
+    bne $0,$1,L2105
+W2106: .dw 2106000,-2106
+B2106: .db 58,-6,7
+L2107: add $30,$31,$0
+    ori $1,7,$2
+    beq $3,$4,L2107
+    jmp L2108
+    la X3
+    call L2391
+    sw $5,7,$6
+    bne $7,$8,L2106
+W2107: .dw 2107000,-2107
+B2107: .db 59,-7,7
+L2108: add $5,$6,$7
+    ori $8,8,$9
+    beq $10,$11,L2108
+    jmp L2109
+    la X4
+    call L2404
+    sw $12,8,$13
+    bne $14,$15,L2107
+W2108: .dw 2108000,-2108
+B2108: .db 60,-8,7
+L2109: add $12,$13,$14
+    ori $15,9,$16
+    beq $17,$18,L2109
+    jmp L2110
+    la X5
+    call L2417
+    sw $19,9,$20
+    bne $21,$22,L2108
+W2109: .dw 2109000,-2109
+B2109: .db 61,-9,7
+L2110: add $19,$20,$21
+    ori $22,10,$23
+    beq $24,$25,L2110
+    jmp L2111
+    la X6
+    call L2430
+    sw $26,10,$27
+    bne $28,$29,L2109
+W2110: .dw 2110000,-2110
+B2110: .db 62,-10,7
+S2110: .asciz "str2110"
+    .dh 2110
+L2111: add $26,$27,$28
+    ori $29,11,$30
+    beq $31,$0,L2111
+    jmp L2112
+    la X7
+    call L2443
+    sw $1,11,$2
+    bne $3,$4,L2110
+W2111: .dw 2111000,-2111
+B2111: .db 63,-11,7
+L2112: add $1,$2,$3
+    ori $4,12,$5
+    beq $6,$7,L2112
+    jmp L2113
+    la X0
+    call L2456
+    sw $8,12,$9
+    bne $10,$11,L2111
+W2112: .dw 2112000,-2112
+B2112: .db 64,-12,7
+L2113: add $8,$9,$10
+    ori $11,13,$12
+    beq $13,$14,L2113
+    jmp L2114
+    la X1
+    call L2469
+    sw $15,13,$16
+    bne $17,$18,L2112
+W2113: .dw 2113000,-2113
+B2113: .db 65,-13,7
+L2114: add $15,$16,$17
+    ori $18,14,$19
+    beq $20,$21,L2114
+    jmp L2115
+    la X2
+    call L2482
+    sw $22,14,$23
+    bne $24,$25,L2113
+W2114: .dw 2114000,-2114
+B2114: .db 66,-14,7
+L2115: add $22,$23,$24
+    ori $25,15,$26
+    beq $27,$28,L2115
+    jmp L2116
+    la X3
+    call L2495
+    sw $29,15,$30
+    bne $31,$0,L2114
+W2115: .dw 2115000,-2115
+B2115: .db 67,-15,7
+L2116: add $29,$30,$31
+    ori $0,16,$1
+    beq $2,$3,L2116
+    jmp L2117
+    la X4
+    call L8
+    sw $4,16,$5
+    bne $6,$7,L2115
+W2116: .dw 2116000,-2116
+B2116: .db 68,-16,7
+L2117: add $4,$5,$6
+    ori $7,17,$8
+    beq $9,$10,L2117
+    jmp L2118
+    la X5
+    call L21
+    sw $11,17,$12
+    bne $13,$14,L2116
+W2117: .dw 2117000,-2117
+B2117: .db 69,-17,7
+L2118: add $11,$12,$13
+    ori $14,18,$15
+    beq $16,$17,L2118
+    jmp L2119
+    la X6
+    call L34
+    sw $18,18,$19
+    bne $20,$21,L2117
+W2118: .dw 2118000,-2118
+B2118: .db 70,-18,7
+L2119: add $18,$19,$20
+    ori $21,19,$22
+    beq $23,$24,L2119
+    jmp L2120
+    la X7
+    call L47
+    sw $25,19,$26
+    bne $27,$28,L2118
+W2119: .dw 2119000,-2119
+B2119: .db 71,-19,7
+L2120: add $25,$26,$27
+    ori $28,20,$29
+    beq $30,$31,L2120
+    jmp L2121
+    la X0
+    call L60
+    sw $0,20,$1
+    bne $2,$3,L2119
+W2120: .dw 2120000,-2120
+B2120: .db 72,-20,7
+S2120: .asciz "str2120"
+    .dh 2120
+L2121: add $0,$1,$2
+    ori $3,21,$4
+    beq $5,$6,L2121
+    jmp L2122
+    la X1
+    call L73
+    sw $7,21,$8
+    bne $9,$10,L2120
+W2121: .dw 2121000,-2121
+B2121: .db 73,-21,7
+L2122: add $7,$8,$9
+    ori $10,22,$11
+    beq $12,$13,L2122
+    jmp L2123
+    la X2
+    call L86
+    sw $14,22,$15
+    bne $16,$17,L2121
+W2122: .dw 2122000,-2122
+B2122: .db 74,-22,7
+L2123: add $14,$15,$16
+    ori $17,23,$18
+    beq $19,$20,L2123
+    jmp L2124
+    la X3
+    call L99
+    sw $21,23,$22
+    bne $23,$24,L2122
+W2123: .dw 2123000,-2123
+B2123: .db 75,-23,7
+L2124: add $21,$22,$23
+    ori $24,24,$25
+    beq $26,$27,L2124
+    jmp L2125
+    la X4
+    call L112
+    sw $28,24,$29
+    bne $30,$31,L2123
+W2124: .dw 2124000,-2124
+B2124: .db 76,-24,7
+L2125: add $28,$29,$30
+    ori $31,25,$0
+    beq $1,$2,L2125
+    jmp L2126
+    la X5
+    call L125
+    sw $3,25,$4
+    bne $5,$6,L2124
+W2125: .dw 2125000,-2125
+B2125: .db 77,-25,7
+L2126: add $3,$4,$5
+    ori $6,26,$7
+    beq $8,$9,L2126
+    jmp L2127
+    la X6
+    call L138
+    sw $10,26,$11
+    bne $12,$13,L2125
+W2126: .dw 2126000,-2126
+B2126: .db 78,-26,7
+L2127: add $10,$11,$12
+    ori $13,27,$14
+    beq $15,$16,L2127
+    jmp L2128
+    la X7
+    call L151
+    sw $17,27,$18
+    bne $19,$20,L2126
+W2127: .dw 2127000,-2127
+B2127: .db 79,-27,7
+L2128: add $17,$18,$19
+    ori $20,28,$21
+    beq $22,$23,L2128
+    jmp L2129
+    la X0
+    call L164
+    sw $24,28,$25
+    bne $26,$27,L2127
+W2128: .dw 2128000,-2128
+B2128: .db 80,-28,7
+L2129: add $24,$25,$26
+    ori $27,29,$28
+    beq $29,$30,L2129
+    jmp L2130
+    la X1
+    call L177
+    sw $31,29,$0
+    bne $1,$2,L2128
+W2129: .dw 2129000,-2129
+B2129: .db 81,-29,7
+L2130: add $31,$0,$1
+    ori $2,30,$3
+    beq $4,$5,L2130
+    jmp L2131
+    la X2
+    call L190
+    sw $6,30,$7
+    bne $8,$9,L2129
+W2130: .dw 2130000,-2130
+B2130: .db 82,-30,7
+S2130: .asciz "str2130"
+    .dh 2130
+L2131: add $6,$7,$8
+    ori $9,31,$10
+    beq $11,$12,L2131
+    jmp L2132
+    la X3
+    call L203
+    sw $13,31,$14
+    bne $15,$16,L2130
+W2131: .dw 2131000,-2131
+B2131: .db 83,-31,7
+L2132: add $13,$14,$15
+    ori $16,32,$17
+    beq $18,$19,L2132
+    jmp L2133
+    la X4
+    call L216
+    sw $20,32,$21
+    bne $22,$23,L2131
+W2132: .dw 2132000,-2132
+B2132: .db 84,-32,7
+L2133: add $20,$21,$22
+    ori $23,33,$24
+    beq $25,$26,L2133
+    jmp L2134
+    la X5
+    call L229
+    sw $27,33,$28
+    bne $29,$30,L2132
+W2133: .dw 2133000,-2133
+B2133: .db 85,-33,7
+L2134: add $27,$28,$29
+    ori $30,34,$31
+    beq $0,$1,L2134
+    jmp L2135
+    la X6
+    call L242
+    sw $2,34,$3
+    bne $4,$5,L2133
+W2134: .dw 2134000,-2134
+B2134: .db 86,-34,7
+L2135: add $2,$3,$4
+    ori $5,35,$6
+    beq $7,$8,L2135
+    jmp L2136
+    la X7
+    call L255
+    sw $9,35,$10
+    bne $11,$12,L2134
+W2135: .dw 2135000,-2135
+B2135: .db 87,-35,7
+L2136: add $9,$10,$11
+    ori $12,36,$13
+    beq $14,$15,L2136
+    jmp L2137
+    la X0
+    call L268
+    sw $16,36,$17
+    bne $18,$19,L2135
+W2136: .dw 2136000,-2136
+B2136: .db 88,-36,7
+L2137: add $16,$17,$18
+    ori $19,37,$20
+    beq $21,$22,L2137
+    jmp L2138
+    la X1
+    call L281
+    sw $23,37,$24
+    bne $25,$26,L2136
+W2137: .dw 2137000,-2137
+B2137: .db 89,-37,7
+L2138: add $23,$24,$25
+    ori $26,38,$27
+    beq $28,$29,L2138
+    jmp L2139
+    la X2
+    call L294
+    sw $30,38,$31
+    bne $0,$1,L2137
+W2138: .dw 2138000,-2138
+B2138: .db 90,-38,7
+L2139: add $30,$31,$0
+    ori $1,39,$2
+    beq $3,$4,L2139
+    jmp L2140
+    la X3
+    call L307
+    sw $5,39,$6
+    bne $7,$8,L2138
+W2139: .dw 2139000,-2139
+B2139: .db 91,-39,7
+L2140: add $5,$6,$7
+    ori $8,40,$9
+    beq $10,$11,L2140
+    jmp L2141
+    la X4
+    call L320
+    sw $12,40,$13
+    bne $14,$15,L2139
+W2140: .dw 2140000,-2140
+B2140: .db 92,-40,7
+S2140: .asciz "str2140"
+    .dh 2140
+L2141: add $12,$13,$14
+    ori $15,41,$16
+    beq $17,$18,L2141
+    jmp L2142
+    la X5
+    call L333
+    sw $19,41,$20
+    bne $21,$22,L2140
+W2141: .dw 2141000,-2141
+B2141: .db 93,-41,7
+L2142: add $19,$20,$21
+    ori $22,42,$23
+    beq $24,$25,L2142
+    jmp L2143
+    la X6
+    call L346
+    sw $26,42,$27
+    bne $28,$29,L2141
+W2142: .dw 2142000,-2142
+B2142: .db 94,-42,7
+L2143: add $26,$27,$28
+    ori $29,43,$30
+    beq $31,$0,L2143
+    jmp L2144
+    la X7
+    call L359
+    sw $1,43,$2
+    bne $3,$4,L2142
+W2143: .dw 2143000,-2143
+B2143: .db 95,-43,7
+L2144: add $1,$2,$3
+    ori $4,44,$5
+    beq $6,$7,L2144
+    jmp L2145
+    la X0
+    call L372
+    sw $8,44,$9
+    bne $10,$11,L2143
+W2144: .dw 2144000,-2144
+B2144: .db 96,-44,7
+L2145: add $8,$9,$10
+    ori $11,45,$12
+    beq $13,$14,L2145
+    jmp L2146
+    la X1
+    call L385
+    sw $15,45,$16
+    bne $17,$18,L2144
+W2145: .dw 2145000,-2145
+B2145: .db 97,-45,7
+L2146: add $15,$16,$17
+    ori $18,46,$19
+    beq $20,$21,L2146
+    jmp L2147
+    la X2
+    call L398
+    sw $22,46,$23
+    bne $24,$25,L2145
+W2146: .dw 2146000,-2146
+B2146: .db 98,-46,7
+L2147: add $22,$23,$24
+    ori $25,47,$26
+    beq $27,$28,L2147
+    jmp L2148
+    la X3
+    call L411
+    sw $29,47,$30
+    bne $31,$0,L2146
+W2147: .dw 2147000,-2147
+B2147: .db 99,-47,7
+L2148: add $29,$30,$31
+    ori $0,48,$1
+    beq $2,$3,L2148
+    jmp L2149
+    la X4
+    call L424
+    sw $4,48,$5
+    bne $6,$7,L2147
+W2148: .dw 2148000,-2148
+B2148: .db 100,-48,7
+L2149: add $4,$5,$6
+    ori $7,49,$8
+    beq $9,$10,L2149
+    jmp L2150
+    la X5
+    call L437
+    sw $11,49,$12
+    bne $13,$14,L2148
+W2149: .dw 2149000,-2149
+B2149: .db 101,-49,7
+L2150: add $11,$12,$13
+    ori $14,50,$15
+    beq $16,$17,L2150
+    jmp L2151
+    la X6
+    call L450
+    sw $18,50,$19
+    bne $20,$21,L2149
+W2150: .dw 2150000,-2150
+B2150: .db 102,-50,7
+S2150: .asciz "str2150"
+    .dh 2150
+.entry L2150
+.entry W2150
+L2151: add $18,$19,$20
+    ori $21,51,$22
+    beq $23,$24,L2151
+    jmp L2152
+    la X7
+    call L463
+    sw $25,51,$26
+    bne $27,$28,L2150
+W2151: .dw 2151000,-2151
+B2151: .db 103,-51,7
+L2152: add $25,$26,$27
+    ori $28,52,$29
+    beq $30,$31,L2152
+    jmp L2153
+    la X0
+    call L476
+    sw $0,52,$1
+    bne $2,$3,L2151
+W2152: .dw 2152000,-2152
+B2152: .db 104,-52,7
+L2153: add $0,$1,$2
+    ori $3,53,$4
+    beq $5,$6,L2153
+    jmp L2154
+    la X1
+    call L489
+    sw $7,53,$8
+    bne $9,$10,L2152
+W2153: .dw 2153000,-2153
+B2153: .db 105,-53,7
+L2154: add $7,$8,$9
+    ori $10,54,$11
+    beq $12,$13,L2154
+    jmp L2155
+    la X2
+    call L502
+    sw $14,54,$15
+    bne $16,$17,L2153
+W2154: .dw 2154000,-2154
+B2154: .db 106,-54,7
+L2155: add $14,$15,$16
+    ori $17,55,$18
+    beq $19,$20,L2155
+    jmp L2156
+    la X3
+    call L515
+    sw $21,55,$22
+    bne $23,$24,L2154
+W2155: .dw 2155000,-2155
+B2155: .db 107,-55,7
+L2156: add $21,$22,$23
+    ori $24,56,$25
+    beq $26,$27,L2156
+    jmp L2157
+    la X4
+    call L528
+    sw $28,56,$29
+    bne $30,$31,L2155
+W2156: .dw 2156000,-2156
+B2156: .db 108,-56,7
+L2157: add $28,$29,$30
+    ori $31,57,$0
+    beq $1,$2,L2157
+    jmp L2158
+    la X5
+    call L541
+    sw $3,57,$4
+    bne $5,$6,L2156
+W2157: .dw 2157000,-2157
+B2157: .db 109,-57,7
+L2158: add $3,$4,$5
+    ori $6,58,$7
+    beq $8,$9,L2158
+    jmp L2159
+    la X6
+    call L554
+    sw $10,58,$11
+    bne $12,$13,L2157
+W2158: .dw 2158000,-2158
+B2158: .db 110,-58,7
+L2159: add $10,$11,$12
+    ori $13,59,$14
+    beq $15,$16,L2159
+    jmp L2160
+    la X7
+    call L567
+    sw $17,59,$18
+    bne $19,$20,L2158
+W2159: .dw 2159000,-2159
+B2159: .db 111,-59,7
+L2160: add $17,$18,$19
+    ori $20,60,$21
+    beq $22,$23,L2160
+    jmp L2161
+    la X0
+    call L580
+    sw $24,60,$25
+    bne $26,$27,L2159
+W2160: .dw 2160000,-2160
+B2160: .db 112,-60,7
+S2160: .asciz "str2160"
+    .dh 2160
+L2161: add $24,$25,$26
+    ori $27,61,$28
+    beq $29,$30,L2161
+    jmp L2162
+    la X1
+    call L593
+    sw $31,61,$0
+    bne $1,$2,L2160
+W2161: .dw 2161000,-2161
+B2161: .db 113,-61,7
+L2162: add $31,$0,$1
+    ori $2,62,$3
+    beq $4,$5,L2162
+    jmp L2163
+    la X2
+    call L606
+    sw $6,62,$7
+    bne $8,$9,L2161
+W2162: .dw 2162000,-2162
+B2162: .db 114,-62,7
+L2163: add $6,$7,$8
+    ori $9,63,$10
+    beq $11,$12,L2163
+    jmp L2164
+    la X3
+    call L619
+    sw $13,63,$14
+    bne $15,$16,L2162
+W2163: .dw 2163000,-2163
+B2163: .db 115,-63,7
+L2164: add $13,$14,$15
+    ori $16,64,$17
+    beq $18,$19,L2164
+    jmp L2165
+    la X4
+    call L632
+    sw $20,64,$21
+    bne $22,$23,L2163
+W2164: .dw 2164000,-2164
+B2164: .db 116,-64,7
+L2165: add $20,$21,$22
+    ori $23,65,$24
+    beq $25,$26,L2165
+    jmp L2166
+    la X5
+    call L645
+    sw $27,65,$28
+    bne $29,$30,L2164
+W2165: .dw 2165000,-2165
+B2165: .db 117,-65,7
+L2166: add $27,$28,$29
+    ori $30,66,$31
+    beq $0,$1,L2166
+    jmp L2167
+    la X6
+    call L658
+    sw $2,66,$3
+    bne $4,$5,L2165
+W2166: .dw 2166000,-2166
+B2166: .db 118,-66,7
+L2167: add $2,$3,$4
+    ori $5,67,$6
+    beq $7,$8,L2167
+    jmp L2168
+    la X7
+    call L671
+    sw $9,67,$10
+    bne $11,$12,L2166
+W2167: .dw 2167000,-2167
+B2167: .db 119,-67,7
+L2168: add $9,$10,$11
+    ori $12,68,$13
+    beq $14,$15,L2168
+    jmp L2169
+    la X0
+    call L684
+    sw $16,68,$17
+    bne $18,$19,L2167
+W2168: .dw 2168000,-2168
+B2168: .db 120,-68,7
+L2169: add $16,$17,$18
+    ori $19,69,$20
+    beq $21,$22,L2169
+    jmp L2170
+    la X1
+    call L697
+    sw $23,69,$24
+    bne $25,$26,L2168
+W2169: .dw 2169000,-2169
+B2169: .db 121,-69,7
+L2170: add $23,$24,$25
+    ori $26,70,$27
+    beq $28,$29,L2170
+    jmp L2171
+    la X2
+    call L710
+    sw $30,70,$31
+    bne $0,$1,L2169
+W2170: .dw 2170000,-2170
+B2170: .db 122,-70,7
+S2170: .asciz "str2170"
+    .dh 2170
+L2171: add $30,$31,$0
+    ori $1,71,$2
+    beq $3,$4,L2171
+    jmp L2172
+    la X3
+    call L723
+    sw $5,71,$6
+    bne $7,$8,L2170
+W2171: .dw 2171000,-2171
+B2171: .db 123,-71,7
+L2172: add $5,$6,$7
+    ori $8,72,$9
+    beq $10,$11,L2172
+    jmp L2173
+    la X4
+    call L736
+    sw $12,72,$13
+    bne $14,$15,L2171
+W2172: .dw 2172000,-2172
+B2172: .db 124,-72,7
+L2173: add $12,$13,$14
+    ori $15,73,$16
+    beq $17,$18,L2173
+    jmp L2174
+    la X5
+    call L749
+    sw $19,73,$20
+    bne $21,$22,L2172
+W2173: .dw 2173000,-2173
+B2173: .db 125,-73,7
+L2174: add $19,$20,$21
+    ori $22,74,$23
+    beq $24,$25,L2174
+    jmp L2175
+    la X6
+    call L762
+    sw $26,74,$27
+    bne $28,$29,L2173
+W2174: .dw 2174000,-2174
+B2174: .db 126,-74,7
+L2175: add $26,$27,$28
+    ori $29,75,$30
+    beq $31,$0,L2175
+    jmp L2176
+    la X7
+    call L775
+    sw $1,75,$2
+    bne $3,$4,L2174
+W2175: .dw 2175000,-2175
+B2175: .db 127,-75,7
+L2176: add $1,$2,$3
+    ori $4,76,$5
+    beq $6,$7,L2176
+    jmp L2177
+    la X0
+    call L788
+    sw $8,76,$9
+    bne $10,$11,L2175
+W2176: .dw 2176000,-2176
+B2176: .db 0,-76,7
+L2177: add $8,$9,$10
+    ori $11,77,$12
+    beq $13,$14,L2177
+    jmp L2178
+    la X1
+    call L801
+    sw $15,77,$16
+    bne $17,$18,L2176
+W2177: .dw 2177000,-2177
+B2177: .db 1,-77,7
+L2178: add $15,$16,$17
+    ori $18,78,$19
+    beq $20,$21,L2178
+    jmp L2179
+    la X2
+    call L814
+    sw $22,78,$23
+    bne $24,$25,L2177
+W2178: .dw 2178000,-2178
+B2178: .db 2,-78,7
+L2179: add $22,$23,$24
+    ori $25,79,$26
+    beq $27,$28,L2179
+    jmp L2180
+    la X3
+    call L827
+    sw $29,79,$30
+    bne $31,$0,L2178
+W2179: .dw 2179000,-2179
+B2179: .db 3,-79,7
+L2180: add $29,$30,$31
+    ori $0,80,$1
+    beq $2,$3,L2180
+    jmp L2181
+    la X4
+    call L840
+    sw $4,80,$5
+    bne $6,$7,L2179
+W2180: .dw 2180000,-2180
+B2180: .db 4,-80,7
+S2180: .asciz "str2180"
+    .dh 2180
+L2181: add $4,$5,$6
+    ori $7,81,$8
+    beq $9,$10,L2181
+    jmp L2182
+    la X5
+    call L853
+    sw $11,81,$12
+    bne $13,$14,L2180
+W2181: .dw 2181000,-2181
+B2181: .db 5,-81,7
+L2182: add $11,$12,$13
+    ori $14,82,$15
+    beq $16,$17,L2182
+    jmp L2183
+    la X6
+    call L866
+    sw $18,82,$19
+    bne $20,$21,L2181
+W2182: .dw 2182000,-2182
+B2182: .db 6,-82,7
+L2183: add $18,$19,$20
+    ori $21,83,$22
+    beq $23,$24,L2183
+    jmp L2184
+    la X7
+    call L879
+    sw $25,83,$26
+    bne $27,$28,L2182
+W2183: .dw 2183000,-2183
+B2183: .db 7,-83,7
+L2184: add $25,$26,$27
+    ori $28,84,$29
+    beq $30,$31,L2184
+    jmp L2185
+    la X0
+    call L892
+    sw $0,84,$1
+    bne $2,$3,L2183
+W2184: .dw 2184000,-2184
+B2184: .db 8,-84,7
+L2185: add $0,$1,$2
+    ori $3,85,$4
+    beq $5,$6,L2185
+    jmp L2186
+    la X1
+    call L905
+    sw $7,85,$8
+    bne $9,$10,L2184
+W2185: .dw 2185000,-2185
+B2185: .db 9,-85,7
+L2186: add $7,$8,$9
+    ori $10,86,$11
+    beq $12,$13,L2186
+    jmp L2187
+    la X2
+    call L918
+    sw $14,86,$15
+    bne $16,$17,L2185
+W2186: .dw 2186000,-2186
+B2186: .db 10,-86,7
+L2187: add $14,$15,$16
+    ori $17,87,$18
+    beq $19,$20,L2187
+    jmp L2188
+    la X3
+    call L931
+    sw $21,87,$22
+    bne $23,$24,L2186
+W2187: .dw 2187000,-2187
+B2187: .db 11,-87,7
+L2188: add $21,$22,$23
+    ori $24,88,$25
+    beq $26,$27,L2188
+    jmp L2189
+    la X4
+    call L944
+    sw $28,88,$29
+    bne $30,$31,L2187
+W2188: .dw 2188000,-2188
+B2188: .db 12,-88,7
+L2189: add $28,$29,$30
+    ori $31,89,$0
+    beq $1,$2,L2189
+    jmp L2190
+    la X5
+    call L957
+    sw $3,89,$4
+    bne $5,$6,L2188
+W2189: .dw 2189000,-2189
+B2189: .db 13,-89,7
+L2190: add $3,$4,$5
+    ori $6,90,$7
+    beq $8,$9,L2190
+    jmp L2191
+    la X6
+    call L970
+    sw $10,90,$11
+    bne $12,$13,L2189
+W2190: .dw 2190000,-2190
+B2190: .db 14,-90,7
+S2190: .asciz "str2190"
+    .dh 2190
+L2191: add $10,$11,$12
+    ori $13,91,$14
+    beq $15,$16,L2191
+    jmp L2192
+    la X7
+    call L983
+    sw $17,91,$18
+    bne $19,$20,L2190
+W2191: .dw 2191000,-2191
+B2191: .db 15,-91,7
+L2192: add $17,$18,$19
+    ori $20,92,$21
+    beq $22,$23,L2192
+    jmp L2193
+    la X0
+    call L996
+    sw $24,92,$25
+    bne $26,$27,L2191
+W2192: .dw 2192000,-2192
+B2192: .db 16,-92,7
+L2193: add $24,$25,$26
+    ori $27,93,$28
+    beq $29,$30,L2193
+    jmp L2194
+    la X1
+    call L1009
+    sw $31,93,$0
+    bne $1,$2,L2192
+W2193: .dw 2193000,-2193
+B2193: .db 17,-93,7
+L2194: add $31,$0,$1
+    ori $2,94,$3
+    beq $4,$5,L2194
+    jmp L2195
+    la X2
+    call L1022
+    sw $6,94,$7
+    bne $8,$9,L2193
+W2194: .dw 2194000,-2194
+B2194: .db 18,-94,7
+L2195: add $6,$7,$8
+    ori $9,95,$10
+    beq $11,$12,L2195
+    jmp L2196
+    la X3
+    call L1035
+    sw $13,95,$14
+    bne $15,$16,L2194
+W2195: .dw 2195000,-2195
+B2195: .db 19,-95,7
+L2196: add $13,$14,$15
+    ori $16,96,$17
+    beq $18,$19,L2196
+    jmp L2197
+    la X4
+    call L1048
+    sw $20,96,$21
+    bne $22,$23,L2195
+W2196: .dw 2196000,-2196
+B2196: .db 20,-96,7
+L2197: add $20,$21,$22
+    ori $23,97,$24
+    beq $25,$26,L2197
+    jmp L2198
+    la X5
+    call L1061
+    sw $27,97,$28
+    bne $29,$30,L2196
+W2197: .dw 2197000,-2197
+B2197: .db 21,-97,7
+L2198: add $27,$28,$29
+    ori $30,98,$31
+    beq $0,$1,L2198
+    jmp L2199
+    la X6
+    call L1074
+    sw $2,98,$3
+    bne $4,$5,L2197
+W2198: .dw 2198000,-2198
+B2198: .db 22,-98,7
+L2199: add $2,$3,$4
+    ori $5,99,$6
+    beq $7,$8,L2199
+    jmp L2200
+    la X7
+    call L1087
+    sw $9,99,$10
+    bne $11,$12,L2198
+W2199: .dw 2199000,-2199
+B2199: .db 23,-99,7
+L2200: add $9,$10,$11
+    ori $12,-100,$13
+    beq $14,$15,L2200
+    jmp L2201
+    la X0
+    call L1100
+    sw $16,0,$17
+    bne $18,$19,L2199
+W2200: .dw 2200000,-2200
+B2200: .db 24,0,7
+S2200: .asciz "str2200"
+    .dh 2200
+.entry L2200
+.entry W2200
+L2201: add $16,$17,$18
+    ori $19,-99,$20
+    beq $21,$22,L2201
+    jmp L2202
+    la X1
+    call L1113
+    sw $23,1,$24
+    bne $25,$26,L2200
+W2201: .dw 2201000,-2201
+B2201: .db 25,-1,7
+L2202: add $23,$24,$25
+    ori $26,-98,$27
+    beq $28,$29,L2202
+    jmp L2203
+    la X2
+    call L1126
+    sw $30,2,$31
+    bne $0,$1,L2201
+W2202: .dw 2202000,-2202
+B2202: .db 26,-2,7
+L2203: add $30,$31,$0
+    ori $1,-97,$2
+    beq $3,$4,L2203
+    jmp L2204
+    la X3
+    call L1139
+    sw $5,3,$6
+    bne $7,$8,L2202
+W2203: .dw 2203000,-2203
+B2203: .db 27,-3,7
+L2204: add $5,$6,$7
+    ori $8,-96,$9
+    beq $10,$11,L2204
+    jmp L2205
+    la X4
+    call L1152
+    sw $12,4,$13
+    bne $14,$15,L2203
+W2204: .dw 2204000,-2204
+B2204: .db 28,-4,7
+L2205: add $12,$13,$14
+    ori $15,-95,$16
+    beq $17,$18,L2205
+    jmp L2206
+    la X5
+    call L1165
+    sw $19,5,$20
+    bne $21,$22,L2204
+W2205: .dw 2205000,-2205
+B2205: .db 29,-5,7
+L2206: add $19,$20,$21
+    ori $22,-94,$23
+    beq $24,$25,L2206
+    jmp L2207
+    la X6
+    call L1178
+    sw $26,6,$27
+    bne $28,$29,L2205
+W2206: .dw 2206000,-2206
+B2206: .db 30,-6,7
+L2207: add $26,$27,$28
+    ori $29,-93,$30
+    beq $31,$0,L2207
+    jmp L2208
+    la X7
+    call L1191
+    sw $1,7,$2
+    bne $3,$4,L2206
+W2207: .dw 2207000,-2207
+B2207: .db 31,-7,7
+L2208: add $1,$2,$3
+    ori $4,-92,$5
+    beq $6,$7,L2208
+    jmp L2209
+    la X0
+    call L1204
+    sw $8,8,$9
+    bne $10,$11,L2207
+W2208: .dw 2208000,-2208
+B2208: .db 32,-8,7
+L2209: add $8,$9,$10
+    ori $11,-91,$12
+    beq $13,$14,L2209
+    jmp L2210
+    la X1
+    call L1217
+    sw $15,9,$16
+    bne $17,$18,L2208
+W2209: .dw 2209000,-2209
+B2209: .db 33,-9,7
+L2210: add $15,$16,$17
+    ori $18,-90,$19
+    beq $20,$21,L2210
+    jmp L2211
+    la X2
+    call L1230
+    sw $22,10,$23
+    bne $24,$25,L2209
+W2210: .dw 2210000,-2210
+B2210: .db 34,-10,7
+S2210: .asciz "str2210"
+    .dh 2210
+L2211: add $22,$23,$24
+    ori $25,-89,$26
+    beq $27,$28,L2211
+    jmp L2212
+    la X3
+    call L1243
+    sw $29,11,$30
+    bne $31,$0,L2210
+W2211: .dw 2211000,-2211
+B2211: .db 35,-11,7
+L2212: add $29,$30,$31
+    ori $0,-88,$1
+    beq $2,$3,L2212
+    jmp L2213
+    la X4
+    call L1256
+    sw $4,12,$5
+    bne $6,$7,L2211
+W2212: .dw 2212000,-2212
+B2212: .db 36,-12,7
+L2213: add $4,$5,$6
+    ori $7,-87,$8
+    beq $9,$10,L2213
+    jmp L2214
+    la X5
+    call L1269
+    sw $11,13,$12
+    bne $13,$14,L2212
+W2213: .dw 2213000,-2213
+B2213: .db 37,-13,7
+L2214: add $11,$12,$13
+    ori $14,-86,$15
+    beq $16,$17,L2214
+    jmp L2215
+    la X6
+    call L1282
+    sw $18,14,$19
+    bne $20,$21,L2213
+W2214: .dw 2214000,-2214
+B2214: .db 38,-14,7
+L2215: add $18,$19,$20
+    ori $21,-85,$22
+    beq $23,$24,L2215
+    jmp L2216
+    la X7
+    call L1295
+    sw $25,15,$26
+    bne $27,$28,L2214
+W2215: .dw 2215000,-2215
+B2215: .db 39,-15,7
+L2216: add $25,$26,$27
+    ori $28,-84,$29
+    beq $30,$31,L2216
+    jmp L2217
+    la X0
+    call L1308
+    sw $0,16,$1
+    bne $2,$3,L2215
+W2216: .dw 2216000,-2216
+B2216: .db 40,-16,7
+L2217: add $0,$1,$2
+    ori $3,-83,$4
+    beq $5,$6,L2217
+    jmp L2218
+    la X1
+    call L1321
+    sw $7,17,$8
+    bne $9,$10,L2216
+W2217: .dw 2217000,-2217
+B2217: .db 41,-17,7
+L2218: add $7,$8,$9
+    ori $10,-82,$11
+    beq $12,$13,L2218
+    jmp L2219
+    la X2
+    call L1334
+    sw $14,18,$15
+    bne $16,$17,L2217
+W2218: .dw 2218000,-2218
+B2218: .db 42,-18,7
+L2219: add $14,$15,$16
+    ori $17,-81,$18
+    beq $19,$20,L2219
+    jmp L2220
+    la X3
+    call L1347
+    sw $21,19,$22
+    bne $23,$24,L2218
+W2219: .dw 2219000,-2219
+B2219: .db 43,-19,7
+L2220: add $21,$22,$23
+    ori $24,-80,$25
+    beq $26,$27,L2220
+    jmp L2221
+    la X4
+    call L1360
+    sw $28,20,$29
+    bne $30,$31,L2219
+W2220: .dw 2220000,-2220
+B2220: .db 44,-20,7
+S2220: .asciz "str2220"
+    .dh 2220
+L2221: add $28,$29,$30
+    ori $31,-79,$0
+    beq $1,$2,L2221
+    jmp L2222
+    la X5
+    call L1373
+    sw $3,21,$4
+    bne $5,$6,L2220
+W2221: .dw 2221000,-2221
+B2221: .db 45,-21,7
+L2222: add $3,$4,$5
+    ori $6,-78,$7
+    beq $8,$9,L2222
+    jmp L2223
+    la X6
+    call L1386
+    sw $10,22,$11
+    bne $12,$13,L2221
+W2222: .dw 2222000,-2222
+B2222: .db 46,-22,7
+L2223: add $10,$11,$12
+    ori $13,-77,$14
+    beq $15,$16,L2223
+    jmp L2224
+    la X7
+    call L1399
+    sw $17,23,$18
+    bne $19,$20,L2222
+W2223: .dw 2223000,-2223
+B2223: .db 47,-23,7
+L2224: add $17,$18,$19
+    ori $20,-76,$21
+    beq $22,$23,L2224
+    jmp L2225
+    la X0
+    call L1412
+    sw $24,24,$25
+    bne $26,$27,L2223
+W2224: .dw 2224000,-2224
+B2224: .db 48,-24,7
+L2225: add $24,$25,$26
+    ori $27,-75,$28
+    beq $29,$30,L2225
+    jmp L2226
+    la X1
+    call L1425
+    sw $31,25,$0
+    bne $1,$2,L2224
+W2225: .dw 2225000,-2225
+B2225: .db 49,-25,7
+L2226: add $31,$0,$1
+    ori $2,-74,$3
+    beq $4,$5,L2226
+    jmp L2227
+    la X2
+    call L1438
+    sw $6,26,$7
+    bne $8,$9,L2225
+W2226: .dw 2226000,-2226
+B2226: .db 50,-26,7
+L2227: add $6,$7,$8
+    ori $9,-73,$10
+    beq $11,$12,L2227
+    jmp L2228
+    la X3
+    call L1451
+    sw $13,27,$14
+    bne $15,$16,L2226
+W2227: .dw 2227000,-2227
+B2227: .db 51,-27,7
+L2228: add $13,$14,$15
+    ori $16,-72,$17
+    beq $18,$19,L2228
+    jmp L2229
+    la X4
+    call L1464
+    sw $20,28,$21
+    bne $22,$23,L2227
+W2228: .dw 2228000,-2228
+B2228: .db 52,-28,7
+L2229: add $20,$21,$22
+    ori $23,-71,$24
+    beq $25,$26,L2229
+    jmp L2230
+    la X5
+    call L1477
+    sw $27,29,$28
+    bne $29,$30,L2228
+W2229: .dw 2229000,-2229
+B2229: .db 53,-29,7
+L2230: add $27,$28,$29
+    ori $30,-70,$31
+    beq $0,$1,L2230
+    jmp L2231
+    la X6
+    call L1490
+    sw $2,30,$3
+    bne $4,$5,L2229
+W2230: .dw 2230000,-2230
+B2230: .db 54,-30,7
+S2230: .asciz "str2230"
+    .dh 2230
+L2231: add $2,$3,$4
+    ori $5,-69,$6
+    beq $7,$8,L2231
+    jmp L2232
+    la X7
+    call L1503
+    sw $9,31,$10
+    bne $11,$12,L2230
+W2231: .dw 2231000,-2231
+B2231: .db 55,-31,7
+L2232: add $9,$10,$11
+    ori $12,-68,$13
+    beq $14,$15,L2232
+    jmp L2233
+    la X0
+    call L1516
+    sw $16,32,$17
+    bne $18,$19,L2231
+W2232: .dw 2232000,-2232
+B2232: .db 56,-32,7
+L2233: add $16,$17,$18
+    ori $19,-67,$20
+    beq $21,$22,L2233
+    jmp L2234
+    la X1
+    call L1529
+    sw $23,33,$24
+    bne $25,$26,L2232
+W2233: .dw 2233000,-2233
+B2233: .db 57,-33,7
+L2234: add $23,$24,$25
+    ori $26,-66,$27
+    beq $28,$29,L2234
+    jmp L2235
+    la X2
+    call L1542
+    sw $30,34,$31
+    bne $0,$1,L2233
+W2234: .dw 2234000,-2234
+B2234: .db 58,-34,7
+L2235: add $30,$31,$0
+    ori $1,-65,$2
+    beq $3,$4,L2235
+    jmp L2236
+    la X3
+    call L1555
+    sw $5,35,$6
+    bne $7,$8,L2234
+W2235: .dw 2235000,-2235
+B2235: .db 59,-35,7
+L2236: add $5,$6,$7
+    ori $8,-64,$9
+    beq $10,$11,L2236
+    jmp L2237
+    la X4
+    call L1568
+    sw $12,36,$13
+    bne $14,$15,L2235
+W2236: .dw 2236000,-2236
+B2236: .db 60,-36,7
+L2237: add $12,$13,$14
+    ori $15,-63,$16
+    beq $17,$18,L2237
+    jmp L2238
+    la X5
+    call L1581
+    sw $19,37,$20
+    bne $21,$22,L2236
+W2237: .dw 2237000,-2237
+B2237: .db 61,-37,7
+L2238: add $19,$20,$21
+    ori $22,-62,$23
+    beq $24,$25,L2238
+    jmp L2239
+    la X6
+    call L1594
+    sw $26,38,$27
+    bne $28,$29,L2237
+W2238: .dw 2238000,-2238
+B2238: .db 62,-38,7
+L2239: add $26,$27,$28
+    ori $29,-61,$30
+    beq $31,$0,L2239
+    jmp L2240
+    la X7
+    call L1607
+    sw $1,39,$2
+    bne $3,$4,L2238
+W2239: .dw 2239000,-2239
+B2239: .db 63,-39,7
+L2240: add $1,$2,$3
+    ori $4,-60,$5
+    beq $6,$7,L2240
+    jmp L2241
+    la X0
+    call L1620
+    sw $8,40,$9
+    bne $10,$11,L2239
+W2240: .dw 2240000,-2240
+B2240: .db 64,-40,7
+S2240: .asciz "str2240"
+    .dh 2240
+L2241: add $8,$9,$10
+    ori $11,-59,$12
+    beq $13,$14,L2241
+    jmp L2242
+    la X1
+    call L1633
+    sw $15,41,$16
+    bne $17,$18,L2240
+W2241: .dw 2241000,-2241
+B2241: .db 65,-41,7
+L2242: add $15,$16,$17
+    ori $18,-58,$19
+    beq $20,$21,L2242
+    jmp L2243
+    la X2
+    call L1646
+    sw $22,42,$23
+    bne $24,$25,L2241
+W2242: .dw 2242000,-2242
+B2242: .db 66,-42,7
+L2243: add $22,$23,$24
+    ori $25,-57,$26
+    beq $27,$28,L2243
+    jmp L2244
+    la X3
+    call L1659
+    sw $29,43,$30
+    bne $31,$0,L2242
+W2243: .dw 2243000,-2243
+B2243: .db 67,-43,7
+L2244: add $29,$30,$31
+    ori $0,-56,$1
+    beq $2,$3,L2244
+    jmp L2245
+    la X4
+    call L1672
+    sw $4,44,$5
+    bne $6,$7,L2243
+W2244: .dw 2244000,-2244
+B2244: .db 68,-44,7
+L2245: add $4,$5,$6
+    ori $7,-55,$8
+    beq $9,$10,L2245
+    jmp L2246
+    la X5
+    call L1685
+    sw $11,45,$12
+    bne $13,$14,L2244
+W2245: .dw 2245000,-2245
+B2245: .db 69,-45,7
+L2246: add $11,$12,$13
+    ori $14,-54,$15
+    beq $16,$17,L2246
+    jmp L2247
+    la X6
+    call L1698
+    sw $18,46,$19
+    bne $20,$21,L2245
+W2246: .dw 2246000,-2246
+B2246: .db 70,-46,7
+L2247: add $18,$19,$20
+    ori $21,-53,$22
+    beq $23,$24,L2247
+    jmp L2248
+    la X7
+    call L1711
+    sw $25,47,$26
+    bne $27,$28,L2246
+W2247: .dw 2247000,-2247
+B2247: .db 71,-47,7
+L2248: add $25,$26,$27
+    ori $28,-52,$29
+    beq $30,$31,L2248
+    jmp L2249
+    la X0
+    call L1724
+    sw $0,48,$1
+    bne $2,$3,L2247
+W2248: .dw 2248000,-2248
+B2248: .db 72,-48,7
+L2249: add $0,$1,$2
+    ori $3,-51,$4
+    beq $5,$6,L2249
+    jmp L2250
+    la X1
+    call L1737
+    sw $7,49,$8
+    bne $9,$10,L2248
+W2249: .dw 2249000,-2249
+B2249: .db 73,-49,7
+L2250: add $7,$8,$9
+    ori $10,-50,$11
+    beq $12,$13,L2250
+    jmp L2251
+    la X2
+    call L1750
+    sw $14,50,$15
+    bne $16,$17,L2249
+W2250: .dw 2250000,-2250
+B2250: .db 74,-50,7
+S2250: .asciz "str2250"
+    .dh 2250
+.entry L2250
+.entry W2250
+L2251: add $14,$15,$16
+    ori $17,-49,$18
+    beq $19,$20,L2251
+    jmp L2252
+    la X3
+    call L1763
+    sw $21,51,$22
+    bne $23,$24,L2250
+W2251: .dw 2251000,-2251
+B2251: .db 75,-51,7
+L2252: add $21,$22,$23
+    ori $24,-48,$25
+    beq $26,$27,L2252
+    jmp L2253
+    la X4
+    call L1776
+    sw $28,52,$29
+    bne $30,$31,L2251
+W2252: .dw 2252000,-2252
+B2252: .db 76,-52,7
+L2253: add $28,$29,$30
+    ori $31,-47,$0
+    beq $1,$2,L2253
+    jmp L2254
+    la X5
+    call L1789
+    sw $3,53,$4
+    bne $5,$6,L2252
+W2253: .dw 2253000,-2253
+B2253: .db 77,-53,7
+L2254: add $3,$4,$5
+    ori $6,-46,$7
+    beq $8,$9,L2254
+    jmp L2255
+    la X6
+    call L1802
+    sw $10,54,$11
+    bne $12,$13,L2253
+W2254: .dw 2254000,-2254
+B2254: .db 78,-54,7
+L2255: add $10,$11,$12
+    ori $13,-45,$14
+    beq $15,$16,L2255
+    jmp L2256
+    la X7
+    call L1815
+    sw $17,55,$18
+    bne $19,$20,L2254
+W2255: .dw 2255000,-2255
+B2255: .db 79,-55,7
+L2256: add $17,$18,$19
+    ori $20,-44,$21
+    beq $22,$23,L2256
+    jmp L2257
+    la X0
+    call L1828
+    sw $24,56,$25
+    bne $26,$27,L2255
+W2256: .dw 2256000,-2256
+B2256: .db 80,-56,7
+L2257: add $24,$25,$26
+    ori $27,-43,$28
+    beq $29,$30,L2257
+    jmp L2258
+    la X1
+    call L1841
+    sw $31,57,$0
+    bne $1,$2,L2256
+W2257: .dw 2257000,-2257
+B2257: .db 81,-57,7
+L2258: add $31,$0,$1
+    ori $2,-42,$3
+    beq $4,$5,L2258
+    jmp L2259
+    la X2
+    call L1854
+    sw $6,58,$7
+    bne $8,$9,L2257
+W2258: .dw 2258000,-2258
+B2258: .db 82,-58,7
+L2259: add $6,$7,$8
+    ori $9,-41,$10
+    beq $11,$12,L2259
+    jmp L2260
+    la X3
+    call L1867
+    sw $13,59,$14
+    bne $15,$16,L2258
+W2259: .dw 2259000,-2259
+B2259: .db 83,-59,7
+L2260: add $13,$14,$15
+    ori $16,-40,$17
+    beq $18,$19,L2260
+    jmp L2261
+    la X4
+    call L1880
+    sw $20,60,$21
+    bne $22,$23,L2259
+W2260: .dw 2260000,-2260
+B2260: .db 84,-60,7
+S2260: .asciz "str2260"
+    .dh 2260
+L2261: add $20,$21,$22
+    ori $23,-39,$24
+    beq $25,$26,L2261
+    jmp L2262
+    la X5
+    call L1893
+    sw $27,61,$28
+    bne $29,$30,L2260
+W2261: .dw 2261000,-2261
+B2261: .db 85,-61,7
+L2262: add $27,$28,$29
+    ori $30,-38,$31
+    beq $0,$1,L2262
+    jmp L2263
+    la X6
+    call L1906
+    sw $2,62,$3
+    bne $4,$5,L2261
+W2262: .dw 2262000,-2262
+B2262: .db 86,-62,7
+L2263: add $2,$3,$4
+    ori $5,-37,$6
+    beq $7,$8,L2263
+    jmp L2264
+    la X7
+    call L1919
+    sw $9,63,$10
+    bne $11,$12,L2262
+W2263: .dw 2263000,-2263
+B2263: .db 87,-63,7
+L2264: add $9,$10,$11
+    ori $12,-36,$13
+    beq $14,$15,L2264
+    jmp L2265
+    la X0
+    call L1932
+    sw $16,64,$17
+    bne $18,$19,L2263
+W2264: .dw 2264000,-2264
+B2264: .db 88,-64,7
+L2265: add $16,$17,$18
+    ori $19,-35,$20
+    beq $21,$22,L2265
+    jmp L2266
+    la X1
+    call L1945
+    sw $23,65,$24
+    bne $25,$26,L2264
+W2265: .dw 2265000,-2265
+B2265: .db 89,-65,7
+L2266: add $23,$24,$25
+    ori $26,-34,$27
+    beq $28,$29,L2266
+    jmp L2267
+    la X2
+    call L1958
+    sw $30,66,$31
+    bne $0,$1,L2265
+W2266: .dw 2266000,-2266
+B2266: .db 90,-66,7
+L2267: add $30,$31,$0
+    ori $1,-33,$2
+    beq $3,$4,L2267
+    jmp L2268
+    la X3
+    call L1971
+    sw $5,67,$6
+    bne $7,$8,L2266
+W2267: .dw 2267000,-2267
+B2267: .db 91,-67,7
+L2268: add $5,$6,$7
+    ori $8,-32,$9
+    beq $10,$11,L2268
+    jmp L2269
+    la X4
+    call L1984
+    sw $12,68,$13
+    bne $14,$15,L2267
+W2268: .dw 2268000,-2268
+B2268: .db 92,-68,7
+L2269: add $12,$13,$14
+    ori $15,-31,$16
+    beq $17,$18,L2269
+    jmp L2270
+    la X5
+    call L1997
+    sw $19,69,$20
+    bne $21,$22,L2268
+W2269: .dw 2269000,-2269
+B2269: .db 93,-69,7
+L2270: add $19,$20,$21
+    ori $22,-30,$23
+    beq $24,$25,L2270
+    jmp L2271
+    la X6
+    call L2010
+    sw $26,70,$27
+    bne $28,$29,L2269
+W2270: .dw 2270000,-2270
+B2270: .db 94,-70,7
+S2270: .asciz "str2270"
+    .dh 2270
+L2271: add $26,$27,$28
+    ori $29,-29,$30
+    beq $31,$0,L2271
+    jmp L2272
+    la X7
+    call L2023
+    sw $1,71,$2
+    bne $3,$4,L2270
+W2271: .dw 2271000,-2271
+B2271: .db 95,-71,7
+L2272: add $1,$2,$3
+    ori $4,-28,$5
+    beq $6,$7,L2272
+    jmp L2273
+    la X0
+    call L2036
+    sw $8,72,$9
+    bne $10,$11,L2271
+W2272: .dw 2272000,-2272
+B2272: .db 96,-72,7
+L2273: add $8,$9,$10
+    ori $11,-27,$12
+    beq $13,$14,L2273
+    jmp L2274
+    la X1
+    call L2049
+    sw $15,73,$16
+    bne $17,$18,L2272
+W2273: .dw 2273000,-2273
+B2273: .db 97,-73,7
+L2274: add $15,$16,$17
+    ori $18,-26,$19
+    beq $20,$21,L2274
+    jmp L2275
+    la X2
+    call L2062
+    sw $22,74,$23
+    bne $24,$25,L2273
+W2274: .dw 2274000,-2274
+B2274: .db 98,-74,7
+L2275: add $22,$23,$24
+    ori $25,-25,$26
+    beq $27,$28,L2275
+    jmp L2276
+    la X3
+    call L2075
+    sw $29,75,$30
+    bne $31,$0,L2274
+W2275: .dw 2275000,-2275
+B2275: .db 99,-75,7
+L2276: add $29,$30,$31
+    ori $0,-24,$1
+    beq $2,$3,L2276
+    jmp L2277
+    la X4
+    call L2088
+    sw $4,76,$5
+    bne $6,$7,L2275
+W2276: .dw 2276000,-2276
+B2276: .db 100,-76,7
+L2277: add $4,$5,$6
+    ori $7,-23,$8
+    beq $9,$10,L2277
+    jmp L2278
+    la X5
+    call L2101
+    sw $11,77,$12
+    bne $13,$14,L2276
+W2277: .dw 2277000,-2277
+B2277: .db 101,-77,7
+L2278: add $11,$12,$13
+    ori $14,-22,$15
+    beq $16,$17,L2278
+    jmp L2279
+    la X6
+    call L2114
+    sw $18,78,$19
+    bne $20,$21,L2277
+W2278: .dw 2278000,-2278
+B2278: .db 102,-78,7
+L2279: add $18,$19,$20
+    ori $21,-21,$22
+    beq $23,$24,L2279
+    jmp L2280
+    la X7
+    call L2127
+    sw $25,79,$26
+    bne $27,$28,L2278
+W2279: .dw 2279000,-2279
+B2279: .db 103,-79,7
+L2280: add $25,$26,$27
+    ori $28,-20,$29
+    beq $30,$31,L2280
+    jmp L2281
+    la X0
+    call L2140
+    sw $0,80,$1
+    bne $2,$3,L2279
+W2280: .dw 2280000,-2280
+B2280: .db 104,-80,7
+S2280: .asciz "str2280"
+    .dh 2280
+L2281: add $0,$1,$2
+    ori $3,-19,$4
+    beq $5,$6,L2281
+    jmp L2282
+    la X1
+    call L2153
+    sw $7,81,$8
+    bne $9,$10,L2280
+W2281: .dw 2281000,-2281
+B2281: .db 105,-81,7
+L2282: add $7,$8,$9
+    ori $10,-18,$11
+    beq $12,$13,L2282
+    jmp L2283
+    la X2
+    call L2166
+    sw $14,82,$15
+    bne $16,$17,L2281
+W2282: .dw 2282000,-2282
+B2282: .db 106,-82,7
+L2283: add $14,$15,$16
+    ori $17,-17,$18
+    beq $19,$20,L2283
+    jmp L2284
+    la X3
+    call L2179
+    sw $21,83,$22
+    bne $23,$24,L2282
+W2283: .dw 2283000,-2283
+B2283: .db 107,-83,7
+L2284: add $21,$22,$23
+    ori $24,-16,$25
+    beq $26,$27,L2284
+    jmp L2285
+    la X4
+    call L2192
+    sw $28,84,$29
+    bne $30,$31,L2283
+W2284: .dw 2284000,-2284
+B2284: .db 108,-84,7
+L2285: add $28,$29,$30
+    ori $31,-15,$0
+    beq $1,$2,L2285
+    jmp L2286
+    la X5
+    call L2205
+    sw $3,85,$4
+    bne $5,$6,L2284
+W2285: .dw 2285000,-2285
+B2285: .db 109,-85,7
+L2286: add $3,$4,$5
+    ori $6,-14,$7
+    beq $8,$9,L2286
+    jmp L2287
+    la X6
+    call L2218
+    sw $10,86,$11
+    bne $12,$13,L2285
+W2286: .dw 2286000,-2286
+B2286: .db 110,-86,7
+L2287: add $10,$11,$12
+    ori $13,-13,$14
+    beq $15,$16,L2287
+    jmp L2288
+    la X7
+    call L2231
+    sw $17,87,$18
+    bne $19,$20,L2286
+W2287: .dw 2287000,-2287
+B2287: .db 111,-87,7
+L2288: add $17,$18,$19
+    ori $20,-12,$21
+    beq $22,$23,L2288
+    jmp L2289
+    la X0
+    call L2244
+    sw $24,88,$25
+    bne $26,$27,L2287
+W2288: .dw 2288000,-2288
+B2288: .db 112,-88,7
+L2289: add $24,$25,$26
+    ori $27,-11,$28
+    beq $29,$30,L2289
+    jmp L2290
+    la X1
+    call L2257
+    sw $31,89,$0
+    bne $1,$2,L2288
+W2289: .dw 2289000,-2289
+B2289: .db 113,-89,7
+L2290: add $31,$0,$1
+    ori $2,-10,$3
+    beq $4,$5,L2290
+    jmp L2291
+    la X2
+    call L2270
+    sw $6,90,$7
+    bne $8,$9,L2289
+W2290: .dw 2290000,-2290
+B2290: .db 114,-90,7
+S2290: .asciz "str2290"
+    .dh 2290
+L2291: add $6,$7,$8
+    ori $9,-9,$10
+    beq $11,$12,L2291
+    jmp L2292
+    la X3
+    call L2283
+    sw $13,91,$14
+    bne $15,$16,L2290
+W2291: .dw 2291000,-2291
+B2291: .db 115,-91,7
+L2292: add $13,$14,$15
+    ori $16,-8,$17
+    beq $18,$19,L2292
+    jmp L2293
+    la X4
+    call L2296
+    sw $20,92,$21
+    bne $22,$23,L2291
+W2292: .dw 2292000,-2292
+B2292: .db 116,-92,7
+L2293: add $20,$21,$22
+    ori $23,-7,$24
+    beq $25,$26,L2293
+    jmp L2294
+    la X5
+    call L2309
+    sw $27,93,$28
+    bne $29,$30,L2292
+W2293: .dw 2293000,-2293
+B2293: .db 117,-93,7
+L2294: add $27,$28,$29
+    ori $30,-6,$31
+    beq $0,$1,L2294
+    jmp L2295
+    la X6
+    call L2322
+    sw $2,94,$3
+    bne $4,$5,L2293
+W2294: .dw 2294000,-2294
+B2294: .db 118,-94,7
+L2295: add $2,$3,$4
+    ori $5,-5,$6
+    beq $7,$8,L2295
+    jmp L2296
+    la X7
+    call L2335
+    sw $9,95,$10
+    bne $11,$12,L2294
+W2295: .dw 2295000,-2295
+B2295: .db 119,-95,7
+L2296: add $9,$10,$11
+    ori $12,-4,$13
+    beq $14,$15,L2296
+    jmp L2297
+    la X0
+    call L2348
+    sw $16,96,$17
+    bne $18,$19,L2295
+W2296: .dw 2296000,-2296
+B2296: .db 120,-96,7
+L2297: add $16,$17,$18
+    ori $19,-3,$20
+    beq $21,$22,L2297
+    jmp L2298
+    la X1
+    call L2361
+    sw $23,97,$24
+    bne $25,$26,L2296
+W2297: .dw 2297000,-2297
+B2297: .db 121,-97,7
+L2298: add $23,$24,$25
+    ori $26,-2,$27
+    beq $28,$29,L2298
+    jmp L2299
+    la X2
+    call L2374
+    sw $30,98,$31
+    bne $0,$1,L2297
+W2298: .dw 2298000,-2298
+B2298: .db 122,-98,7
+L2299: add $30,$31,$0
+    ori $1,-1,$2
+    beq $3,$4,L2299
+    jmp L2300
+    la X3
+    call L2387
+    sw $5,99,$6
+    bne $7,$8,L2298
+W2299: .dw 2299000,-2299
+B2299: .db 123,-99,7
+L2300: add $5,$6,$7
+    ori $8,0,$9
+    beq $10,$11,L2300
+    jmp L2301
+    la X4
+    call L2400
+    sw $12,0,$13
+    bne $14,$15,L2299
+W2300: .dw 2300000,-2300
+B2300: .db 124,0,7
+S2300: .asciz "str2300"
+    .dh 2300
+.entry L2300
+.entry W2300
+L2301: add $12,$13,$14
+    ori $15,1,$16
+    beq $17,$18,L2301
+    jmp L2302
+    la X5
+    call L2413
+    sw $19,1,$20
+    bne $21,$22,L2300
+W2301: .dw 2301000,-2301
+B2301: .db 125,-1,7
+L2302: add $19,$20,$21
+    ori $22,2,$23
+    beq $24,$25,L2302
+    jmp L2303
+    la X6
+    call L2426
+    sw $26,2,$27
+    bne $28,$29,L2301
+W2302: .dw 2302000,-2302
+B2302: .db 126,-2,7
+L2303: add $26,$27,$28
+    ori $29,3,$30
+    beq $31,$0,L2303
+    jmp L2304
+    la X7
+    call L2439
+    sw $1,3,$2
+    bne $3,$4,L2302
+W2303: .dw 2303000,-2303
+B2303: .db 127,-3,7
+L2304: add $1,$2,$3
+    ori $4,4,$5
+    beq $6,$7,L2304
+    jmp L2305
+    la X0
+    call L2452
+    sw $8,4,$9
+    bne $10,$11,L2303
+W2304: .dw 2304000,-2304
+B2304: .db 0,-4,7
+L2305: add $8,$9,$10
+    ori $11,5,$12
+    beq $13,$14,L2305
+    jmp L2306
+    la X1
+    call L2465
+    sw $15,5,$16
+    bne $17,$18,L2304
+W2305: .dw 2305000,-2305
+B2305: .db 1,-5,7
+L2306: add $15,$16,$17
+    ori $18,6,$19
+    beq $20,$21,L2306
+    jmp L2307
+    la X2
+    call L2478
+    sw $22,6,$23
+    bne $24,$25,L2305
+W2306: .dw 2306000,-2306
+B2306: .db 2,-6,7
+L2307: add $22,$23,$24
+    ori $25,7,$26
+    beq $27,$28,L2307
+    jmp L2308
+    la X3
+    call L2491
+    sw $29,7,$30
+    bne $31,$0,L2306
+W2307: .dw 2307000,-2307
+B2307: .db 3,-7,7
+L2308: add $29,$30,$31
+    ori $0,8,$1
+    beq $2,$3,L2308
+    jmp L2309
+    la X4
+    call L4
+    sw $4,8,$5
+    bne $6,$7,L2307
+W2308: .dw 2308000,-2308
+B2308: .db 4,-8,7
+L2309: add $4,$5,$6
+    ori $7,9,$8
+    beq $9,$10,L2309
+    jmp L2310
+    la X5
+    call L17
+    sw $11,9,$12
+    bne $13,$14,L2308
+W2309: .dw 2309000,-2309
+B2309: .db 5,-9,7
+L2310: add $11,$12,$13
+    ori $14,10,$15
+    beq $16,$17,L2310
+    jmp L2311
+    la X6
+    call L30
+    sw $18,10,$19
+    bne $20,$21,L2309
+W2310: .dw 2310000,-2310
+B2310: .db 6,-10,7
+S2310: .asciz "str2310"
+    .dh 2310
+L2311: add $18,$19,$20
+    ori $21,11,$22
+    beq $23,$24,L2311
+    jmp L2312
+    la X7
+    call L43
+    sw $25,11,$26
+    bne $27,$28,L2310
+W2311: .dw 2311000,-2311
+B2311: .db 7,-11,7
+L2312: add $25,$26,$27
+    ori $28,12,$29
+    beq $30,$31,L2312
+    jmp L2313
+    la X0
+    call L56
+    sw $0,12,$1
+    bne $2,$3,L2311
+W2312: .dw 2312000,-2312
+B2312: .db 8,-12,7
+L2313: add $0,$1,$2
+    ori $3,13,$4
+    beq $5,$6,L2313
+    jmp L2314
+    la X1
+    call L69
+    sw $7,13,$8
+    bne $9,$10,L2312
+W2313: .dw 2313000,-2313
+B2313: .db 9,-13,7
+L2314: add $7,$8,$9
+    ori $10,14,$11
+    beq $12,$13,L2314
+    jmp L2315
+    la X2
+    call L82
+    sw $14,14,$15
+    bne $16,$17,L2313
+W2314: .dw 2314000,-2314
+B2314: .db 10,-14,7
+L2315: add $14,$15,$16
+    ori $17,15,$18
+    beq $19,$20,L2315
+    jmp L2316
+    la X3
+    call L95
+    sw $21,15,$22
+    bne $23,$24,L2314
+W2315: .dw 2315000,-2315
+B2315: .db 11,-15,7
+L2316: add $21,$22,$23
+    ori $24,16,$25
+    beq $26,$27,L2316
+    jmp L2317
+    la X4
+    call L108
+    sw $28,16,$29
+    bne $30,$31,L2315
+W2316: .dw 2316000,-2316
+B2316: .db 12,-16,7
+L2317: add $28,$29,$30
+    ori $31,17,$0
+    beq $1,$2,L2317
+    jmp L2318
+    la X5
+    call L121
+    sw $3,17,$4
+    bne $5,$6,L2316
+W2317: .dw 2317000,-2317
+B2317: .db 13,-17,7
+L2318: add $3,$4,$5
+    ori $6,18,$7
+    beq $8,$9,L2318
+    jmp L2319
+    la X6
+    call L134
+    sw $10,18,$11
+    bne $12,$13,L2317
+W2318: .dw 2318000,-2318
+B2318: .db 14,-18,7
+L2319: add $10,$11,$12
+    ori $13,19,$14
+    beq $15,$16,L2319
+    jmp L2320
+    la X7
+    call L147
+    sw $17,19,$18
+    bne $19,$20,L2318
+W2319: .dw 2319000,-2319
+B2319: .db 15,-19,7
+L2320: add $17,$18,$19
+    ori $20,20,$21
+    beq $22,$23,L2320
+    jmp L2321
+    la X0
+    call L160
+    sw $24,20,$25
+    bne $26,$27,L2319
+W2320: .dw 2320000,-2320
+B2320: .db 16,-20,7
+S2320: .asciz "str2320"
+    .dh 2320
+L2321: add $24,$25,$26
+    ori $27,21,$28
+    beq $29,$30,L2321
+    jmp L2322
+    la X1
+    call L173
+    sw $31,21,$0
+    bne $1,$2,L2320
+W2321: .dw 2321000,-2321
+B2321: .db 17,-21,7
+L2322: add $31,$0,$1
+    ori $2,22,$3
+    beq $4,$5,L2322
+    jmp L2323
+    la X2
+    call L186
+    sw $6,22,$7
+    bne $8,$9,L2321
+W2322: .dw 2322000,-2322
+B2322: .db 18,-22,7
+L2323: add $6,$7,$8
+    ori $9,23,$10
+    beq $11,$12,L2323
+    jmp L2324
+    la X3
+    call L199
+    sw $13,23,$14
+    bne $15,$16,L2322
+W2323: .dw 2323000,-2323
+B2323: .db 19,-23,7
+L2324: add $13,$14,$15
+    ori $16,24,$17
+    beq $18,$19,L2324
+    jmp L2325
+    la X4
+    call L212
+    sw $20,24,$21
+    bne $22,$23,L2323
+W2324: .dw 2324000,-2324
+B2324: .db 20,-24,7
+L2325: add $20,$21,$22
+    ori $23,25,$24
+    beq $25,$26,L2325
+    jmp L2326
+    la X5
+    call L225
+    sw $27,25,$28
+    bne $29,$30,L2324
+W2325: .dw 2325000,-2325
+B2325: .db 21,-25,7
+L2326: add $27,$28,$29
+    ori $30,26,$31
+    beq $0,$1,L2326
+    jmp L2327
+    la X6
+    call L238
+    sw $2,26,$3
+    bne $4,$5,L2325
+W2326: .dw 2326000,-2326
+B2326: .db 22,-26,7
+L2327: add $2,$3,$4
+    ori $5,27,$6
+    beq $7,$8,L2327
+    jmp L2328
+    la X7
+    call L251
+    sw $9,27,$10
+    bne $11,$12,L2326
+W2327: .dw 2327000,-2327
+B2327: .db 23,-27,7
+L2328: add $9,$10,$11
+    ori $12,28,$13
+    beq $14,$15,L2328
+    jmp L2329
+    la X0
+    call L264
+    sw $16,28,$17
+    bne $18,$19,L2327
+W2328: .dw 2328000,-2328
+B2328: .db 24,-28,7
+L2329: add $16,$17,$18
+    ori $19,29,$20
+    beq $21,$22,L2329
+    jmp L2330
+    la X1
+    call L277
+    sw $23,29,$24
+    bne $25,$26,L2328
+W2329: .dw 2329000,-2329
+B2329: .db 25,-29,7
+L2330: add $23,$24,$25
+    ori $26,30,$27
+    beq $28,$29,L2330
+    jmp L2331
+    la X2
+    call L290
+    sw $30,30,$31
+    bne $0,$1,L2329
+W2330: .dw 2330000,-2330
+B2330: .db 26,-30,7
+S2330: .asciz "str2330"
+    .dh 2330
+L2331: add $30,$31,$0
+    ori $1,31,$2
+    beq $3,$4,L2331
+    jmp L2332
+    la X3
+    call L303
+    sw $5,31,$6
+    bne $7,$8,L2330
+W2331: .dw 2331000,-2331
+B2331: .db 27,-31,7
+L2332: add $5,$6,$7
+    ori $8,32,$9
+    beq $10,$11,L2332
+    jmp L2333
+    la X4
+    call L316
+    sw $12,32,$13
+    bne $14,$15,L2331
+W2332: .dw 2332000,-2332
+B2332: .db 28,-32,7
+L2333: add $12,$13,$14
+    ori $15,33,$16
+    beq $17,$18,L2333
+    jmp L2334
+    la X5
+    call L329
+    sw $19,33,$20
+    bne $21,$22,L2332
+W2333: .dw 2333000,-2333
+B2333: .db 29,-33,7
+L2334: add $19,$20,$21
+    ori $22,34,$23
+    beq $24,$25,L2334
+    jmp L2335
+    la X6
+    call L342
+    sw $26,34,$27
+    bne $28,$29,L2333
+W2334: .dw 2334000,-2334
+B2334: .db 30,-34,7
+L2335: add $26,$27,$28
+    ori $29,35,$30
+    beq $31,$0,L2335
+    jmp L2336
+    la X7
+    call L355
+    sw $1,35,$2
+    bne $3,$4,L2334
+W2335: .dw 2335000,-2335
+B2335: .db 31,-35,7
+L2336: add $1,$2,$3
+    ori $4,36,$5
+    beq $6,$7,L2336
+    jmp L2337
+    la X0
+    call L368
+    sw $8,36,$9
+    bne $10,$11,L2335
+W2336: .dw 2336000,-2336
+B2336: .db 32,-36,7
+L2337: add $8,$9,$10
+    ori $11,37,$12
+    beq $13,$14,L2337
+    jmp L2338
+    la X1
+    call L381
+    sw $15,37,$16
+    bne $17,$18,L2336
+W2337: .dw 2337000,-2337
+B2337: .db 33,-37,7
+L2338: add $15,$16,$17
+    ori $18,38,$19
+    beq $20,$21,L2338
+    jmp L2339
+    la X2
+    call L394
+    sw $22,38,$23
+    bne $24,$25,L2337
+W2338: .dw 2338000,-2338
+B2338: .db 34,-38,7
+L2339: add $22,$23,$24
+    ori $25,39,$26
+    beq $27,$28,L2339
+    jmp L2340
+    la X3
+    call L407
+    sw $29,39,$30
+    bne $31,$0,L2338
+W2339: .dw 2339000,-2339
+B2339: .db 35,-39,7
+L2340: add $29,$30,$31
+    ori $0,40,$1
+    beq $2,$3,L2340
+    jmp L2341
+    la X4
+    call L420
+    sw $4,40,$5
+    bne $6,$7,L2339
+W2340: .dw 2340000,-2340
+B2340: .db 36,-40,7
+S2340: .asciz "str2340"
+    .dh 2340
+L2341: add $4,$5,$6
+    ori $7,41,$8
+    beq $9,$10,L2341
+    jmp L2342
+    la X5
+    call L433
+    sw $11,41,$12
+    bne $13,$14,L2340
+W2341: .dw 2341000,-2341
+B2341: .db 37,-41,7
+L2342: add $11,$12,$13
+    ori $14,42,$15
+    beq $16,$17,L2342
+    jmp L2343
+    la X6
+    call L446
+    sw $18,42,$19
+    bne $20,$21,L2341
+W2342: .dw 2342000,-2342
+B2342: .db 38,-42,7
+L2343: add $18,$19,$20
+    ori $21,43,$22
+    beq $23,$24,L2343
+    jmp L2344
+    la X7
+    call L459
+    sw $25,43,$26
+    bne $27,$28,L2342
+W2343: .dw 2343000,-2343
+B2343: .db 39,-43,7
+L2344: add $25,$26,$27
+    ori $28,44,$29
+    beq $30,$31,L2344
+    jmp L2345
+    la X0
+    call L472
+    sw $0,44,$1
+    bne $2,$3,L2343
+W2344: .dw 2344000,-2344
+B2344: .db 40,-44,7
+L2345: add $0,$1,$2
+    ori $3,45,$4
+    beq $5,$6,L2345
+    jmp L2346
+    la X1
+    call L485
+    sw $7,45,$8
+    bne $9,$10,L2344
+W2345: .dw 2345000,-2345
+B2345: .db 41,-45,7
+L2346: add $7,$8,$9
+    ori $10,46,$11
+    beq $12,$13,L2346
+    jmp L2347
+    la X2
+    call L498
+    sw $14,46,$15
+    bne $16,$17,L2345
+W2346: .dw 2346000,-2346
+B2346: .db 42,-46,7
+L2347: add $14,$15,$16
+    ori $17,47,$18
+    beq $19,$20,L2347
+    jmp L2348
+    la X3
+    call L511
+    sw $21,47,$22
+    bne $23,$24,L2346
+W2347: .dw 2347000,-2347
+B2347: .db 43,-47,7
+L2348: add $21,$22,$23
+    ori $24,48,$25
+    beq $26,$27,L2348
+    jmp L2349
+    la X4
+    call L524
+    sw $28,48,$29
+    bne $30,$31,L2347
+W2348: .dw 2348000,-2348
+B2348: .db 44,-48,7
+L2349: add $28,$29,$30
+    ori $31,49,$0
+    beq $1,$2,L2349
+    jmp L2350
+    la X5
+    call L537
+    sw $3,49,$4
+    bne $5,$6,L2348
+W2349: .dw 2349000,-2349
+B2349: .db 45,-49,7
+L2350: add $3,$4,$5
+    ori $6,50,$7
+    beq $8,$9,L2350
+    jmp L2351
+    la X6
+    call L550
+    sw $10,50,$11
+    bne $12,$13,L2349
+W2350: .dw 2350000,-2350
+B2350: .db 46,-50,7
+S2350: .asciz "str2350"
+    .dh 2350
+.entry L2350
+.entry W2350
+L2351: add $10,$11,$12
+    ori $13,51,$14
+    beq $15,$16,L2351
+    jmp L2352
+    la X7
+    call L563
+    sw $17,51,$18
+    bne $19,$20,L2350
+W2351: .dw 2351000,-2351
+B2351: .db 47,-51,7
+L2352: add $17,$18,$19
+    ori $20,52,$21
+    beq $22,$23,L2352
+    jmp L2353
+    la X0
+    call L576
+    sw $24,52,$25
+    bne $26,$27,L2351
+W2352: .dw 2352000,-2352
+B2352: .db 48,-52,7
+L2353: add $24,$25,$26
+    ori $27,53,$28
+    beq $29,$30,L2353
+    jmp L2354
+    la X1
+    call L589
+    sw $31,53,$0
+    bne $1,$2,L2352
+W2353: .dw 2353000,-2353
+B2353: .db 49,-53,7
+L2354: add $31,$0,$1
+    ori $2,54,$3
+    beq $4,$5,L2354
+    jmp L2355
+    la X2
+    call L602
+    sw $6,54,$7
+    bne $8,$9,L2353
+W2354: .dw 2354000,-2354
+B2354: .db 50,-54,7
+L2355: add $6,$7,$8
+    ori $9,55,$10
+    beq $11,$12,L2355
+    jmp L2356
+    la X3
+    call L615
+    sw $13,55,$14
+    bne $15,$16,L2354
+W2355: .dw 2355000,-2355
+B2355: .db 51,-55,7
+L2356: add $13,$14,$15
+    ori $16,56,$17
+    beq $18,$19,L2356
+    jmp L2357
+    la X4
+    call L628
+    sw $20,56,$21
+    bne $22,$23,L2355
+W2356: .dw 2356000,-2356
+B2356: .db 52,-56,7
+L2357: add $20,$21,$22
+    ori $23,57,$24
+    beq $25,$26,L2357
+    jmp L2358
+    la X5
+    call L641
+    sw $27,57,$28
+    bne $29,$30,L2356
+W2357: .dw 2357000,-2357
+B2357: .db 53,-57,7
+L2358: add $27,$28,$29
+    ori $30,58,$31
+    beq $0,$1,L2358
+    jmp L2359
+    la X6
+    call L654
+    sw $2,58,$3
+    bne $4,$5,L2357
+W2358: .dw 2358000,-2358
+B2358: .db 54,-58,7
+L2359: add $2,$3,$4
+    ori $5,59,$6
+    beq $7,$8,L2359
+    jmp L2360
+    la X7
+    call L667
+    sw $9,59,$10
+    bne $11,$12,L2358
+W2359: .dw 2359000,-2359
+B2359: .db 55,-59,7
+L2360: add $9,$10,$11
+    ori $12,60,$13
+    beq $14,$15,L2360
+    jmp L2361
+    la X0
+    call L680
+    sw $16,60,$17
+    bne $18,$19,L2359
+W2360: .dw 2360000,-2360
+B2360: .db 56,-60,7
+S2360: .asciz "str2360"
+    .dh 2360
+L2361: add $16,$17,$18
+    ori $19,61,$20
+    beq $21,$22,L2361
+    jmp L2362
+    la X1
+    call L693
+    sw $23,61,$24
+    bne $25,$26,L2360
+W2361: .dw 2361000,-2361
+B2361: .db 57,-61,7
+L2362: add $23,$24,$25
+    ori $26,62,$27
+    beq $28,$29,L2362
+    jmp L2363
+    la X2
+    call L706
+    sw $30,62,$31
+    bne $0,$1,L2361
+W2362: .dw 2362000,-2362
+B2362: .db 58,-62,7
+L2363: add $30,$31,$0
+    ori $1,63,$2
+    beq $3,$4,L2363
+    jmp L2364
+    la X3
+    call L719
+    sw $5,63,$6
+    bne $7,$8,L2362
+W2363: .dw 2363000,-2363
+B2363: .db 59,-63,7
+L2364: add $5,$6,$7
+    ori $8,64,$9
+    beq $10,$11,L2364
+    jmp L2365
+    la X4
+    call L732
+    sw $12,64,$13
+    bne $14,$15,L2363
+W2364: .dw 2364000,-2364
+B2364: .db 60,-64,7
+L2365: add $12,$13,$14
+    ori $15,65,$16
+    beq $17,$18,L2365
+    jmp L2366
+    la X5
+    call L745
+    sw $19,65,$20
+    bne $21,$22,L2364
+W2365: .dw 2365000,-2365
+B2365: .db 61,-65,7
+L2366: add $19,$20,$21
+    ori $22,66,$23
+    beq $24,$25,L2366
+    jmp L2367
+    la X6
+    call L758
+    sw $26,66,$27
+    bne $28,$29,L2365
+W2366: .dw 2366000,-2366
+B2366: .db 62,-66,7
+L2367: add $26,$27,$28
+    ori $29,67,$30
+    beq $31,$0,L2367
+    jmp L2368
+    la X7
+    call L771
+    sw $1,67,$2
+    bne $3,$4,L2366
+W2367: .dw 2367000,-2367
+B2367: .db 63,-67,7
+L2368: add $1,$2,$3
+    ori $4,68,$5
+    beq $6,$7,L2368
+    jmp L2369
+    la X0
+    call L784
+    sw $8,68,$9
+    bne $10,$11,L2367
+W2368: .dw 2368000,-2368
+B2368: .db 64,-68,7
+L2369: add $8,$9,$10
+    ori $11,69,$12
+    beq $13,$14,L2369
+    jmp L2370
+    la X1
+    call L797
+    sw $15,69,$16
+    bne $17,$18,L2368
+W2369: .dw 2369000,-2369
+B2369: .db 65,-69,7
+L2370: add $15,$16,$17
+    ori $18,70,$19
+    beq $20,$21,L2370
+    jmp L2371
+    la X2
+    call L810
+    sw $22,70,$23
+    bne $24,$25,L2369
+W2370: .dw 2370000,-2370
+B2370: .db 66,-70,7
+S2370: .asciz "str2370"
+    .dh 2370
+L2371: add $22,$23,$24
+    ori $25,71,$26
+    beq $27,$28,L2371
+    jmp L2372
+    la X3
+    call L823
+    sw $29,71,$30
+    bne $31,$0,L2370
+W2371: .dw 2371000,-2371
+B2371: .db 67,-71,7
+L2372: add $29,$30,$31
+    ori $0,72,$1
+    beq $2,$3,L2372
+    jmp L2373
+    la X4
+    call L836
+    sw $4,72,$5
+    bne $6,$7,L2371
+W2372: .dw 2372000,-2372
+B2372: .db 68,-72,7
+L2373: add $4,$5,$6
+    ori $7,73,$8
+    beq $9,$10,L2373
+    jmp L2374
+    la X5
+    call L849
+    sw $11,73,$12
+    bne $13,$14,L2372
+W2373: .dw 2373000,-2373
+B2373: .db 69,-73,7
+L2374: add $11,$12,$13
+    ori $14,74,$15
+    beq $16,$17,L2374
+    jmp L2375
+    la X6
+    call L862
+    sw $18,74,$19
+    bne $20,$21,L2373
+W2374: .dw 2374000,-2374
+B2374: .db 70,-74,7
+L2375: add $18,$19,$20
+    ori $21,75,$22
+    beq $23,$24,L2375
+    jmp L2376
+    la X7
+    call L875
+    sw $25,75,$26
+    bne $27,$28,L2374
+W2375: .dw 2375000,-2375
+B2375: .db 71,-75,7
+L2376: add $25,$26,$27
+    ori $28,76,$29
+    beq $30,$31,L2376
+    jmp L2377
+    la X0
+    call L888
+    sw $0,76,$1
+    bne $2,$3,L2375
+W2376: .dw 2376000,-2376
+B2376: .db 72,-76,7
+L2377: add $0,$1,$2
+    ori $3,77,$4
+    beq $5,$6,L2377
+    jmp L2378
+    la X1
+    call L901
+    sw $7,77,$8
+    bne $9,$10,L2376
+W2377: .dw 2377000,-2377
+B2377: .db 73,-77,7
+L2378: add $7,$8,$9
+    ori $10,78,$11
+    beq $12,$13,L2378
+    jmp L2379
+    la X2
+    call L914
+    sw $14,78,$15
+    bne $16,$17,L2377
+W2378: .dw 2378000,-2378
+B2378: .db 74,-78,7
+L2379: add $14,$15,$16
+    ori $17,79,$18
+    beq $19,$20,L2379
+    jmp L2380
+    la X3
+    call L927
+    sw $21,79,$22
+    bne $23,$24,L2378
+W2379: .dw 2379000,-2379
+B2379: .db 75,-79,7
+L2380: add $21,$22,$23
+    ori $24,80,$25
+    beq $26,$27,L2380
+    jmp L2381
+    la X4
+    call L940
+    sw $28,80,$29
+    bne $30,$31,L2379
+W2380: .dw 2380000,-2380
+B2380: .db 76,-80,7
+S2380: .asciz "str2380"
+    .dh 2380
+L2381: add $28,$29,$30
+    ori $31,81,$0
+    beq $1,$2,L2381
+    jmp L2382
+    la X5
+    call L953
+    sw $3,81,$4
+    bne $5,$6,L2380
+W2381: .dw 2381000,-2381
+B2381: .db 77,-81,7
+L2382: add $3,$4,$5
+    ori $6,82,$7
+    beq $8,$9,L2382
+    jmp L2383
+    la X6
+    call L966
+    sw $10,82,$11
+    bne $12,$13,L2381
+W2382: .dw 2382000,-2382
+B2382: .db 78,-82,7
+L2383: add $10,$11,$12
+    ori $13,83,$14
+    beq $15,$16,L2383
+    jmp L2384
+    la X7
+    call L979
+    sw $17,83,$18
+    bne $19,$20,L2382
+W2383: .dw 2383000,-2383
+B2383: .db 79,-83,7
+L2384: add $17,$18,$19
+    ori $20,84,$21
+    beq $22,$23,L2384
+    jmp L2385
+    la X0
+    call L992
+    sw $24,84,$25
+    bne $26,$27,L2383
+W2384: .dw 2384000,-2384
+B2384: .db 80,-84,7
+L2385: add $24,$25,$26
+    ori $27,85,$28
+    beq $29,$30,L2385
+    jmp L2386
+    la X1
+    call L1005
+    sw $31,85,$0
+    bne $1,$2,L2384
+W2385: .dw 2385000,-2385
+B2385: .db 81,-85,7
+L2386: add $31,$0,$1
+    ori $2,86,$3
+    beq $4,$5,L2386
+    jmp L2387
+    la X2
+    call L1018
+    sw $6,86,$7
+    bne $8,$9,L2385
+W2386: .dw 2386000,-2386
+B2386: .db 82,-86,7
+L2387: add $6,$7,$8
+    ori $9,87,$10
+    beq $11,$12,L2387
+    jmp L2388
+    la X3
+    call L1031
+    sw $13,87,$14
+    bne $15,$16,L2386
+W2387: .dw 2387000,-2387
+B2387: .db 83,-87,7
+L2388: add $13,$14,$15
+    ori $16,88,$17
+    beq $18,$19,L2388
+    jmp L2389
+    la X4
+    call L1044
+    sw $20,88,$21
+    bne $22,$23,L2387
+W2388: .dw 2388000,-2388
+B2388: .db 84,-88,7
+L2389: add $20,$21,$22
+    ori $23,89,$24
+    beq $25,$26,L2389
+    jmp L2390
+    la X5
+    call L1057
+    sw $27,89,$28
+    bne $29,$30,L2388
+W2389: .dw 2389000,-2389
+B2389: .db 85,-89,7
+L2390: add $27,$28,$29
+    ori $30,90,$31
+    beq $0,$1,L2390
+    jmp L2391
+    la X6
+    call L1070
+    sw $2,90,$3
+    bne $4,$5,L2389
+W2390: .dw 2390000,-2390
+B2390: .db 86,-90,7
+S2390: .asciz "str2390"
+    .dh 2390
+L2391: add $2,$3,$4
+    ori $5,91,$6
+    beq $7,$8,L2391
+    jmp L2392
+    la X7
+    call L1083
+    sw $9,91,$10
+    bne $11,$12,L2390
+W2391: .dw 2391000,-2391
+B2391: .db 87,-91,7
+L2392: add $9,$10,$11
+    ori $12,92,$13
+    beq $14,$15,L2392
+    jmp L2393
+    la X0
+    call L1096
+    sw $16,92,$17
+    bne $18,$19,L2391
+W2392: .dw 2392000,-2392
+B2392: .db 88,-92,7
+L2393: add $16,$17,$18
+    ori $19,93,$20
+    beq $21,$22,L2393
+    jmp L2394
+    la X1
+    call L1109
+    sw $23,93,$24
+    bne $25,$26,L2392
+W2393: .dw 2393000,-2393
+B2393: .db 89,-93,7
+L2394: add $23,$24,$25
+    ori $26,94,$27
+    beq $28,$29,L2394
+    jmp L2395
+    la X2
+    call L1122
+    sw $30,94,$31
+    bne $0,$1,L2393
+W2394: .dw 2394000,-2394
+B2394: .db 90,-94,7
+L2395: add $30,$31,$0
+    ori $1,95,$2
+    beq $3,$4,L2395
+    jmp L2396
+    la X3
+    call L1135
+    sw $5,95,$6
+    bne $7,$8,L2394
+W2395: .dw 2395000,-2395
+B2395: .db 91,-95,7
+L2396: add $5,$6,$7
+    ori $8,96,$9
+    beq $10,$11,L2396
+    jmp L2397
+    la X4
+    call L1148
+    sw $12,96,$13
+    bne $14,$15,L2395
+W2396: .dw 2396000,-2396
+B2396: .db 92,-96,7
+L2397: add $12,$13,$14
+    ori $15,97,$16
+    beq $17,$18,L2397
+    jmp L2398
+    la X5
+    call L1161
+    sw $19,97,$20
+    bne $21,$22,L2396
+W2397: .dw 2397000,-2397
+B2397: .db 93,-97,7
+L2398: add $19,$20,$21
+    ori $22,98,$23
+    beq $24,$25,L2398
+    jmp L2399
+    la X6
+    call L1174
+    sw $26,98,$27
+    bne $28,$29,L2397
+W2398: .dw 2398000,-2398
+B2398: .db 94,-98,7
+L2399: add $26,$27,$28
+    ori $29,99,$30
+    beq $31,$0,L2399
+    jmp L2400
+    la X7
+    call L1187
+    sw $1,99,$2
+    bne $3,$4,L2398
+W2399: .dw 2399000,-2399
+B2399: .db 95,-99,7
+L2400: add $1,$2,$3
+    ori $4,-100,$5
+    beq $6,$7,L2400
+    jmp L2401
+    la X0
+    call L1200
+    sw $8,0,$9
+    bne $10,$11,L2399
+W2400: .dw 2400000,-2400
+B2400: .db 96,0,7
+S2400: .asciz "str2400"
+    .dh 2400
+.entry L2400
+.entry W2400
+L2401: add $8,$9,$10
+    ori $11,-99,$12
+    beq $13,$14,L2401
+    jmp L2402
+    la X1
+    call L1213
+    sw $15,1,$16
+    bne $17,$18,L2400
+W2401: .dw 2401000,-2401
+B2401: .db 97,-1,7
+L2402: add $15,$16,$17
+    ori $18,-98,$19
+    beq $20,$21,L2402
+    jmp L2403
+    la X2
+    call L1226
+    sw $22,2,$23
+    bne $24,$25,L2401
+W2402: .dw 2402000,-2402
+B2402: .db 98,-2,7
+L2403: add $22,$23,$24
+    ori $25,-97,$26
+    beq $27,$28,L2403
+    jmp L2404
+    la X3
+    call L1239
+    sw $29,3,$30
+    bne $31,$0,L2402
+W2403: .dw 2403000,-2403
+B2403: .db 99,-3,7
+L2404: add $29,$30,$31
+    ori $0,-96,$1
+    beq $2,$3,L2404
+    jmp L2405
+    la X4
+    call L1252
+    sw $4,4,$5
+    bne $6,$7,L2403
+W2404: .dw 2404000,-2404
+B2404: .db 100,-4,7
+L2405: add $4,$5,$6
+    ori $7,-95,$8
+    beq $9,$10,L2405
+    jmp L2406
+    la X5
+    call L1265
+    sw $11,5,$12
+    bne $13,$14,L2404
+W2405: .dw 2405000,-2405
+B2405: .db 101,-5,7
+L2406: add $11,$12,$13
+    ori $14,-94,$15
+    beq $16,$17,L2406
+    jmp L2407
+    la X6
+    call L1278
+    sw $18,6,$19
+    bne $20,$21,L2405
+W2406: .dw 2406000,-2406
+B2406: .db 102,-6,7
+L2407: add $18,$19,$20
+    ori $21,-93,$22
+    beq $23,$24,L2407
+    jmp L2408
+    la X7
+    call L1291
+    sw $25,7,$26
+    bne $27,$28,L2406
+W2407: .dw 2407000,-2407
+B2407: .db 103,-7,7
+L2408: add $25,$26,$27
+    ori $28,-92,$29
+    beq $30,$31,L2408
+    jmp L2409
+    la X0
+    call L1304
+    sw $0,8,$1
+    bne $2,$3,L2407
+W2408: .dw 2408000,-2408
+B2408: .db 104,-8,7
+L2409: add $0,$1,$2
+    ori $3,-91,$4
+    beq $5,$6,L2409
+    jmp L2410
+    la X1
+    call L1317
+    sw $7,9,$8
+    bne $9,$10,L2408
+W2409: .dw 2409000,-2409
+B2409: .db 105,-9,7
+L2410: add $7,$8,$9
+    ori $10,-90,$11
+    beq $12,$13,L2410
+    jmp L2411
+    la X2
+    call L1330
+    sw $14,10,$15
+    bne $16,$17,L2409
+W2410: .dw 2410000,-2410
+B2410: .db 106,-10,7
+S2410: .asciz "str2410"
+    .dh 2410
+L2411: add $14,$15,$16
+    ori $17,-89,$18
+    beq $19,$20,L2411
+    jmp L2412
+    la X3
+    call L1343
+    sw $21,11,$22
+    bne $23,$24,L2410
+W2411: .dw 2411000,-2411
+B2411: .db 107,-11,7
+L2412: add $21,$22,$23
+    ori $24,-88,$25
+    beq $26,$27,L2412
+    jmp L2413
+    la X4
+    call L1356
+    sw $28,12,$29
+    bne $30,$31,L2411
+W2412: .dw 2412000,-2412
+B2412: .db 108,-12,7
+L2413: add $28,$29,$30
+    ori $31,-87,$0
+    beq $1,$2,L2413
+    jmp L2414
+    la X5
+    call L1369
+    sw $3,13,$4
+    bne $5,$6,L2412
+W2413: .dw 2413000,-2413
+B2413: .db 109,-13,7
+L2414: add $3,$4,$5
+    ori $6,-86,$7
+    beq $8,$9,L2414
+    jmp L2415
+    la X6
+    call L1382
+    sw $10,14,$11
+    bne $12,$13,L2413
+W2414: .dw 2414000,-2414
+B2414: .db 110,-14,7
+L2415: add $10,$11,$12
+    ori $13,-85,$14
+    beq $15,$16,L2415
+    jmp L2416
+    la X7
+    call L1395
+    sw $17,15,$18
+    bne $19,$20,L2414
+W2415: .dw 2415000,-2415
+B2415: .db 111,-15,7
+L2416: add $17,$18,$19
+    ori $20,-84,$21
+    beq $22,$23,L2416
+    jmp L2417
+    la X0
+    call L1408
+    sw $24,16,$25
+    bne $26,$27,L2415
+W2416: .dw 2416000,-2416
+B2416: .db 112,-16,7
+L2417: add $24,$25,$26
+    ori $27,-83,$28
+    beq $29,$30,L2417
+    jmp L2418
+    la X1
+    call L1421
+    sw $31,17,$0
+    bne $1,$2,L2416
+W2417: .dw 2417000,-2417
+B2417: .db 113,-17,7
+L2418: add $31,$0,$1
+    ori $2,-82,$3
+    beq $4,$5,L2418
+    jmp L2419
+    la X2
+    call L1434
+    sw $6,18,$7
+    bne $8,$9,L2417
+W2418: .dw 2418000,-2418
+B2418: .db 114,-18,7
+L2419: add $6,$7,$8
+    ori $9,-81,$10
+    beq $11,$12,L2419
+    jmp L2420
+    la X3
+    call L1447
+    sw $13,19,$14
+    bne $15,$16,L2418
+W2419: .dw 2419000,-2419
+B2419: .db 115,-19,7
+L2420: add $13,$14,$15
+    ori $16,-80,$17
+    beq $18,$19,L2420
+    jmp L2421
+    la X4
+    call L1460
+    sw $20,20,$21
+    bne $22,$23,L2419
+W2420: .dw 2420000,-2420
+B2420: .db 116,-20,7
+S2420: .asciz "str2420"
+    .dh 2420
+L2421: add $20,$21,$22
+    ori $23,-79,$24
+    beq $25,$26,L2421
+    jmp L2422
+    la X5
+    call L1473
+    sw $27,21,$28
+    bne $29,$30,L2420
+W2421: .dw 2421000,-2421
+B2421: .db 117,-21,7
+L2422: add $27,$28,$29
+    ori $30,-78,$31
+    beq $0,$1,L2422
+    jmp L2423
+    la X6
+    call L1486
+    sw $2,22,$3
+    bne $4,$5,L2421
+W2422: .dw 2422000,-2422
+B2422: .db 118,-22,7
+L2423: add $2,$3,$4
+    ori $5,-77,$6
+    beq $7,$8,L2423
+    jmp L2424
+    la X7
+    call L1499
+    sw $9,23,$10
+    bne $11,$12,L2422
+W2423: .dw 2423000,-2423
+B2423: .db 119,-23,7
+L2424: add $9,$10,$11
+    ori $12,-76,$13
+    beq $14,$15,L2424
+    jmp L2425
+    la X0
+    call L1512
+    sw $16,24,$17
+    bne $18,$19,L2423
+W2424: .dw 2424000,-2424
+B2424: .db 120,-24,7
+L2425: add $16,$17,$18
+    ori $19,-75,$20
+    beq $21,$22,L2425
+    jmp L2426
+    la X1
+    call L1525
+    sw $23,25,$24
+    bne $25,$26,L2424
+W2425: .dw 2425000,-2425
+B2425: .db 121,-25,7
+L2426: add $23,$24,$25
+    ori $26,-74,$27
+    beq $28,$29,L2426
+    jmp L2427
+    la X2
+    call L1538
+    sw $30,26,$31
+    bne $0,$1,L2425
+W2426: .dw 2426000,-2426
+B2426: .db 122,-26,7
+L2427: add $30,$31,$0
+    ori $1,-73,$2
+    beq $3,$4,L2427
+    jmp L2428
+    la X3
+    call L1551
+    sw $5,27,$6
+    bne $7,$8,L2426
+W2427: .dw 2427000,-2427
+B2427: .db 123,-27,7
+L2428: add $5,$6,$7
+    ori $8,-72,$9
+    beq $10,$11,L2428
+    jmp L2429
+    la X4
+    call L1564
+    sw $12,28,$13
+    bne $14,$15,L2427
+W2428: .dw 2428000,-2428
+B2428: .db 124,-28,7
+L2429: add $12,$13,$14
+    ori $15,-71,$16
+    beq $17,$18,L2429
+    jmp L2430
+    la X5
+    call L1577
+    sw $19,29,$20
+    bne $21,$22,L2428
+W2429: .dw 2429000,-2429
+B2429: .db 125,-29,7
+L2430: add $19,$20,$21
+    ori $22,-70,$23
+    beq $24,$25,L2430
+    jmp L2431
+    la X6
+    call L1590
+    sw $26,30,$27
+    bne $28,$29,L2429
+W2430: .dw 2430000,-2430
+B2430: .db 126,-30,7
+S2430: .asciz "str2430"
+    .dh 2430
+L2431: add $26,$27,$28
+    ori $29,-69,$30
+    beq $31,$0,L2431
+    jmp L2432
+    la X7
+    call L1603
+    sw $1,31,$2
+    bne $3,$4,L2430
+W2431: .dw 2431000,-2431
+B2431: .db 127,-31,7
+L2432: add $1,$2,$3
+    ori $4,-68,$5
+    beq $6,$7,L2432
+    jmp L2433
+    la X0
+    call L1616
+    sw $8,32,$9
+    bne $10,$11,L2431
+W2432: .dw 2432000,-2432
+B2432: .db 0,-32,7
+L2433: add $8,$9,$10
+    ori $11,-67,$12
+    beq $13,$14,L2433
+    jmp L2434
+    la X1
+    call L1629
+    sw $15,33,$16
+    bne $17,$18,L2432
+W2433: .dw 2433000,-2433
+B2433: .db 1,-33,7
+L2434: add $15,$16,$17
+    ori $18,-66,$19
+    beq $20,$21,L2434
+    jmp L2435
+    la X2
+    call L1642
+    sw $22,34,$23
+    bne $24,$25,L2433
+W2434: .dw 2434000,-2434
+B2434: .db 2,-34,7
+L2435: add $22,$23,$24
+    ori $25,-65,$26
+    beq $27,$28,L2435
+    jmp L2436
+    la X3
+    call L1655
+    sw $29,35,$30
+    bne $31,$0,L2434
+W2435: .dw 2435000,-2435
+B2435: .db 3,-35,7
+L2436: add $29,$30,$31
+    ori $0,-64,$1
+    beq $2,$3,L2436
+    jmp L2437
+    la X4
+    call L1668
+    sw $4,36,$5
+    bne $6,$7,L2435
+W2436: .dw 2436000,-2436
+B2436: .db 4,-36,7
+L2437: add $4,$5,$6
+    ori $7,-63,$8
+    beq $9,$10,L2437
+    jmp L2438
+    la X5
+    call L1681
+    sw $11,37,$12
+    bne $13,$14,L2436
+W2437: .dw 2437000,-2437
+B2437: .db 5,-37,7
+L2438: add $11,$12,$13
+    ori $14,-62,$15
+    beq $16,$17,L2438
+    jmp L2439
+    la X6
+    call L1694
+    sw $18,38,$19
+    bne $20,$21,L2437
+W2438: .dw 2438000,-2438
+B2438: .db 6,-38,7
+L2439: add $18,$19,$20
+    ori $21,-61,$22
+    beq $23,$24,L2439
+    jmp L2440
+    la X7
+    call L1707
+    sw $25,39,$26
+    bne $27,$28,L2438
+W2439: .dw 2439000,-2439
+B2439: .db 7,-39,7
+L2440: add $25,$26,$27
+    ori $28,-60,$29
+    beq $30,$31,L2440
+    jmp L2441
+    la X0
+    call L1720
+    sw $0,40,$1
+    bne $2,$3,L2439
+W2440: .dw 2440000,-2440
+B2440: .db 8,-40,7
+S2440: .asciz "str2440"
+    .dh 2440
+L2441: add $0,$1,$2
+    ori $3,-59,$4
+    beq $5,$6,L2441
+    jmp L2442
+    la X1
+    call L1733
+    sw $7,41,$8
+    bne $9,$10,L2440
+W2441: .dw 2441000,-2441
+B2441: .db 9,-41,7
+L2442: add $7,$8,$9
+    ori $10,-58,$11
+    beq $12,$13,L2442
+    jmp L2443
+    la X2
+    call L1746
+    sw $14,42,$15
+    bne $16,$17,L2441
+W2442: .dw 2442000,-2442
+B2442: .db 10,-42,7
+L2443: add $14,$15,$16
+    ori $17,-57,$18
+    beq $19,$20,L2443
+    jmp L2444
+    la X3
+    call L1759
+    sw $21,43,$22
+    bne $23,$24,L2442
+W2443: .dw 2443000,-2443
+B2443: .db 11,-43,7
+L2444: add $21,$22,$23
+    ori $24,-56,$25
+    beq $26,$27,L2444
+    jmp L2445
+    la X4
+    call L1772
+    sw $28,44,$29
+    bne $30,$31,L2443
+W2444: .dw 2444000,-2444
+B2444: .db 12,-44,7
+L2445: add $28,$29,$30
+    ori $31,-55,$0
+    beq $1,$2,L2445
+    jmp L2446
+    la X5
+    call L1785
+    sw $3,45,$4
+    bne $5,$6,L2444
+W2445: .dw 2445000,-2445
+B2445: .db 13,-45,7
+L2446: add $3,$4,$5
+    ori $6,-54,$7
+    beq $8,$9,L2446
+    jmp L2447
+    la X6
+    call L1798
+    sw $10,46,$11
+    bne $12,$13,L2445
+W2446: .dw 2446000,-2446
+B2446: .db 14,-46,7
+L2447: add $10,$11,$12
+    ori $13,-53,$14
+    beq $15,$16,L2447
+    jmp L2448
+    la X7
+    call L1811
+    sw $17,47,$18
+    bne $19,$20,L2446
+W2447: .dw 2447000,-2447
+B2447: .db 15,-47,7
+L2448: add $17,$18,$19
+    ori $20,-52,$21
+    beq $22,$23,L2448
+    jmp L2449
+    la X0
+    call L1824
+    sw $24,48,$25
+    bne $26,$27,L2447
+W2448: .dw 2448000,-2448
+B2448: .db 16,-48,7
+L2449: add $24,$25,$26
+    ori $27,-51,$28
+    beq $29,$30,L2449
+    jmp L2450
+    la X1
+    call L1837
+    sw $31,49,$0
+    bne $1,$2,L2448
+W2449: .dw 2449000,-2449
+B2449: .db 17,-49,7
+L2450: add $31,$0,$1
+    ori $2,-50,$3
+    beq $4,$5,L2450
+    jmp L2451
+    la X2
+    call L1850
+    sw $6,50,$7
+    bne $8,$9,L2449
+W2450: .dw 2450000,-2450
+B2450: .db 18,-50,7
+S2450: .asciz "str2450"
+    .dh 2450
+.entry L2450
+.entry W2450
+L2451: add $6,$7,$8
+    ori $9,-49,$10
+    beq $11,$12,L2451
+    jmp L2452
+    la X3
+    call L1863
+    sw $13,51,$14
+    bne $15,$16,L2450
+W2451: .dw 2451000,-2451
+B2451: .db 19,-51,7
+L2452: add $13,$14,$15
+    ori $16,-48,$17
+    beq $18,$19,L2452
+    jmp L2453
+    la X4
+    call L1876
+    sw $20,52,$21
+    bne $22,$23,L2451
+W2452: .dw 2452000,-2452
+B2452: .db 20,-52,7
+L2453: add $20,$21,$22
+    ori $23,-47,$24
+    beq $25,$26,L2453
+    jmp L2454
+    la X5
+    call L1889
+    sw $27,53,$28
+    bne $29,$30,L2452
+W2453: .dw 2453000,-2453
+B2453: .db 21,-53,7
+L2454: add $27,$28,$29
+    ori $30,-46,$31
+    beq $0,$1,L2454
+    jmp L2455
+    la X6
+    call L1902
+    sw $2,54,$3
+    bne $4,$5,L2453
+W2454: .dw 2454000,-2454
+B2454: .db 22,-54,7
+L2455: add $2,$3,$4
+    ori $5,-45,$6
+    beq $7,$8,L2455
+    jmp L2456
+    la X7
+    call L1915
+    sw $9,55,$10
+    bne $11,$12,L2454
+W2455: .dw 2455000,-2455
+B2455: .db 23,-55,7
+L2456: add $9,$10,$11
+    ori $12,-44,$13
+    beq $14,$15,L2456
+    jmp L2457
+    la X0
+    call L1928
+    sw $16,56,$17
+    bne $18,$19,L2455
+W2456: .dw 2456000,-2456
+B2456: .db 24,-56,7
+L2457: add $16,$17,$18
+    ori $19,-43,$20
+    beq $21,$22,L2457
+    jmp L2458
+    la X1
+    call L1941
+    sw $23,57,$24
+    bne $25,$26,L2456
+W2457: .dw 2457000,-2457
+B2457: .db 25,-57,7
+L2458: add $23,$24,$25
+    ori $26,-42,$27
+    beq $28,$29,L2458
+    jmp L2459
+    la X2
+    call L1954
+    sw $30,58,$31
+    bne $0,$1,L2457
+W2458: .dw 2458000,-2458
+B2458: .db 26,-58,7
+L2459: add $30,$31,$0
+    ori $1,-41,$2
+    beq $3,$4,L2459
+    jmp L2460
+    la X3
+    call L1967
+    sw $5,59,$6
+    bne $7,$8,L2458
+W2459: .dw 2459000,-2459
+B2459: .db 27,-59,7
+L2460: add $5,$6,$7
+    ori $8,-40,$9
+    beq $10,$11,L2460
+    jmp L2461
+    la X4
+    call L1980
+    sw $12,60,$13
+    bne $14,$15,L2459
+W2460: .dw 2460000,-2460
+B2460: .db 28,-60,7
+S2460: .asciz "str2460"
+    .dh 2460
+L2461: add $12,$13,$14
+    ori $15,-39,$16
+    beq $17,$18,L2461
+    jmp L2462
+    la X5
+    call L1993
+    sw $19,61,$20
+    bne $21,$22,L2460
+W2461: .dw 2461000,-2461
+B2461: .db 29,-61,7
+L2462: add $19,$20,$21
+    ori $22,-38,$23
+    beq $24,$25,L2462
+    jmp L2463
+    la X6
+    call L2006
+    sw $26,62,$27
+    bne $28,$29,L2461
+W2462: .dw 2462000,-2462
+B2462: .db 30,-62,7
+L2463: add $26,$27,$28
+    ori $29,-37,$30
+    beq $31,$0,L2463
+    jmp L2464
+    la X7
+    call L2019
+    sw $1,63,$2
+    bne $3,$4,L2462
+W2463: .dw 2463000,-2463
+B2463: .db 31,-63,7
+L2464: add $1,$2,$3
+    ori $4,-36,$5
+    beq $6,$7,L2464
+    jmp L2465
+    la X0
+    call L2032
+    sw $8,64,$9
+    bne $10,$11,L2463
+W2464: .dw 2464000,-2464
+B2464: .db 32,-64,7
+L2465: add $8,$9,$10
+    ori $11,-35,$12
+    beq $13,$14,L2465
+    jmp L2466
+    la X1
+    call L2045
+    sw $15,65,$16
+    bne $17,$18,L2464
+W2465: .dw 2465000,-2465
+B2465: .db 33,-65,7
+L2466: add $15,$16,$17
+    ori $18,-34,$19
+    beq $20,$21,L2466
+    jmp L2467
+    la X2
+    call L2058
+    sw $22,66,$23
+    bne $24,$25,L2465
+W2466: .dw 2466000,-2466
+B2466: .db 34,-66,7
+L2467: add $22,$23,$24
+    ori $25,-33,$26
+    beq $27,$28,L2467
+    jmp L2468
+    la X3
+    call L2071
+    sw $29,67,$30
+    bne $31,$0,L2466
+W2467: .dw 2467000,-2467
+B2467: .db 35,-67,7
+L2468: add $29,$30,$31
+    ori $0,-32,$1
+    beq $2,$3,L2468
+    jmp L2469
+    la X4
+    call L2084
+    sw $4,68,$5
+    bne $6,$7,L2467
+W2468: .dw 2468000,-2468
+B2468: .db 36,-68,7
+L2469: add $4,$5,$6
+    ori $7,-31,$8
+    beq $9,$10,L2469
+    jmp L2470
+    la X5
+    call L2097
+    sw $11,69,$12
+    bne $13,$14,L2468
+W2469: .dw 2469000,-2469
+B2469: .db 37,-69,7
+L2470: add $11,$12,$13
+    ori $14,-30,$15
+    beq $16,$17,L2470
+    jmp L2471
+    la X6
+    call L2110
+    sw $18,70,$19
+    bne $20,$21,L2469
+W2470: .dw 2470000,-2470
+B2470: .db 38,-70,7
+S2470: .asciz "str2470"
+    .dh 2470
+L2471: add $18,$19,$20
+    ori $21,-29,$22
+    beq $23,$24,L2471
+    jmp L2472
+    la X7
+    call L2123
+    sw $25,71,$26
+    bne $27,$28,L2470
+W2471: .dw 2471000,-2471
+B2471: .db 39,-71,7
+L2472: add $25,$26,$27
+    ori $28,-28,$29
+    beq $30,$31,L2472
+    jmp L2473
+    la X0
+    call L2136
+    sw $0,72,$1
+    bne $2,$3,L2471
+W2472: .dw 2472000,-2472
+B2472: .db 40,-72,7
+L2473: add $0,$1,$2
+    ori $3,-27,$4
+    beq $5,$6,L2473
+    jmp L2474
+    la X1
+    call L2149
+    sw $7,73,$8
+    bne $9,$10,L2472
+W2473: .dw 2473000,-2473
+B2473: .db 41,-73,7
+L2474: add $7,$8,$9
+    ori $10,-26,$11
+    beq $12,$13,L2474
+    jmp L2475
+    la X2
+    call L2162
+    sw $14,74,$15
+    bne $16,$17,L2473
+W2474: .dw 2474000,-2474
+B2474: .db 42,-74,7
+L2475: add $14,$15,$16
+    ori $17,-25,$18
+    beq $19,$20,L2475
+    jmp L2476
+    la X3
+    call L2175
+    sw $21,75,$22
+    bne $23,$24,L2474
+W2475: .dw 2475000,-2475
+B2475: .db 43,-75,7
+L2476: add $21,$22,$23
+    ori $24,-24,$25
+    beq $26,$27,L2476
+    jmp L2477
+    la X4
+    call L2188
+    sw $28,76,$29
+    bne $30,$31,L2475
+W2476: .dw 2476000,-2476
+B2476: .db 44,-76,7
+L2477: add $28,$29,$30
+    ori $31,-23,$0
+    beq $1,$2,L2477
+    jmp L2478
+    la X5
+    call L2201
+    sw $3,77,$4
+    bne $5,$6,L2476
+W2477: .dw 2477000,-2477
+B2477: .db 45,-77,7
+L2478: add $3,$4,$5
+    ori $6,-22,$7
+    beq $8,$9,L2478
+    jmp L2479
+    la X6
+    call L2214
+    sw $10,78,$11
+    bne $12,$13,L2477
+W2478: .dw 2478000,-2478
+B2478: .db 46,-78,7
+L2479: add $10,$11,$12
+    ori $13,-21,$14
+    beq $15,$16,L2479
+    jmp L2480
+    la X7
+    call L2227
+    sw $17,79,$18
+    bne $19,$20,L2478
+W2479: .dw 2479000,-2479
+B2479: .db 47,-79,7
+L2480: add $17,$18,$19
+    ori $20,-20,$21
+    beq $22,$23,L2480
+    jmp L2481
+    la X0
+    call L2240
+    sw $24,80,$25
+    bne $26,$27,L2479
+W2480: .dw 2480000,-2480
+B2480: .db 48,-80,7
+S2480: .asciz "str2480"
+    .dh 2480
+L2481: add $24,$25,$26
+    ori $27,-19,$28
+    beq $29,$30,L2481
+    jmp L2482
+    la X1
+    call L2253
+    sw $31,81,$0
+    bne $1,$2,L2480
+W2481: .dw 2481000,-2481
+B2481: .db 49,-81,7
+L2482: add $31,$0,$1
+    ori $2,-18,$3
+    beq $4,$5,L2482
+    jmp L2483
+    la X2
+    call L2266
+    sw $6,82,$7
+    bne $8,$9,L2481
+W2482: .dw 2482000,-2482
+B2482: .db 50,-82,7
+L2483: add $6,$7,$8
+    ori $9,-17,$10
+    beq $11,$12,L2483
+    jmp L2484
+    la X3
+    call L2279
+    sw $13,83,$14
+    bne $15,$16,L2482
+W2483: .dw 2483000,-2483
+B2483: .db 51,-83,7
+L2484: add $13,$14,$15
+    ori $16,-16,$17
+    beq $18,$19,L2484
+    jmp L2485
+    la X4
+    call L2292
+    sw $20,84,$21
+    bne $22,$23,L2483
+W2484: .dw 2484000,-2484
+B2484: .db 52,-84,7
+L2485: add $20,$21,$22
+    ori $23,-15,$24
+    beq $25,$26,L2485
+    jmp L2486
+    la X5
+    call L2305
+    sw $27,85,$28
+    bne $29,$30,L2484
+W2485: .dw 2485000,-2485
+B2485: .db 53,-85,7
+L2486: add $27,$28,$29
+    ori $30,-14,$31
+    beq $0,$1,L2486
+    jmp L2487
+    la X6
+    call L2318
+    sw $2,86,$3
+    bne $4,$5,L2485
+W2486: .dw 2486000,-2486
+B2486: .db 54,-86,7
+L2487: add $2,$3,$4
+    ori $5,-13,$6
+    beq $7,$8,L2487
+    jmp L2488
+    la X7
+    call L2331
+    sw $9,87,$10
+    bne $11,$12,L2486
+W2487: .dw 2487000,-2487
+B2487: .db 55,-87,7
+L2488: add $9,$10,$11
+    ori $12,-12,$13
+    beq $14,$15,L2488
+    jmp L2489
+    la X0
+    call L2344
+    sw $16,88,$17
+    bne $18,$19,L2487
+W2488: .dw 2488000,-2488
+B2488: .db 56,-88,7
+L2489: add $16,$17,$18
+    ori $19,-11,$20
+    beq $21,$22,L2489
+    jmp L2490
+    la X1
+    call L2357
+    sw $23,89,$24
+    bne $25,$26,L2488
+W2489: .dw 2489000,-2489
+B2489: .db 57,-89,7
+L2490: add $23,$24,$25
+    ori $26,-10,$27
+    beq $28,$29,L2490
+    jmp L2491
+    la X2
+    call L2370
+    sw $30,90,$31
+    bne $0,$1,L2489
+W2490: .dw 2490000,-2490
+B2490: .db 58,-90,7
+S2490: .asciz "str2490"
+    .dh 2490
+L2491: add $30,$31,$0
+    ori $1,-9,$2
+    beq $3,$4,L2491
+    jmp L2492
+    la X3
+    call L2383
+    sw $5,91,$6
+    bne $7,$8,L2490
+W2491: .dw 2491000,-2491
+B2491: .db 59,-91,7
+L2492: add $5,$6,$7
+    ori $8,-8,$9
+    beq $10,$11,L2492
+    jmp L2493
+    la X4
+    call L2396
+    sw $12,92,$13
+    bne $14,$15,L2491
+W2492: .dw 2492000,-2492
+B2492: .db 60,-92,7
+L2493: add $12,$13,$14
+    ori $15,-7,$16
+    beq $17,$18,L2493
+    jmp L2494
+    la X5
+    call L2409
+    sw $19,93,$20
+    bne $21,$22,L2492
+W2493: .dw 2493000,-2493
+B2493: .db 61,-93,7
+L2494: add $19,$20,$21
+    ori $22,-6,$23
+    beq $24,$25,L2494
+    jmp L2495
+    la X6
+    call L2422
+    sw $26,94,$27
+    bne $28,$29,L2493
+W2494: .dw 2494000,-2494
+B2494: .db 62,-94,7
+L2495: add $26,$27,$28
+    ori $29,-5,$30
+    beq $31,$0,L2495
+    jmp L2496
+    la X7
+    call L2435
+    sw $1,95,$2
+    bne $3,$4,L2494
+W2495: .dw 2495000,-2495
+B2495: .db 63,-95,7
+L2496: add $1,$2,$3
+    ori $4,-4,$5
+    beq $6,$7,L2496
+    jmp L2497
+    la X0
+    call L2448
+    sw $8,96,$9
+    bne $10,$11,L2495
+W2496: .dw 2496000,-2496
+B2496: .db 64,-96,7
+L2497: add $8,$9,$10
+    ori $11,-3,$12
+    beq $13,$14,L2497
+    jmp L2498
+    la X1
+    call L2461
+    sw $15,97,$16
+    bne $17,$18,L2496
+W2497: .dw 2497000,-2497
+B2497: .db 65,-97,7
+L2498: add $15,$16,$17
+    ori $18,-2,$19
+    beq $20,$21,L2498
+    jmp L2499
+    la X2
+    call L2474
+    sw $22,98,$23
+    bne $24,$25,L2497
+W2498: .dw 2498000,-2498
+B2498: .db 66,-98,7
+L2499: add $22,$23,$24
+    ori $25,-1,$26
+    beq $27,$28,L2499
+    jmp L0
+    la X3
+    call L2487
+    sw $29,99,$30
+    bne $31,$0,L2498
+W2499: .dw 2499000,-2499
+B2499: .db 67,-99,7
+END: stop
+.entry END
@@ -0,0 +1,267 @@
+/*******************************************************************************
+* Title                 :   Memory-bounded images
+* Filename              :   spill.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file spill.c
+ * \brief This module keeps the code image and data image tables within a memory limit (--max-memory).
+ * when the part of a table that is kept in memory reaches its limit, the cells in it are final, so they are
+ * written ("spilled") to a temporary file and the table starts over. the missing info completed in the 2nd pass
+ * (see complete_missing_info in tables.c) for an order that was already spilled is kept in a patch list,
+ * which is applied when the code image is read back for the output files.
+ * without --max-memory nothing is spilled, and the tables are kept in memory as a whole.
+ *
+ * the rest of the assembler accesses the images only through this module:
+ * get_code_word/set_code_word by the index of the order, and start_images/next_code_word/next_data_cell
+ * to read both tables from the start, in order.
+ */
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "assembler.h"
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define MIN_WINDOW  64 /*minimal number of cells kept in memory for each table*/
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+extern arena file_arena;
+extern FILE *diag_file;
+extern machine_word *code_img;
+extern data_image *data_img;
+extern unsigned long code_img_length, data_img_length;
+
+static FILE *code_spill = NULL; /*temporary file with the first cells of the code image*/
+static FILE *data_spill = NULL; /*temporary file with the first cells of the data image*/
+static unsigned long code_spilled = 0; /*number of cells of the code image in code_spill*/
+static unsigned long data_spilled = 0; /*number of cells of the data image in data_spill*/
+static patch_node *patch_list; /*missing info for orders that were spilled (sorted by index)*/
+static unsigned long patch_list_length = 0;
+static unsigned long patch_list_capacity = 0;
+/*reading the images back (see start_images)*/
+static unsigned long code_read, data_read, patch_read;
+static boolean code_moved = FALSE; /*get_code_word moved the position in code_spill since the last order read*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : spill_check(int ok);
+*//**
+* \section Description: this function stops the assembler if reading or writing a temporary file failed
+*                       (like alloc_check does when there is no memory left, see fatal_stop)
+*
+* \param  		ok - FALSE if the operation on the temporary file failed
+*******************************************************************************/
+void spill_check(int ok) {
+    if(!ok) {
+        fprintf(diag_file,"error: cannot use temporary file for --max-memory\n");
+        fatal_stop();
+    }
+}
+
+/******************************************************************************
+* Function : window(size_t size);
+*//**
+* \section Description: calculates the number of cells of a table that are kept in memory.
+*                       half of the memory limit goes to the code image, and half to the data image
+*
+* \param  		size - the size of a cell
+* \return       the number of cells. 0 if there is no memory limit
+*******************************************************************************/
+unsigned long window(size_t size) {
+    unsigned long cells;
+    if(options.max_memory == 0)
+        return 0;
+    cells = options.max_memory / 2 / size;
+    return (cells < MIN_WINDOW) ? MIN_WINDOW : cells;
+}
+
+/******************************************************************************
+* Function : spill_code();
+*//**
+* \section Description: if the code image in memory has reached its limit, this function writes it
+*                       to the end of the temporary file, and empties it.
+*                       called before an order is added to the code image
+*******************************************************************************/
+void spill_code() {
+    unsigned long limit = window(sizeof(machine_word));
+    if(limit == 0 || code_img_length < limit)
+        return;
+    if(code_spill == NULL)
+        spill_check((code_spill = tmpfile()) != NULL);
+    spill_check(fwrite(code_img, sizeof(machine_word), code_img_length, code_spill) == code_img_length);
+    code_spilled += code_img_length;
+    code_img_length = 0;
+}
+
+/******************************************************************************
+* Function : spill_data();
+*//**
+* \section Description: if the data image in memory has reached its limit, this function writes it
+*                       to the end of the temporary file, and empties it.
+*                       called before a data directive is added to the data image
+*******************************************************************************/
+void spill_data() {
+    unsigned long limit = window(sizeof(data_image));
+    if(limit == 0 || data_img_length < limit)
+        return;
+    if(data_spill == NULL)
+        spill_check((data_spill = tmpfile()) != NULL);
+    spill_check(fwrite(data_img, sizeof(data_image), data_img_length, data_spill) == data_img_length);
+    data_spilled += data_img_length;
+    data_img_length = 0;
+}
+
+/******************************************************************************
+* Function : code_length();
+*//**
+* \return       the number of orders in the code image (in memory and spilled)
+*******************************************************************************/
+unsigned long code_length() {
+    return code_spilled + code_img_length;
+}
+
+/******************************************************************************
+* Function : data_length();
+*//**
+* \return       the number of cells in the data image (in memory and spilled)
+*******************************************************************************/
+unsigned long data_length() {
+    return data_spilled + data_img_length;
+}
+
+/******************************************************************************
+* Function : get_code_word(unsigned long index);
+*//**
+* \section Description: gets the machine word of an order in the code image, from memory or from the temporary file
+*
+* \param  		index - the index of the order (must be less than code_length())
+* \return       the machine word of the order
+*******************************************************************************/
+machine_word get_code_word(unsigned long index) {
+    machine_word word;
+    if(index >= code_spilled)
+        return code_img[index-code_spilled];
+    /*the missing info of an order is completed only once, so a patched order is always the last one patched*/
+    if(patch_list_length > 0 && patch_list[patch_list_length-1].index == index)
+        return patch_list[patch_list_length-1].word;
+    spill_check(fseek(code_spill, (long)(index * sizeof(machine_word)), SEEK_SET) == 0);
+    spill_check(fread(&word, sizeof(machine_word), 1, code_spill) == 1);
+    spill_check(fseek(code_spill, 0, SEEK_END) == 0);
+    code_moved = TRUE;
+    return word;
+}
+
+/******************************************************************************
+* Function : set_code_word(unsigned long index, machine_word word);
+*//**
+* \section Description: replaces the machine word of an order in the code image.
+*                       if the order was spilled, the new word is added to the patch list
+*
+* \param  		index - the index of the order (must be less than code_length())
+* \param        word - the new machine word
+*******************************************************************************/
+void set_code_word(unsigned long index, machine_word word) {
+    if(index >= code_spilled) {
+        code_img[index-code_spilled] = word;
+        return;
+    }
+    if(patch_list_length > 0 && patch_list[patch_list_length-1].index == index) {
+        patch_list[patch_list_length-1].word = word;
+        return;
+    }
+    patch_list = (patch_node*) grow_vector(patch_list, patch_list_length+1, &patch_list_capacity, PATCH_LIST_INIT, sizeof(patch_node), MEM_IMAGES);
+    patch_list[patch_list_length].index = index;
+    patch_list[patch_list_length].word = word;
+    patch_list_length++;
+}
+
+/******************************************************************************
+* Function : start_images();
+*//**
+* \section Description: goes back to the start of the code image and data image,
+*                       before reading them with next_code_word and next_data_cell
+*******************************************************************************/
+void start_images() {
+    code_read = 0;
+    data_read = 0;
+    patch_read = 0;
+    if(code_spill != NULL)
+        spill_check(fseek(code_spill, 0, SEEK_SET) == 0);
+    code_moved = FALSE;
+    if(data_spill != NULL)
+        spill_check(fseek(data_spill, 0, SEEK_SET) == 0);
+}
+
+/******************************************************************************
+* Function : next_code_word(machine_word *word);
+*//**
+* \section Description: reads the next order of the code image (see start_images)
+*
+* \param  		word - the machine word of the order is written here
+* \return       FALSE if there are no more orders
+*******************************************************************************/
+int next_code_word(machine_word *word) {
+    if(code_read >= code_length())
+        return FALSE;
+    if(code_read < code_spilled) {
+        /*the orders can be read while the 2nd pass still completes missing info (see stream_code in files.c)*/
+        if(code_moved) {
+            spill_check(fseek(code_spill, (long)(code_read * sizeof(machine_word)), SEEK_SET) == 0);
+            code_moved = FALSE;
+        }
+        spill_check(fread(word, sizeof(machine_word), 1, code_spill) == 1);
+        if(patch_read < patch_list_length && patch_list[patch_read].index == code_read)
+            *word = patch_list[patch_read++].word;
+    } else *word = code_img[code_read-code_spilled];
+    code_read++;
+    return TRUE;
+}
+
+/******************************************************************************
+* Function : next_data_cell(data_image *cell);
+*//**
+* \section Description: reads the next cell of the data image (see start_images)
+*
+* \param  		cell - the cell is written here
+* \return       FALSE if there are no more cells
+*******************************************************************************/
+int next_data_cell(data_image *cell) {
+    if(data_read >= data_length())
+        return FALSE;
+    if(data_read < data_spilled)
+        spill_check(fread(cell, sizeof(data_image), 1, data_spill) == 1);
+    else *cell = data_img[data_read-data_spilled];
+    data_read++;
+    return TRUE;
+}
+
+/******************************************************************************
+* Function : spill_reset();
+*//**
+* \section Description: closes (and so deletes) the temporary files, and empties the patch list.
+*                       used before we go to another source file
+*******************************************************************************/
+void spill_reset() {
+    if(code_spill != NULL)
+        fclose(code_spill);
+    if(data_spill != NULL)
+        fclose(data_spill);
+    code_spill = NULL;
+    data_spill = NULL;
+    code_spilled = 0;
+    data_spilled = 0;
+    patch_list = NULL; /*allocated from the file arena*/
+    patch_list_length = 0;
+    patch_list_capacity = 0;
+}
+
+/*************** END OF FUNCTIONS ***************************************************************************/
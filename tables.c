@@ -6,7 +6,8 @@
 *******************************************************************************/
 /** \file tables.c
  * \brief This module contains function that maintain all the tables necessary to the assembler
- * the tables are: the opcode table, the code image table, the data image table, te symbol table, and the external label list.
+ * the tables are: the opcode table, the code image table, the data image table, te symbol table, the external label list
+ * and the cross reference list.
  */
 /******************************************************************************
 * Includes
@@ -15,6 +16,11 @@
 #include <stdio.h>
 #include <string.h>
 #include "assembler.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /******************************************************************************
 * Module Preprocessor Constants
@@ -24,7 +30,7 @@
 * Module Variable Definitions
 *******************************************************************************/
 /*tables*/
-const cmd_info opcode_table[] = {{"add", 0, 1},{"addi", 10, 0},{"and", 0, 3},
+static const cmd_info opcode_table[] = {{"add", 0, 1},{"addi", 10, 0},{"and", 0, 3},
                                  {"andi", 12, 0},{"beq", 16, 0},{"bgt", 18, 0},
                                  {"blt", 17, 0},{"bne", 15, 0},{"call", 32, 0},
                                  {"jmp", 30, 0},{"la", 31, 0},{"lb", 19, 0},
@@ -34,26 +40,41 @@ const cmd_info opcode_table[] = {{"add", 0, 1},{"addi", 10, 0},{"and", 0, 3},
                                  {"sb", 20, 0},{"sh", 24, 0},{"stop", 63, 0},
                                  {"sub", 0, 2},{"subi", 11, 0},{"sw", 22, 0}};
 
-command_image *code_img;
+machine_word *code_img; /*the order in index i is at address CODE_BASE + 4*i*/
 data_image *data_img;
 symbol_node *symbol_table;
+static symbol_node *symbol_table_tail; /*last symbol in the symbol table (new symbols are added after it)*/
+static symbol_node *symbol_hash[SYMBOL_BUCKETS]; /*hash index over the symbol table*/
 ext_node *external_list;
+unsigned long ext_list_length = 0; /*number of nodes in the external label list*/
+static unsigned long ext_list_capacity = 0; /*number of nodes allocated for the external label list*/
+
+xref_node *xref_list; /*uses of symbols in the source file (only with --xref)*/
+unsigned long xref_list_length = 0; /*number of nodes in the cross reference list*/
+static unsigned long xref_list_capacity = 0; /*number of nodes allocated for the cross reference list*/
 
 /*other global vars*/
 unsigned long code_img_length = 0; /*length of code image table*/
 unsigned long data_img_length = 0; /*length of data image table*/
+unsigned long code_img_capacity = 0; /*number of cells allocated for the code image table*/
+unsigned long data_img_capacity = 0; /*number of cells allocated for the data image table*/
+extern arena file_arena, line_arena;
+extern FILE *diag_file;
 int data_exists = FALSE; /*indicates if there is data*/
 extern unsigned long DC; /*current data counter*/
-int entries_exist = FALSE; /*indicates if there are labels that are entry points*/
+extern unsigned long ICF; /*the final value of IC (see pass_one.c)*/
+symbol_node **entry_list; /*the symbols that are entry points, in the order of their .entry directives*/
+unsigned long entry_list_length = 0; /*number of entry points*/
+static unsigned long entry_list_capacity = 0; /*number of entry points allocated for the entry list*/
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
-void code_r_cmd(char *line, unsigned opcode, unsigned funct, cmd_in_binary *ptr_to_printable);
-void code_i_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable);
-void code_j_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable);
+void code_r_cmd(char *line, unsigned opcode, unsigned funct, machine_word *ptr_to_printable);
+void code_i_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable);
+void code_j_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable);
 
-int complete_missing_info_i(unsigned long label_address, unsigned long IC);
-int complete_missing_info_j(char *label, unsigned long label_address, unsigned long IC);
+int complete_missing_info_i(symbol_node *symbol, unsigned long IC);
+int complete_missing_info_j(symbol_node *symbol, unsigned long IC);
 
 void code_db(char *line, int num_args, int pos);
 void code_dh(char *line, int num_args, int pos);
@@ -66,15 +87,23 @@ void code_dw(char *line, int num_args, int pos);
 /******************************************************************************
 * Function : initialize_tables();
 *//**
-* \section Description: this function initializes all the tables (besides the opcode table) to NULL,
+* \section Description: this function initializes all the tables (besides the opcode table, and the code image
+*                       and data image tables, which are kept from one file to the next - see memory_mgmt.c) to NULL,
 *                       and all of the flags to FALSE accordingly
 *******************************************************************************/
 void initialize_tables(){
-    code_img = NULL;
-    data_img = NULL;
     symbol_table = NULL;
+    symbol_table_tail = NULL;
+    memset(symbol_hash, 0, sizeof(symbol_hash));
     external_list = NULL;
-    entries_exist = FALSE;
+    ext_list_length = 0;
+    ext_list_capacity = 0;
+    entry_list = NULL;
+    entry_list_length = 0;
+    entry_list_capacity = 0;
+    xref_list = NULL;
+    xref_list_length = 0;
+    xref_list_capacity = 0;
     data_exists = FALSE;
 }
 /******************************************************************************
@@ -134,24 +163,20 @@ int num_ops_expected(unsigned opcode) {
 int order_index(char *line) {
     int i;
     char *word = NULL;
-    word = (char *)malloc(MAX_LINE+1);
-    alloc_check(word);
+    word = (char *)arena_alloc(&line_arena, MAX_LINE+1);
     scan_op(line, word);
     /*looking for it in the opcode table, which is sorted alphabetically*/
     for(i = 0; i < NUM_ORDERS; i++) {
         if(strcmp(word,opcode_table[i].name)<0) {
-            fprintf(stderr, "error: order (%s) does not exist ", word);
-            free(word);
+            fprintf(diag_file, "error: order (%s) does not exist ", word);
             return NON_REAL_INDEX;
         }
         if(strcmp(word,opcode_table[i].name)==0) {
-            free(word);
             return i;
         }
     }
     /*order is not in the table*/
-    fprintf(stderr, "error: order (%s) does not exist ", word);
-    free(word);
+    fprintf(diag_file, "error: order (%s) does not exist ", word);
     return NON_REAL_INDEX;
 }
 
@@ -182,9 +207,9 @@ void cmd_to_info(char *line, unsigned IC) {
     unsigned type;
     unsigned opcode = get_opcode(line);
     unsigned funct = get_funct(line);
-    cmd_in_binary printable;
-    command_image img;
+    machine_word printable;
     line+= next_op(line,FALSE);
+    spill_code(); /*making room for the order if there is a memory limit*/
     code_img_length++;
     if(opcode<=1) {
         type = R_CMD;
@@ -203,27 +228,104 @@ void cmd_to_info(char *line, unsigned IC) {
             code_j_cmd(line, opcode, &printable);
             break;
     }
-    img.address = IC;
-    img.machine_code = printable;
-    code_img = (command_image*) realloc (code_img,(code_img_length)* sizeof(command_image));
-    alloc_check(code_img);
-    code_img[code_img_length-1] = img;
+    code_img = (machine_word*) grow_image(code_img, code_img_length, &code_img_capacity, sizeof(machine_word));
+    code_img[code_img_length-1] = printable;
+}
+
+/******************************************************************************
+* Function : encode_r(unsigned opcode, unsigned rs, unsigned rt, unsigned rd, unsigned funct);
+*//**
+* \section Description: this function builds the machine word of an R order out of its fields (see FIELD_SHIFTS in assembler.h)
+* \return       the machine word
+*******************************************************************************/
+machine_word encode_r(unsigned opcode, unsigned rs, unsigned rt, unsigned rd, unsigned funct) {
+    return (machine_word)(((opcode & OPCODE_MASK) << OPCODE_SHIFT) | ((rs & REG_MASK) << RS_SHIFT) |
+                          ((rt & REG_MASK) << RT_SHIFT) | ((rd & REG_MASK) << RD_SHIFT) | ((funct & FUNCT_MASK) << FUNCT_SHIFT));
+}
+
+/******************************************************************************
+* Function : encode_i(unsigned opcode, unsigned rs, unsigned rt, long immed);
+*//**
+* \section Description: this function builds the machine word of an I order out of its fields (see FIELD_SHIFTS in assembler.h).
+*                       immed is kept in 16 bits (2's complement)
+* \return       the machine word
+*******************************************************************************/
+machine_word encode_i(unsigned opcode, unsigned rs, unsigned rt, long immed) {
+    return (machine_word)(((opcode & OPCODE_MASK) << OPCODE_SHIFT) | ((rs & REG_MASK) << RS_SHIFT) |
+                          ((rt & REG_MASK) << RT_SHIFT) | ((unsigned long)immed & IMMED_MASK));
+}
+
+/******************************************************************************
+* Function : encode_j(unsigned opcode, int reg, unsigned long address);
+*//**
+* \section Description: this function builds the machine word of a J order out of its fields (see FIELD_SHIFTS in assembler.h)
+* \param        reg - TRUE if address is a register number, FALSE if it is the address of a label
+* \return       the machine word
+*******************************************************************************/
+machine_word encode_j(unsigned opcode, int reg, unsigned long address) {
+    return (machine_word)(((opcode & OPCODE_MASK) << OPCODE_SHIFT) | ((unsigned long)(reg ? 1 : 0) << REG_SHIFT) |
+                          (address & ADDRESS_MASK));
+}
+
+/******************************************************************************
+* Function : set_immed(machine_word w, long immed);
+*//**
+* \section Description: this function replaces the immed field of an I order
+* \return       the machine word with the new immed field
+*******************************************************************************/
+machine_word set_immed(machine_word w, long immed) {
+    return (machine_word)((w & ~IMMED_MASK) | ((unsigned long)immed & IMMED_MASK));
+}
+
+/******************************************************************************
+* Function : set_address(machine_word w, unsigned long address);
+*//**
+* \section Description: this function replaces the address field of a J order
+* \return       the machine word with the new address field
+*******************************************************************************/
+machine_word set_address(machine_word w, unsigned long address) {
+    return (machine_word)((w & ~ADDRESS_MASK) | (address & ADDRESS_MASK));
+}
+
+/******************************************************************************
+* Function : is_reg_j(machine_word w);
+*//**
+* \section Description: this function checks the reg field of a J order
+* \return       TRUE if the operand of this J order is a register
+*******************************************************************************/
+int is_reg_j(machine_word w) {
+    return (w >> REG_SHIFT) & 1;
+}
+
+/******************************************************************************
+* Function : to_bytes(unsigned char *bytes, unsigned long value, int n);
+*//**
+* \section Description: this function splits the lowest n bytes of value into bytes in the little endian method
+*                       (the lowest byte first), no matter what the byte order of this computer is
+* \param  		bytes - the result. must have room for n bytes
+* \param        value - a machine word, or the value of data
+* \param        n - the number of bytes (1, 2 or 4)
+*******************************************************************************/
+void to_bytes(unsigned char *bytes, unsigned long value, int n) {
+    int i;
+    for(i = 0; i < n; i++) {
+        bytes[i] = (unsigned char)(value & 0xFF);
+        value >>= 8;
+    }
 }
 
 /******************************************************************************
-* Function : code_r_cmd(char *line, unsigned opcode, unsigned funct, cmd_in_binary *ptr_to_printable);
+* Function : code_r_cmd(char *line, unsigned opcode, unsigned funct, machine_word *ptr_to_printable);
 *//**
 * \section Description: this function codes R commands into machine code
 * \param  		line - the current line(points after order)
 * \param        opcode - opcode of this R order
 * \param        funct - funct of this R order
-* \param        ptr_to_printable - pointer to a union with a divided word, which allows the assembler to divide orders into bytes later on
+* \param        ptr_to_printable - pointer to the machine word of the order
 *******************************************************************************/
-void code_r_cmd(char *line, unsigned opcode, unsigned funct, cmd_in_binary *ptr_to_printable) {
+void code_r_cmd(char *line, unsigned opcode, unsigned funct, machine_word *ptr_to_printable) {
     unsigned regs[] = {0,0,0};
     int i;
-    r_command r_cmd;
-    r_cmd.opcode = opcode;
     regs[0] = atoi(++line);
     if(opcode == 0) {
         for(i=1;i<3;i++) {
@@ -236,28 +338,23 @@ void code_r_cmd(char *line, unsigned opcode, unsigned funct, cmd_in_binary *ptr_
             line+=next_op(line,TRUE);
         regs[2] = atoi(++line);
     }
-    r_cmd.rs = regs[0];
-    r_cmd.rt = regs[1];
-    r_cmd.rd = regs[2];
-    r_cmd.funct = funct;
-    r_cmd.zeros = 0;
-    ptr_to_printable->r_cmd = r_cmd;
+    *ptr_to_printable = encode_r(opcode, regs[0], regs[1], regs[2], funct);
 }
 
 /******************************************************************************
-* Function : code_i_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable);
+* Function : code_i_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable);
 *//**
-* \section Description: this function codes I commands into machine code
+* \section Description: this function codes I commands into machine code.
+*                       the immed field of conditional branch orders is left 0 until the 2nd pass
 * \param  		line - the current line(points after order)
 * \param        opcode - opcode of this I order
-* \param        ptr_to_printable - pointer to a union with a divided word, which allows the assembler to divide orders into bytes later on
+* \param        ptr_to_printable - pointer to the machine word of the order
 *******************************************************************************/
-void code_i_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable) {
+void code_i_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable) {
     int can_code_immed;
     unsigned regs[] = {0,0,0};
+    long immed = 0;
     int i;
-    i_command i_cmd;
-    i_cmd.opcode = opcode;
     if(opcode <= 14 || (opcode>=19 && opcode<=24)) {
         can_code_immed = TRUE;
     } else can_code_immed = FALSE;
@@ -265,41 +362,27 @@ void code_i_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable) {
     for(i=1;i<3;i++) {
         line+= next_op(line,TRUE);
         if(can_code_immed && i==1) {
-            i_cmd.immed=atoi(line);
+            immed=atoi(line);
         } else regs[i] = atoi(++line);
     }
     /*happens if the command is an arithmetic or a load/save command:*/
     if(regs[2]!=0) regs[1] = regs[2];
-    i_cmd.rs = regs[0];
-    i_cmd.rt = regs[1];
-    ptr_to_printable->i_cmd = i_cmd;
+    *ptr_to_printable = encode_i(opcode, regs[0], regs[1], immed);
 }
 
 /******************************************************************************
-* Function : code_j_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable);
+* Function : code_j_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable);
 *//**
-* \section Description: this function codes I commands into machine code
+* \section Description: this function codes J commands into machine code.
+*                       the address of a label is left 0 until the 2nd pass
 * \param  		line - the current line(points after order)
-* \param        opcode - opcode of this I order
-* \param        ptr_to_printable - pointer to a union with a divided word, which allows the assembler to divide orders into bytes later on
-*******************************************************************************/
-void code_j_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable) {
-    j_command j_cmd;
-    j_cmd.opcode = opcode;
-    if(opcode <= 32) {
-        if(*line != '$') {
-            j_cmd.reg = FALSE;
-        } else {
-            j_cmd.reg = 1;
-            j_cmd.address = (unsigned)atoi(++line);
-        }
-
-    }
-    else {
-        j_cmd.reg = FALSE;
-        j_cmd.address = 0;
-    }
-    ptr_to_printable->j_cmd = j_cmd;
+* \param        opcode - opcode of this J order
+* \param        ptr_to_printable - pointer to the machine word of the order
+*******************************************************************************/
+void code_j_cmd(char *line, unsigned opcode, machine_word *ptr_to_printable) {
+    if(opcode <= 32 && *line == '$') /*the operand is a register*/
+        *ptr_to_printable = encode_j(opcode, TRUE, (unsigned)atoi(++line));
+    else *ptr_to_printable = encode_j(opcode, FALSE, 0);
 }
 
 /******************************************************************************
@@ -321,92 +404,75 @@ void code_j_cmd(char *line, unsigned opcode, cmd_in_binary *ptr_to_printable) {
 * \return       TRUE if the info was completed successfully. FALSE if error was found
 *******************************************************************************/
 int complete_missing_info(char *label, char order_type, unsigned long IC) {
-    unsigned long label_address;
-    int i;
-    symbol_node *curr = symbol_table;
-    if(order_type == 'J') {
-        for(i = 0; i < code_img_length; i++) {
-            /*no info need to be completed. a register has already been coded into the binary image:*/
-            if(IC == code_img[i].address && code_img[i].machine_code.j_cmd.reg == TRUE)
-                return TRUE;
-        }
+    symbol_node *curr;
+    if((IC-CODE_BASE)/WORD >= code_length()) {
+        fprintf(diag_file,"error: this should not happen (algorithm flaw in assembler) ");
+        return FALSE;
     }
-    /*pass on the symbol table.*/
-    while(curr!=NULL) {
-        if(strcmp(label,curr->symbol) == 0) {
-            label_address = curr->address;
-            break;
-        }
-        curr = curr->next;
+    if(order_type == 'J') {
+        /*no info need to be completed. a register has already been coded into the binary image:*/
+        if(is_reg_j(get_code_word((IC-CODE_BASE)/WORD)))
+            return TRUE;
     }
+    /*look the label up in the symbol table.*/
+    curr = find_symbol(label);
     if(curr == NULL) {
-        fprintf(stderr,"error: label used as operand does not exist ");
+        fprintf(diag_file,"error: label used as operand does not exist ");
         return FALSE;
     }
     if(order_type == 'I') {
-        return complete_missing_info_i(label_address, IC);
+        return complete_missing_info_i(curr, IC);
     }
     if(order_type == 'J') {
-        return complete_missing_info_j(label, label_address, IC);
+        return complete_missing_info_j(curr, IC);
     }
-    fprintf(stderr,"error: this should not happen (algorithm flaw in assembler) ");
+    fprintf(diag_file,"error: this should not happen (algorithm flaw in assembler) ");
     return FALSE;
 }
 
 /******************************************************************************
-* Function : complete_missing_info_i(unsigned long label_address, unsigned long IC);
+* Function : complete_missing_info_i(symbol_node *symbol, unsigned long IC);
 *//**
 * \section Description: this function completes the missing info about conditional branch orders.
-*                       it has the address of the label that shows up as an operand, and it has the instruction counter
-*                       of this order, so it just searches the array for the right order and completes it with the information it has
-* \param        label - the label that shows up as an operand in this J order
+*                       it has the label that shows up as an operand, and it has the instruction counter
+*                       of this order. every order takes 4 bytes starting at CODE_BASE, so the index of the order in the code image
+*                       is (IC-CODE_BASE)/4, and the order is completed with the information it has
+* \param        symbol - the label that shows up as an operand in the order
 * \param  		IC - address of the conditional branch order
-* \param        label_address - address of the label that shows up as an operand in he order
 * \return       TRUE if no error was found (see \errors in complete_missing_info)
 *******************************************************************************/
-int complete_missing_info_i(unsigned long label_address, unsigned long IC) {
-    int i;
+int complete_missing_info_i(symbol_node *symbol, unsigned long IC) {
+    unsigned long i = (IC-CODE_BASE)/WORD;
+    unsigned long label_address = symbol_address(symbol);
     if(!in_lim((long int)(label_address-IC),16)) {
-        fprintf(stderr,"error: immed value should be in 16 bit limits ");
+        fprintf(diag_file,"error: immed value should be in 16 bit limits ");
         return FALSE;
     }
-    if(label_address == 0) {
-        fprintf(stderr,"error: external symbol cannot be used in conditional branch orders ");
+    if(symbol->attribute == EXTERNAL) {
+        fprintf(diag_file,"error: external symbol cannot be used in conditional branch orders ");
         return FALSE;
     }
-    for(i = 0; i < code_img_length; i++) {
-        if(code_img[i].address == IC) {
-            code_img[i].machine_code.i_cmd.immed = label_address - IC;
-            return TRUE;
-        }
-    }
-    fprintf(stderr,"error: this should not happen (algorithm flaw in assembler) ");
-    return FALSE;
+    set_code_word(i, set_immed(get_code_word(i), (long)(label_address - IC)));
+    return TRUE;
 }
 
 /******************************************************************************
-* Function : complete_missing_info_j(unsigned long label_address);
+* Function : complete_missing_info_j(symbol_node *symbol, unsigned long IC);
 *//**
 * \section Description: this function completes the missing info about J orders that are not "stop".
-*                       it searches the array for this J order and puts the parameter "label_address"
-*                       into the "address" field. if the label is external, it will be added to the external label list
-* \param        label_address - address of the label that shows up as an operand in he order
+*                       it puts the address of the label into the "address" field of this J order (its index in the
+*                       code image is (IC-CODE_BASE)/4). if the label is external, it will be added to the external label list
+* \param        symbol - the label that shows up as an operand in the order
 * \param        IC - address of this J order
 * \return       TRUE if no error was found (see \errors in complete_missing_info)
 *******************************************************************************/
-int complete_missing_info_j(char *label, unsigned long label_address, unsigned long IC) {
-    int i;
-    if(label_address == 0) { /*external label*/
-        add_to_ext_list(IC,label);
+int complete_missing_info_j(symbol_node *symbol, unsigned long IC) {
+    unsigned long i = (IC-CODE_BASE)/WORD;
+    if(symbol->attribute == EXTERNAL) {
+        add_to_ext_list(IC,symbol->symbol.name);
     }
-    for(i = 0; i < code_img_length; i++) {
-        if(code_img[i].address == IC) {
-            code_img[i].machine_code.j_cmd.address = label_address;
-            return TRUE;
-        }
-    }
-    fprintf(stderr,"error: this should not happen (algorithm flaw in assembler) ");
-    return FALSE;
+    set_code_word(i, set_address(get_code_word(i), symbol_address(symbol)));
+    return TRUE;
 }
 /******************************************************************************
 * Functions For Data Storage Directive Lines
@@ -423,7 +489,9 @@ void data_to_info(char *line) {
     int d = is_data(line);
     int len;
     int num_args;
-    int pos = data_img_length;    /* we start to update in this position */
+    int pos;
+    spill_data(); /*making room for the directive if there is a memory limit*/
+    pos = data_img_length;    /* we start to update in this position */
     if(data_exists == FALSE) {
         data_exists = TRUE;
     }
@@ -436,8 +504,7 @@ void data_to_info(char *line) {
         num_args = get_num_args(line);  /* num numbers */
         data_img_length += num_args;
     }
-    data_img = (data_image*) realloc(data_img,data_img_length *(sizeof(data_image)));
-    alloc_check(data_img);
+    data_img = (data_image*) grow_image(data_img, data_img_length, &data_img_capacity, sizeof(data_image));
 
     switch(d) {
         case DB:
@@ -466,14 +533,12 @@ void data_to_info(char *line) {
 void code_db(char *line, int num_args, int pos) {
     /*each argument takes 1 byte*/
     int i;
-    data_img[pos].machine_code.b = atoi(line);
-    data_img[pos].address=DC;
+    data_img[pos].machine_code = (unsigned long)atol(line);
     data_img[pos].bytes_taken = ONE_BYTE;
     DC+=ONE_BYTE;
     for(i=1;i< num_args;i++) {
         line+=next_op(line,TRUE);
-        data_img[pos+i].machine_code.b = atoi(line);
-        data_img[pos+i].address=DC;
+        data_img[pos+i].machine_code = (unsigned long)atol(line);
         data_img[pos+i].bytes_taken = ONE_BYTE;
         DC+=ONE_BYTE;
     }
@@ -490,14 +555,12 @@ void code_db(char *line, int num_args, int pos) {
 void code_dh(char *line, int num_args, int pos) {
     /*each argument takes 2 bytes*/
     int i;
-    data_img[pos].machine_code.dh.img = atoi(line);
-    data_img[pos].address=DC;
+    data_img[pos].machine_code = (unsigned long)atol(line);
     data_img[pos].bytes_taken = HALF_WORD;
     DC+=HALF_WORD;
     for(i=1;i< num_args;i++) {
         line+=next_op(line,TRUE);
-        data_img[pos+i].machine_code.dh.img = atoi(line);
-        data_img[pos+i].address=DC;
+        data_img[pos+i].machine_code = (unsigned long)atol(line);
         data_img[pos+i].bytes_taken = HALF_WORD;
         DC+=HALF_WORD;
     }
@@ -517,14 +580,12 @@ void code_asciz(char *line, int pos) {
     /*encoding all the chars of the directive to all the cells left but the last one*/
     /*last cell in array saved for '\0'*/
     for(i=pos;i<(data_img_length-1);i++) {
-        data_img[i].machine_code.b = (unsigned)(line[i]);
-        data_img[i].address = DC;
+        data_img[i].machine_code = (unsigned char)(line[i-pos]); /*the offset in the string, not in the image*/
         data_img[i].bytes_taken = ONE_BYTE;
         DC+=ONE_BYTE;
     }
     /*adding the null character*/
-    data_img[i].machine_code.b = 0;
-    data_img[i].address = DC;
+    data_img[i].machine_code = 0;
     data_img[i].bytes_taken = ONE_BYTE;
     DC+=ONE_BYTE;
 }
@@ -540,169 +601,312 @@ void code_asciz(char *line, int pos) {
 void code_dw(char *line, int num_args, int pos) {
     /*each argument takes 4 bytes*/
     int i;
-    data_img[pos].machine_code.dw.img = atol(line);
-    data_img[pos].address=DC;
+    data_img[pos].machine_code = (unsigned long)atol(line);
     data_img[pos].bytes_taken = WORD;
     DC+=WORD;
     for(i=1;i< num_args;i++) {
         line+=next_op(line,TRUE);
-        data_img[pos+i].machine_code.dw.img = atol(line);
-        data_img[pos+i].address=DC;
+        data_img[pos+i].machine_code = (unsigned long)atol(line);
         data_img[pos+i].bytes_taken = WORD;
         DC+=WORD;
     }
 }
 
 /******************************************************************************
-* Function : update_data_img(unsigned ICF);
+* Function : make_label_key(label_key *key, char *label);
+*//**
+* \section Description: this function copies a label into a fixed width key, padding the rest of the key with zeros.
+*                       labels are at most MAX_LABEL characters long, so there is always room for the null character
+* \param  		key - the result
+* \param        label - the label (a null terminated string)
+*******************************************************************************/
+void make_label_key(label_key *key, char *label) {
+    memset(key, 0, sizeof(label_key));
+    strncpy(key->name, label, MAX_LABEL);
+}
+
+/******************************************************************************
+* Function : same_label(const label_key *a, const label_key *b);
 *//**
-* \section Description: at the end of the 1st pass, to maintain continuity in addresses,
-*                       ICF (see pass_one.c) is added to each address in the data table
-* \param  		ICF - the final value of IC (see pass_one.c)
+* \section Description: this function checks if two label keys hold the same label.
+*                       since both keys are padded with zeros, the whole 32 bytes are compared at once:
+*                       with one AVX2 compare, two SSE2 compares, or a word at a time when neither is available.
+*                       there is no early exit, so the comparison does not branch on the contents of the labels
+* \param  		a,b - the keys to compare
+* \return       TRUE if the keys are identical
+*******************************************************************************/
+int same_label(const label_key *a, const label_key *b) {
+#if defined(__AVX2__)
+    __m256i x = _mm256_loadu_si256((const __m256i*)a->name);
+    __m256i y = _mm256_loadu_si256((const __m256i*)b->name);
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) == -1;
+#elif defined(__SSE2__)
+    __m128i lo = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)a->name), _mm_loadu_si128((const __m128i*)b->name));
+    __m128i hi = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(a->name+16)), _mm_loadu_si128((const __m128i*)(b->name+16)));
+    return _mm_movemask_epi8(_mm_and_si128(lo, hi)) == 0xFFFF;
+#else
+    unsigned long diff = 0;
+    int i;
+    for(i = 0; i < sizeof(a->words)/sizeof(unsigned long); i++)
+        diff |= a->words[i] ^ b->words[i];
+    return diff == 0;
+#endif
+}
+
+/******************************************************************************
+* Function : hash_label(const label_key *key);
+*//**
+* \section Description: this function calculates the hash of a label (32 bit FNV-1a over the characters of the label)
+* \param  		key - the label
+* \return       the hash of the label
 *******************************************************************************/
-void update_data_img(unsigned ICF) {
+unsigned long hash_label(const label_key *key) {
+    unsigned long hash = 2166136261UL;
     int i;
-    for(i=0;i<data_img_length;i++)
-        data_img[i].address+=ICF;
+    for(i = 0; i < MAX_LABEL && key->name[i] != '\0'; i++) {
+        hash ^= (unsigned char)key->name[i];
+        hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+/******************************************************************************
+* Function : lookup_key(const label_key *key);
+*//**
+* \section Description: this function looks for a symbol in the bucket of the symbol hash table that its key belongs to
+* \param  		key - the label of the symbol
+* \return       pointer to the symbol in the symbol table. NULL if the symbol does not exist
+*******************************************************************************/
+symbol_node *lookup_key(const label_key *key) {
+    symbol_node *curr = symbol_hash[hash_label(key) & (SYMBOL_BUCKETS-1)];
+    while(curr != NULL && !same_label(&curr->symbol, key))
+        curr = curr->hash_next;
+    return curr;
 }
 
 /******************************************************************************
-* Function : create_symbol(symbol_node *dest,unsigned address, char *symbol, int attribute, int is_entry);
+* Function : find_symbol(char *symbol);
+*//**
+* \section Description: this function looks for a symbol in the symbol table
+* \param  		symbol - the name of the symbol
+* \return       pointer to the symbol in the symbol table. NULL if the symbol does not exist
+*******************************************************************************/
+symbol_node *find_symbol(char *symbol) {
+    label_key key;
+    make_label_key(&key, symbol);
+    return lookup_key(&key);
+}
+
+/******************************************************************************
+* Function : create_symbol(symbol_node *dest,unsigned long offset, char *symbol, int attribute, int is_entry);
 *//**
 * \section Description: this function creates a symbol_node (ready to add to the symbol table)
 *                       with the attributes given. for explanation about each attribute ot the symbol, see assembler.h
 * \param  		dest - pointer to the result. must be allocated memory to it before using this function
 *******************************************************************************/
-void create_symbol(symbol_node *dest, unsigned address, char *symbol, int attribute, int is_entry) {
+void create_symbol(symbol_node *dest, unsigned long offset, char *symbol, int attribute, int is_entry) {
     dest->next = NULL;
-    dest->address = address;
+    dest->hash_next = NULL;
+    dest->offset = offset;
     dest->attribute = attribute;
-    strcpy(dest->symbol, symbol);
+    make_label_key(&dest->symbol, symbol);
     dest->is_entry = is_entry;
 }
 
 /******************************************************************************
-* Function : add_symbol(unsigned address, char *symbol, int attribute, int is_entry);
+* Function : add_symbol(unsigned long offset, char *symbol, int attribute, int is_entry);
 *//**
 * \section Description: this function adds the symbol represented by the parameters given to the symbol table.
 *                       for explanation about each attribute ot the symbol, see assembler.h.
 *                       an error will e detected if the assembler will try to add a symbol with an identical name to another symbol in the table
 * \return  FALSE if error occurs, TRUE if the symbol was added successfully
 *******************************************************************************/
-int add_symbol(unsigned address, char *symbol, int attribute, int is_entry) {
+int add_symbol(unsigned long offset, char *symbol, int attribute, int is_entry) {
     symbol_node *node;
-    symbol_node *curr;
-    node = (symbol_node*)malloc(sizeof(symbol_node));
-    node->symbol = (char*) malloc (MAX_LABEL+1);
-    alloc_check(node);
-    alloc_check(node->symbol);
-    create_symbol(node, address ,symbol ,attribute ,is_entry);
-    if (symbol_table == NULL) {
-        symbol_table = node;
-        return TRUE;
-    }
-    curr = symbol_table;
-    while(curr!=NULL) {
-        if(strcmp((node->symbol),(curr->symbol))==0) { /*checking if symbol already exists*/
-            fprintf(stderr, "symbol (%s) already exists, and cannot be used twice ", node->symbol);
-            free(node->symbol);
-            free(node);
-            return FALSE;
-        }
-        curr = curr->next;
+    unsigned long bucket;
+    if(find_symbol(symbol) != NULL) { /*checking if symbol already exists*/
+        fprintf(diag_file, "symbol (%s) already exists, and cannot be used twice ", symbol);
+        return FALSE;
     }
-    curr = symbol_table;
-    while(curr->next!=NULL)
-        curr = curr->next;
-    curr->next = node;
+    node = (symbol_node*)arena_alloc_for(&file_arena, sizeof(symbol_node), MEM_SYMBOLS);
+    create_symbol(node, offset ,symbol ,attribute ,is_entry);
+    /*adding the symbol to its bucket in the hash table, and to the end of the symbol table*/
+    bucket = hash_label(&node->symbol) & (SYMBOL_BUCKETS-1);
+    node->hash_next = symbol_hash[bucket];
+    symbol_hash[bucket] = node;
+    if (symbol_table == NULL)
+        symbol_table = node;
+    else symbol_table_tail->next = node;
+    symbol_table_tail = node;
     return TRUE;
 }
 
+/******************************************************************************
+* Function : symbol_address(const symbol_node *symbol);
+*//**
+* \section Description: this function works out the address of a symbol from its segment and its offset in it.
+*                       the code segment starts at CODE_BASE, and the data segment right after it, at ICF (see pass_one.c),
+*                       so the address of a data symbol is known only after the 1st pass
+* \param  		symbol - the symbol
+* \return       the address of the symbol (0 for an external symbol)
+*******************************************************************************/
+unsigned long symbol_address(const symbol_node *symbol) {
+    switch(symbol->attribute) {
+        case CODE:
+            return CODE_BASE + symbol->offset;
+        case DATA:
+            return ICF + symbol->offset;
+        default:
+            return 0;
+    }
+}
+
 /******************************************************************************
 * Function : add_ent(char *symbol);
 *//**
 * \section Description: this function is called when an entry point has been detected,
 *                       it sees if the symbol does ont exist, or if it is external. if it is one of thw two,
 *                       the assembler will report an error. otherwise, it will turn on the "is_entry" flag in the correct symbol_node
-*                       in the symbol table.
+*                       in the symbol table, and add the symbol to the entry list (only the first time, so that
+*                       a label that shows up in more than one .entry directive is written to the .ent file once).
 *
 * \param  		symbol - the name of the symbol
 * \return               TRUE is the symbol can be an entry, FALSE if an error was found
 *******************************************************************************/
 int add_ent(char *symbol) {
-    symbol_node *curr = symbol_table;
-    if(entries_exist == FALSE)
-        entries_exist = TRUE;
-    while(curr!=NULL) {
-        if(strcmp(curr->symbol,symbol) == 0) {
-            /*don't need a loop. there is only one attribute*/
-            if(curr->attribute == EXTERNAL) {
-                fprintf(stderr,"error: the symbol (%s) cannot be an entry and external at the same time ",symbol);
-                return FALSE;
-            }
-            curr->is_entry = TRUE;
-            return TRUE;
-        }
-        curr = curr->next;
-    }
+    symbol_node *curr = find_symbol(symbol);
     /*checking if the symbol does not exist, which is not valid*/
-    fprintf(stderr,"error: the symbol requested as an entry point does not exist ");
-    return FALSE;
+    if(curr == NULL) {
+        fprintf(diag_file,"error: the symbol requested as an entry point does not exist ");
+        return FALSE;
+    }
+    /*don't need a loop. there is only one attribute*/
+    if(curr->attribute == EXTERNAL) {
+        fprintf(diag_file,"error: the symbol (%s) cannot be an entry and external at the same time ",symbol);
+        return FALSE;
+    }
+    if(curr->is_entry == TRUE) /*already in the entry list*/
+        return TRUE;
+    curr->is_entry = TRUE;
+    entry_list = (symbol_node**) grow_vector(entry_list, entry_list_length+1, &entry_list_capacity, ENTRY_LIST_INIT, sizeof(symbol_node*), MEM_SYMBOLS);
+    entry_list[entry_list_length++] = curr;
+    return TRUE;
 }
 
 /******************************************************************************
-* Function : update_symbol_table(unsigned ICF);
+* Function : compare_entries(const void *a, const void *b);
 *//**
-* \section Description: at the end of the 1st pass, to maintain continuity in addresses,
-*                       ICF (see pass_one.c) is added to each address of a symbol that has the attribute "data"
-*                       in the symbol table.
-* \param  		ICF - the final value of IC (see pass_one.c)
-*******************************************************************************/
-void update_symbol_table(unsigned long ICF) {
-    symbol_node *curr = symbol_table;
-    while(curr != NULL) {
-        if(curr->attribute == DATA) {
-            curr->address+=ICF;
-        }
-        curr = curr->next;
-    }
+* \section Description: comparison function for qsort. orders entry points by address
+* \return       negative, zero or positive like strcmp
+*******************************************************************************/
+int compare_entries(const void *a, const void *b) {
+    const symbol_node *x = *(symbol_node* const*)a;
+    const symbol_node *y = *(symbol_node* const*)b;
+    if(symbol_address(x) != symbol_address(y))
+        return (symbol_address(x) < symbol_address(y)) ? -1 : 1;
+    return 0;
 }
 
 /******************************************************************************
-* Function : create_ext_node(ext_node *dest,unsigned address, char *label);
+* Function : sort_entry_list();
 *//**
-* \section Description: this function creates an ext_node (ready to add to the external label list)
-*                       with the attributes given. for explanation about each attribute ot the external label, see assembler.h
-* \param  		dest - pointer to the result. must be allocated memory to it before using this function
+* \section Description: this function sorts the entry list by address (see --ent-sorted)
 *******************************************************************************/
-void create_ext_node(ext_node *dest,unsigned address, char *label) {
-    dest->address = address;
-    strcpy(dest->label,label);
-    dest->next = NULL;
+void sort_entry_list() {
+    if(entry_list_length > 1)
+        qsort(entry_list, entry_list_length, sizeof(symbol_node*), compare_entries);
 }
 
 /******************************************************************************
 * Function : add_to_ext_list(unsigned address, char *label);
 *//**
 * \section Description: this function adds the external label represented by the parameters given to the external label list.
-*                       for explanation about each attribute ot the external label, see assembler.h
+*                       for explanation about each attribute ot the external label, see assembler.h.
+*                       the node is appended at the end of the vector (see grow_vector in memory_mgmt.c)
 *******************************************************************************/
 void add_to_ext_list(unsigned address, char *label) {
-    ext_node *node;
-    ext_node *curr = external_list;
-    node = (ext_node*) malloc(sizeof(ext_node));
-    node->label = (char*) malloc(MAX_LABEL+1);
-    alloc_check(node);
-    alloc_check(node->label);
-    create_ext_node(node,address,label);
-    if(external_list == NULL) {
-        external_list = node;
+    external_list = (ext_node*) grow_vector(external_list, ext_list_length+1, &ext_list_capacity, EXT_LIST_INIT, sizeof(ext_node), MEM_EXTERNAL);
+    external_list[ext_list_length].address = address;
+    make_label_key(&external_list[ext_list_length].label, label);
+    ext_list_length++;
+}
+
+/******************************************************************************
+* Function : compare_ext_nodes(const void *a, const void *b);
+*//**
+* \section Description: comparison function for qsort. orders external label nodes by label, then by address
+* \return       negative, zero or positive like strcmp
+*******************************************************************************/
+int compare_ext_nodes(const void *a, const void *b) {
+    const ext_node *x = (const ext_node*)a;
+    const ext_node *y = (const ext_node*)b;
+    int cmp = strcmp(x->label.name, y->label.name);
+    if(cmp != 0)
+        return cmp;
+    if(x->address != y->address)
+        return (x->address < y->address) ? -1 : 1;
+    return 0;
+}
+
+/******************************************************************************
+* Function : group_ext_list();
+*//**
+* \section Description: this function sorts the external label list by label, then by address,
+*                       so that all the uses of each external label are next to each other (see --ext-grouped)
+*******************************************************************************/
+void group_ext_list() {
+    if(ext_list_length > 1)
+        qsort(external_list, ext_list_length, sizeof(ext_node), compare_ext_nodes);
+}
+
+/******************************************************************************
+* Function : add_xref(char *label, unsigned long address, unsigned long line, int kind);
+*//**
+* \section Description: this function adds a use of a symbol to the cross reference list.
+*                       if the label is not in the symbol table (for example, a register operand of jmp), nothing is added
+* \param  		label - the label that was used
+* \param        address - the address of the order that uses the label (0 for .entry)
+* \param        line - the line number in the source file
+* \param        kind - the kind of the reference (see XREF_KINDS in assembler.h)
+*******************************************************************************/
+void add_xref(char *label, unsigned long address, unsigned long line, int kind) {
+    symbol_node *symbol = find_symbol(label);
+    if(symbol == NULL)
         return;
-    }
-    while(curr->next!=NULL)
-        curr = curr->next;
-    /*we are on the last node*/
-    curr->next = node;
+    xref_list = (xref_node*) grow_vector(xref_list, xref_list_length+1, &xref_list_capacity, XREF_LIST_INIT, sizeof(xref_node), MEM_SYMBOLS);
+    xref_list[xref_list_length].symbol = symbol;
+    xref_list[xref_list_length].address = address;
+    xref_list[xref_list_length].line = line;
+    xref_list[xref_list_length].kind = kind;
+    xref_list_length++;
+}
+
+/******************************************************************************
+* Function : compare_xrefs(const void *a, const void *b);
+*//**
+* \section Description: comparison function for qsort. orders cross reference nodes by label, then by line number
+* \return       negative, zero or positive like strcmp
+*******************************************************************************/
+int compare_xrefs(const void *a, const void *b) {
+    const xref_node *x = (const xref_node*)a;
+    const xref_node *y = (const xref_node*)b;
+    int cmp = strcmp(x->symbol->symbol.name, y->symbol->symbol.name);
+    if(cmp != 0)
+        return cmp;
+    if(x->line != y->line)
+        return (x->line < y->line) ? -1 : 1;
+    return 0;
+}
+
+/******************************************************************************
+* Function : sort_xref_list();
+*//**
+* \section Description: this function sorts the cross reference list by label, then by line number,
+*                       so that all the uses of each symbol are next to each other
+*******************************************************************************/
+void sort_xref_list() {
+    if(xref_list_length > 1)
+        qsort(xref_list, xref_list_length, sizeof(xref_node), compare_xrefs);
 }
 
 /*************** END OF FUNCTIONS ***************************************************************************/
@@ -0,0 +1,484 @@
+/*******************************************************************************
+* Title                 :   Batched output files
+* Filename              :   uring_files.c
+* Author                :   Itai Kimelman
+* Version               :   1.5.4
+*******************************************************************************/
+/** \file uring_files.c
+ * \brief This module writes the .ob, .ent and .ext files of a number of source files in batches (--io-uring).
+ * the files of a source file are formatted into memory (see format_output in files.c), and the operations that make
+ * them - open, write and close - are only queued. when the queue is full, or after the last source file, all of them
+ * are handed to the kernel at once through io_uring, and the assembler waits for all of them to complete.
+ * the open, the writes and the close of a file are linked, so they are done in order, and the file is closed
+ * before the batch is over. the kernel keeps the file descriptor of an open file in a slot of its own
+ * ("direct descriptor"), so the write can use it without waiting for the open to return to the assembler.
+ * an error in a file is reported when its batch completes, so it may come after the output of later source files.
+ * direct descriptors need linux 5.15: on older kernels, the open ignores the slot and returns a real descriptor.
+ * so when the ring is set up, a file (/dev/null) is opened into a slot once, and the ring is used only if that works.
+ * if io_uring cannot be used (an old kernel, or a system that is not linux), every file is written right away
+ * with open, pwritev and close instead. the same is done for the files of a batch whose open was not done into
+ * its slot after all (see ring_flush), and the ring is not used after that.
+ * there is no liburing here: the ring is set up with the system calls themselves.
+ */
+/*the system calls used here are not ANSI C*/
+#define _POSIX_C_SOURCE 200112L
+#define _DEFAULT_SOURCE
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "assembler.h"
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif
+
+/******************************************************************************
+* Module Preprocessor Constants
+*******************************************************************************/
+#define URING_ENTRIES   128 /*number of operations in the submission queue*/
+#define URING_FILES     32 /*number of files in a batch (each one takes a slot for its direct descriptor)*/
+#define URING_WRITE_MAX 1048576 /*the most bytes in one write operation (bigger files are written in parts)*/
+#define URING_OPS       256 /*the operation codes are below this (user_data is file*URING_OPS+opcode)*/
+#define OUTPUT_ARENA_CHUNK  65536
+#define PROBE_FILE      "/dev/null" /*the file opened into a slot to see if the kernel has direct descriptors*/
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+/*the ring is shared with the kernel, so its head and tail are read and written with acquire and release ordering*/
+#define load_acquire(P)     __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define store_release(P,X)  __atomic_store_n((P), (X), __ATOMIC_RELEASE)
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+extern asm_options options;
+/*the contents and names of the files in the current batch. reset when the batch completes*/
+static arena output_arena = {NULL, NULL, NULL, OUTPUT_ARENA_CHUNK, MEM_BUFFERS};
+static int output_failures = 0; /*number of files in completed batches that could not be written (see finish_output_files)*/
+
+#ifdef __linux__
+/*a file in the current batch*/
+typedef struct batch_file {
+    char *name;
+    char *contents;
+    unsigned long size;
+    int failed; /*TRUE after its first failed operation (the rest of its operations are canceled)*/
+    int retry; /*TRUE if it was not opened into its slot, so it is written with pwritev after the batch*/
+}batch_file;
+
+static int ring_fd = -1; /*the io_uring. -1 if it is not set up yet, -2 if it cannot be used*/
+static unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+static unsigned *cq_head, *cq_tail, *cq_mask;
+static struct io_uring_sqe *sqes;
+static struct io_uring_cqe *cqes;
+static void *sq_ring, *cq_ring;
+static size_t sq_ring_size, cq_ring_size, sqes_size;
+static batch_file batch[URING_FILES];
+static int batch_length = 0;
+static unsigned queued = 0; /*number of operations queued and not submitted yet*/
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/******************************************************************************
+* Function : ring_teardown();
+*//**
+* \section Description: gives the io_uring back to the system. the files after it are written with pwritev
+*******************************************************************************/
+void ring_teardown() {
+    munmap(sqes, sqes_size);
+    munmap(sq_ring, sq_ring_size);
+    close(ring_fd);
+    ring_fd = -2;
+}
+
+/******************************************************************************
+* Function : next_sqe(int file, int opcode, int link);
+*//**
+* \section Description: takes the next entry of the submission queue for an operation on a file of the batch
+*
+* \param  		file - the index of the file in the batch (and of the slot of its direct descriptor)
+* \param        opcode - the operation
+* \param        link - TRUE if the next operation on the file must wait for this one
+* \return       the entry, cleared
+*******************************************************************************/
+struct io_uring_sqe *next_sqe(int file, int opcode, int link) {
+    unsigned tail = *sq_tail, index = tail & *sq_mask;
+    struct io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (unsigned char)opcode;
+    sqe->user_data = (unsigned long)(file * URING_OPS + opcode); /*where the completion comes from*/
+    sqe->flags = link ? IOSQE_IO_LINK : 0;
+    sq_array[index] = index;
+    store_release(sq_tail, tail+1);
+    queued++;
+    return sqe;
+}
+
+/******************************************************************************
+* Function : ring_wait_one();
+*//**
+* \section Description: submits the operations queued, and waits for one of them to complete
+*
+* \return       the result of the operation. -EIO if the io_uring failed
+*******************************************************************************/
+int ring_wait_one() {
+    unsigned head;
+    long ret;
+    int res;
+    while(TRUE) {
+        ret = syscall(__NR_io_uring_enter, ring_fd, queued, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+        if(ret < 0 && errno != EINTR)
+            return -EIO;
+        if(ret > 0)
+            queued -= (unsigned)ret;
+        head = *cq_head;
+        if(head != load_acquire(cq_tail)) {
+            res = cqes[head & *cq_mask].res;
+            store_release(cq_head, head+1);
+            return res;
+        }
+    }
+}
+
+/******************************************************************************
+* Function : ring_probe();
+*//**
+* \section Description: checks that the kernel opens files into the slots of direct descriptors (linux 5.15).
+*                       an older kernel ignores the slot, and returns a real file descriptor (or an error)
+*
+* \return       STATUS_OK if it does. otherwise: STATUS_ERR
+*******************************************************************************/
+int ring_probe() {
+    static char probe_file[] = PROBE_FILE;
+    struct io_uring_sqe *sqe;
+    int res;
+    sqe = next_sqe(0, IORING_OP_OPENAT, FALSE);
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (unsigned long)probe_file;
+    sqe->open_flags = O_RDONLY;
+    sqe->file_index = 1;
+    if((res = ring_wait_one()) != 0) {
+        if(res > 0)
+            close(res);
+        queued = 0;
+        return STATUS_ERR;
+    }
+    sqe = next_sqe(0, IORING_OP_CLOSE, FALSE);
+    sqe->file_index = 1;
+    if(ring_wait_one() != 0) {
+        queued = 0;
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : ring_setup();
+*//**
+* \section Description: sets up the io_uring: the submission and completion queues are mapped to memory,
+*                       and a table of URING_FILES empty slots is registered for the direct descriptors
+*
+* \return       STATUS_OK if the io_uring can be used. otherwise: STATUS_ERR
+*******************************************************************************/
+int ring_setup() {
+    struct io_uring_params params;
+    int files[URING_FILES], fd, i;
+    memset(&params, 0, sizeof(params));
+    ring_fd = -2;
+    if((fd = (int)syscall(__NR_io_uring_setup, URING_ENTRIES, &params)) < 0)
+        return STATUS_ERR;
+    /*kernels without IORING_FEAT_SINGLE_MMAP are too old for direct descriptors anyway*/
+    if(!(params.features & IORING_FEAT_SINGLE_MMAP) || params.cq_entries < URING_ENTRIES) {
+        close(fd);
+        return STATUS_ERR;
+    }
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(cq_ring_size > sq_ring_size)
+        sq_ring_size = cq_ring_size;
+    sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    /*both queues are in one mapping*/
+    sq_ring = mmap(NULL, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQ_RING);
+    if(sq_ring == MAP_FAILED) {
+        close(fd);
+        return STATUS_ERR;
+    }
+    cq_ring = sq_ring;
+    sqes = (struct io_uring_sqe*) mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQES);
+    if(sqes == MAP_FAILED) {
+        munmap(sq_ring, sq_ring_size);
+        close(fd);
+        return STATUS_ERR;
+    }
+    /*empty slots (-1) for the direct descriptors*/
+    for(i = 0; i < URING_FILES; i++)
+        files[i] = -1;
+    if(syscall(__NR_io_uring_register, fd, IORING_REGISTER_FILES, files, URING_FILES) < 0) {
+        munmap(sqes, sqes_size);
+        munmap(sq_ring, sq_ring_size);
+        close(fd);
+        return STATUS_ERR;
+    }
+    ring_fd = fd;
+    sq_head = (unsigned*)((char*)sq_ring + params.sq_off.head);
+    sq_tail = (unsigned*)((char*)sq_ring + params.sq_off.tail);
+    sq_mask = (unsigned*)((char*)sq_ring + params.sq_off.ring_mask);
+    sq_array = (unsigned*)((char*)sq_ring + params.sq_off.array);
+    cq_head = (unsigned*)((char*)cq_ring + params.cq_off.head);
+    cq_tail = (unsigned*)((char*)cq_ring + params.cq_off.tail);
+    cq_mask = (unsigned*)((char*)cq_ring + params.cq_off.ring_mask);
+    cqes = (struct io_uring_cqe*)((char*)cq_ring + params.cq_off.cqes);
+    if(ring_probe() == STATUS_ERR) {
+        ring_teardown();
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : write_file_now(char *name, char *contents, unsigned long size);
+*//**
+* \section Description: writes a file right away with open, pwritev and close (when io_uring cannot be used)
+*
+* \param  		name - the name of the file
+* \param        contents - the contents of the file
+* \param        size - the length of the contents
+* \return       STATUS_OK if the file was written. otherwise: STATUS_ERR (an error is printed)
+*******************************************************************************/
+int write_file_now(char *name, char *contents, unsigned long size) {
+    struct iovec iov;
+    ssize_t written = 0;
+    int fd;
+    if((fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+        fprintf(stderr, "error: cannot make output file [%s]", name);
+        return STATUS_ERR;
+    }
+    iov.iov_base = contents;
+    iov.iov_len = size;
+    while(iov.iov_len > 0 && (written = pwritev(fd, &iov, 1, (off_t)(size - iov.iov_len))) > 0) {
+        iov.iov_base = (char*)iov.iov_base + written;
+        iov.iov_len -= written;
+    }
+    if(close(fd) != 0 || iov.iov_len > 0) {
+        fprintf(stderr, "error: cannot write output file [%s]", name);
+        return STATUS_ERR;
+    }
+    return STATUS_OK;
+}
+
+/******************************************************************************
+* Function : ring_flush();
+*//**
+* \section Description: submits every operation queued, and waits until all of them are completed.
+*                       then the files of the batch are closed, and its memory can be used again.
+*                       a file that was not opened into its slot (see \brief) is written with pwritev now
+*
+* \return       number of files in the batch that could not be written
+*******************************************************************************/
+int ring_flush() {
+    unsigned head, completed = 0, submitted = queued;
+    struct io_uring_cqe *cqe;
+    batch_file *file;
+    int i, failed = 0, retried = FALSE;
+    long ret;
+    while(completed < submitted) {
+        ret = syscall(__NR_io_uring_enter, ring_fd, queued, submitted-completed, IORING_ENTER_GETEVENTS, NULL, 0);
+        if(ret < 0 && errno != EINTR)
+            break;
+        if(ret > 0)
+            queued -= (unsigned)ret;
+        for(head = *cq_head; head != load_acquire(cq_tail); head++, completed++) {
+            cqe = &cqes[head & *cq_mask];
+            file = &batch[cqe->user_data / URING_OPS];
+            /*an open that returned a real descriptor, or did not take the slot: the kernel has no direct descriptors*/
+            if(cqe->user_data % URING_OPS == IORING_OP_OPENAT
+               && (cqe->res > 0 || cqe->res == -EINVAL || cqe->res == -EBADF)) {
+                if(cqe->res > 0)
+                    close(cqe->res);
+                file->retry = TRUE;
+            }
+            /*the operations after one that failed (or wrote less than it was given) are canceled*/
+            if(cqe->res < 0 && !file->failed && !file->retry) {
+                if(cqe->user_data % URING_OPS == IORING_OP_OPENAT)
+                    fprintf(stderr, "error: cannot make output file [%s]", file->name);
+                else fprintf(stderr, "error: cannot write output file [%s]", file->name);
+                file->failed = TRUE;
+            }
+        }
+        store_release(cq_head, head);
+    }
+    if(completed < submitted) {
+        /*the kernel may still be using the memory of the batch: it is left to it (never freed), and the ring is
+         *not used anymore*/
+        fprintf(stderr, "error: cannot write output files (io_uring failed)");
+        failed = batch_length;
+        batch_length = 0;
+        queued = 0;
+        memset(&output_arena, 0, sizeof(arena));
+        output_arena.chunk_size = OUTPUT_ARENA_CHUNK;
+        output_arena.subsystem = MEM_BUFFERS;
+        ring_teardown();
+        return failed;
+    }
+    for(i = 0; i < batch_length; i++) {
+        if(batch[i].retry) {
+            retried = TRUE;
+            batch[i].failed = (write_file_now(batch[i].name, batch[i].contents, batch[i].size) == STATUS_ERR);
+        }
+        failed += batch[i].failed;
+    }
+    batch_length = 0;
+    arena_reset(&output_arena);
+    if(retried)
+        ring_teardown();
+    return failed;
+}
+
+/******************************************************************************
+* Function : queue_file(char *name, char *contents, unsigned long size);
+*//**
+* \section Description: queues the operations that make one file: open it into the slot of the file in the batch,
+*                       write the contents (in parts of at most URING_WRITE_MAX bytes), and close it
+*
+* \param  		name - the name of the file (must be kept until the batch completes)
+* \param        contents - the contents of the file (must be kept until the batch completes)
+* \param        size - the length of the contents
+*******************************************************************************/
+void queue_file(char *name, char *contents, unsigned long size) {
+    struct io_uring_sqe *sqe;
+    unsigned long offset, part;
+    int file = batch_length++;
+    batch[file].name = name;
+    batch[file].contents = contents;
+    batch[file].size = size;
+    batch[file].failed = FALSE;
+    batch[file].retry = FALSE;
+    sqe = next_sqe(file, IORING_OP_OPENAT, TRUE);
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (unsigned long)name;
+    sqe->len = 0666;
+    sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC;
+    sqe->file_index = file+1; /*the slot of the direct descriptor (counted from 1)*/
+    for(offset = 0; offset < size; offset += part) {
+        part = (size - offset > URING_WRITE_MAX) ? URING_WRITE_MAX : size - offset;
+        sqe = next_sqe(file, IORING_OP_WRITE, TRUE);
+        sqe->flags |= IOSQE_FIXED_FILE;
+        sqe->fd = file;
+        sqe->addr = (unsigned long)(contents + offset);
+        sqe->len = (unsigned)part;
+        sqe->off = offset;
+    }
+    sqe = next_sqe(file, IORING_OP_CLOSE, FALSE);
+    sqe->file_index = file+1;
+}
+
+/******************************************************************************
+* Function : queue_output_files(char *file_name);
+*//**
+* \section Description: formats the .ob, .ent and .ext files of a source file, and queues them in the batch (see \brief).
+*                       if the batch has no room for them (or has a file with the same name), it is completed first
+*
+* \param  		file_name - the name of the source file
+* \return       STATUS_OK if no error was found so far. otherwise: STATUS_ERR (errors in a batch are found
+*               when it completes, and counted by finish_output_files)
+*******************************************************************************/
+int queue_output_files(char *file_name) {
+    output_section sections[OUTPUT_FILES];
+    char *names[OUTPUT_FILES];
+    int i, j, n, err = STATUS_OK;
+    unsigned needed;
+    boolean flush;
+    if(ring_fd == -1)
+        ring_setup(); /*if it cannot be set up, the files are written with pwritev*/
+    do {
+        if((n = format_output(file_name, &output_arena, sections)) == 0) {
+            if(batch_length == 0)
+                arena_reset(&output_arena);
+            return STATUS_ERR;
+        }
+        needed = 0;
+        for(i = 0; i < n; i++) {
+            names[i] = output_file_name(file_name, sections[i].kind, &output_arena); /*named like in output (files.c)*/
+            needed += 2 + (unsigned)((sections[i].size + URING_WRITE_MAX-1) / URING_WRITE_MAX); /*open, writes and close*/
+        }
+        /*making room in the batch. a file must not be written twice in one batch, and a file too big for
+         *the submission queue is written on its own. completing the batch gives its memory back, with the files
+         *just formatted in it, so they are formatted again after it*/
+        flush = FALSE;
+        if(ring_fd >= 0 && batch_length > 0) {
+            for(i = 0; i < batch_length && !flush; i++) {
+                for(j = 0; j < n && !flush; j++)
+                    flush = (strcmp(batch[i].name, names[j]) == 0);
+            }
+            if(flush || batch_length + n > URING_FILES || queued + needed > URING_ENTRIES) {
+                flush = TRUE;
+                output_failures += ring_flush();
+            }
+        }
+    } while(flush);
+    for(i = 0; i < n; i++) {
+        if(ring_fd >= 0 && needed <= URING_ENTRIES)
+            queue_file(names[i], sections[i].contents, sections[i].size);
+        else if(write_file_now(names[i], sections[i].contents, sections[i].size) == STATUS_ERR)
+            err = STATUS_ERR;
+    }
+    if(batch_length == 0)
+        arena_reset(&output_arena); /*nothing is waiting for this memory*/
+    return err;
+}
+
+/******************************************************************************
+* Function : finish_output_files();
+*//**
+* \section Description: completes the last batch, and gives the io_uring back to the system.
+*                       used after the last source file
+*
+* \return       number of files that could not be written in the batches (each one was reported)
+*******************************************************************************/
+int finish_output_files() {
+    int failed;
+    if(ring_fd >= 0) {
+        if(batch_length > 0)
+            output_failures += ring_flush(); /*if the ring failed, it is already given back, and so is its memory*/
+        if(ring_fd >= 0)
+            ring_teardown();
+    }
+    ring_fd = -1;
+    arena_free(&output_arena);
+    failed = output_failures;
+    output_failures = 0;
+    return failed;
+}
+#else
+/******************************************************************************
+* Function : queue_output_files(char *file_name);
+*//**
+* \section Description: without io_uring, the files are written with stdio (see output in files.c)
+*
+* \return       STATUS_FALLBACK
+*******************************************************************************/
+int queue_output_files(char *file_name) {
+    return STATUS_FALLBACK;
+}
+
+/******************************************************************************
+* Function : finish_output_files();
+*//**
+* \return       0 (nothing is left to write)
+*******************************************************************************/
+int finish_output_files() {
+    return 0;
+}
+#endif
+
+/*************** END OF FUNCTIONS ***************************************************************************/